@@ -0,0 +1,114 @@
+#!/usr/bin/env python
+"""
+ Copyright (C) 2018-2019 Intel Corporation
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+      http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+"""
+from __future__ import print_function
+import sys
+import os
+import threading
+from argparse import ArgumentParser, SUPPRESS
+import numpy as np
+import logging as log
+from time import time
+from openvino.inference_engine import IENetwork, IECore
+
+
+def build_argparser():
+    parser = ArgumentParser(add_help=False)
+    args = parser.add_argument_group('Options')
+    args.add_argument('-h', '--help', action='help', default=SUPPRESS, help='Show this help message and exit.')
+    args.add_argument("-m", "--model", help="Required. Path to an .xml file with a trained model.", required=True,
+                      type=str)
+    args.add_argument("-l", "--cpu_extension",
+                      help="Optional. Required for CPU custom layers. "
+                           "MKLDNN (CPU)-targeted custom layers. Absolute path to a shared library with the"
+                           " kernels implementations.", type=str, default=None)
+    args.add_argument("-d", "--device",
+                      help="Optional. Specify the target device to infer on; CPU, GPU, FPGA, HDDL, MYRIAD or HETERO: is "
+                           "acceptable. Default value is CPU", default="CPU", type=str)
+    args.add_argument("-nthreads", "--number_threads", help="Optional. Number of Python threads, each of them runs "
+                      "synchronous inference of its own infer request. Default value is 4", default=4, type=int)
+    args.add_argument("-niter", "--number_iter", help="Optional. Number of inference iterations per thread. "
+                      "Default value is 100", default=100, type=int)
+    args.add_argument("--copy_inputs", help="Optional. Pass inputs as non-contiguous arrays, so that they are copied "
+                      "to the blobs of the requests instead of being bound to them", action='store_true')
+    return parser
+
+
+def worker(request, inputs, niter, latencies):
+    for _ in range(niter):
+        request.infer(inputs)
+        # the views are valid until the next inference of the request, no copy is needed to consume them
+        _ = request.output_views
+        latencies.append(request.latency)
+
+
+def main():
+    log.basicConfig(format="[ %(levelname)s ] %(message)s", level=log.INFO, stream=sys.stdout)
+    args = build_argparser().parse_args()
+    model_xml = args.model
+    model_bin = os.path.splitext(model_xml)[0] + ".bin"
+
+    log.info("Creating Inference Engine")
+    ie = IECore()
+    if args.cpu_extension and 'CPU' in args.device:
+        ie.add_extension(args.cpu_extension, "CPU")
+    log.info("Loading network files:\n\t{}\n\t{}".format(model_xml, model_bin))
+    net = IENetwork(model=model_xml, weights=model_bin)
+
+    config = {}
+    if args.device == "CPU":
+        # one stream per thread, so the requests don't wait for each other in the plugin
+        config["CPU_THROUGHPUT_STREAMS"] = str(args.number_threads)
+
+    log.info("Loading model to the plugin")
+    exec_net = ie.load_network(network=net, device_name=args.device, config=config,
+                               num_requests=args.number_threads)
+
+    log.info("Preparing input data")
+    dtypes = {"FP32": np.float32, "FP16": np.float16, "U8": np.uint8, "I8": np.int8, "I16": np.int16,
+              "U16": np.uint16, "I32": np.int32}
+    thread_inputs = []
+    for _ in range(args.number_threads):
+        inputs = {}
+        for name, info in net.inputs.items():
+            data = np.random.uniform(0, 255, info.shape).astype(dtypes.get(info.precision, np.float32))
+            if args.copy_inputs:
+                # a strided view can't be bound to the request and is copied on every inference
+                data = np.repeat(data, 2, axis=-1)[..., ::2]
+            inputs[name] = data
+        thread_inputs.append(inputs)
+
+    log.info("Starting inference in {} threads, {} iterations each".format(args.number_threads, args.number_iter))
+    latencies = [[] for _ in range(args.number_threads)]
+    threads = [threading.Thread(target=worker, args=(exec_net.requests[i], thread_inputs[i], args.number_iter,
+                                                     latencies[i]))
+               for i in range(args.number_threads)]
+    start_time = time()
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    total_time = time() - start_time
+
+    all_latencies = sorted(l for thread_latencies in latencies for l in thread_latencies)
+    log.info("Count:      {} iterations".format(len(all_latencies)))
+    log.info("Duration:   {:.2f} ms".format(total_time * 1000))
+    log.info("Latency:    {:.2f} ms (median)".format(all_latencies[len(all_latencies) // 2]))
+    log.info("Throughput: {:.2f} FPS".format(len(all_latencies) * net.batch_size / total_time))
+
+
+if __name__ == '__main__':
+    sys.exit(main() or 0)
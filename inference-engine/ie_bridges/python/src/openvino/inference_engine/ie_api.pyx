@@ -239,7 +239,7 @@ cdef class ExecutableNetwork:
     def infer(self, inputs=None):
         current_request = self.requests[0]
         current_request.infer(inputs)
-        return deepcopy(current_request.outputs)
+        return current_request.outputs
 
     def start_async(self, request_id, inputs=None):
         if request_id not in list(range(len(self.requests))):
@@ -282,6 +282,7 @@ cdef class InferRequest:
     def __init__(self):
         self._inputs_list = []
         self._outputs_list = []
+        self._bound_inputs = {}
         self._py_callback = lambda *args, **kwargs: None
         self._py_callback_used = False
         self._py_callback_called = threading.Event()
@@ -309,24 +310,29 @@ cdef class InferRequest:
         if inputs is not None:
             self._fill_inputs(inputs)
 
-        deref(self.impl).infer()
+        with nogil:
+            deref(self.impl).infer()
 
     cpdef async_infer(self, inputs=None):
         if inputs is not None:
             self._fill_inputs(inputs)
         self._py_callback_called.clear()
-        deref(self.impl).infer_async()
+        with nogil:
+            deref(self.impl).infer_async()
 
     cpdef wait(self, timeout=None):
+        cdef int64_t c_timeout
+        cdef int status
         if self._py_callback_used:
             while not self._py_callback_called.is_set():
                 if not self._py_callback_called.wait(timeout):
                     return StatusCode.REQUEST_BUSY
             return StatusCode.OK
         else:
-            if timeout is None:
-                timeout = -1
-            return deref(self.impl).wait(<int64_t> timeout)
+            c_timeout = -1 if timeout is None else timeout
+            with nogil:
+                status = deref(self.impl).wait(c_timeout)
+            return status
 
     cpdef get_perf_counts(self):
         cdef map[string, C.ProfileInfo] c_profile = deref(self.impl).getPerformanceCounts()
@@ -353,6 +359,14 @@ cdef class InferRequest:
             outputs[output] = self._get_blob_buffer(output.encode()).to_numpy()
         return deepcopy(outputs)
 
+    @property
+    def output_views(self):
+        """Output blobs as numpy arrays sharing memory with the request, valid until the next inference"""
+        outputs = {}
+        for output in self._outputs_list:
+            outputs[output] = self._get_blob_buffer(output.encode()).to_numpy()
+        return outputs
+
     @property
     def latency(self):
         return self.impl.exec_time
@@ -365,7 +379,28 @@ cdef class InferRequest:
     def _fill_inputs(self, inputs):
         for k, v in inputs.items():
             assert k in self._inputs_list, "No input with name {} found in network".format(k)
-            self.inputs[k][:] = v
+            if self._bind_input(k, v):
+                continue
+            if k in self._bound_inputs:
+                deref(self.impl).resetBlob(k.encode())
+                del self._bound_inputs[k]
+            self._get_blob_buffer(k.encode()).to_numpy()[:] = v
+
+    def _bind_input(self, name, array):
+        # Dense arrays of the blob's type and shape are passed to the plugin as is, without a copy.
+        # The request keeps a reference to the array while it is bound.
+        if not isinstance(array, np.ndarray):
+            return False
+        flags = array.flags
+        if not (flags.c_contiguous and flags.aligned and flags.writeable):
+            return False
+        blob = self._get_blob_buffer(name.encode()).to_numpy()
+        if array.dtype != blob.dtype or array.shape != blob.shape:
+            return False
+        if not deref(self.impl).setBlobFromBuffer(name.encode(), <void *> <size_t> array.ctypes.data, array.nbytes):
+            return False
+        self._bound_inputs[name] = array
+        return True
 
 
 class LayerStats:
@@ -491,6 +491,44 @@ void InferenceEnginePython::InferRequestWrap::getBlobPtr(const std::string &blob
     IE_CHECK_CALL(request_ptr->GetBlob(blob_name.c_str(), blob_ptr, &response));
 }
 
+bool InferenceEnginePython::InferRequestWrap::setBlobFromBuffer(const std::string &blob_name, void *data, size_t size) {
+    InferenceEngine::ResponseDesc response;
+    InferenceEngine::Blob::Ptr blob_ptr;
+    IE_CHECK_CALL(request_ptr->GetBlob(blob_name.c_str(), blob_ptr, &response));
+
+    // user memory is always dense row major, so it can replace only a blob with the same plain layout
+    const auto &desc = blob_ptr->getTensorDesc();
+    const auto &blk = desc.getBlockingDesc();
+    if (blk.getOffsetPadding() != 0 || blk.getOrder().size() != desc.getDims().size() ||
+        blob_ptr->byteSize() != size) {
+        return false;
+    }
+    for (size_t i = 0; i < blk.getOrder().size(); i++) {
+        if (blk.getOrder()[i] != i) {
+            return false;
+        }
+    }
+    if (blob_ptr->buffer().as<void *>() == data) {
+        return true;
+    }
+
+    if (own_blobs.find(blob_name) == own_blobs.end()) {
+        own_blobs[blob_name] = blob_ptr;
+    }
+    auto user_blob = make_blob_with_precision(desc, data);
+    IE_CHECK_CALL(request_ptr->SetBlob(blob_name.c_str(), user_blob, &response));
+    return true;
+}
+
+void InferenceEnginePython::InferRequestWrap::resetBlob(const std::string &blob_name) {
+    auto own = own_blobs.find(blob_name);
+    if (own == own_blobs.end()) {
+        return;
+    }
+    InferenceEngine::ResponseDesc response;
+    IE_CHECK_CALL(request_ptr->SetBlob(blob_name.c_str(), own->second, &response));
+    own_blobs.erase(own);
+}
 
 void InferenceEnginePython::InferRequestWrap::setBatch(int size) {
     InferenceEngine::ResponseDesc response;
@@ -20,6 +20,7 @@
 #include <ie_extension.h>
 #include "inference_engine.hpp"
 #include "../../../../../src/inference_engine/ie_ir_reader.hpp"
+#include "../../../../../src/inference_engine/blob_factory.hpp"
 
 
 typedef std::chrono::high_resolution_clock Time;
@@ -119,6 +120,8 @@ struct InferRequestWrap {
     cy_callback user_callback;
     void *user_data;
     int status;
+    // blobs allocated by the request itself for the blobs replaced with user memory
+    std::map<std::string, InferenceEngine::Blob::Ptr> own_blobs;
 
     void infer();
 
@@ -130,6 +133,10 @@ struct InferRequestWrap {
 
     void getBlobPtr(const std::string &blob_name, InferenceEngine::Blob::Ptr &blob_ptr);
 
+    bool setBlobFromBuffer(const std::string &blob_name, void *data, size_t size);
+
+    void resetBlob(const std::string &blob_name);
+
     void setBatch(int size);
 
     std::map<std::string, InferenceEnginePython::ProfileInfo> getPerformanceCounts();
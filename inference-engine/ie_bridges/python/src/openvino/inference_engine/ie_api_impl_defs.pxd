@@ -116,9 +116,11 @@ cdef extern from "ie_api_impl.hpp" namespace "InferenceEnginePython":
         double exec_time;
         void getBlobPtr(const string & blob_name, Blob.Ptr & blob_ptr) except +
         map[string, ProfileInfo] getPerformanceCounts() except +
-        void infer() except +
-        void infer_async() except +
-        int wait(int64_t timeout) except +
+        bool setBlobFromBuffer(const string & blob_name, void * data, size_t size) except +
+        void resetBlob(const string & blob_name) except +
+        void infer() nogil except +
+        void infer_async() nogil except +
+        int wait(int64_t timeout) nogil except +
         void setBatch(int size) except +
         void setCyCallback(void (*)(void*, int), void *) except +
 
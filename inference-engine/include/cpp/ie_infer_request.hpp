@@ -11,8 +11,10 @@
 #include <memory>
 #include <string>
 #include <map>
+#include <vector>
 #include "ie_iinfer_request.hpp"
 #include "details/ie_exception_conversion.hpp"
+#include "cpp/ie_memory_state.hpp"
 #include "ie_plugin_ptr.hpp"
 
 namespace InferenceEngine {
@@ -149,6 +151,27 @@ public:
         CALL_STATUS_FNC(SetBatch, batch);
     }
 
+    /**
+     * @brief see original function InferenceEngine::IInferRequest::QueryState
+     */
+    std::vector<MemoryState> QueryState() {
+        IMemoryState::Ptr pState = nullptr;
+        auto res = OK;
+        std::vector<MemoryState> controller;
+        for (size_t idx = 0; res == OK; ++idx) {
+            ResponseDesc resp;
+            res = actual->QueryState(pState, idx, &resp);
+            if (res != OK && res != OUT_OF_BOUNDS) {
+                THROW_IE_EXCEPTION << resp.msg;
+            }
+            if (res != OUT_OF_BOUNDS) {
+                controller.push_back(MemoryState(pState));
+            }
+        }
+
+        return controller;
+    }
+
     /**
      * constructs InferRequest from initialised shared_pointer
      * @param actual
@@ -45,7 +45,9 @@ DECLARE_GNA_CONFIG_KEY(PRECISION);
 DECLARE_GNA_CONFIG_KEY(FIRMWARE_MODEL_IMAGE);
 
 /**
-* @brief GNA proc_type setting that should be one of GNA_AUTO, GNA_HW, GNA_SW, GNA_SW_EXACT
+* @brief GNA proc_type setting that should be one of GNA_AUTO, GNA_HW, GNA_SW, GNA_SW_EXACT,
+* GNA_SW_FP32 runs the network in fp32 without quantization,
+* GNA_SW_HOST runs the quantized network by the plugin's integer emulation of GNA without the GNA library
 */
 DECLARE_GNA_CONFIG_KEY(DEVICE_MODE);
 
@@ -54,6 +56,7 @@ DECLARE_GNA_CONFIG_VALUE(HW);
 DECLARE_GNA_CONFIG_VALUE(SW);
 DECLARE_GNA_CONFIG_VALUE(SW_EXACT);
 DECLARE_GNA_CONFIG_VALUE(SW_FP32);
+DECLARE_GNA_CONFIG_VALUE(SW_HOST);
 
 /**
 * @brief if enabled produced minimum memory footprint for loaded network in GNA memory, default value is YES
@@ -11,6 +11,7 @@
 
 #include "ie_common.h"
 #include <ie_blob.h>
+#include <ie_imemory_state.hpp>
 #include <memory>
 #include <string>
 #include <map>
@@ -132,6 +133,17 @@ public:
     * @return Enumeration of the resulted action: OK (0) for success
     */
     virtual InferenceEngine::StatusCode SetBatch(int batch_size, ResponseDesc *resp) noexcept = 0;
+
+    /**
+    * @brief Gets state control interface for given network of this request, multiple states can exist
+    * @note The state belongs to the request: requests created from the same executable network read and update
+    * their own states, so every request can serve a separate session of a network with memory layers
+    * @param pState reference to a pointer that receives internal states
+    * @param idx requested index for receiving memory state
+    * @param resp Optional: pointer to an already allocated object to contain information in case of failure
+    * @return Status code of the operation: OK (0) for success, OUT_OF_BOUNDS (-6) no memory state for given index
+    */
+    virtual StatusCode QueryState(IMemoryState::Ptr &pState, size_t idx, ResponseDesc *resp) noexcept = 0;
 };
 
 }  // namespace InferenceEngine
@@ -11,6 +11,8 @@
  */
 #pragma once
 
+#include <cstdint>
+#include <map>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -79,6 +81,7 @@ DECLARE_METRIC_KEY(FULL_DEVICE_NAME, std::string);
 *  - "FP16" - device can support FP16 models
 *  - "INT8" - device can support models with INT8 layers
 *  - "BIN" - device can support models with BIN layers
+*  - "BF16" - device can run FP32 models in bfloat16 precision (see KEY_ENFORCE_BF16)
 *  - "WINOGRAD" - device can support models where convolution implemented via Winograd transformations
 */
 DECLARE_METRIC_KEY(OPTIMIZATION_CAPABILITIES, std::vector<std::string>);
@@ -87,6 +90,7 @@ DECLARE_METRIC_VALUE(FP32);
 DECLARE_METRIC_VALUE(FP16);
 DECLARE_METRIC_VALUE(INT8);
 DECLARE_METRIC_VALUE(BIN);
+DECLARE_METRIC_VALUE(BF16);
 DECLARE_METRIC_VALUE(WINOGRAD);
 
 /**
@@ -136,6 +140,64 @@ DECLARE_METRIC_KEY(DEVICE_THERMAL, float);
 */
 DECLARE_EXEC_NETWORK_METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS, unsigned int);
 
+/**
+* @brief Metric to get a size in bytes of the memory allocated for the intermediate (non-constant) data
+* of a single stream of the CPU executable network. String value is "CPU_STREAM_MEMORY_SIZE"
+*/
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_STREAM_MEMORY_SIZE, uint64_t);
+
+/**
+* @brief Metric to get a total size in bytes of the read-only constant memory that is shared by all streams
+* of the CPU executable network (one copy per socket). String value is "CPU_SHARED_CONSTANTS_MEMORY_SIZE"
+*/
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_SHARED_CONSTANTS_MEMORY_SIZE, uint64_t);
+
+/**
+* @brief Metric to get a number of reorders the CPU executable network runs on every inference to convert
+* the data between the layers which selected different layouts or precisions. String value is "CPU_REORDERS_COUNT"
+*/
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_REORDERS_COUNT, uint64_t);
+
+/**
+* @brief Metric to get a histogram of the time requests waited for their batch to start when CPU batching is enabled
+* (see CONFIG_KEY(CPU_BATCHING_MAX_BATCH)). The element i is a number of requests waited less than 2^i microseconds
+* (and not less than 2^(i-1)), the last element counts the rest. String value is "CPU_BATCHING_WAIT_HISTOGRAM"
+*/
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_BATCHING_WAIT_HISTOGRAM, std::vector<uint64_t>);
+
+/**
+* @brief Metric to get a histogram of batches executed when CPU batching is enabled. The element i is a number
+* of inferences which coalesced i requests. String value is "CPU_BATCHING_BATCH_HISTOGRAM"
+*/
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_BATCHING_BATCH_HISTOGRAM, std::vector<uint64_t>);
+
+/**
+* @brief Metric to get the latest executions of the layers of all streams in the Chrome trace event format
+* (chrome://tracing, Perfetto UI) when CONFIG_KEY(CPU_PERF_TRACE) is enabled. String value is "CPU_PERF_TRACE"
+*/
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_PERF_TRACE, std::string);
+
+/**
+* @brief Metric to get the 50th, 90th and 99th percentiles of the execution time of every layer in nanoseconds
+* over the latest executions of all streams when CONFIG_KEY(CPU_PERF_TRACE) is enabled.
+* String value is "CPU_PERF_TRACE_PERCENTILES"
+*/
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_PERF_TRACE_PERCENTILES, std::map<std::string, std::vector<uint64_t>>);
+
+/**
+* @brief Metric to get a number of Core::LoadNetwork calls for the device which were served by importing
+* a network from the compiled networks cache (see CONFIG_KEY(CACHE_DIR)). String value is "CACHE_HITS".
+* The metric is provided by InferenceEngine::Core, not by the device plugin.
+*/
+DECLARE_METRIC_KEY(CACHE_HITS, uint64_t);
+
+/**
+* @brief Metric to get a number of Core::LoadNetwork calls for the device which compiled a network
+* because it was not found in the compiled networks cache. String value is "CACHE_MISSES".
+* The metric is provided by InferenceEngine::Core, not by the device plugin.
+*/
+DECLARE_METRIC_KEY(CACHE_MISSES, uint64_t);
+
 }  // namespace Metrics
 
 namespace PluginConfigParams {
@@ -186,6 +248,45 @@ DECLARE_CONFIG_VALUE(CPU_THROUGHPUT_NUMA);
 DECLARE_CONFIG_VALUE(CPU_THROUGHPUT_AUTO);
 DECLARE_CONFIG_KEY(CPU_THROUGHPUT_STREAMS);
 
+/**
+* @brief Optimize CPU execution of batch-1 requests by coalescing concurrent ones into a single batched inference.
+* Requests arriving within CPU_BATCHING_TIMEOUT after the first one are executed together, up to the given batch.
+* The network must have batch 1 and be applicable for dynamic batch. The feature is used with a single stream only.
+* The value is an integer number: 0 or 1 (default) disables the batching
+*/
+DECLARE_CONFIG_KEY(CPU_BATCHING_MAX_BATCH);
+
+/**
+* @brief Time in microseconds the first request of a batch waits for other requests (see CPU_BATCHING_MAX_BATCH).
+* Default value is 1000
+*/
+DECLARE_CONFIG_KEY(CPU_BATCHING_TIMEOUT);
+
+/**
+* @brief Execute independent branches of the network (e.g. Inception-like or multi-head topologies) concurrently.
+* Layers are grouped into levels by their depth in the graph, layers of the same level run in parallel within
+* the stream threads, and intermediate memory is reused according to this schedule.
+* The value is YES or NO (default)
+*/
+DECLARE_CONFIG_KEY(CPU_PARALLEL_BRANCHES);
+
+/**
+* @brief Run the FP32 layers which have bfloat16 kernels (convolutions and fully connected) in bfloat16.
+* Weights are converted once when the network is loaded, activations are converted on the input of such layers
+* and accumulation is done in FP32, the other layers keep FP32. Requires a CPU with AVX-512 (see the "BF16"
+* optimization capability), on CPUs without native bfloat16 instructions the conversion is emulated.
+* The value is YES or NO (default)
+*/
+DECLARE_CONFIG_KEY(ENFORCE_BF16);
+
+/**
+* @brief Record start and end time of every layer execution, per stream and with nanosecond resolution.
+* The latest executions are kept in a ring buffer of every layer and are reported by the executable network
+* metrics METRIC_KEY(CPU_PERF_TRACE) and METRIC_KEY(CPU_PERF_TRACE_PERCENTILES).
+* The value is YES or NO (default)
+*/
+DECLARE_CONFIG_KEY(CPU_PERF_TRACE);
+
 /**
 * @brief Optimize GPU plugin execution to maximize throughput.
 * It is passed to IInferencePlugin::SetConfig(), this option should be used with values:
@@ -293,5 +394,13 @@ DECLARE_CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS);
  */
 DECLARE_CONFIG_KEY(DUMP_EXEC_GRAPH_AS_DOT);
 
+/**
+ * @brief The key defines a directory where InferenceEngine::Core keeps networks compiled by LoadNetwork.
+ * Later loads of the same network with the same device, plugin version and configuration are served by
+ * ImportNetwork from this directory. Devices which do not support Export are not affected.
+ * The key is handled by Core itself and is not passed to plugins. Empty value (default) disables the cache.
+ */
+DECLARE_CONFIG_KEY(CACHE_DIR);
+
 }  // namespace PluginConfigParams
 }  // namespace InferenceEngine
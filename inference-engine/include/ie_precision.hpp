@@ -24,6 +24,7 @@ public:
         MIXED = 0,  /**< Mixed value. Can be received from network. No applicable for tensors */
         FP32 = 10,  /**< 32bit floating point value */
         FP16 = 11,  /**< 16bit floating point value */
+        BF16 = 12,  /**< 16bit floating point value, 8 bit for exponent, 7 bit for mantissa*/
         Q78 = 20,   /**< 16bit specific signed fixed point precision */
         I16 = 30,   /**< 16bit signed integer value */
         U8 = 40,    /**< 8bit unsigned integer value */
@@ -96,6 +97,7 @@ public:
             switch (precisionInfo.value) {
                 CASE(FP32, float);
                 CASE2(FP16, int16_t, uint16_t);
+                CASE2(BF16, int16_t, uint16_t);
                 CASE(I16, int16_t);
                 CASE(I32, int32_t);
                 CASE(I64, int64_t);
@@ -170,6 +172,7 @@ public:
             PRECISION_NAME(U16),
             PRECISION_NAME(FP32),
             PRECISION_NAME(FP16),
+            PRECISION_NAME(BF16),
             PRECISION_NAME(MIXED),
             PRECISION_NAME(BIN),
 #undef      PRECISION_NAME
@@ -216,6 +219,7 @@ public:
         switch (v) {
             CASE(FP32);
             CASE(FP16);
+            CASE(BF16);
             CASE(I16);
             CASE(I32);
             CASE(I64);
@@ -249,6 +253,10 @@ struct PrecisionTrait<Precision::FP16> {
     using value_type = int16_t;
 };
 template<>
+struct PrecisionTrait<Precision::BF16> {
+    using value_type = int16_t;
+};
+template<>
 struct PrecisionTrait<Precision::Q78> {
     using value_type = uint16_t;
 };
@@ -301,16 +309,12 @@ inline uint8_t type_size_or_zero<void>() {
 }
 
 template<Precision::ePrecision T>
-inline typename std::enable_if<std::is_same<
-    std::integral_constant<Precision::ePrecision, Precision::FP16>,
-    std::integral_constant<Precision::ePrecision, T>>::value, bool>::type is_floating() {
+inline typename std::enable_if<T == Precision::FP16 || T == Precision::BF16, bool>::type is_floating() {
     return true;
 }
 
 template<Precision::ePrecision T>
-inline typename std::enable_if<!std::is_same<
-    std::integral_constant<Precision::ePrecision, Precision::FP16>,
-    std::integral_constant<Precision::ePrecision, T>>::value, bool>::type is_floating() {
+inline typename std::enable_if<T != Precision::FP16 && T != Precision::BF16, bool>::type is_floating() {
     return std::is_floating_point<typename PrecisionTrait<T>::value_type>::value;
 }
 
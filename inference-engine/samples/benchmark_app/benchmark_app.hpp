@@ -73,6 +73,30 @@ static const char report_folder_message[] = "Optional. Path to a folder where st
 // @brief message for exec_graph_path option
 static const char exec_graph_path_message[] = "Optional. Path to a file where to store executable graph information serialized.";
 
+// @brief message for cache_dir option
+static const char cache_dir_message[] = "Optional. Path to a folder where compiled networks are cached. "
+                                        "If a compiled network for the same model, device and configuration is found there, "
+                                        "it is imported instead of being compiled again.";
+
+// @brief message for arrival_rate option
+static const char arrival_rate_message[] = "Optional. Run in the open-loop mode: issue requests at the given mean rate (requests per second) "
+                                           "regardless of the completion of previous ones. The time a request waits for an idle infer "
+                                           "request is reported as queueing time and is included into its latency. "
+                                           "By default a new request is started as soon as one completes (closed loop).";
+
+// @brief message for arrival_distribution option
+static const char arrival_distribution_message[] = "Optional. Distribution of the intervals between arrivals in the open-loop mode: "
+                                                   "\"poisson\" (default) or \"constant\".";
+
+// @brief message for sweep option
+static const char sweep_message[] = "Optional. Comma-separated list of <nstreams>:<nireq> pairs. After the main measurement the network is loaded "
+                                    "and measured again for every pair to get throughput and latency for each of them. "
+                                    "Zero nireq means the optimal number of requests for the device. Async API only.";
+
+// @brief message for json_report option
+static const char json_report_message[] = "Optional. Path to a file where to store the configuration, throughput, latency percentiles "
+                                          "and the sweep results in JSON format.";
+
 // @brief message for progress bar option
 static const char progress_message[] = "Optional. Show progress bar (can affect performance measurement). Default values is \"false\".";
 
@@ -143,6 +167,21 @@ DEFINE_string(report_folder, "", report_folder_message);
 /// @brief Path to a file where to store executable graph information serialized
 DEFINE_string(exec_graph_path, "", exec_graph_path_message);
 
+/// @brief Path to a folder where compiled networks are cached
+DEFINE_string(cache_dir, "", cache_dir_message);
+
+/// @brief Mean arrival rate of requests in the open-loop mode
+DEFINE_double(arrival_rate, 0.0, arrival_rate_message);
+
+/// @brief Distribution of intervals between arrivals in the open-loop mode
+DEFINE_string(arrival_distribution, "poisson", arrival_distribution_message);
+
+/// @brief List of <nstreams>:<nireq> pairs for the throughput-vs-latency sweep
+DEFINE_string(sweep, "", sweep_message);
+
+/// @brief Path to a file where to store the JSON report
+DEFINE_string(json_report, "", json_report_message);
+
 /// @brief Define flag for showing progress bar <br>
 DEFINE_bool(progress, false, progress_message);
 
@@ -171,6 +210,10 @@ static void showUsage() {
     std::cout << "    -stream_output            " << stream_output_message << std::endl;
     std::cout << "    -t                        " << execution_time_message << std::endl;
     std::cout << "    -progress                 " << progress_message << std::endl;
+    std::cout << "    -cache_dir \"<path>\"       " << cache_dir_message << std::endl;
+    std::cout << "    -arrival_rate \"<float>\"   " << arrival_rate_message << std::endl;
+    std::cout << "    -arrival_distribution     " << arrival_distribution_message << std::endl;
+    std::cout << "    -sweep \"<list>\"           " << sweep_message << std::endl;
     std::cout << std::endl << "  device-specific performance options:" << std::endl;
     std::cout << "    -nstreams \"<integer>\"     " << infer_num_streams_message << std::endl;
     std::cout << "    -nthreads \"<integer>\"     " << infer_num_threads_message << std::endl;
@@ -179,5 +222,6 @@ static void showUsage() {
     std::cout << "    -report_type \"<type>\"     " << report_type_message << std::endl;
     std::cout << "    -report_folder            " << report_folder_message << std::endl;
     std::cout << "    -exec_graph_path          " << exec_graph_path_message << std::endl;
+    std::cout << "    -json_report \"<path>\"     " << json_report_message << std::endl;
     std::cout << "    -pc                       " << pc_message << std::endl;
 }
@@ -21,7 +21,7 @@
 typedef std::chrono::high_resolution_clock Time;
 typedef std::chrono::nanoseconds ns;
 
-typedef std::function<void(size_t id, const double latency)> QueueCallbackFunction;
+typedef std::function<void(size_t id, const double latency, const double queueingTime)> QueueCallbackFunction;
 
 /// @brief Wrapper class for InferenceEngine::InferRequest. Handles asynchronous callbacks and calculates execution time.
 class InferReqWrap final {
@@ -37,20 +37,23 @@ public:
         _request.SetCompletionCallback(
                 [&]() {
                     _endTime = Time::now();
-                    _callbackQueue(_id, getExecutionTimeInMilliseconds());
+                    _callbackQueue(_id, getExecutionTimeInMilliseconds(), getQueueingTimeInMilliseconds());
                 });
     }
 
-    void startAsync() {
+    /// @param arrivalTime the time the request was issued at, the time before the start is reported as queueing
+    void startAsync(Time::time_point arrivalTime = Time::time_point::max()) {
         _startTime = Time::now();
+        _arrivalTime = std::min(arrivalTime, _startTime);
         _request.StartAsync();
     }
 
-    void infer() {
+    void infer(Time::time_point arrivalTime = Time::time_point::max()) {
         _startTime = Time::now();
+        _arrivalTime = std::min(arrivalTime, _startTime);
         _request.Infer();
         _endTime = Time::now();
-        _callbackQueue(_id, getExecutionTimeInMilliseconds());
+        _callbackQueue(_id, getExecutionTimeInMilliseconds(), getQueueingTimeInMilliseconds());
     }
 
     std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> getPerformanceCounts() {
@@ -66,8 +69,14 @@ public:
         return static_cast<double>(execTime.count()) * 0.000001;
     }
 
+    double getQueueingTimeInMilliseconds() const {
+        auto queueingTime = std::chrono::duration_cast<ns>(_startTime - _arrivalTime);
+        return static_cast<double>(queueingTime.count()) * 0.000001;
+    }
+
 private:
     InferenceEngine::InferRequest _request;
+    Time::time_point _arrivalTime;
     Time::time_point _startTime;
     Time::time_point _endTime;
     size_t _id;
@@ -80,7 +89,8 @@ public:
         for (size_t id = 0; id < nireq; id++) {
             requests.push_back(std::make_shared<InferReqWrap>(net, id, std::bind(&InferRequestsQueue::putIdleRequest, this,
                                                                                  std::placeholders::_1,
-                                                                                 std::placeholders::_2)));
+                                                                                 std::placeholders::_2,
+                                                                                 std::placeholders::_3)));
             _idleIds.push(id);
         }
         resetTimes();
@@ -91,6 +101,7 @@ public:
         _startTime = Time::time_point::max();
         _endTime = Time::time_point::min();
         _latencies.clear();
+        _queueingTimes.clear();
     }
 
     double getDurationInMilliseconds() {
@@ -98,9 +109,11 @@ public:
     }
 
     void putIdleRequest(size_t id,
-                        const double latency) {
+                        const double latency,
+                        const double queueingTime) {
         std::unique_lock<std::mutex> lock(_mutex);
         _latencies.push_back(latency);
+        _queueingTimes.push_back(queueingTime);
         _idleIds.push(id);
         _endTime = std::max(Time::now(), _endTime);
         _cv.notify_one();
@@ -120,10 +133,16 @@ public:
         _cv.wait(lock, [this]{ return _idleIds.size() == requests.size(); });
     }
 
+    /// @brief Execution times of the requests, without the time they waited for an idle request
     std::vector<double> getLatencies() {
         return _latencies;
     }
 
+    /// @brief Times the requests waited for an idle request since their arrival, in the same order as latencies
+    std::vector<double> getQueueingTimes() {
+        return _queueingTimes;
+    }
+
     std::vector<InferReqWrap::Ptr> requests;
 
 private:
@@ -133,4 +152,5 @@ private:
     Time::time_point _startTime;
     Time::time_point _endTime;
     std::vector<double> _latencies;
+    std::vector<double> _queueingTimes;
 };
@@ -0,0 +1,43 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include "infer_request_wrap.hpp"
+
+/// @brief Arrival times of the requests in the open-loop mode, independent of how fast the requests are served
+class ArrivalProcess final {
+public:
+    /// @param rate mean number of requests per second
+    /// @param distribution "poisson" (exponentially distributed intervals) or "constant"
+    ArrivalProcess(double rate, const std::string &distribution, Time::time_point startTime)
+        : _poisson(distribution == "poisson"), _interval(1.0 / rate), _next(startTime) {
+        if (rate <= 0.0) {
+            throw std::logic_error("Arrival rate must be positive");
+        }
+        if (distribution != "poisson" && distribution != "constant") {
+            throw std::logic_error("Unknown arrival distribution '" + distribution + "', only poisson and constant are supported");
+        }
+    }
+
+    /// @brief Time of the next arrival, it may be in the past if the previous requests waited for an idle request
+    Time::time_point next() {
+        double interval = _poisson ? _exponential(_generator) * _interval : _interval;
+        _next += std::chrono::duration_cast<Time::duration>(std::chrono::duration<double>(interval));
+        return _next;
+    }
+
+private:
+    bool _poisson;
+    double _interval;
+    Time::time_point _next;
+    // fixed seed, so runs with the same rate issue the same sequence of requests
+    std::mt19937_64 _generator{0};
+    std::exponential_distribution<double> _exponential{1.0};
+};
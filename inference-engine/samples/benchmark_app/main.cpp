@@ -7,6 +7,7 @@
 #include <memory>
 #include <map>
 #include <string>
+#include <thread>
 #include <vector>
 #include <utility>
 
@@ -23,6 +24,7 @@
 #include "progress_bar.hpp"
 #include "statistics_report.hpp"
 #include "inputs_filling.hpp"
+#include "load_generator.hpp"
 #include "utils.hpp"
 
 using namespace InferenceEngine;
@@ -55,6 +57,18 @@ bool ParseAndCheckCommandLine(int argc, char *argv[]) {
         throw std::logic_error("Incorrect API. Please set -api option to `sync` or `async` value.");
     }
 
+    if (FLAGS_arrival_rate < 0) {
+        throw std::logic_error("Incorrect arrival rate. Please set -arrival_rate option to a positive value.");
+    }
+
+    if (FLAGS_arrival_distribution != "poisson" && FLAGS_arrival_distribution != "constant") {
+        throw std::logic_error("Incorrect arrival distribution. Please set -arrival_distribution option to `poisson` or `constant` value.");
+    }
+
+    if (!FLAGS_sweep.empty() && FLAGS_api != "async") {
+        throw std::logic_error("The sweep over streams and requests is supported for the async API only.");
+    }
+
     if (!FLAGS_report_type.empty() &&
          FLAGS_report_type != noCntReport && FLAGS_report_type != averageCntReport && FLAGS_report_type != detailedCntReport) {
         std::string err = "only " + std::string(noCntReport) + "/" + std::string(averageCntReport) + "/" + std::string(detailedCntReport) +
@@ -65,6 +79,98 @@ bool ParseAndCheckCommandLine(int argc, char *argv[]) {
     return true;
 }
 
+/**
+* @brief Parses the list of <nstreams>:<nireq> pairs of the sweep
+*/
+std::vector<std::pair<uint32_t, uint32_t>> parseSweepPoints(const std::string &sweep) {
+    std::vector<std::pair<uint32_t, uint32_t>> points;
+    std::stringstream ss(sweep);
+    std::string point;
+    while (std::getline(ss, point, ',')) {
+        auto delimiter = point.find(':');
+        if (delimiter == std::string::npos) {
+            throw std::logic_error("Incorrect sweep point '" + point + "', the expected format is <nstreams>:<nireq>");
+        }
+        points.emplace_back(std::stoi(point.substr(0, delimiter)), std::stoi(point.substr(delimiter + 1)));
+    }
+    return points;
+}
+
+/**
+* @brief Runs the inference until the limits are reached, returns the number of executed iterations
+*/
+size_t measure(InferRequestsQueue &inferRequestsQueue, uint32_t nireq, uint32_t niter, uint64_t duration_nanoseconds,
+               ProgressBar &progressBar, size_t progressBarTotalCount) {
+    size_t progressCnt = 0;
+    size_t iteration = 0;
+
+    // warming up - out of scope
+    auto inferRequest = inferRequestsQueue.getIdleRequest();
+    if (!inferRequest) {
+        THROW_IE_EXCEPTION << "No idle Infer Requests!";
+    }
+
+    if (FLAGS_api == "sync") {
+        inferRequest->infer();
+    } else {
+        inferRequest->startAsync();
+    }
+    inferRequestsQueue.waitAll();
+    inferRequestsQueue.resetTimes();
+
+    const auto startTime = Time::now();
+    auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+
+    // in the open loop requests arrive on their own schedule and wait for an idle infer request if all are busy
+    const bool openLoop = FLAGS_arrival_rate > 0;
+    std::unique_ptr<ArrivalProcess> arrivals;
+    if (openLoop) {
+        arrivals.reset(new ArrivalProcess(FLAGS_arrival_rate, FLAGS_arrival_distribution, startTime));
+    }
+
+    /** Start inference & calculate performance **/
+    /** to align number if iterations to guarantee that last infer requests are executed in the same conditions **/
+    while ((niter != 0LL && iteration < niter) ||
+           (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
+           (FLAGS_api == "async" && !openLoop && iteration % nireq != 0)) {
+        auto arrivalTime = Time::time_point::max();
+        if (openLoop) {
+            arrivalTime = arrivals->next();
+            std::this_thread::sleep_until(arrivalTime);
+        }
+
+        inferRequest = inferRequestsQueue.getIdleRequest();
+        if (!inferRequest) {
+            THROW_IE_EXCEPTION << "No idle Infer Requests!";
+        }
+
+        if (FLAGS_api == "sync") {
+            inferRequest->infer(arrivalTime);
+        } else {
+            inferRequest->startAsync(arrivalTime);
+        }
+        iteration++;
+
+        execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+
+        if (niter > 0) {
+            progressBar.addProgress(1);
+        } else {
+            // calculate how many progress intervals are covered by current iteration.
+            // depends on the current iteration time and time of each progress interval.
+            // Previously covered progress intervals must be skipped.
+            auto progressIntervalTime = duration_nanoseconds / progressBarTotalCount;
+            size_t newProgress = execTime / progressIntervalTime - progressCnt;
+            progressBar.addProgress(newProgress);
+            progressCnt += newProgress;
+        }
+    }
+
+    // wait the latest inference executions
+    inferRequestsQueue.waitAll();
+    return iteration;
+}
+
 static void next_step(const std::string additional_info = "") {
     static size_t step_id = 0;
     static const std::map<size_t, std::string> step_names = {
@@ -131,6 +237,11 @@ int main(int argc, char *argv[]) {
             slog::info << "GPU extensions is loaded " << FLAGS_c << slog::endl;
         }
 
+        if (!FLAGS_cache_dir.empty()) {
+            ie.SetConfig({ {CONFIG_KEY(CACHE_DIR), FLAGS_cache_dir} });
+            slog::info << "Compiled networks are cached in " << FLAGS_cache_dir << slog::endl;
+        }
+
         slog::info << "InferenceEngine: " << GetInferenceEngineVersion() << slog::endl;
         slog::info << "Device info: " << slog::endl;
         std::cout << ie.GetVersions(device_name) << std::endl;
@@ -234,7 +345,19 @@ int main(int argc, char *argv[]) {
 
         std::map<std::string, std::string> config = {{ CONFIG_KEY(PERF_COUNT), perf_counts ? CONFIG_VALUE(YES) :
                                                                                              CONFIG_VALUE(NO) }};
+        const auto loadStartTime = Time::now();
         ExecutableNetwork exeNetwork = ie.LoadNetwork(cnnNetwork, device_name, config);
+        const auto loadTime = std::chrono::duration_cast<std::chrono::duration<double, std::ratio<1, 1000>>>(
+                Time::now() - loadStartTime).count();
+        slog::info << "Load network took " << loadTime << " ms" << slog::endl;
+        if (!FLAGS_cache_dir.empty()) {
+            for (auto& device : devices) {
+                slog::info << device << " compiled network cache: "
+                           << ie.GetMetric(device, METRIC_KEY(CACHE_HITS)).as<uint64_t>() << " hit(s), "
+                           << ie.GetMetric(device, METRIC_KEY(CACHE_MISSES)).as<uint64_t>() << " miss(es)"
+                           << slog::endl;
+            }
+        }
 
         // ----------------- 8. Setting optimal runtime parameters -----------------------------------------------------
         next_step();
@@ -282,9 +405,7 @@ int main(int argc, char *argv[]) {
         fillBlobs(inputFiles, batchSize, inputInfo, inferRequestsQueue.requests);
 
         // ----------------- 10. Measuring performance ------------------------------------------------------------------
-        size_t progressCnt = 0;
         size_t progressBarTotalCount = progressBarDefaultTotalCount;
-        size_t iteration = 0;
 
         std::stringstream ss;
         ss << "Start inference " << FLAGS_api << "ronously";
@@ -304,6 +425,9 @@ int main(int argc, char *argv[]) {
                 ss << " using " << device_ss.str();
             }
         }
+        if (FLAGS_arrival_rate > 0) {
+            ss << ", " << FLAGS_arrival_distribution << " arrivals at " << FLAGS_arrival_rate << " requests/s";
+        }
         ss << ", limits: ";
         if (duration_seconds > 0) {
             ss << getDurationInMilliseconds(duration_seconds) << " ms duration";
@@ -319,59 +443,9 @@ int main(int argc, char *argv[]) {
         }
         next_step(ss.str());
 
-        // warming up - out of scope
-        auto inferRequest = inferRequestsQueue.getIdleRequest();
-        if (!inferRequest) {
-            THROW_IE_EXCEPTION << "No idle Infer Requests!";
-        }
-
-        if (FLAGS_api == "sync") {
-            inferRequest->infer();
-        } else {
-            inferRequest->startAsync();
-        }
-        inferRequestsQueue.waitAll();
-        inferRequestsQueue.resetTimes();
-
-        const auto startTime = Time::now();
-        auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
-
-        /** Start inference & calculate performance **/
-        /** to align number if iterations to guarantee that last infer requests are executed in the same conditions **/
         ProgressBar progressBar(progressBarTotalCount, FLAGS_stream_output, FLAGS_progress);
 
-        while ((niter != 0LL && iteration < niter) ||
-               (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
-               (FLAGS_api == "async" && iteration % nireq != 0)) {
-            inferRequest = inferRequestsQueue.getIdleRequest();
-            if (!inferRequest) {
-                THROW_IE_EXCEPTION << "No idle Infer Requests!";
-            }
-
-            if (FLAGS_api == "sync") {
-                inferRequest->infer();
-            } else {
-                inferRequest->startAsync();
-            }
-            iteration++;
-
-            execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
-
-            if (niter > 0) {
-                progressBar.addProgress(1);
-            } else {
-                // calculate how many progress intervals are covered by current iteration.
-                // depends on the current iteration time and time of each progress interval.
-                // Previously covered progress intervals must be skipped.
-                auto progressIntervalTime = duration_nanoseconds / progressBarTotalCount;
-                size_t newProgress = execTime / progressIntervalTime - progressCnt;
-                progressBar.addProgress(newProgress);
-                progressCnt += newProgress;
-            }
-        }
-
-        // wait the latest inference executions
-        inferRequestsQueue.waitAll();
+        size_t iteration = measure(inferRequestsQueue, nireq, niter, duration_nanoseconds, progressBar, progressBarTotalCount);
 
         StatisticsReport statistics({ FLAGS_d,
                                       FLAGS_api,
@@ -383,25 +457,76 @@ int main(int argc, char *argv[]) {
                                       device_nstreams,
                                       FLAGS_pin,
                                       FLAGS_report_type,
-                                      FLAGS_report_folder
+                                      FLAGS_report_folder,
+                                      FLAGS_arrival_rate,
+                                      FLAGS_arrival_distribution
                                     });
         if (perf_counts) {
             for (auto& request : inferRequestsQueue.requests) {
                 statistics.addPerfCounts(request->getPerformanceCounts());
             }
         }
-        statistics.addLatencies(inferRequestsQueue.getLatencies());
+        statistics.addLatencies(inferRequestsQueue.getLatencies(), inferRequestsQueue.getQueueingTimes());
 
         double totalDuration = inferRequestsQueue.getDurationInMilliseconds();
-        double fps = (FLAGS_api == "sync") ? batchSize * 1000.0 / statistics.getMedianLatency() :
-                                             batchSize * 1000.0 * iteration / totalDuration;
+        double fps = (FLAGS_api == "sync" && FLAGS_arrival_rate <= 0) ?
+                     batchSize * 1000.0 / statistics.getMedianLatency() :
+                     batchSize * 1000.0 * iteration / totalDuration;
         progressBar.finish();
 
+        // throughput-vs-latency sweep, each point loads the network with its own number of streams
+        for (auto& point : parseSweepPoints(FLAGS_sweep)) {
+            std::map<std::string, uint32_t> point_nstreams;
+            for (auto& device : devices) {
+                if (device == "CPU") {
+                    ie.SetConfig({{ CONFIG_KEY(CPU_THROUGHPUT_STREAMS), std::to_string(point.first) }}, device);
+                    point_nstreams[device] = std::stoi(ie.GetConfig(device, CONFIG_KEY(CPU_THROUGHPUT_STREAMS)).as<std::string>());
+                } else if (device == "GPU") {
+                    ie.SetConfig({{ CONFIG_KEY(GPU_THROUGHPUT_STREAMS), std::to_string(point.first) }}, device);
+                    point_nstreams[device] = std::stoi(ie.GetConfig(device, CONFIG_KEY(GPU_THROUGHPUT_STREAMS)).as<std::string>());
+                }
+            }
+            ExecutableNetwork pointNetwork = ie.LoadNetwork(cnnNetwork, device_name, config);
+
+            uint32_t point_nireq = point.second != 0 ? point.second :
+                                   pointNetwork.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+            uint32_t point_niter = FLAGS_niter > 0 ? ((FLAGS_niter + point_nireq - 1) / point_nireq) * point_nireq : 0;
+            slog::info << "Sweep point: " << point.first << " streams, " << point_nireq << " inference requests" << slog::endl;
+
+            InferRequestsQueue pointRequestsQueue(pointNetwork, point_nireq);
+            fillBlobs(inputFiles, batchSize, inputInfo, pointRequestsQueue.requests);
+
+            ProgressBar pointProgressBar(progressBarTotalCount, FLAGS_stream_output, FLAGS_progress);
+            size_t pointIterations = measure(pointRequestsQueue, point_nireq, point_niter, duration_nanoseconds,
+                                             pointProgressBar, progressBarTotalCount);
+            pointProgressBar.finish();
+
+            StatisticsReport::SweepPoint result;
+            result.nstreams = point_nstreams;
+            result.nireq = point_nireq;
+            result.iterations = pointIterations;
+            result.fps = batchSize * 1000.0 * pointIterations / pointRequestsQueue.getDurationInMilliseconds();
+            auto pointLatencies = pointRequestsQueue.getLatencies();
+            auto pointQueueingTimes = pointRequestsQueue.getQueueingTimes();
+            for (size_t i = 0; i < pointLatencies.size(); i++) {
+                pointLatencies[i] += pointQueueingTimes[i];
+            }
+            result.latency = StatisticsReport::getStatistics(pointLatencies);
+            statistics.addSweepPoint(result);
+
+            slog::info << "Throughput: " << result.fps << " FPS, latency median: " << result.latency.median
+                       << " ms, p99: " << result.latency.p99 << " ms" << slog::endl;
+        }
+
         // ----------------- 11. Dumping statistics report -------------------------------------------------------------
         next_step();
 
         statistics.dump(fps, iteration, totalDuration);
 
+        if (!FLAGS_json_report.empty()) {
+            statistics.dumpJson(FLAGS_json_report, fps, iteration, totalDuration);
+        }
+
         if (!FLAGS_exec_graph_path.empty()) {
             try {
                 CNNNetwork execGraphInfo = exeNetwork.GetExecGraphInfo();
@@ -422,6 +547,15 @@ int main(int argc, char *argv[]) {
         std::cout << "Count:      " << iteration << " iterations" << std::endl;
         std::cout << "Duration:   " << totalDuration << " ms" << std::endl;
         std::cout << "Latency:    " << statistics.getMedianLatency() << " ms" << std::endl;
+        auto latency = statistics.getLatencyStatistics();
+        std::cout << "Latency percentiles: p90 " << latency.p90 << " ms, p99 " << latency.p99 << " ms, p99.9 "
+                  << latency.p999 << " ms, max " << latency.max << " ms" << std::endl;
+        if (FLAGS_arrival_rate > 0) {
+            std::cout << "Queueing:   " << statistics.getQueueingTimeStatistics().median << " ms median, "
+                      << statistics.getQueueingTimeStatistics().p99 << " ms p99" << std::endl;
+            std::cout << "Service:    " << statistics.getServiceTimeStatistics().median << " ms median, "
+                      << statistics.getServiceTimeStatistics().p99 << " ms p99" << std::endl;
+        }
         std::cout << "Throughput: " << fps << " FPS" << std::endl;
     } catch (const std::exception& ex) {
         slog::err << ex.what() << slog::endl;
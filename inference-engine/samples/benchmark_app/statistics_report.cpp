@@ -7,6 +7,10 @@
 #include <utility>
 #include <map>
 #include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
 
 #include "statistics_report.hpp"
 
@@ -17,8 +21,20 @@ void StatisticsReport::addPerfCounts(const std::map<std::string, InferenceEngine
     }
 }
 
-void StatisticsReport::addLatencies(const std::vector<double> &latencies) {
-    _latencies.insert(_latencies.end(), latencies.begin(), latencies.end());
+void StatisticsReport::addLatencies(const std::vector<double> &latencies, const std::vector<double> &queueingTimes) {
+    if (!queueingTimes.empty() && queueingTimes.size() != latencies.size()) {
+        throw std::logic_error("queueing time must be collected for each processed infer request");
+    }
+    _serviceTimes.insert(_serviceTimes.end(), latencies.begin(), latencies.end());
+    for (size_t i = 0; i < latencies.size(); i++) {
+        double queueingTime = queueingTimes.empty() ? 0.0 : queueingTimes[i];
+        _queueingTimes.push_back(queueingTime);
+        _latencies.push_back(queueingTime + latencies[i]);
+    }
+}
+
+void StatisticsReport::addSweepPoint(const SweepPoint &point) {
+    _sweepPoints.push_back(point);
 }
 
 void StatisticsReport::dump(const double &fps, const size_t &iteration_number, const double &totalExecTime) {
@@ -180,6 +196,21 @@ void StatisticsReport::dump(const double &fps, const size_t &iteration_number, c
     completeCsvRow(dumper, numOfColumns, 2);
     dumper << "latency" << getMedianValue<double>(_latencies);
     completeCsvRow(dumper, numOfColumns, 2);
+    auto latency = getLatencyStatistics();
+    dumper << "latency p90" << latency.p90;
+    completeCsvRow(dumper, numOfColumns, 2);
+    dumper << "latency p99" << latency.p99;
+    completeCsvRow(dumper, numOfColumns, 2);
+    dumper << "latency p99.9" << latency.p999;
+    completeCsvRow(dumper, numOfColumns, 2);
+    dumper << "latency max" << latency.max;
+    completeCsvRow(dumper, numOfColumns, 2);
+    if (_config.arrival_rate > 0) {
+        dumper << "queueing time" << getQueueingTimeStatistics().median;
+        completeCsvRow(dumper, numOfColumns, 2);
+        dumper << "service time" << getServiceTimeStatistics().median;
+        completeCsvRow(dumper, numOfColumns, 2);
+    }
     dumper << "throughput" << fps;
     completeCsvRow(dumper, numOfColumns, 2);
     dumper << "total execution time" << totalExecTime;
@@ -192,6 +223,127 @@ double StatisticsReport::getMedianLatency() {
     return getMedianValue<double>(_latencies);
 }
 
+StatisticsReport::LatencyStatistics StatisticsReport::getLatencyStatistics() {
+    return getStatistics(_latencies);
+}
+
+StatisticsReport::LatencyStatistics StatisticsReport::getQueueingTimeStatistics() {
+    return getStatistics(_queueingTimes);
+}
+
+StatisticsReport::LatencyStatistics StatisticsReport::getServiceTimeStatistics() {
+    return getStatistics(_serviceTimes);
+}
+
+StatisticsReport::LatencyStatistics StatisticsReport::getStatistics(const std::vector<double> &values) {
+    LatencyStatistics result;
+    if (values.empty()) {
+        return result;
+    }
+    std::vector<double> sorted(values);
+    std::sort(sorted.begin(), sorted.end());
+    // nearest-rank percentile, so the tail percentiles are always the observed values
+    auto percentile = [&](double p) {
+        size_t rank = static_cast<size_t>(std::ceil(p / 100.0 * sorted.size()));
+        return sorted[std::min(std::max<size_t>(rank, 1), sorted.size()) - 1];
+    };
+    result.median = getMedianValue<double>(sorted);
+    result.p90 = percentile(90.0);
+    result.p99 = percentile(99.0);
+    result.p999 = percentile(99.9);
+    result.max = sorted.back();
+    return result;
+}
+
+namespace {
+
+std::string jsonString(const std::string &str) {
+    std::ostringstream out;
+    out << '"';
+    for (char c : str) {
+        if (c == '"' || c == '\\') {
+            out << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec;
+        } else {
+            out << c;
+        }
+    }
+    out << '"';
+    return out.str();
+}
+
+void writeJson(std::ostream &out, const StatisticsReport::LatencyStatistics &stats) {
+    out << "{\"median\": " << stats.median << ", \"p90\": " << stats.p90 << ", \"p99\": " << stats.p99
+        << ", \"p99.9\": " << stats.p999 << ", \"max\": " << stats.max << "}";
+}
+
+void writeJson(std::ostream &out, const std::map<std::string, uint32_t> &nstreams) {
+    out << "{";
+    for (auto it = nstreams.begin(); it != nstreams.end(); ++it) {
+        out << (it == nstreams.begin() ? "" : ", ") << jsonString(it->first) << ": " << it->second;
+    }
+    out << "}";
+}
+
+}  // namespace
+
+void StatisticsReport::dumpJson(const std::string &path, const double &fps, const size_t &iteration_number,
+                                const double &totalExecTime) {
+    std::ofstream out(path);
+    if (!out.is_open()) {
+        throw std::runtime_error("Can't open " + path + " to store the JSON report");
+    }
+    out << std::setprecision(6) << std::fixed;
+
+    // times are in milliseconds
+    out << "{\n";
+    out << "  \"configuration\": {\n";
+    out << "    \"device\": " << jsonString(_config.device) << ",\n";
+    out << "    \"api\": " << jsonString(_config.api) << ",\n";
+    out << "    \"batch\": " << _config.batch << ",\n";
+    out << "    \"nireq\": " << _config.nireq << ",\n";
+    out << "    \"niter\": " << _config.niter << ",\n";
+    out << "    \"duration\": " << _config.duration << ",\n";
+    out << "    \"nthreads\": " << _config.cpu_nthreads << ",\n";
+    out << "    \"nstreams\": ";
+    writeJson(out, _config.nstreams);
+    out << ",\n";
+    out << "    \"pin\": " << jsonString(_config.cpu_pin) << ",\n";
+    out << "    \"arrival_rate\": " << _config.arrival_rate << ",\n";
+    out << "    \"arrival_distribution\": " << jsonString(_config.arrival_rate > 0 ? _config.arrival_distribution : "closed_loop") << "\n";
+    out << "  },\n";
+    out << "  \"results\": {\n";
+    out << "    \"iterations\": " << iteration_number << ",\n";
+    out << "    \"total_execution_time\": " << totalExecTime << ",\n";
+    out << "    \"throughput\": " << fps << ",\n";
+    out << "    \"latency\": ";
+    writeJson(out, getLatencyStatistics());
+    out << ",\n";
+    out << "    \"queueing_time\": ";
+    writeJson(out, getQueueingTimeStatistics());
+    out << ",\n";
+    out << "    \"service_time\": ";
+    writeJson(out, getServiceTimeStatistics());
+    out << "\n";
+    out << "  },\n";
+    out << "  \"sweep\": [";
+    for (size_t i = 0; i < _sweepPoints.size(); i++) {
+        auto &point = _sweepPoints[i];
+        out << (i == 0 ? "\n" : ",\n");
+        out << "    {\"nstreams\": ";
+        writeJson(out, point.nstreams);
+        out << ", \"nireq\": " << point.nireq << ", \"iterations\": " << point.iterations
+            << ", \"throughput\": " << point.fps << ", \"latency\": ";
+        writeJson(out, point.latency);
+        out << "}";
+    }
+    out << (_sweepPoints.empty() ? "]\n" : "\n  ]\n");
+    out << "}\n";
+
+    slog::info << "JSON report is stored to " << path << slog::endl;
+}
+
 std::vector<std::pair<std::string, InferenceEngine::InferenceEngineProfileInfo>> StatisticsReport::preparePmStatistics() {
     if (_performanceCounters.empty()) {
         throw std::logic_error("preparePmStatistics() was called when no PM data was collected");
@@ -34,6 +34,27 @@ public:
         std::string cpu_pin;
         std::string report_type;
         std::string report_folder;
+        // zero for the closed loop, when a request is started as soon as the previous one completes
+        double arrival_rate;
+        std::string arrival_distribution;
+    };
+
+    /// @brief Distribution of times in milliseconds
+    struct LatencyStatistics {
+        double median = 0.0;
+        double p90 = 0.0;
+        double p99 = 0.0;
+        double p999 = 0.0;
+        double max = 0.0;
+    };
+
+    /// @brief Results of a single run of the throughput-vs-latency sweep
+    struct SweepPoint {
+        std::map<std::string, uint32_t> nstreams;
+        size_t nireq;
+        size_t iterations;
+        double fps;
+        LatencyStatistics latency;
     };
 
     explicit StatisticsReport(Config config) : _config(std::move(config)) {
@@ -44,22 +65,40 @@ public:
 
     void addPerfCounts(const std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &pmStat);
 
-    void addLatencies(const std::vector<double> &latency);
+    /// @param latency execution (service) times of the requests
+    /// @param queueingTimes times the requests waited since their arrival, empty for the closed loop
+    void addLatencies(const std::vector<double> &latency, const std::vector<double> &queueingTimes = {});
+
+    void addSweepPoint(const SweepPoint &point);
 
     void dump(const double &fps, const size_t &numProcessedReq, const double &totalExecTime);
 
+    /// @brief Writes the configuration, the results and the sweep points as a JSON object
+    void dumpJson(const std::string &path, const double &fps, const size_t &numProcessedReq, const double &totalExecTime);
+
     double getMedianLatency();
 
+    /// @brief Latency from the arrival of a request till its completion, i.e. queueing time + service time
+    LatencyStatistics getLatencyStatistics();
+    LatencyStatistics getQueueingTimeStatistics();
+    LatencyStatistics getServiceTimeStatistics();
+
+    static LatencyStatistics getStatistics(const std::vector<double> &values);
+
 private:
     std::vector<std::pair<std::string, InferenceEngine::InferenceEngineProfileInfo>> preparePmStatistics();
 
     template <typename T>
-    T getMedianValue(const std::vector<T> &vec);
+    static T getMedianValue(const std::vector<T> &vec);
 
     // Contains PM data for each processed infer request
     std::vector<std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>> _performanceCounters;
-    // Contains latency of each processed infer request
+    // Contains latency (queueing + service time) of each processed infer request
     std::vector<double> _latencies;
+    std::vector<double> _queueingTimes;
+    std::vector<double> _serviceTimes;
+
+    std::vector<SweepPoint> _sweepPoints;
 
     // configuration of current benchmark execution
     const Config _config;
@@ -93,11 +93,10 @@ void ExtLayerBase::addConfig(const CNNLayer* layer, std::vector<DataConfigurator
             order.push_back(1);
             blocks[1] = div_up(blocks[1], blk_size);
             blocks.push_back(blk_size);
-        } else if (isInt8) {
+        } else if (isInt8 && data_dims.size() == 4) {
+            // Channels last. Like [nhwc], the layout of the int8 convolutions
             order = {0, 2, 3, 1};
-            size_t tmp = blocks[1];
-            blocks[1] = blocks[3];
-            blocks[3] = tmp;
+            blocks = {data_dims[0], data_dims[2], data_dims[3], data_dims[1]};
 
             conf.layout = ConfLayout::PLN;
         }
@@ -12,17 +12,14 @@
 #include <utility>
 #include <algorithm>
 #include "ie_parallel.hpp"
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#endif
 
 namespace InferenceEngine {
 namespace Extensions {
 namespace Cpu {
 
-template <typename T>
-static bool SortScorePairDescend(const std::pair<float, T>& pair1,
-                                 const std::pair<float, T>& pair2) {
-    return pair1.first > pair2.first;
-}
-
 class DetectionOutputImpl: public ExtLayerBase {
 public:
     explicit DetectionOutputImpl(const CNNLayer* layer) {
@@ -95,9 +92,14 @@ public:
             _detections_count = InferenceEngine::make_shared_blob<int>({Precision::I32, detections_size, C});
             _detections_count->allocate();
 
-            const InferenceEngine::SizeVector &conf_size = layer->insData[idx_confidence].lock()->getTensorDesc().getDims();
-            _reordered_conf = InferenceEngine::make_shared_blob<float>({Precision::FP32, conf_size, ANY});
-            _reordered_conf->allocate();
+            // boxes kept by NMS of a class, stored as xmin, ymin, xmax, ymax and size planes, one set per thread
+            _num_threads = parallel_get_max_threads();
+            InferenceEngine::SizeVector kept_boxes_size{static_cast<size_t>(_num_threads),
+                                                        5,
+                                                        static_cast<size_t>(_num_priors)};
+            _kept_boxes = InferenceEngine::make_shared_blob<float>(
+                    {Precision::FP32, kept_boxes_size, {kept_boxes_size, {0, 1, 2}}});
+            _kept_boxes->allocate();
 
             InferenceEngine::SizeVector decoded_bboxes_size{static_cast<size_t>(_num),
                                                             static_cast<size_t>(_num_priors),
@@ -106,6 +108,12 @@ public:
                     {Precision::FP32, decoded_bboxes_size, {decoded_bboxes_size, {0, 1, 2}}});
             _bbox_sizes->allocate();
 
+            // candidates of the keep_top_k selection of every image, stored as class * num_priors + prior
+            InferenceEngine::SizeVector top_k_size{static_cast<size_t>(_num),
+                                                   static_cast<size_t>(_num_classes * _num_priors)};
+            _top_k_candidates = InferenceEngine::make_shared_blob<int>({Precision::I32, top_k_size, NC});
+            _top_k_candidates->allocate();
+
             InferenceEngine::SizeVector num_priors_actual_size{static_cast<size_t>(_num)};
             _num_priors_actual = InferenceEngine::make_shared_blob<int>({Precision::I32, num_priors_actual_size, C});
             _num_priors_actual->allocate();
@@ -128,13 +136,24 @@ public:
 
         const int N = inputs[idx_confidence]->getTensorDesc().getDims()[0];
 
+        const int DETECTION_SIZE = outputs[0]->getTensorDesc().getDims()[3];
+        if (DETECTION_SIZE != 7) {
+            return NOT_IMPLEMENTED;
+        }
+
+        auto dst_data_size = N * _keep_top_k * DETECTION_SIZE * sizeof(float);
+
+        if (dst_data_size > outputs[0]->byteSize()) {
+            return OUT_OF_BOUNDS;
+        }
+
         float *decoded_bboxes_data = _decoded_bboxes->buffer();
-        float *reordered_conf_data = _reordered_conf->buffer();
         float *bbox_sizes_data     = _bbox_sizes->buffer();
         int *detections_data       = _detections_count->buffer();
         int *buffer_data           = _buffer->buffer();
         int *indices_data          = _indices->buffer();
         int *num_priors_actual     = _num_priors_actual->buffer();
+        float *kept_boxes_data     = _kept_boxes->buffer();
 
         for (int n = 0; n < N; ++n) {
             const float *ppriors = prior_data;
@@ -163,28 +182,33 @@ public:
             }
         }
 
-        for (int n = 0; n < N; ++n) {
-            for (int c = 0; c < _num_classes; ++c) {
-                for (int p = 0; p < _num_priors; ++p) {
-                    reordered_conf_data[n*_num_priors*_num_classes + c*_num_priors + p] = conf_data[n*_num_priors*_num_classes + p*_num_classes + c];
-                }
-            }
-        }
-
-        memset(detections_data, 0, N*_num_classes*sizeof(int));
-
-        for (int n = 0; n < N; ++n) {
-            int detections_total = 0;
-
-            if (!_decrease_label_id) {
-                // Caffe style
-                parallel_for(_num_classes, [&](int c) {
-                    if (c != _background_label_id) {  // Ignore background class
-                        int *pindices    = indices_data + n*_num_classes*_num_priors + c*_num_priors;
-                        int *pbuffer     = buffer_data + c*_num_priors;
-                        int *pdetections = detections_data + n*_num_classes + c;
+        // Confidences are read in place in the [prior, class] order of the input, no transposed copy is made
+        if (!_decrease_label_id) {
+            // Caffe style: every thread takes a contiguous range of (image, class) pairs, selects the candidates
+            // of its classes in a single pass over the confidence rows and suppresses them class by class
+            const int work_amount = N*_num_classes;
+            const int nthr = std::min(_num_threads, parallel_get_max_threads());
+            parallel_nt(nthr, [&](const int ithr, const int nthr) {
+                int start = 0, end = 0;
+                splitter(work_amount, nthr, ithr, start, end);
+                float *kept_boxes = kept_boxes_data + ithr*5*_num_priors;
+
+                while (start < end) {
+                    const int n = start / _num_classes;
+                    const int c_start = start % _num_classes;
+                    const int c_end = std::min(_num_classes, c_start + end - start);
+
+                    const float *pconf = conf_data + n*_num_classes*_num_priors;
+                    int *pindices    = indices_data + n*_num_classes*_num_priors;
+                    int *pdetections = detections_data + n*_num_classes;
+
+                    filterConfidences(pconf, pindices, pdetections, c_start, c_end, num_priors_actual[n]);
+
+                    for (int c = c_start; c < c_end; ++c) {
+                        if (c == _background_label_id) {  // Ignore background class
+                            continue;
+                        }
 
-                        const float *pconf = reordered_conf_data + n*_num_classes*_num_priors + c*_num_priors;
                         const float *pboxes;
                         const float *psizes;
                         if (_share_location) {
@@ -195,73 +219,45 @@ public:
                             psizes = bbox_sizes_data + n*_num_classes*_num_priors + c*_num_priors;
                         }
 
-                        nms_cf(pconf, pboxes, psizes, pbuffer, pindices, *pdetections, num_priors_actual[n]);
+                        nms_cf(pconf + c, pboxes, psizes, buffer_data + n*_num_classes*_num_priors + c*_num_priors,
+                               pindices + c*_num_priors, pdetections[c], kept_boxes);
                     }
-                });
-            } else {
-                // MXNet style
+
+                    start += c_end - c_start;
+                }
+            });
+        } else {
+            // MXNet style
+            memset(detections_data, 0, N*_num_classes*sizeof(int));
+
+            parallel_for(N, [&](int n) {
                 int *pindices = indices_data + n*_num_classes*_num_priors;
-                int *pbuffer = buffer_data;
+                int *pbuffer = buffer_data + n*_num_classes*_num_priors;
                 int *pdetections = detections_data + n*_num_classes;
 
-                const float *pconf = reordered_conf_data + n*_num_classes*_num_priors;
+                const float *pconf = conf_data + n*_num_classes*_num_priors;
                 const float *pboxes = decoded_bboxes_data + n*4*_num_priors;
                 const float *psizes = bbox_sizes_data + n*_num_priors;
 
                 nms_mx(pconf, pboxes, psizes, pbuffer, pindices, pdetections, _num_priors);
-            }
-
-            for (int c = 0; c < _num_classes; ++c) {
-                detections_total += detections_data[n*_num_classes + c];
-            }
-
-            if (_keep_top_k > -1 && detections_total > _keep_top_k) {
-                std::vector<std::pair<float, std::pair<int, int>>> conf_index_class_map;
-
-                for (int c = 0; c < _num_classes; ++c) {
-                    int detections = detections_data[n*_num_classes + c];
-                    int *pindices = indices_data + n*_num_classes*_num_priors + c*_num_priors;
-                    float *pconf  = reordered_conf_data + n*_num_classes*_num_priors + c*_num_priors;
-
-                    for (int i = 0; i < detections; ++i) {
-                        int idx = pindices[i];
-                        conf_index_class_map.push_back(std::make_pair(pconf[idx], std::make_pair(c, idx)));
-                    }
-                }
-
-                std::sort(conf_index_class_map.begin(), conf_index_class_map.end(),
-                          SortScorePairDescend<std::pair<int, int>>);
-                conf_index_class_map.resize(_keep_top_k);
-
-                // Store the new indices.
-                memset(detections_data + n*_num_classes, 0, _num_classes * sizeof(int));
-
-                for (size_t j = 0; j < conf_index_class_map.size(); ++j) {
-                    int label = conf_index_class_map[j].second.first;
-                    int idx = conf_index_class_map[j].second.second;
-                    int *pindices = indices_data + n * _num_classes * _num_priors + label * _num_priors;
-                    pindices[detections_data[n*_num_classes + label]] = idx;
-                    detections_data[n*_num_classes + label]++;
-                }
-            }
-        }
-
-        const int DETECTION_SIZE = outputs[0]->getTensorDesc().getDims()[3];
-        if (DETECTION_SIZE != 7) {
-            return NOT_IMPLEMENTED;
+            });
         }
 
-        auto dst_data_size = N * _keep_top_k * DETECTION_SIZE * sizeof(float);
-
-        if (dst_data_size > outputs[0]->byteSize()) {
-            return OUT_OF_BOUNDS;
+        if (_keep_top_k > -1) {
+            int *top_k_data = _top_k_candidates->buffer();
+            parallel_for(N, [&](int n) {
+                keepTopK(conf_data + n*_num_classes*_num_priors,
+                         indices_data + n*_num_classes*_num_priors,
+                         detections_data + n*_num_classes,
+                         top_k_data + n*_num_classes*_num_priors);
+            });
         }
 
         memset(dst_data, 0, dst_data_size);
 
         int count = 0;
         for (int n = 0; n < N; ++n) {
-            const float *pconf   = reordered_conf_data + n * _num_priors * _num_classes;
+            const float *pconf   = conf_data + n * _num_priors * _num_classes;
             const float *pboxes  = decoded_bboxes_data + n*_num_priors*4*_num_loc_classes;
             const int *pindices  = indices_data + n*_num_classes*_num_priors;
 
@@ -271,7 +267,7 @@ public:
 
                     dst_data[count * DETECTION_SIZE + 0] = static_cast<float>(n);
                     dst_data[count * DETECTION_SIZE + 1] = static_cast<float>(_decrease_label_id ? c-1 : c);
-                    dst_data[count * DETECTION_SIZE + 2] = pconf[c*_num_priors + idx];
+                    dst_data[count * DETECTION_SIZE + 2] = pconf[idx*_num_classes + c];
 
                     float xmin = _share_location ? pboxes[idx*4 + 0] :
                                  pboxes[c*4*_num_priors + idx*4 + 0];
@@ -338,40 +334,86 @@ private:
     int _num_loc_classes = 0;
     int _num_priors = 0;
     bool _priors_batches = false;
+    int _num_threads = 1;
 
     enum CodeType {
         CORNER = 1,
         CENTER_SIZE = 2,
     };
 
+#if defined(HAVE_AVX512F)
+    const int block_size = 16;
+    typedef __m512 vec_type_f;
+    typedef __mmask16 vmask_type;
+#elif defined(HAVE_AVX2)
+    const int block_size = 8;
+    typedef __m256 vec_type_f;
+    typedef __m256 vmask_type;
+#elif defined(HAVE_SSE)
+    const int block_size = 4;
+    typedef __m128 vec_type_f;
+    typedef __m128 vmask_type;
+#endif
+
     void decodeBBoxes(const float *prior_data, const float *loc_data, const float *variance_data,
                       float *decoded_bboxes, float *decoded_bbox_sizes, int* num_priors_actual, int n);
 
+    void filterConfidences(const float *conf_data, int *indices, int *counts,
+                           int class_start, int class_end, int num_priors_actual);
+
     void nms_cf(const float *conf_data, const float *bboxes, const float *sizes,
-                int *buffer, int *indices, int &detections, int num_priors_actual);
+                int *buffer, int *indices, int &detections, float *kept_boxes);
 
     void nms_mx(const float *conf_data, const float *bboxes, const float *sizes,
                 int *buffer, int *indices, int *detections, int num_priors_actual);
 
+    void keepTopK(const float *conf_data, int *indices, int *detections, int *candidates);
+
     InferenceEngine::Blob::Ptr _decoded_bboxes;
     InferenceEngine::Blob::Ptr _buffer;
     InferenceEngine::Blob::Ptr _indices;
     InferenceEngine::Blob::Ptr _detections_count;
-    InferenceEngine::Blob::Ptr _reordered_conf;
+    InferenceEngine::Blob::Ptr _kept_boxes;
     InferenceEngine::Blob::Ptr _bbox_sizes;
     InferenceEngine::Blob::Ptr _num_priors_actual;
+    InferenceEngine::Blob::Ptr _top_k_candidates;
 };
 
-struct ConfidenceComparator {
-    explicit ConfidenceComparator(const float* conf_data) : _conf_data(conf_data) {}
+// Compares prior indices of the confidences of one class stored as [prior, class]. The name differs from
+// ConfidenceComparator of the ONNX DetectionOutput, both are linked into the same library
+struct StridedConfidenceComparator {
+    StridedConfidenceComparator(const float* conf_data, int stride) : _conf_data(conf_data), _stride(stride) {}
 
     bool operator()(int idx1, int idx2) {
-        if (_conf_data[idx1] > _conf_data[idx2]) return true;
-        if (_conf_data[idx1] < _conf_data[idx2]) return false;
+        if (_conf_data[idx1*_stride] > _conf_data[idx2*_stride]) return true;
+        if (_conf_data[idx1*_stride] < _conf_data[idx2*_stride]) return false;
         return idx1 < idx2;
     }
 
     const float* _conf_data;
+    const int _stride;
+};
+
+// Compares indices class*num_priors + prior of the confidences stored as [prior, class]
+struct ClassConfidenceComparator {
+    ClassConfidenceComparator(const float* conf_data, int num_classes, int num_priors)
+            : _conf_data(conf_data), _num_classes(num_classes), _num_priors(num_priors) {}
+
+    bool operator()(int idx1, int idx2) {
+        const float conf1 = confidence(idx1);
+        const float conf2 = confidence(idx2);
+        if (conf1 > conf2) return true;
+        if (conf1 < conf2) return false;
+        return idx1 < idx2;
+    }
+
+    float confidence(int idx) const {
+        return _conf_data[(idx % _num_priors)*_num_classes + idx / _num_priors];
+    }
+
+    const float* _conf_data;
+    const int _num_classes;
+    const int _num_priors;
 };
 
 static inline float JaccardOverlap(const float *decoded_bbox,
@@ -511,40 +553,130 @@ void DetectionOutputImpl::decodeBBoxes(const float *prior_data,
     });
 }
 
+void DetectionOutputImpl::filterConfidences(const float* conf_data,
+                                            int* indices,
+                                            int* counts,
+                                            int class_start,
+                                            int class_end,
+                                            int num_priors_actual) {
+    for (int c = class_start; c < class_end; ++c) {
+        counts[c] = 0;
+    }
+
+    auto add_candidate = [&](int c, int p) {
+        if (c != _background_label_id) {
+            indices[c*_num_priors + counts[c]++] = p;
+        }
+    };
+
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    const vec_type_f vthreshold = _mm_uni_set1_ps(_confidence_threshold);
+#endif
+    // rows of the confidences are scanned in memory order, each row holds all the classes of a prior
+    for (int p = 0; p < num_priors_actual; ++p) {
+        const float *pconf = conf_data + p*_num_classes;
+        int c = class_start;
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+        for (; c + block_size <= class_end; c += block_size) {
+#if defined(HAVE_AVX512F)
+            unsigned int mask = _mm_uni_cmpgt_ps(_mm_uni_loadu_ps(pconf + c), vthreshold);
+#else
+            unsigned int mask = _mm_uni_movemask_ps(_mm_uni_cmpgt_ps(_mm_uni_loadu_ps(pconf + c), vthreshold));
+#endif
+            for (int i = 0; mask; ++i, mask >>= 1) {
+                if (mask & 1) {
+                    add_candidate(c + i, p);
+                }
+            }
+        }
+#endif
+        for (; c < class_end; ++c) {
+            if (pconf[c] > _confidence_threshold) {
+                add_candidate(c, p);
+            }
+        }
+    }
+}
+
 void DetectionOutputImpl::nms_cf(const float* conf_data,
                           const float* bboxes,
                           const float* sizes,
                           int* buffer,
                           int* indices,
                           int& detections,
-                          int num_priors_actual) {
-    int count = 0;
-    for (int i = 0; i < num_priors_actual; ++i) {
-        if (conf_data[i] > _confidence_threshold) {
-            indices[count] = i;
-            count++;
-        }
-    }
+                          float* kept_boxes) {
+    // the candidates are passed in indices[0, detections), confidences are strided by the number of classes
+    const int count = detections;
+    detections = 0;
 
     int num_output_scores = (_top_k == -1 ? count : std::min<int>(_top_k, count));
 
     std::partial_sort_copy(indices, indices + count,
                            buffer, buffer + num_output_scores,
-                           ConfidenceComparator(conf_data));
+                           StridedConfidenceComparator(conf_data, _num_classes));
+
+    // the kept boxes are copied to planes so that a candidate is compared with a vector of them at once
+    float *kept_xmin = kept_boxes;
+    float *kept_ymin = kept_boxes + _num_priors;
+    float *kept_xmax = kept_boxes + 2*_num_priors;
+    float *kept_ymax = kept_boxes + 3*_num_priors;
+    float *kept_size = kept_boxes + 4*_num_priors;
 
     for (int i = 0; i < num_output_scores; ++i) {
         const int idx = buffer[i];
+        const float xmin = bboxes[idx*4 + 0];
+        const float ymin = bboxes[idx*4 + 1];
+        const float xmax = bboxes[idx*4 + 2];
+        const float ymax = bboxes[idx*4 + 3];
+        const float size = sizes[idx];
 
         bool keep = true;
-        for (int k = 0; k < detections; ++k) {
-            const int kept_idx = indices[k];
-            float overlap = JaccardOverlap(bboxes, sizes, idx, kept_idx);
-            if (overlap > _nms_threshold) {
-                keep = false;
-                break;
+        int k = 0;
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+        const vec_type_f vxmin = _mm_uni_set1_ps(xmin);
+        const vec_type_f vymin = _mm_uni_set1_ps(ymin);
+        const vec_type_f vxmax = _mm_uni_set1_ps(xmax);
+        const vec_type_f vymax = _mm_uni_set1_ps(ymax);
+        const vec_type_f vsize = _mm_uni_set1_ps(size);
+        const vec_type_f vzero = _mm_uni_setzero_ps();
+        const vec_type_f vthreshold = _mm_uni_set1_ps(_nms_threshold);
+        for (; keep && k + block_size <= detections; k += block_size) {
+            vec_type_f vwidth = _mm_uni_sub_ps(_mm_uni_min_ps(vxmax, _mm_uni_loadu_ps(kept_xmax + k)),
+                                               _mm_uni_max_ps(vxmin, _mm_uni_loadu_ps(kept_xmin + k)));
+            vec_type_f vheight = _mm_uni_sub_ps(_mm_uni_min_ps(vymax, _mm_uni_loadu_ps(kept_ymax + k)),
+                                                _mm_uni_max_ps(vymin, _mm_uni_loadu_ps(kept_ymin + k)));
+            vec_type_f vintersect = _mm_uni_mul_ps(vwidth, vheight);
+            vec_type_f voverlap = _mm_uni_div_ps(vintersect,
+                    _mm_uni_sub_ps(_mm_uni_add_ps(vsize, _mm_uni_loadu_ps(kept_size + k)), vintersect));
+            // same as JaccardOverlap: boxes which do not intersect have zero overlap
+#if defined(HAVE_AVX512F)
+            vmask_type vintersects = _mm_uni_cmpgt_ps(vwidth, vzero) & _mm_uni_cmpgt_ps(vheight, vzero);
+            voverlap = _mm_uni_blendv_ps(vzero, voverlap, vintersects);
+            keep = _mm_uni_cmpgt_ps(voverlap, vthreshold) == 0;
+#else
+            vmask_type vintersects = _mm_uni_and_ps(_mm_uni_cmpgt_ps(vwidth, vzero), _mm_uni_cmpgt_ps(vheight, vzero));
+            voverlap = _mm_uni_and_ps(vintersects, voverlap);
+            keep = _mm_uni_movemask_ps(_mm_uni_cmpgt_ps(voverlap, vthreshold)) == 0;
+#endif
+        }
+#endif
+        for (; keep && k < detections; ++k) {
+            float intersect_width  = std::min(xmax, kept_xmax[k]) - std::max(xmin, kept_xmin[k]);
+            float intersect_height = std::min(ymax, kept_ymax[k]) - std::max(ymin, kept_ymin[k]);
+            float overlap = 0.0f;
+            if (intersect_width > 0 && intersect_height > 0) {
+                float intersect_size = intersect_width * intersect_height;
+                overlap = intersect_size / (size + kept_size[k] - intersect_size);
             }
+            keep = !(overlap > _nms_threshold);
         }
+
         if (keep) {
+            kept_xmin[detections] = xmin;
+            kept_ymin[detections] = ymin;
+            kept_xmax[detections] = xmax;
+            kept_ymax[detections] = ymax;
+            kept_size[detections] = size;
             indices[detections] = idx;
             detections++;
         }
@@ -560,10 +692,11 @@ void DetectionOutputImpl::nms_mx(const float* conf_data,
                           int num_priors_actual) {
     int count = 0;
     for (int i = 0; i < num_priors_actual; ++i) {
+        const float *pconf = conf_data + i*_num_classes;
         float conf = -1;
         int id = 0;
         for (int c = 1; c < _num_classes; ++c) {
-            float temp = conf_data[c*_num_priors + i];
+            float temp = pconf[c];
             if (temp > conf) {
                 conf = temp;
                 id = c;
@@ -579,7 +712,7 @@ void DetectionOutputImpl::nms_mx(const float* conf_data,
 
     std::partial_sort_copy(indices, indices + count,
                            buffer, buffer + num_output_scores,
-                           ConfidenceComparator(conf_data));
+                           ClassConfidenceComparator(conf_data, _num_classes, _num_priors));
 
     for (int i = 0; i < num_output_scores; ++i) {
         const int idx = buffer[i];
@@ -604,6 +737,47 @@ void DetectionOutputImpl::nms_mx(const float* conf_data,
     }
 }
 
+void DetectionOutputImpl::keepTopK(const float* conf_data,
+                                   int* indices,
+                                   int* detections,
+                                   int* candidates) {
+    int detections_total = 0;
+    for (int c = 0; c < _num_classes; ++c) {
+        detections_total += detections[c];
+    }
+    if (detections_total <= _keep_top_k) {
+        return;
+    }
+
+    int *candidates_end = candidates;
+    for (int c = 0; c < _num_classes; ++c) {
+        const int *pindices = indices + c*_num_priors;
+        for (int i = 0; i < detections[c]; ++i) {
+            *candidates_end++ = c*_num_priors + pindices[i];
+        }
+    }
+
+    // detections are ordered by score descending, then by class and prior,
+    // so equal scores at the keep_top_k cut don't depend on the order of selection
+    auto higher = [&](int a, int b) {
+        const float score_a = conf_data[(a % _num_priors)*_num_classes + a / _num_priors];
+        const float score_b = conf_data[(b % _num_priors)*_num_classes + b / _num_priors];
+        return score_a > score_b || (score_a == score_b && a < b);
+    };
+    std::nth_element(candidates, candidates + _keep_top_k, candidates_end, higher);
+    std::sort(candidates, candidates + _keep_top_k, higher);
+
+    // Store the new indices.
+    memset(detections, 0, _num_classes * sizeof(int));
+
+    for (int j = 0; j < _keep_top_k; ++j) {
+        int label = candidates[j] / _num_priors;
+        int idx = candidates[j] % _num_priors;
+        indices[label*_num_priors + detections[label]] = idx;
+        detections[label]++;
+    }
+}
+
 REG_FACTORY_FOR(ImplFactory<DetectionOutputImpl>, DetectionOutput);
 
 }  // namespace Cpu
@@ -4,6 +4,7 @@
 
 #include "ext_list.hpp"
 #include "ext_base.hpp"
+#include "ie_parallel.hpp"
 
 #include <algorithm>
 #include <string>
@@ -37,7 +38,24 @@ public:
             channel_shared = layer->GetParamAsBool("channel_shared", false);
             eps = layer->GetParamAsFloat("eps");
 
-            addConfig(layer, {{ConfLayout::PLN, false, 0}}, {{ConfLayout::PLN, false, 0}}, true);
+            const auto& data = layer->insData[0].lock();
+            if (data->getPrecision() == Precision::U8 || data->getPrecision() == Precision::I8) {
+                // int8 data is read as is (channels last for 4D), the output is FP32
+                if (layer->outData[0]->getPrecision() != Precision::FP32)
+                    THROW_IE_EXCEPTION << layer->name << " supports only FP32 output!";
+                addConfig(layer, {{ConfLayout::PLN, false, -1}}, {{ConfLayout::PLN, false, -1}}, true);
+            } else {
+                addConfig(layer, {{ConfLayout::PLN, false, 0}}, {{ConfLayout::PLN, false, 0}}, true);
+                // the layout of the convolutions Normalize usually follows, so no reorders are needed around it
+                if (data->getTensorDesc().getDims().size() == 4) {
+#if defined(HAVE_AVX512F)
+                    auto blk_layout = ConfLayout::BLK16;
+#else
+                    auto blk_layout = ConfLayout::BLK8;
+#endif
+                    addConfig(layer, {{blk_layout, false, 0}}, {{blk_layout, false, 0}}, true);
+                }
+            }
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
@@ -74,17 +92,34 @@ public:
             }
             return GENERAL_ERROR;
         }
-        const float* src = inputs[0]->buffer();
         const float* scl = weights->buffer();
         float* dst = outputs[0]->buffer();
 
-        SizeVector dims = inputs[0]->getTensorDesc().getDims();
+        const TensorDesc& srcDesc = inputs[0]->getTensorDesc();
+        SizeVector dims = srcDesc.getDims();
 
         const int N = static_cast<const int>(dims[0]);
         const int C = static_cast<int>(dims[1]);
         const int H = static_cast<int>(dims.size() > 2 ? dims[2] : 1);
         const int W = static_cast<int>(dims.size() > 3 ? dims[3] : 1);
 
+        if (srcDesc.getPrecision() == Precision::U8) {
+            normalize_int8(inputs[0]->cbuffer().as<const uint8_t *>(), dst, scl, N, C, H, W,
+                           srcDesc.getLayout() == NHWC);
+            return OK;
+        }
+        if (srcDesc.getPrecision() == Precision::I8) {
+            normalize_int8(inputs[0]->cbuffer().as<const int8_t *>(), dst, scl, N, C, H, W,
+                           srcDesc.getLayout() == NHWC);
+            return OK;
+        }
+
+        const float* src = inputs[0]->buffer();
+        if (srcDesc.getBlockingDesc().getBlockDims().size() > dims.size()) {
+            normalize_blk(src, dst, scl, N, C, H, W, static_cast<int>(srcDesc.getBlockingDesc().getBlockDims().back()));
+            return OK;
+        }
+
         for (int n = 0; n < N; n++) {
             const float* psrc = src + n*C*H*W;
             float* pdst = dst + n*C*H*W;
@@ -215,6 +250,97 @@ public:
     }
 
 private:
+    // nChw8c or nChw16c, the output has the same layout and may share the memory with the input
+    void normalize_blk(const float* src, float* dst, const float* scl, int N, int C, int H, int W, int blk) {
+        const int CB = (C + blk - 1) / blk;
+        const int HW = H*W;
+
+        for (int n = 0; n < N; n++) {
+            const float* psrc = src + n*CB*HW*blk;
+            float* pdst = dst + n*CB*HW*blk;
+
+            if (across_spatial) {
+                float norm = eps;
+                for (int cb = 0; cb < CB; cb++) {
+                    const float* psrc_cb = psrc + cb*HW*blk;
+                    const int tail = std::min(blk, C - cb*blk);
+                    for (int hw = 0; hw < HW; hw++) {
+                        for (int b = 0; b < tail; b++)
+                            norm += psrc_cb[hw*blk + b]*psrc_cb[hw*blk + b];
+                    }
+                }
+                norm = 1.0f / std::sqrt(norm);
+
+                parallel_for2d(CB, HW, [&](int cb, int hw) {
+                    const float* psrc_b = psrc + (cb*HW + hw)*blk;
+                    float* pdst_b = pdst + (cb*HW + hw)*blk;
+                    const int tail = std::min(blk, C - cb*blk);
+                    for (int b = 0; b < tail; b++)
+                        pdst_b[b] = psrc_b[b] * norm * (channel_shared ? scl[0] : scl[cb*blk + b]);
+                });
+            } else {
+                parallel_for(HW, [&](int hw) {
+                    float norm = eps;
+                    for (int cb = 0; cb < CB; cb++) {
+                        const float* psrc_b = psrc + (cb*HW + hw)*blk;
+                        const int tail = std::min(blk, C - cb*blk);
+                        for (int b = 0; b < tail; b++)
+                            norm += psrc_b[b]*psrc_b[b];
+                    }
+                    norm = 1.0f / std::sqrt(norm);
+
+                    for (int cb = 0; cb < CB; cb++) {
+                        const float* psrc_b = psrc + (cb*HW + hw)*blk;
+                        float* pdst_b = pdst + (cb*HW + hw)*blk;
+                        const int tail = std::min(blk, C - cb*blk);
+                        for (int b = 0; b < tail; b++)
+                            pdst_b[b] = psrc_b[b] * norm * (channel_shared ? scl[0] : scl[cb*blk + b]);
+                    }
+                });
+            }
+        }
+    }
+
+    // U8 or I8 input (nhwc for 4D, plain otherwise) and FP32 plain output
+    template <typename data_t>
+    void normalize_int8(const data_t* src, float* dst, const float* scl, int N, int C, int H, int W, bool nhwc) {
+        const int HW = H*W;
+        const int c_stride = nhwc ? 1 : HW;
+        const int hw_stride = nhwc ? C : 1;
+
+        for (int n = 0; n < N; n++) {
+            const data_t* psrc = src + n*C*HW;
+            float* pdst = dst + n*C*HW;
+
+            if (across_spatial) {
+                float norm = eps;
+                for (int i = 0; i < C*HW; i++)
+                    norm += static_cast<float>(psrc[i])*static_cast<float>(psrc[i]);
+                norm = 1.0f / std::sqrt(norm);
+
+                parallel_for(C, [&](int c) {
+                    const float s = norm * (channel_shared ? scl[0] : scl[c]);
+                    for (int hw = 0; hw < HW; hw++)
+                        pdst[c*HW + hw] = static_cast<float>(psrc[c*c_stride + hw*hw_stride]) * s;
+                });
+            } else {
+                parallel_for(HW, [&](int hw) {
+                    float norm = eps;
+                    for (int c = 0; c < C; c++) {
+                        const float v = static_cast<float>(psrc[c*c_stride + hw*hw_stride]);
+                        norm += v*v;
+                    }
+                    norm = 1.0f / std::sqrt(norm);
+
+                    for (int c = 0; c < C; c++) {
+                        const float s = channel_shared ? scl[0] : scl[c];
+                        pdst[c*HW + hw] = static_cast<float>(psrc[c*c_stride + hw*hw_stride]) * norm * s;
+                    }
+                });
+            }
+        }
+    }
+
     TBlob<float>::Ptr weights;
 
     bool across_spatial = true;
@@ -31,6 +31,15 @@ public:
             mask = layer->GetParamAsInts("mask", {});
 
             addConfig(layer, {DataConfigurator(ConfLayout::PLN)}, {DataConfigurator(ConfLayout::PLN)});
+            // the input is converted from the layout of the convolution while it's copied to the output
+            if (layer->insData[0].lock()->getTensorDesc().getDims().size() == 4) {
+#if defined(HAVE_AVX512F)
+                auto blk_layout = ConfLayout::BLK16;
+#else
+                auto blk_layout = ConfLayout::BLK8;
+#endif
+                addConfig(layer, {DataConfigurator(blk_layout)}, {DataConfigurator(ConfLayout::PLN)});
+            }
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
@@ -48,9 +57,21 @@ public:
         int IC = (inputs[0]->getTensorDesc().getDims().size() > 1) ? inputs[0]->getTensorDesc().getDims()[1] : 1;
         int B = (inputs[0]->getTensorDesc().getDims().size() > 0) ? inputs[0]->getTensorDesc().getDims()[0] : 1;
 
-        parallel_for(B * IC * IH * IW, [&](int i) {
-            dst_data[i] = src_data[i];
-        });
+        const BlockingDesc& srcBlocking = inputs[0]->getTensorDesc().getBlockingDesc();
+        if (srcBlocking.getBlockDims().size() > inputs[0]->getTensorDesc().getDims().size()) {
+            const int blk = static_cast<int>(srcBlocking.getBlockDims().back());
+            const int ICB = (IC + blk - 1) / blk;
+            parallel_for2d(B, IC, [&](int b, int c) {
+                const float *psrc = src_data + ((b * ICB + c / blk) * IH * IW) * blk + c % blk;
+                float *pdst = dst_data + (b * IC + c) * IH * IW;
+                for (int i = 0; i < IH * IW; i++)
+                    pdst[i] = psrc[i * blk];
+            });
+        } else {
+            parallel_for(B * IC * IH * IW, [&](int i) {
+                dst_data[i] = src_data[i];
+            });
+        }
 
         int end_index = 0;
         int num_ = 0;
@@ -97,11 +118,12 @@ public:
             }
         }
 
+        // the classes are still copied as is, softmax reads them from the output as it's in the plain layout
         if (do_softmax) {
             int index = IW * IH * (coords + 1);
             int batch_offset = inputs_size / num;
             for (int b = 0; b < B * num; b++)
-                softmax_generic(src_data + index + b * batch_offset, dst_data + index + b * batch_offset, 1, classes,
+                softmax_generic(dst_data + index + b * batch_offset, dst_data + index + b * batch_offset, 1, classes,
                                 IH, IW);
         }
 
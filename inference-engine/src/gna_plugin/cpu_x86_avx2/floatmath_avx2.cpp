@@ -0,0 +1,127 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "floatmath_avx2.hpp"
+
+#include <immintrin.h>
+#include <algorithm>
+
+namespace GNAPluginNS {
+namespace avx2 {
+
+// after the call r[k] holds the k-th column of the 8x8 block which rows were in r[]
+static inline void transpose8x8(__m256 r[8]) {
+    __m256 t0 = _mm256_unpacklo_ps(r[0], r[1]);
+    __m256 t1 = _mm256_unpackhi_ps(r[0], r[1]);
+    __m256 t2 = _mm256_unpacklo_ps(r[2], r[3]);
+    __m256 t3 = _mm256_unpackhi_ps(r[2], r[3]);
+    __m256 t4 = _mm256_unpacklo_ps(r[4], r[5]);
+    __m256 t5 = _mm256_unpackhi_ps(r[4], r[5]);
+    __m256 t6 = _mm256_unpacklo_ps(r[6], r[7]);
+    __m256 t7 = _mm256_unpackhi_ps(r[6], r[7]);
+
+    __m256 s0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+    __m256 s1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+    __m256 s2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+    __m256 s3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+    __m256 s4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+    __m256 s5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+    __m256 s6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+    __m256 s7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+
+    r[0] = _mm256_permute2f128_ps(s0, s4, 0x20);
+    r[1] = _mm256_permute2f128_ps(s1, s5, 0x20);
+    r[2] = _mm256_permute2f128_ps(s2, s6, 0x20);
+    r[3] = _mm256_permute2f128_ps(s3, s7, 0x20);
+    r[4] = _mm256_permute2f128_ps(s0, s4, 0x31);
+    r[5] = _mm256_permute2f128_ps(s1, s5, 0x31);
+    r[6] = _mm256_permute2f128_ps(s2, s6, 0x31);
+    r[7] = _mm256_permute2f128_ps(s3, s7, 0x31);
+}
+
+void sgemm_rows(const float *const *A, const float *B, int ldb, int N, int K,
+                float *const *C, bool accumulate) {
+    // accumulators of 4 output columns and 8 columns of A stay in registers
+    constexpr int cols_block = 4;
+    alignas(32) float tmp[sgemm_rows_block];
+
+    for (int j0 = 0; j0 < N; j0 += cols_block) {
+        const int cols = std::min(cols_block, N - j0);
+
+        __m256 acc[cols_block];
+        for (int j = 0; j < cols; j++) {
+            for (int r = 0; r < sgemm_rows_block; r++)
+                tmp[r] = accumulate ? C[r][j0 + j] : 0.f;
+            acc[j] = _mm256_load_ps(tmp);
+        }
+
+        int k = 0;
+        for (; k + 8 <= K; k += 8) {
+            __m256 a[8];
+            for (int r = 0; r < 8; r++)
+                a[r] = _mm256_loadu_ps(A[r] + k);
+            transpose8x8(a);
+
+            for (int kk = 0; kk < 8; kk++) {
+                const float *b = B + (k + kk) * ldb + j0;
+                for (int j = 0; j < cols; j++)
+                    acc[j] = _mm256_add_ps(acc[j], _mm256_mul_ps(a[kk], _mm256_set1_ps(b[j])));
+            }
+        }
+        for (; k < K; k++) {
+            for (int r = 0; r < sgemm_rows_block; r++)
+                tmp[r] = A[r][k];
+            __m256 a = _mm256_load_ps(tmp);
+
+            const float *b = B + k * ldb + j0;
+            for (int j = 0; j < cols; j++)
+                acc[j] = _mm256_add_ps(acc[j], _mm256_mul_ps(a, _mm256_set1_ps(b[j])));
+        }
+
+        for (int j = 0; j < cols; j++) {
+            _mm256_store_ps(tmp, acc[j]);
+            for (int r = 0; r < sgemm_rows_block; r++)
+                C[r][j0 + j] = tmp[r];
+        }
+    }
+}
+
+void vmadd(int N, const float *A, const float *X, float *Y) {
+    int i = 0;
+    for (; i + 8 <= N; i += 8) {
+        __m256 y = _mm256_add_ps(_mm256_loadu_ps(Y + i), _mm256_mul_ps(_mm256_loadu_ps(A + i), _mm256_loadu_ps(X + i)));
+        _mm256_storeu_ps(Y + i, y);
+    }
+    for (; i < N; i++)
+        Y[i] += A[i] * X[i];
+}
+
+void relu(int N, const float *in, float *out, float negative_slope) {
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 slope = _mm256_set1_ps(negative_slope);
+    int i = 0;
+    for (; i + 8 <= N; i += 8) {
+        __m256 x = _mm256_loadu_ps(in + i);
+        __m256 negative = _mm256_cmp_ps(x, zero, _CMP_LT_OQ);
+        _mm256_storeu_ps(out + i, _mm256_blendv_ps(x, _mm256_mul_ps(x, slope), negative));
+    }
+    for (; i < N; i++)
+        out[i] = (in[i] < 0.0f) ? in[i] * negative_slope : in[i];
+}
+
+void clip(int N, const float *in, float *out, float lower, float upper) {
+    const __m256 lo = _mm256_set1_ps(lower);
+    const __m256 hi = _mm256_set1_ps(upper);
+    int i = 0;
+    for (; i + 8 <= N; i += 8) {
+        // NB: min/max return the second operand if any of them is NaN, so NaN passes through as in the reference
+        __m256 x = _mm256_loadu_ps(in + i);
+        _mm256_storeu_ps(out + i, _mm256_max_ps(lo, _mm256_min_ps(hi, x)));
+    }
+    for (; i < N; i++)
+        out[i] = in[i] > upper ? upper : (in[i] < lower ? lower : in[i]);
+}
+
+}  // namespace avx2
+}  // namespace GNAPluginNS
@@ -0,0 +1,267 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "intmath_avx2.hpp"
+#include "pwl.h"
+
+#include <immintrin.h>
+#include <algorithm>
+#include <bitset>
+#include <limits>
+
+namespace GNAPluginNS {
+namespace avx2 {
+
+static inline int64_t hsum_epi64(__m256i v) {
+    __m128i s = _mm_add_epi64(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+    return _mm_cvtsi128_si64(s) + _mm_extract_epi64(s, 1);
+}
+
+static inline __m256i add_epi32_to_epi64(__m256i acc, __m256i v) {
+    return _mm256_add_epi64(acc, _mm256_add_epi64(_mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)),
+                                                  _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1))));
+}
+
+// a + b saturated to the int32 range
+static inline __m256i adds_epi32(__m256i a, __m256i b) {
+    const __m256i sum = _mm256_add_epi32(a, b);
+    // overflow happens only if the operands have the same sign and the sum has another one
+    const __m256i overflow = _mm256_andnot_si256(_mm256_xor_si256(a, b), _mm256_xor_si256(a, sum));
+    const __m256i limit = _mm256_xor_si256(_mm256_srai_epi32(a, 31), _mm256_set1_epi32(std::numeric_limits<int32_t>::max()));
+    return _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(sum), _mm256_castsi256_ps(limit),
+                                                _mm256_castsi256_ps(overflow)));
+}
+
+int64_t dot16(const int16_t *a, const int16_t *b, int K) {
+    // pmaddwd overflows only if all four operands of a pair are -32768: it returns INT32_MIN instead of 2^31.
+    // Any pair decreased by one fits int32 though, so pairs are accumulated minus one and corrected in the end.
+    const __m256i one = _mm256_set1_epi32(1);
+    __m256i acc0 = _mm256_setzero_si256();
+    __m256i acc1 = _mm256_setzero_si256();
+    int k = 0;
+    for (; k + 32 <= K; k += 32) {
+        __m256i p0 = _mm256_madd_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + k)),
+                                       _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + k)));
+        __m256i p1 = _mm256_madd_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + k + 16)),
+                                       _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + k + 16)));
+        acc0 = add_epi32_to_epi64(acc0, _mm256_sub_epi32(p0, one));
+        acc1 = add_epi32_to_epi64(acc1, _mm256_sub_epi32(p1, one));
+    }
+    for (; k + 16 <= K; k += 16) {
+        __m256i p = _mm256_madd_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + k)),
+                                      _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + k)));
+        acc0 = add_epi32_to_epi64(acc0, _mm256_sub_epi32(p, one));
+    }
+
+    // every 16 elements contributed 8 pairs
+    int64_t sum = hsum_epi64(_mm256_add_epi64(acc0, acc1)) + k / 2;
+    for (; k < K; k++) {
+        sum += static_cast<int32_t>(a[k]) * b[k];
+    }
+    return sum;
+}
+
+int64_t dot8(const int8_t *a, const int16_t *b, int K) {
+    // a pair of int8 x int16 products is below 2^23 by magnitude, so 255 of them can be summed in int32
+    constexpr int block = 255 * 16;
+    __m256i acc64 = _mm256_setzero_si256();
+    int k = 0;
+    while (k + 16 <= K) {
+        const int end = k + std::min(block, (K - k) / 16 * 16);
+        __m256i acc32 = _mm256_setzero_si256();
+        for (; k < end; k += 16) {
+            __m256i w = _mm256_cvtepi8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(a + k)));
+            __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + k));
+            acc32 = _mm256_add_epi32(acc32, _mm256_madd_epi16(w, x));
+        }
+        acc64 = add_epi32_to_epi64(acc64, acc32);
+    }
+
+    int64_t sum = hsum_epi64(acc64);
+    for (; k < K; k++) {
+        sum += static_cast<int32_t>(a[k]) * b[k];
+    }
+    return sum;
+}
+
+void sbmv16(int N, const int16_t *a, const int16_t *x, int32_t *y) {
+    int i = 0;
+    for (; i + 8 <= N; i += 8) {
+        // |a * x| <= 2^30, so the product itself fits int32
+        __m256i av = _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i)));
+        __m256i xv = _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(x + i)));
+        __m256i yv = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(y + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(y + i), adds_epi32(yv, _mm256_mullo_epi32(av, xv)));
+    }
+    for (; i < N; i++) {
+        int64_t sum = static_cast<int64_t>(y[i]) + static_cast<int32_t>(a[i]) * x[i];
+        y[i] = static_cast<int32_t>(std::min<int64_t>(std::max<int64_t>(sum, std::numeric_limits<int32_t>::min()),
+                                                      std::numeric_limits<int32_t>::max()));
+    }
+}
+
+void sbmv8(int N, const int8_t *a, const intel_compound_bias_t *bias, const int16_t *x, int32_t *y) {
+    static_assert(sizeof(intel_compound_bias_t) == 2 * sizeof(int32_t), "unexpected layout of the compound bias");
+    const __m256i even = _mm256_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14);
+    const __m256i low_byte = _mm256_set1_epi32(0xFF);
+    const int32_t *b = reinterpret_cast<const int32_t *>(bias);
+    int i = 0;
+    for (; i + 8 <= N; i += 8) {
+        // |multiplier * a * x| < 255 * 128 * 32768 < 2^31
+        __m256i bv = _mm256_i32gather_epi32(b + 2 * i, even, 4);
+        __m256i mv = _mm256_and_si256(_mm256_i32gather_epi32(b + 2 * i + 1, even, 4), low_byte);
+        __m256i av = _mm256_cvtepi8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(a + i)));
+        __m256i xv = _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(x + i)));
+        __m256i prod = _mm256_mullo_epi32(_mm256_mullo_epi32(av, mv), xv);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(y + i), adds_epi32(bv, prod));
+    }
+    for (; i < N; i++) {
+        int64_t sum = bias[i].bias + static_cast<int64_t>(bias[i].multiplier) * a[i] * x[i];
+        y[i] = static_cast<int32_t>(std::min<int64_t>(std::max<int64_t>(sum, std::numeric_limits<int32_t>::min()),
+                                                      std::numeric_limits<int32_t>::max()));
+    }
+}
+
+// x >> shift for signed 64-bit lanes, AVX2 has logical variable shifts only
+static inline __m256i srav_epi64(__m256i x, __m256i shift) {
+    const __m256i sign = _mm256_cmpgt_epi64(_mm256_setzero_si256(), x);
+    return _mm256_xor_si256(_mm256_srlv_epi64(_mm256_xor_si256(x, sign), shift), sign);
+}
+
+// ybase + ((diff * slope) >> shift) saturated to int16 for four 64-bit lanes;
+// diff is unsigned 32-bit, slope and ybase are sign-extended to 64 bits
+static inline __m256i pwl_segment_epi64(__m256i diff, __m256i slope, __m256i shift, __m256i ybase,
+                                        __m256i &saturated) {
+    const __m256i negative = _mm256_cmpgt_epi64(_mm256_setzero_si256(), slope);
+    const __m256i abs_slope = _mm256_sub_epi64(_mm256_xor_si256(slope, negative), negative);
+    __m256i prod = _mm256_mul_epu32(diff, abs_slope);
+    prod = _mm256_sub_epi64(_mm256_xor_si256(prod, negative), negative);
+    __m256i sum = _mm256_add_epi64(srav_epi64(prod, shift), ybase);
+
+    const __m256i max16 = _mm256_set1_epi64x(std::numeric_limits<int16_t>::max());
+    const __m256i min16 = _mm256_set1_epi64x(std::numeric_limits<int16_t>::min());
+    const __m256i above = _mm256_cmpgt_epi64(sum, max16);
+    const __m256i below = _mm256_cmpgt_epi64(min16, sum);
+    saturated = _mm256_or_si256(above, below);
+    sum = _mm256_blendv_epi8(sum, max16, above);
+    return _mm256_blendv_epi8(sum, min16, below);
+}
+
+uint32_t pwl16(int N, const int32_t *in, int16_t *out, const intel_pwl_segment_t *segments, uint32_t num_segments) {
+    static_assert(sizeof(intel_pwl_segment_t) == 2 * sizeof(int32_t), "unexpected layout of the PWL segment");
+    const int32_t *seg = reinterpret_cast<const int32_t *>(segments);
+    const __m256i xbase_mask = _mm256_set1_epi32(static_cast<int32_t>(XBASEMASK));
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256i xbase0 = _mm256_set1_epi32(static_cast<int32_t>(segments[0].xBase & XBASEMASK));
+    const __m256i ybase0 = _mm256_set1_epi32(segments[0].yBase);
+    // 64-bit lanes are low dwords of 32-bit ones
+    const __m256i pack_low = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+    const __m256i minus_one = _mm256_set1_epi32(-1);
+    uint32_t num_saturate = 0;
+
+    // GNA requires segments to be sorted, in which case the search is replaced by counting
+    bool ascending = num_segments <= PWL_MAX_NUM_SEGMENTS;
+    int32_t xbases[PWL_MAX_NUM_SEGMENTS];
+    for (uint32_t k = 0; ascending && k < num_segments; k++) {
+        xbases[k] = static_cast<int32_t>(segments[k].xBase & XBASEMASK);
+        ascending = k == 0 || xbases[k - 1] <= xbases[k];
+    }
+
+    int i = 0;
+    for (; i + 8 <= N; i += 8) {
+        const __m256i input = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + i));
+        const __m256i active = _mm256_cmpgt_epi32(input, xbase0);
+
+        __m256i lower = _mm256_setzero_si256();
+        if (ascending) {
+            // the bisection ends at the last segment which starts not after the input,
+            // for ascending segments it's the number of such segments besides the first one
+            for (uint32_t k = 1; k < num_segments; k++) {
+                const __m256i greater = _mm256_cmpgt_epi32(_mm256_set1_epi32(xbases[k]), input);
+                lower = _mm256_sub_epi32(lower, _mm256_andnot_si256(greater, minus_one));
+            }
+        } else {
+            // the same bisection as the reference does, lanes which interval is narrowed down stop moving
+            __m256i upper = _mm256_set1_epi32(num_segments);
+            for (;;) {
+                const __m256i searching = _mm256_cmpgt_epi32(_mm256_sub_epi32(upper, lower), one);
+                if (_mm256_testz_si256(searching, searching))
+                    break;
+                const __m256i k = _mm256_srli_epi32(_mm256_add_epi32(lower, upper), 1);
+                const __m256i xbase = _mm256_and_si256(_mm256_i32gather_epi32(seg, _mm256_slli_epi32(k, 1), 4),
+                                                       xbase_mask);
+                const __m256i greater = _mm256_cmpgt_epi32(xbase, input);
+                upper = _mm256_blendv_epi8(upper, k, _mm256_and_si256(searching, greater));
+                lower = _mm256_blendv_epi8(lower, k, _mm256_andnot_si256(greater, searching));
+            }
+        }
+
+        const __m256i index = _mm256_slli_epi32(lower, 1);
+        const __m256i xbase_raw = _mm256_i32gather_epi32(seg, index, 4);
+        const __m256i yslope = _mm256_i32gather_epi32(seg + 1, index, 4);
+        const __m256i diff = _mm256_sub_epi32(input, _mm256_and_si256(xbase_raw, xbase_mask));
+        const __m256i shift = _mm256_slli_epi32(_mm256_add_epi32(_mm256_andnot_si256(xbase_mask, xbase_raw), one), 3);
+        const __m256i ybase = _mm256_srai_epi32(_mm256_slli_epi32(yslope, 16), 16);
+        const __m256i slope = _mm256_srai_epi32(yslope, 16);
+
+        __m256i saturated_lo, saturated_hi;
+        const __m256i lo = pwl_segment_epi64(_mm256_cvtepu32_epi64(_mm256_castsi256_si128(diff)),
+                                             _mm256_cvtepi32_epi64(_mm256_castsi256_si128(slope)),
+                                             _mm256_cvtepu32_epi64(_mm256_castsi256_si128(shift)),
+                                             _mm256_cvtepi32_epi64(_mm256_castsi256_si128(ybase)), saturated_lo);
+        const __m256i hi = pwl_segment_epi64(_mm256_cvtepu32_epi64(_mm256_extracti128_si256(diff, 1)),
+                                             _mm256_cvtepi32_epi64(_mm256_extracti128_si256(slope, 1)),
+                                             _mm256_cvtepu32_epi64(_mm256_extracti128_si256(shift, 1)),
+                                             _mm256_cvtepi32_epi64(_mm256_extracti128_si256(ybase, 1)), saturated_hi);
+
+        const __m256i result = _mm256_permute2x128_si256(_mm256_permutevar8x32_epi32(lo, pack_low),
+                                                         _mm256_permutevar8x32_epi32(hi, pack_low), 0x20);
+        const __m256i saturated = _mm256_permute2x128_si256(_mm256_permutevar8x32_epi32(saturated_lo, pack_low),
+                                                            _mm256_permutevar8x32_epi32(saturated_hi, pack_low), 0x20);
+        const __m256i output = _mm256_blendv_epi8(ybase0, result, active);
+        num_saturate += std::bitset<8>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_and_si256(saturated, active)))).count();
+
+        const __m256i packed = _mm256_packs_epi32(output, output);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i),
+                         _mm256_castsi256_si128(_mm256_permute4x64_epi64(packed, _MM_SHUFFLE(3, 1, 2, 0))));
+    }
+
+    for (; i < N; i++) {
+        int32_t xbase = (int32_t) (segments[0].xBase & XBASEMASK);
+        int32_t input = in[i];
+        if (input <= xbase) {
+            out[i] = segments[0].yBase;
+            continue;
+        }
+        uint32_t k = num_segments / 2;
+        uint32_t k_upper = num_segments;
+        uint32_t k_lower = 0;
+        while (k_upper > k_lower + 1) {
+            xbase = (int32_t) (segments[k].xBase & XBASEMASK);
+            if (xbase > input) {
+                k_upper = k;
+                k = (k + k_lower) / 2;
+            } else {
+                k_lower = k;
+                k = (k_upper + k) / 2;
+            }
+        }
+        xbase = (int32_t) (segments[k].xBase & XBASEMASK);
+        uint32_t slope_shift = ((segments[k].xBase & ~XBASEMASK) + 1) * 8;
+        int64_t sum = (((int64_t) input - (int64_t) xbase) * segments[k].slope >> slope_shift) + segments[k].yBase;
+        if (sum > 32767LL) {
+            out[i] = 32767;
+            num_saturate++;
+        } else if (sum < -32768LL) {
+            out[i] = -32768;
+            num_saturate++;
+        } else {
+            out[i] = (int16_t) sum;
+        }
+    }
+    return num_saturate;
+}
+
+}  // namespace avx2
+}  // namespace GNAPluginNS
@@ -0,0 +1,36 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <stdint.h>
+#include "gna-api.h"
+
+namespace GNAPluginNS {
+namespace avx2 {
+
+//------------------------------------------------------------------------
+//
+// Integer math of the quantized GNA emulation manually vectored for AVX2 (w/o threads).
+// Results are bit-exact with the reference routines of intmath.cpp: a dot product is the exact sum
+// of one pass of the device, and the int32 saturation between passes stays in intmath.cpp.
+//
+//------------------------------------------------------------------------
+
+// sum(a[k] * b[k], k = 0..K-1) without overflow
+int64_t dot16(const int16_t *a, const int16_t *b, int K);
+int64_t dot8(const int8_t *a, const int16_t *b, int K);
+
+// y[i] = saturate(y[i] + a[i] * x[i])
+void sbmv16(int N, const int16_t *a, const int16_t *x, int32_t *y);
+
+// y[i] = saturate(bias[i].bias + bias[i].multiplier * a[i] * x[i])
+void sbmv8(int N, const int8_t *a, const intel_compound_bias_t *bias, const int16_t *x, int32_t *y);
+
+// GNA piecewise linear function of in[i], the segment is found with the same binary search as PwlApply16 does;
+// returns the number of saturated outputs
+uint32_t pwl16(int N, const int32_t *in, int16_t *out, const intel_pwl_segment_t *segments, uint32_t num_segments);
+
+}  // namespace avx2
+}  // namespace GNAPluginNS
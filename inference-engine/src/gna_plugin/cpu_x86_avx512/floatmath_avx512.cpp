@@ -0,0 +1,135 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "floatmath_avx512.hpp"
+
+#include <immintrin.h>
+#include <algorithm>
+
+namespace GNAPluginNS {
+namespace avx512 {
+
+// after the call r[k] holds the k-th column of the 8x8 block which rows were in r[]
+static inline void transpose8x8(__m256 r[8]) {
+    __m256 t0 = _mm256_unpacklo_ps(r[0], r[1]);
+    __m256 t1 = _mm256_unpackhi_ps(r[0], r[1]);
+    __m256 t2 = _mm256_unpacklo_ps(r[2], r[3]);
+    __m256 t3 = _mm256_unpackhi_ps(r[2], r[3]);
+    __m256 t4 = _mm256_unpacklo_ps(r[4], r[5]);
+    __m256 t5 = _mm256_unpackhi_ps(r[4], r[5]);
+    __m256 t6 = _mm256_unpacklo_ps(r[6], r[7]);
+    __m256 t7 = _mm256_unpackhi_ps(r[6], r[7]);
+
+    __m256 s0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+    __m256 s1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+    __m256 s2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+    __m256 s3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+    __m256 s4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+    __m256 s5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+    __m256 s6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+    __m256 s7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+
+    r[0] = _mm256_permute2f128_ps(s0, s4, 0x20);
+    r[1] = _mm256_permute2f128_ps(s1, s5, 0x20);
+    r[2] = _mm256_permute2f128_ps(s2, s6, 0x20);
+    r[3] = _mm256_permute2f128_ps(s3, s7, 0x20);
+    r[4] = _mm256_permute2f128_ps(s0, s4, 0x31);
+    r[5] = _mm256_permute2f128_ps(s1, s5, 0x31);
+    r[6] = _mm256_permute2f128_ps(s2, s6, 0x31);
+    r[7] = _mm256_permute2f128_ps(s3, s7, 0x31);
+}
+
+static inline __m512 concat(__m256 lo, __m256 hi) {
+    return _mm512_castpd_ps(_mm512_insertf64x4(_mm512_castpd256_pd512(_mm256_castps_pd(lo)), _mm256_castps_pd(hi), 1));
+}
+
+void sgemm_rows(const float *const *A, const float *B, int ldb, int N, int K,
+                float *const *C, bool accumulate) {
+    constexpr int cols_block = 4;
+    alignas(64) float tmp[sgemm_rows_block];
+
+    for (int j0 = 0; j0 < N; j0 += cols_block) {
+        const int cols = std::min(cols_block, N - j0);
+
+        __m512 acc[cols_block];
+        for (int j = 0; j < cols; j++) {
+            for (int r = 0; r < sgemm_rows_block; r++)
+                tmp[r] = accumulate ? C[r][j0 + j] : 0.f;
+            acc[j] = _mm512_load_ps(tmp);
+        }
+
+        int k = 0;
+        for (; k + 8 <= K; k += 8) {
+            // columns of the upper and the lower 8 rows are transposed separately and then joined
+            __m256 lo[8], hi[8];
+            for (int r = 0; r < 8; r++) {
+                lo[r] = _mm256_loadu_ps(A[r] + k);
+                hi[r] = _mm256_loadu_ps(A[r + 8] + k);
+            }
+            transpose8x8(lo);
+            transpose8x8(hi);
+
+            for (int kk = 0; kk < 8; kk++) {
+                const __m512 a = concat(lo[kk], hi[kk]);
+                const float *b = B + (k + kk) * ldb + j0;
+                for (int j = 0; j < cols; j++)
+                    acc[j] = _mm512_add_ps(acc[j], _mm512_mul_ps(a, _mm512_set1_ps(b[j])));
+            }
+        }
+        for (; k < K; k++) {
+            for (int r = 0; r < sgemm_rows_block; r++)
+                tmp[r] = A[r][k];
+            __m512 a = _mm512_load_ps(tmp);
+
+            const float *b = B + k * ldb + j0;
+            for (int j = 0; j < cols; j++)
+                acc[j] = _mm512_add_ps(acc[j], _mm512_mul_ps(a, _mm512_set1_ps(b[j])));
+        }
+
+        for (int j = 0; j < cols; j++) {
+            _mm512_store_ps(tmp, acc[j]);
+            for (int r = 0; r < sgemm_rows_block; r++)
+                C[r][j0 + j] = tmp[r];
+        }
+    }
+}
+
+void vmadd(int N, const float *A, const float *X, float *Y) {
+    int i = 0;
+    for (; i + 16 <= N; i += 16) {
+        __m512 y = _mm512_add_ps(_mm512_loadu_ps(Y + i), _mm512_mul_ps(_mm512_loadu_ps(A + i), _mm512_loadu_ps(X + i)));
+        _mm512_storeu_ps(Y + i, y);
+    }
+    for (; i < N; i++)
+        Y[i] += A[i] * X[i];
+}
+
+void relu(int N, const float *in, float *out, float negative_slope) {
+    const __m512 zero = _mm512_setzero_ps();
+    const __m512 slope = _mm512_set1_ps(negative_slope);
+    int i = 0;
+    for (; i + 16 <= N; i += 16) {
+        __m512 x = _mm512_loadu_ps(in + i);
+        __mmask16 negative = _mm512_cmp_ps_mask(x, zero, _CMP_LT_OQ);
+        _mm512_storeu_ps(out + i, _mm512_mask_mul_ps(x, negative, x, slope));
+    }
+    for (; i < N; i++)
+        out[i] = (in[i] < 0.0f) ? in[i] * negative_slope : in[i];
+}
+
+void clip(int N, const float *in, float *out, float lower, float upper) {
+    const __m512 lo = _mm512_set1_ps(lower);
+    const __m512 hi = _mm512_set1_ps(upper);
+    int i = 0;
+    for (; i + 16 <= N; i += 16) {
+        // NB: min/max return the second operand if any of them is NaN, so NaN passes through as in the reference
+        __m512 x = _mm512_loadu_ps(in + i);
+        _mm512_storeu_ps(out + i, _mm512_max_ps(lo, _mm512_min_ps(hi, x)));
+    }
+    for (; i < N; i++)
+        out[i] = in[i] > upper ? upper : (in[i] < lower ? lower : in[i]);
+}
+
+}  // namespace avx512
+}  // namespace GNAPluginNS
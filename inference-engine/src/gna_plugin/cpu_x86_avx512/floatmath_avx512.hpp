@@ -0,0 +1,38 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <stdint.h>
+
+namespace GNAPluginNS {
+namespace avx512 {
+
+//------------------------------------------------------------------------
+//
+// Floating point math of the SW_FP32 mode manually vectored for AVX-512 (w/o threads).
+// Results are bit-exact with the reference routines of floatmath.cpp: every output
+// accumulates products in the same order, and multiplications are never fused with additions.
+//
+//------------------------------------------------------------------------
+
+// number of rows of the output sgemm_rows() processes at once
+constexpr int sgemm_rows_block = 16;
+
+// C[r][j] = (accumulate ? C[r][j] : 0) + sum(A[r][k] * B[k * ldb + j], k = 0..K-1)
+// for r < sgemm_rows_block and j < N, where A[r] and C[r] are pointers to rows
+void sgemm_rows(const float *const *A, const float *B, int ldb, int N, int K,
+                float *const *C, bool accumulate);
+
+// Y[i] += A[i] * X[i]
+void vmadd(int N, const float *A, const float *X, float *Y);
+
+// out[i] = in[i] < 0 ? in[i] * negative_slope : in[i]
+void relu(int N, const float *in, float *out, float negative_slope);
+
+// out[i] = in[i] > upper ? upper : (in[i] < lower ? lower : in[i])
+void clip(int N, const float *in, float *out, float lower, float upper);
+
+}  // namespace avx512
+}  // namespace GNAPluginNS
@@ -16,14 +16,8 @@ extern bool global_debug;
 #include <mkl_dnn.h>
 #endif
 #include "dnn.h"
-#ifdef INTEGER_REF
-#include "convnet.h"
-#include "igemv16.h"
-#include "igemv8.h"
-#include "sgemm.h"
-#else
 #include "floatmath.h"
-#endif
+#include "intmath.h"
 #include "pwl.h"
 #include "util.h"
 #include "gna_plugin_log.hpp"
@@ -488,59 +482,44 @@ __inline void ApplyAffineTransform(intel_dnn_component_t *component, uint32_t *l
     int ldc = component->num_columns_out;
 
     switch (component->num_bytes_per_input) {
-#ifdef INTEGER_REF
         case 2:
             if (component->op.affine.num_bytes_per_weight == 1) {
-                int8_t *A = reinterpret_cast<int8_t*>(transform->ptr_weights);
-                int16_t *B = reinterpret_cast<int16_t*>(component->ptr_inputs);
-                int32_t *C = reinterpret_cast<int32_t*>(component->ptr_outputs);
-                intel_compound_bias_t *bias = reinterpret_cast<intel_compound_bias_t*>(transform->ptr_biases);
+                auto A = reinterpret_cast<int8_t *>(transform->ptr_weights);
+                auto B = reinterpret_cast<int16_t *>(component->ptr_inputs);
+                auto C = reinterpret_cast<int32_t *>(component->ptr_outputs);
+                auto bias = reinterpret_cast<intel_compound_bias_t *>(transform->ptr_biases);
                 if (list == nullptr) {
-                    //  PrintMatrixInt8("W int8", W, k, m, ldw, component->op.affine.weight_scale_factor);
-                    //  PrintMatrixInt16("X int16", X, k, n, ldx, component->op.affine.weight_scale_factor);
-                    //  PrintMatrixInt32("Y int32", Y, m, n, ldy, component->output_scale_factor);
                     igemm8_gna(m, n, k, A, lda, B, ldb, bias, C, ldc);
                 } else {
-                    //  PrintMatrixInt8("W int8", W, k, m, ldw, component->op.affine.weight_scale_factor);
-                    //  PrintMatrixInt16("X int16", X, k, n, ldx, component->op.affine.weight_scale_factor);
-                    //  PrintMatrixInt32("Y int32", Y, m, n, ldy, component->output_scale_factor);
                     igemm8_gna_subset(m, n, k, A, lda, B, ldb, bias, C, ldc, list, listsize);
                 }
-                //  PrintMatrixInt32("C int32", C, m, n, ldc, component->output_scale_factor);
             } else if (component->op.affine.num_bytes_per_weight == 2) {
-                int16_t *A = reinterpret_cast<int16_t*>(transform->ptr_weights);
-                int16_t *B = reinterpret_cast<int16_t*>(component->ptr_inputs);
-                int32_t *C = reinterpret_cast<int32_t*>(component->ptr_outputs);
-                int32_t *bias = reinterpret_cast<int32_t*>(transform->ptr_biases);
+                auto A = reinterpret_cast<int16_t *>(transform->ptr_weights);
+                auto B = reinterpret_cast<int16_t *>(component->ptr_inputs);
+                auto C = reinterpret_cast<int32_t *>(component->ptr_outputs);
+                auto bias = reinterpret_cast<int32_t *>(transform->ptr_biases);
                 if (list == nullptr) {
                     for (uint32_t i = 0; i < m; i++) {
                         for (uint32_t j = 0; j < n; j++) {
-                            C[i*ldc+j] = bias[i];
+                            C[i * ldc + j] = bias[i];
                         }
                     }
-                    //  PrintMatrixInt16("A int16", A, k, m, lda, component->op.affine.weight_scale_factor);
-                    //  PrintMatrixInt16("trans(B) int16", B, k, n, ldb, component->op.affine.weight_scale_factor);
-                    //  PrintMatrixInt32("C int32", C, m, n, ldc, component->output_scale_factor);
                     cblas_igemm16(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k, 1.0, A, lda, B, ldb, 1.0, C, ldc);
                 } else {
                     for (int l = 0; l < listsize; l++) {
                         int i = list[l];
                         for (uint32_t j = 0; j < n; j++) {
-                            C[l*ldc+j] = bias[i];
+                            C[l * ldc + j] = bias[i];
                         }
                     }
-                    //  PrintMatrixInt16("A int16", A, k, m, lda, component->op.affine.scale_factor);
-                    //  PrintMatrixInt16("trans(B) int16", B, k, n, ldb, component->op.affine.scale_factor);
-                    //  PrintMatrixInt32("C int32", C, m, n, ldc, component->op.affine.scale_factor * component->op.affine.scale_factor);
-                    cblas_igemm16_subset(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k, 1.0, A, lda, B, ldb, 1.0, C, ldc, list, listsize);
+                    cblas_igemm16_subset(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k, 1.0, A, lda, B, ldb, 1.0,
+                                         C, ldc, list, listsize);
                 }
-                //  PrintMatrixInt32("C int32", C, m, n, ldc, component->output_scale_factor);
             } else {
-                fprintf(stderr, "Bad weight width in ApplyAffineTransform!\n");
-                throw -1;
+                THROW_GNA_EXCEPTION << "Bad weight width in ApplyAffineTransform: "
+                                    << component->op.affine.num_bytes_per_weight;
             }
             break;
-#endif  // #ifdef INTEGER_REF
         case 4: {
             auto A = reinterpret_cast<float *>(transform->ptr_weights);
             auto B = reinterpret_cast<float *>(component->ptr_inputs);
@@ -600,39 +579,29 @@ __inline void ApplyDiagonalTransform(intel_dnn_component_t *component) {
     int ldc = component->num_columns_out;
 
     switch (component->num_bytes_per_input) {
-#ifdef INTEGER_REF
         case 2:
             if (component->op.affine.num_bytes_per_weight == 1) {
-                int8_t *A = reinterpret_cast<int8_t*>(transform->ptr_weights);
-                int16_t *B = reinterpret_cast<int16_t*>(component->ptr_inputs);
-                int32_t *C = reinterpret_cast<int32_t*>(component->ptr_outputs);
-                intel_compound_bias_t *bias = reinterpret_cast<intel_compound_bias_t*>(transform->ptr_biases);
-                //  PrintMatrixInt8("W int8", W, k, m, ldw, component->op.affine.weight_scale_factor);
-                //  PrintMatrixInt16("X int16", X, k, n, ldx, component->op.affine.weight_scale_factor);
-                //  PrintMatrixInt32("Y int32", Y, m, n, ldy, component->output_scale_factor);
-                isbmm8_gna(m, n, A, lda, B, ldb, bias, C, ldc);
-                //  PrintMatrixInt32("C int32", C, m, n, ldc, component->output_scale_factor);
+                auto A = reinterpret_cast<int8_t *>(transform->ptr_weights);
+                auto B = reinterpret_cast<int16_t *>(component->ptr_inputs);
+                auto C = reinterpret_cast<int32_t *>(component->ptr_outputs);
+                auto bias = reinterpret_cast<intel_compound_bias_t *>(transform->ptr_biases);
+                isbmm8_gna(m, n, A, B, ldb, bias, C, ldc);
             } else if (component->op.affine.num_bytes_per_weight == 2) {
-                int16_t *A = reinterpret_cast<int16_t*>(transform->ptr_weights);
-                int16_t *B = reinterpret_cast<int16_t*>(component->ptr_inputs);
-                int32_t *C = reinterpret_cast<int32_t*>(component->ptr_outputs);
-                int32_t *bias = reinterpret_cast<int32_t*>(transform->ptr_biases);
+                auto A = reinterpret_cast<int16_t *>(transform->ptr_weights);
+                auto B = reinterpret_cast<int16_t *>(component->ptr_inputs);
+                auto C = reinterpret_cast<int32_t *>(component->ptr_outputs);
+                auto bias = reinterpret_cast<int32_t *>(transform->ptr_biases);
                 for (uint32_t i = 0; i < m; i++) {
                     for (uint32_t j = 0; j < n; j++) {
-                        C[i*ldc+j] = bias[i];
+                        C[i * ldc + j] = bias[i];
                     }
                 }
-                //  PrintMatrixInt16("A int16", A, 1, m, lda, component->op.affine.weight_scale_factor);
-                //  PrintMatrixInt16("trans(B) int16", B, k, n, ldb, component->op.affine.weight_scale_factor);
-                //  PrintMatrixInt32("C int32", C, m, n, ldc, component->output_scale_factor);
-                cblas_isbmm16(m, n, A, lda, B, ldb, C, ldc);
-                //  PrintMatrixInt32("C int32", C, m, n, ldc, component->output_scale_factor);
+                cblas_isbmm16(m, n, A, B, ldb, C, ldc);
             } else {
-                fprintf(stderr, "Bad weight width in ApplyDiagonalTransform!\n");
-                throw -1;
+                THROW_GNA_EXCEPTION << "Bad weight width in ApplyDiagonalTransform: "
+                                    << component->op.affine.num_bytes_per_weight;
             }
             break;
-#endif  // #ifdef INTEGER_REF
         case 4: {
             auto A = reinterpret_cast<float *>(transform->ptr_weights);
             auto B = reinterpret_cast<float *>(component->ptr_inputs);
@@ -671,38 +640,26 @@ __inline void ApplyRecurrentTransform(intel_dnn_component_t *component, uint32_t
     }
 
     switch (component->num_bytes_per_input) {
-#ifdef INTEGER_REF
         case 2:
             if (component->op.recurrent.num_bytes_per_weight == 1) {
-                int16_t *A1 = reinterpret_cast<int16_t*>(component->ptr_inputs) + row * component->num_columns_in;
-                int16_t *A2 = reinterpret_cast<int16_t*>(ptr_feedbacks);
-                int8_t *X = reinterpret_cast<int8_t*>(transform->ptr_weights);
-                intel_compound_bias_t *B = reinterpret_cast<intel_compound_bias_t*>(transform->ptr_biases);
-                int32_t *C = reinterpret_cast<int32_t*>(component->ptr_outputs) + row * component->num_columns_out;
-                //  PrintMatrixInt16("A1 int", A1, 1, k1, k1, component->op.recurrent.weight_scale_factor);
-                //  PrintMatrixInt16("A2 int", A2, 1, k2, k2);
-                //  PrintMatrixInt8("X int", X, k, n, n, component->op.recurrent.weight_scale_factor);
-                //  PrintMatrixInt32("B int", B, 1, 2*n, 2*n, component->output_scale_factor);
+                auto A1 = reinterpret_cast<int16_t *>(component->ptr_inputs) + row * component->num_columns_in;
+                auto A2 = reinterpret_cast<int16_t *>(ptr_feedbacks);
+                auto X = reinterpret_cast<int8_t *>(transform->ptr_weights);
+                auto B = reinterpret_cast<intel_compound_bias_t *>(transform->ptr_biases);
+                auto C = reinterpret_cast<int32_t *>(component->ptr_outputs) + row * component->num_columns_out;
                 igemv8_gna_split(n, k1, k2, A1, A2, X, B, C);
-                //  PrintMatrixInt32("C int", C, 1, n, n, component->output_scale_factor);
             } else if (component->op.recurrent.num_bytes_per_weight == 2) {
-                int16_t *A1 = reinterpret_cast<int16_t*>(component->ptr_inputs) + row * component->num_columns_in;
-                int16_t *A2 = reinterpret_cast<int16_t*>(ptr_feedbacks);
-                int16_t *X = reinterpret_cast<int16_t*>(transform->ptr_weights);
-                int32_t *B = reinterpret_cast<int32_t*>(transform->ptr_biases);
-                int32_t *C = reinterpret_cast<int32_t*>(component->ptr_outputs) + row * component->num_columns_out;
-                //  PrintMatrixInt16("A1 int", A1, 1, k1, k1, component->op.recurrent.weight_scale_factor);
-                //  PrintMatrixInt16("A2 int", A2, 1, k2, k2, component->op.recurrent.weight_scale_factor);
-                //  PrintMatrixInt16("X int", X, k, n, n, component->op.recurrent.weight_scale_factor);
-                //  PrintMatrixInt32("B int", B, 1, n, n, component->output_scale_factor);
+                auto A1 = reinterpret_cast<int16_t *>(component->ptr_inputs) + row * component->num_columns_in;
+                auto A2 = reinterpret_cast<int16_t *>(ptr_feedbacks);
+                auto X = reinterpret_cast<int16_t *>(transform->ptr_weights);
+                auto B = reinterpret_cast<int32_t *>(transform->ptr_biases);
+                auto C = reinterpret_cast<int32_t *>(component->ptr_outputs) + row * component->num_columns_out;
                 igemv16_split(n, k1, k2, A1, A2, X, B, C);
-                //  PrintMatrixInt32("C int", C, 1, n, n, component->output_scale_factor);
             } else {
-                fprintf(stderr, "Weight width not supported in ApplyRecurrentTransform!\n");
-                throw -1;
+                THROW_GNA_EXCEPTION << "Bad weight width in ApplyRecurrentTransform: "
+                                    << component->op.recurrent.num_bytes_per_weight;
             }
             break;
-#endif  // #ifdef INTEGER_REF
         case 4: {
             auto A1 = reinterpret_cast<float *>(component->ptr_inputs) + row * component->num_columns_in;
             auto A2 = reinterpret_cast<float *>(ptr_feedbacks);
@@ -724,11 +681,9 @@ __inline void ApplyRecurrentTransform(intel_dnn_component_t *component, uint32_t
 
 __inline void ApplyConvolutional1DTransform(intel_dnn_component_t *component) {
     switch (component->num_bytes_per_input) {
-#ifdef INTEGER_REF
         case 2:
             CNNFilter16(component);
             break;
-#endif  // #ifdef INTEGER_REF
         case 4:
             //  PrintMatrixFloat32("Input float", reinterpret_cast<float*>(component->ptr_inputs),
             //  component->num_rows_in, component->num_columns_in, component->num_columns_in);
@@ -756,10 +711,8 @@ __inline void ApplyPiecewiseLinearTransform(intel_dnn_component_t *component,
         PwlApply32(component, listsize);
         // PrintMatrixFloat32("PWL Output float", reinterpret_cast<float*>(component->ptr_outputs), component->num_rows_out,
         // component->num_columns_out, component->num_columns_out);
-#ifdef INTEGER_REF
-        } else if (component->num_bytes_per_output == 2) {
-            PwlApply16(component, listsize);
-#endif  // #ifdef INTEGER_REF
+    } else if (component->num_bytes_per_output == 2) {
+        PwlApply16(component, listsize);
     } else {
         THROW_GNA_EXCEPTION << "Bad data width in ApplyPiecewiseLinearTransform: " << number_type;
     }
@@ -771,10 +724,8 @@ __inline void ApplyPiecewiseLinearTransform(intel_dnn_component_t *component,
                                             uint32_t num_row) {
     if (number_type == kDnnFloat) {
         PwlApply32(component, num_row, num_row, 0, listsize - 1);
-#ifdef INTEGER_REF
-        } else if (component->num_bytes_per_output == 2) {
-            PwlApply16(component, num_row, num_row, 0, listsize-1);
-#endif  // #ifdef INTEGER_REF
+    } else if (component->num_bytes_per_output == 2) {
+        PwlApply16(component, num_row, num_row, 0, listsize - 1);
     } else {
         THROW_GNA_EXCEPTION << "Bad data width in ApplyPiecewiseLinearTransform: " << number_type;
     }
@@ -800,7 +751,6 @@ __inline void ApplyTranspose(intel_dnn_component_t *component) {
     int ldb = component->num_columns_out;
     // B = Transpose(A) where A is mxn and B is nxm
     switch (component->num_bytes_per_input) {
-#ifdef INTEGER_REF
         case 1:
             {
                 int8_t *A = reinterpret_cast<int8_t*>(component->ptr_inputs);
@@ -823,7 +773,6 @@ __inline void ApplyTranspose(intel_dnn_component_t *component) {
                 }
             }
             break;
-#endif  // #ifdef INTEGER_REF
         case 4: {
             auto A = reinterpret_cast<float *>(component->ptr_inputs);
             auto B = reinterpret_cast<float *>(component->ptr_outputs);
@@ -851,7 +800,6 @@ __inline void ApplyCopy(intel_dnn_component_t *component) {
         throw -1;
     } else {
         switch (component->num_bytes_per_input) {
-#ifdef INTEGER_REF
             case 2:
                 {
                     int16_t *A = reinterpret_cast<int16_t*>(src);
@@ -863,7 +811,6 @@ __inline void ApplyCopy(intel_dnn_component_t *component) {
                     }
                 }
                 break;
-#endif  // #ifdef INTEGER_REF
             case 4: {
                 auto A = reinterpret_cast<float *>(src);
                 auto B = reinterpret_cast<float *>(dst);
@@ -908,7 +855,14 @@ uint32_t AmIntelDnn::CopyActiveList(std::vector<std::vector<uint32_t> > &active_
 }
 
 void AmIntelDnn::Propagate() {
+    if (collect_perf_counters) {
+        component_time_ns.resize(component.size(), 0);
+        num_propagations++;
+    }
+
     for (uint32_t i = 0; i < component.size(); i++) {
+        const uint32_t component_index = i;
+        const auto start = std::chrono::steady_clock::now();
         intel_dnn_component_t *comp = &component[i];
         uint32_t *ptr_active_outputs = nullptr;
         uint32_t num_active_outputs = (comp->orientation_out == kDnnInterleavedOrientation)
@@ -961,6 +915,10 @@ void AmIntelDnn::Propagate() {
                 throw -1;
                 break;
         }
+        if (collect_perf_counters) {
+            component_time_ns[component_index] += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - start).count();
+        }
         //  PrintOutputs(i); fflush(stdout);
     }
 }
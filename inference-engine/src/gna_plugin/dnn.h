@@ -16,6 +16,7 @@
 #include <iomanip>
 #include <type_traits>
 #include <vector>
+#include <chrono>
 #include "gna-api.h"
 
 #define DNN_MAX_BATCH_SIZE 8
@@ -711,6 +712,11 @@ class AmIntelDnn {
     }
 
     std::vector<intel_dnn_component_t> component;
+    // time spent by Propagate() in every component (in nanoseconds), accumulated while collect_perf_counters is set.
+    // A recurrent component accounts for the piecewise linear one which follows it
+    bool collect_perf_counters = false;
+    std::vector<uint64_t> component_time_ns;
+    uint64_t num_propagations = 0;
     uint32_t num_left_context;
     uint32_t num_right_context;
     bool do_rotate_input;
@@ -1,13 +1,154 @@
 // Copyright (C) 2018-2019 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 //
-// floatmath.cpp : unoptimized floating point math routines (for reference)
+// floatmath.cpp : floating point math routines of the SW_FP32 mode
 //
 
 #include "floatmath.h"
 #include "pwl.h"
 #include "gna_plugin_log.hpp"
 #include <cmath>
+#include <cstdint>
+#include <algorithm>
+#include <vector>
+#include <ie_parallel.hpp>
+#include <cpu_detector.hpp>
+
+#ifdef HAVE_AVX2
+#include "cpu_x86_avx2/floatmath_avx2.hpp"
+#endif
+#ifdef HAVE_AVX512
+#include "cpu_x86_avx512/floatmath_avx512.hpp"
+#endif
+
+namespace {
+
+// matrix products smaller than this number of multiply-adds aren't split between threads
+constexpr size_t sgemm_parallel_threshold = 1 << 15;
+// activations with transcendental functions are split between threads starting from this number of elements
+constexpr size_t pwl_parallel_threshold = 1 << 10;
+constexpr uint32_t pwl_chunk_size = 1 << 10;
+
+void vmadd_ref(int N, const float *A, const float *X, float *Y) {
+    for (int i = 0; i < N; i++) {
+        Y[i] += A[i] * X[i];
+    }
+}
+
+void relu_ref(int N, const float *in, float *out, float negative_slope) {
+    for (int i = 0; i < N; i++) {
+        out[i] = (in[i] < 0.0f) ? in[i] * negative_slope : in[i];
+    }
+}
+
+void clip_ref(int N, const float *in, float *out, float lower, float upper) {
+    for (int i = 0; i < N; i++) {
+        out[i] = in[i] > upper ? upper : (in[i] < lower ? lower : in[i]);
+    }
+}
+
+// SIMD kernels of the best instruction set the CPU supports, they are bit-exact with the scalar loops
+struct FloatMathKernels {
+    void (*sgemm_rows)(const float *const *A, const float *B, int ldb, int N, int K,
+                       float *const *C, bool accumulate);
+    int sgemm_rows_block;
+    void (*vmadd)(int N, const float *A, const float *X, float *Y);
+    void (*relu)(int N, const float *in, float *out, float negative_slope);
+    void (*clip)(int N, const float *in, float *out, float lower, float upper);
+};
+
+FloatMathKernels selectKernels() {
+#ifdef HAVE_AVX512
+    if (InferenceEngine::with_cpu_x86_avx512f()) {
+        using namespace GNAPluginNS::avx512;
+        return {sgemm_rows, sgemm_rows_block, vmadd, relu, clip};
+    }
+#endif
+#ifdef HAVE_AVX2
+    if (InferenceEngine::with_cpu_x86_avx2()) {
+        using namespace GNAPluginNS::avx2;
+        return {sgemm_rows, sgemm_rows_block, vmadd, relu, clip};
+    }
+#endif
+    return {nullptr, 8, vmadd_ref, relu_ref, clip_ref};
+}
+
+const FloatMathKernels &kernels() {
+    static const FloatMathKernels selected = selectKernels();
+    return selected;
+}
+
+// C[l][j] = (accumulate ? C[l][j] : 0) + sum(A[row(l)][k] * B[k][j], k = 0..K-1) for l < L, j < N
+// where row(l) = rows ? rows[l] : l. Every output accumulates products in the order of k like the reference loops,
+// so the result doesn't depend on blocking, vectorization and threading.
+void sgemm_nn(int L, int N, int K, const float *A, int lda, const uint32_t *rows,
+              const float *B, int ldb, bool accumulate, float *C, int ldc) {
+    if (L <= 0 || N <= 0)
+        return;
+
+    const FloatMathKernels &isa = kernels();
+    const int block = isa.sgemm_rows_block;
+    const int num_blocks = (L + block - 1) / block;
+    auto row = [&](int l) { return A + static_cast<size_t>(rows ? rows[l] : l) * lda; };
+
+    auto sgemm_block = [&](int b) {
+        const int l0 = b * block;
+        const int count = std::min(block, L - l0);
+        if (isa.sgemm_rows != nullptr && count == block) {
+            const float *a_rows[16];
+            float *c_rows[16];
+            for (int r = 0; r < block; r++) {
+                a_rows[r] = row(l0 + r);
+                c_rows[r] = C + static_cast<size_t>(l0 + r) * ldc;
+            }
+            isa.sgemm_rows(a_rows, B, ldb, N, K, c_rows, accumulate);
+            return;
+        }
+        for (int l = l0; l < l0 + count; l++) {
+            const float *a = row(l);
+            float *c = C + static_cast<size_t>(l) * ldc;
+            for (int j = 0; j < N; j++) {
+                float sum = accumulate ? c[j] : 0;
+                for (int k = 0; k < K; k++) {
+                    sum += a[k] * B[k * ldb + j];
+                }
+                c[j] = sum;
+            }
+        }
+    };
+
+    if (static_cast<size_t>(L) * N * K < sgemm_parallel_threshold) {
+        for (int b = 0; b < num_blocks; b++)
+            sgemm_block(b);
+    } else {
+        InferenceEngine::parallel_for(num_blocks, sgemm_block);
+    }
+}
+
+// applies func(in, out, count) to chunks of rows [row_start, row_end] limited by columns [col_start, col_end]
+template <typename F>
+void pwl_for_each_chunk(uint32_t row_start, uint32_t row_end, uint32_t col_start, uint32_t col_end,
+                        uint32_t num_columns, const float *in, float *out, size_t parallel_threshold, const F &func) {
+    const uint32_t num_cols = col_end - col_start + 1;
+    const uint32_t chunks_per_row = (num_cols + pwl_chunk_size - 1) / pwl_chunk_size;
+    const uint32_t num_chunks = (row_end - row_start + 1) * chunks_per_row;
+
+    auto apply = [&](uint32_t c) {
+        const uint32_t i = row_start + c / chunks_per_row;
+        const uint32_t j = col_start + (c % chunks_per_row) * pwl_chunk_size;
+        const uint32_t count = std::min(pwl_chunk_size, col_end + 1 - j);
+        func(in + i * num_columns + j, out + i * num_columns + j, count);
+    };
+
+    if (static_cast<size_t>(row_end - row_start + 1) * num_cols < parallel_threshold) {
+        for (uint32_t c = 0; c < num_chunks; c++)
+            apply(c);
+    } else {
+        InferenceEngine::parallel_for(num_chunks, apply);
+    }
+}
+
+}  // namespace
 
 
 void CNNFilter32(intel_dnn_component_t *component) {
@@ -26,17 +167,22 @@ void CNNFilter32(intel_dnn_component_t *component) {
         THROW_GNA_EXCEPTION << "Bad problem dimensions in CNNFilter32!";
     }
 
-    for (uint32_t j = 0; j < num_filter_outputs; j++) {
-        float *ptr_in = ptr_inputs + j * num_inputs_band_stride;
-        for (uint32_t i = 0; i < component->op.conv1D.num_filters; i++) {
-            float *ptr_coef = ptr_filters + i * num_filter_coefficients;
-            float sum = ptr_biases[i];
-            for (uint32_t k = 0; k < num_filter_coefficients; k++) {
-                sum += ptr_in[k] * ptr_coef[k];
-            }
-            ptr_outputs[j * component->op.conv1D.num_filters + i] = sum;
+    // outputs of a filter are the rows of inputs (with the band stride) multiplied by the filter coefficients,
+    // so the whole convolution is a product of inputs and transposed filters
+    const uint32_t num_filters = component->op.conv1D.num_filters;
+    thread_local std::vector<float> filters_transposed;
+    filters_transposed.resize(num_filters * num_filter_coefficients);
+    for (uint32_t i = 0; i < num_filters; i++) {
+        for (uint32_t k = 0; k < num_filter_coefficients; k++) {
+            filters_transposed[k * num_filters + i] = ptr_filters[i * num_filter_coefficients + k];
         }
     }
+
+    for (uint32_t j = 0; j < num_filter_outputs; j++) {
+        std::copy(ptr_biases, ptr_biases + num_filters, ptr_outputs + j * num_filters);
+    }
+    sgemm_nn(num_filter_outputs, num_filters, num_filter_coefficients, ptr_inputs, num_inputs_band_stride, nullptr,
+             filters_transposed.data(), num_filters, true, ptr_outputs, num_filters);
 }
 
 void CNNMaxPool(intel_dnn_component_t *component, intel_dnn_number_type_t number_type) {
@@ -123,75 +269,6 @@ void CNNMaxPool(intel_dnn_component_t *component, intel_dnn_number_type_t number
     }
 }
 
-void PwlApply16(intel_dnn_component_t *component, uint32_t num_subset_size) {
-    if (component->orientation_in == kDnnInterleavedOrientation) {  // subsets only supported in interleaved orientation
-        PwlApply16(component, 0, num_subset_size - 1, 0, component->num_columns_in - 1);
-    } else {
-        PwlApply16(component, 0, component->num_rows_in - 1, 0, component->num_columns_in - 1);
-    }
-}
-
-void PwlApply16(intel_dnn_component_t *component,
-                uint32_t num_row_start,
-                uint32_t num_row_end,
-                uint32_t num_col_start,
-                uint32_t num_col_end) {
-    uint32_t num_saturate = 0;
-    uint32_t num_segments = component->op.pwl.num_segments;
-    if (num_segments > 0) {
-        intel_pwl_segment_t *ptr_segment = component->op.pwl.ptr_segments;
-        for (int i = num_row_start; i <= num_row_end; i++) {
-            int32_t *ptr_input = reinterpret_cast<int32_t *>(component->ptr_inputs) + i * component->num_columns_in;
-            int16_t *ptr_output = reinterpret_cast<int16_t *>(component->ptr_outputs) + i * component->num_columns_in;
-            for (int j = num_col_start; j <= num_col_end; j++) {
-                int32_t xbase = (int32_t) (ptr_segment[0].xBase & XBASEMASK);
-                int32_t input = ptr_input[j];
-                if (input <= xbase) {
-                    ptr_output[j] = ptr_segment[0].yBase;
-                } else {
-                    uint32_t slope_shift;
-                    int16_t slope, ybase;
-                    int64_t diff, prod, prod_shift, sum;
-                    uint32_t k = num_segments / 2;
-                    uint32_t k_upper = num_segments;
-                    uint32_t k_lower = 0;
-                    while (k_upper > k_lower + 1) {
-                        xbase = (int32_t) (ptr_segment[k].xBase & XBASEMASK);
-                        if (xbase > input) {
-                            k_upper = k;
-                            k = (k + k_lower) / 2;
-                        } else {
-                            k_lower = k;
-                            k = (k_upper + k) / 2;
-                        }
-                    }
-                    xbase = (int32_t) (ptr_segment[k].xBase & XBASEMASK);
-                    slope_shift = ((ptr_segment[k].xBase & ~XBASEMASK) + 1) * 8;
-                    slope = ptr_segment[k].slope;
-                    ybase = ptr_segment[k].yBase;
-                    diff = (int64_t) input - (int64_t) xbase;
-                    prod = diff * slope;
-                    prod_shift = prod >> slope_shift;
-                    sum = prod_shift + (int64_t) ybase;
-                    if (sum > 32767LL) {
-                        ptr_output[j] = 32767;
-                        num_saturate++;
-                    } else if (sum < -32768LL) {
-                        ptr_output[j] = -32768;
-                        num_saturate++;
-                    } else {
-                        ptr_output[j] = (int16_t) sum;
-                    }
-                }
-            }
-        }
-    }
-
-    if (num_saturate > 0) {
-        fprintf(stderr, "Warning:  %d saturations in PwlApply16!\n", num_saturate);
-    }
-}
-
 void PwlApply32(intel_dnn_component_t *component, uint32_t num_subset_size) {
     if (component->orientation_in == kDnnInterleavedOrientation) {  // subsets only supported in interleaved orientation
         PwlApply32(component, 0, num_subset_size - 1, 0, component->num_columns_in - 1);
@@ -211,47 +288,40 @@ void PwlApply32(intel_dnn_component_t *component,
     uint32_t num_columns = component->num_columns_in;
     switch (transform->func_id.type) {
         case kActSigmoid:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = 0.5 * (1.0 + tanh(0.5 * ptr_in[i * num_columns + j]));
+            pwl_for_each_chunk(num_row_start, num_row_end, num_col_start, num_col_end, num_columns, ptr_in, ptr_out,
+                               pwl_parallel_threshold, [](const float *in, float *out, uint32_t count) {
+                for (uint32_t j = 0; j < count; j++) {
+                    out[j] = 0.5 * (1.0 + tanh(0.5 * in[j]));
                 }
-            }
+            });
             break;
         case kActTanh:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = tanh(ptr_in[i * num_columns + j]);
+            pwl_for_each_chunk(num_row_start, num_row_end, num_col_start, num_col_end, num_columns, ptr_in, ptr_out,
+                               pwl_parallel_threshold, [](const float *in, float *out, uint32_t count) {
+                for (uint32_t j = 0; j < count; j++) {
+                    out[j] = tanh(in[j]);
                 }
-            }
+            });
             break;
-        case kActRelu:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] =
-                        (ptr_in[i * num_columns + j] < 0.0f) ? ptr_in[i * num_columns + j] * transform->func_id.negative_slope : ptr_in[i * num_columns + j];
-                }
-            }
+        case kActRelu: {
+            const float negative_slope = transform->func_id.negative_slope;
+            pwl_for_each_chunk(num_row_start, num_row_end, num_col_start, num_col_end, num_columns, ptr_in, ptr_out,
+                               SIZE_MAX, [&](const float *in, float *out, uint32_t count) {
+                kernels().relu(count, in, out, negative_slope);
+            });
             break;
+        }
         case kActIdentity:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = ptr_in[i * num_columns + j];
-                }
-            }
+            pwl_for_each_chunk(num_row_start, num_row_end, num_col_start, num_col_end, num_columns, ptr_in, ptr_out,
+                               SIZE_MAX, [](const float *in, float *out, uint32_t count) {
+                std::copy(in, in + count, out);
+            });
             break;
         case kActKaldiLstmClipping:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    float val = ptr_in[i * num_columns + j];
-                    if (val > KALDI_LSTM_CLIP_UPPER) {
-                        ptr_out[i * num_columns + j] = KALDI_LSTM_CLIP_UPPER;
-                    } else if (val < KALDI_LSTM_CLIP_LOWER) {
-                        ptr_out[i * num_columns + j] = KALDI_LSTM_CLIP_LOWER;
-                    } else {
-                        ptr_out[i * num_columns + j] = val;
-                    }
-                }
-            }
+            pwl_for_each_chunk(num_row_start, num_row_end, num_col_start, num_col_end, num_columns, ptr_in, ptr_out,
+                               SIZE_MAX, [](const float *in, float *out, uint32_t count) {
+                kernels().clip(count, in, out, KALDI_LSTM_CLIP_LOWER, KALDI_LSTM_CLIP_UPPER);
+            });
             break;
         case kActCustom:
             // break;
@@ -278,15 +348,7 @@ void cblas_sgemm1(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
     }
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[i * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
-                }
-                C[i * ldc + j] = sum;
-            }
-        }
+        sgemm_nn(M, N, K, A, lda, nullptr, B, ldb, beta == 1.0, C, ldc);
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
         for (i = 0; i < M; i++) {
             for (j = 0; j < N; j++) {
@@ -332,9 +394,7 @@ void cblas_ssbmv1(const CBLAS_LAYOUT Layout, const CBLAS_UPLO Uplo,
         throw -1;
     }
     if ((alpha == 1.0) && (beta == 1.0) && (incX == 1) && (incY == 1)) {
-        for (i = 0; i < N; i++) {
-            Y[i] += A[i] * X[i];
-        }
+        kernels().vmadd(N, A, X, Y);
     } else {
         fprintf(stderr, "Only alpha=1, beta=1, incX=1, incY=1, LDA=1 supported in cblas_ssbmv at this time!\n");
         throw -1;
@@ -356,16 +416,7 @@ void cblas_sgemm_subset(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
     }
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (l = 0; l < L; l++) {
-            i = OutputList[l];
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[l * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
-                }
-                C[l * ldc + j] = sum;
-            }
-        }
+        sgemm_nn(L, N, K, A, lda, OutputList, B, ldb, beta == 1.0, C, ldc);
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
         for (i = 0; i < M; i++) {
             for (l = 0; l < L; l++) {
@@ -406,18 +457,15 @@ void sgemv_split(const uint32_t N,
                  float *C) {
     uint32_t num_columns = K1 + K2;
     uint32_t num_rows = N;
-    uint32_t i, j;
 
-    for (i = 0; i < num_rows; i++) {
-        float sum = B[i];
-        for (j = 0; j < K1; j++) {
-            sum += A1[j] * X[i * num_columns + j];
-        }
-        for (j = K1; j < num_columns; j++) {
-            sum += A2[j - K1] * X[i * num_columns + j];
-        }
-        C[i] = sum;
-    }
+    // the row of weights is multiplied by the concatenation of both parts of the input
+    thread_local std::vector<float> input;
+    input.resize(num_columns);
+    std::copy(A1, A1 + K1, input.begin());
+    std::copy(A2, A2 + K2, input.begin() + K1);
+
+    std::copy(B, B + num_rows, C);
+    sgemm_nn(num_rows, 1, num_columns, X, num_columns, nullptr, input.data(), 1, true, C, 1);
 }
 
 #ifdef __cplusplus
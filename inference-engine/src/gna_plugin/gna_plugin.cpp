@@ -306,7 +306,7 @@ void GNAPlugin::ImportFrames(
             auto src = reinterpret_cast<const int16_t *>(ptr_src);
             copyInputData(dst, src, num_frames, num_group, num_vector_elements, num_vector_stride, orientation, scaleFactor);
         } else if (input_precision.size() == 4) {
-            if (!gnadevice) {
+            if (!quantized_network) {
                 auto dst = reinterpret_cast<float *>(ptr_dst);
                 auto src = reinterpret_cast<const float *>(ptr_src);
                 copyInputData(dst, src, num_frames, num_group, num_vector_elements, num_vector_stride, orientation, scaleFactor);
@@ -319,7 +319,7 @@ void GNAPlugin::ImportFrames(
     } else {
         if (input_precision == Precision::U8) {
             auto src = reinterpret_cast<const uint8_t *>(ptr_src);
-            if (!gnadevice) {
+            if (!quantized_network) {
                 auto dst = reinterpret_cast<float *>(ptr_dst);
                 copyInputData(dst, src, num_frames, num_group, num_vector_elements, num_vector_stride, orientation, scaleFactor);
             } else {
@@ -332,7 +332,7 @@ void GNAPlugin::ImportFrames(
             auto src = reinterpret_cast<const int16_t *>(ptr_src);
             copyInputData(dst, src, num_frames, num_group, num_vector_elements, num_vector_stride, orientation, scaleFactor);
         } else if (input_precision.size() == 4) {
-            if (!gnadevice) {
+            if (!quantized_network) {
                 auto dst = reinterpret_cast<float *>(ptr_dst);
                 auto src = reinterpret_cast<const float *>(ptr_src);
                 copyInputData(dst, src, num_frames, num_group, num_vector_elements, num_vector_stride, orientation, scaleFactor);
@@ -1788,8 +1788,14 @@ void GNAPlugin::LoadNetwork(ICNNNetwork &network) {
     }
 
     auto networkPrecision = newNet->getPrecision();
+    quantized_network = !networkPrecision.is_float();
 
-    if (!networkPrecision.is_float()) {
+    if (quantized_network && sw_host) {
+        // host emulation propagates the single copy of network memory
+        gna_lib_async_threads_num = 1;
+    }
+
+    if (quantized_network && !sw_host) {
         gnadevice.reset(new GNADeviceHelper(gna_proc_type,
                                             gna_lib_async_threads_num,
                                             gna_openmp_multithreading,
@@ -2104,7 +2110,7 @@ uint32_t GNAPlugin::QueueInference(const InferenceEngine::BlobMap &inputs, Infer
             != (orientation_in[input.first] == kDnnInterleavedOrientation))
             && !isOneChannel) {
             RotateFeatures(reinterpret_cast<uint8_t *>(get_ptr_inputs_global(input.first)[idx]),
-                           gnadevice ? 2 : 4,
+                           quantized_network ? 2 : 4,
                            // TODO: only works for cnn4a and google command so far
                            dims[dims.size() - 1],
                            is2D ? dims[0] : dims[0] * dims[2],  // num_feature_vectors looks batch should be there
@@ -2114,6 +2120,7 @@ uint32_t GNAPlugin::QueueInference(const InferenceEngine::BlobMap &inputs, Infer
     }
 
     if (!gnadevice) {
+        dnn.collect_perf_counters = performance_counting;
         dnn.Propagate();
         std::get<1>(*freeNnet) = 1;
     } else {
@@ -2164,7 +2171,7 @@ void GNAPlugin::Wait(uint32_t idx) {
 //        }
         // we concider the last layer as output ...
         size_t output_layer_index = std::max(0, static_cast<int>(std::get<0>(nnets[idx])->obj.nLayers - 1));
-        if (gnadevice && std::get<0>(nnets[idx])->obj.pLayers[output_layer_index].pOutputs != ptr_outputs_global[idx]) {
+        if (quantized_network && std::get<0>(nnets[idx])->obj.pLayers[output_layer_index].pOutputs != ptr_outputs_global[idx]) {
             // ...as this is not true, we should look for output layer index
             for (int j = 0; j != std::get<0>(nnets[idx])->obj.nLayers; j++) {
                 if (std::get<0>(nnets[idx])->obj.pLayers[j].pOutputs == ptr_outputs_global[idx]) {
@@ -2183,13 +2190,13 @@ void GNAPlugin::Wait(uint32_t idx) {
                      output.dims()[0],
                      output.dims()[0],
                      // TODO: create better getter consider multiple outputs case
-                     gnadevice ? std::get<0>(nnets[idx])->obj.pLayers[output_layer_index].nBytesPerOutput : sizeof(float),
+                     quantized_network ? std::get<0>(nnets[idx])->obj.pLayers[output_layer_index].nBytesPerOutput : sizeof(float),
                      sizeof(float));
     } else if (output.layout() != Layout::CN) {
         THROW_GNA_EXCEPTION << "Expected output blob to have Layout::NC or Layout::CN. But was " << output.layout();
     }
 
-    if (gnadevice) {
+    if (quantized_network) {
 #ifdef PLOT
         FILE *f = nullptr;
         static int num_infers = 0;
@@ -2297,6 +2304,7 @@ InferenceEngine::IExecutableNetwork::Ptr GNAPlugin::ImportNetwork(const std::str
 
     auto header = GNAModelSerial::ReadHeader(inputStream);
 
+    quantized_network = true;
     gnadevice.reset(new GNADeviceHelper(gna_proc_type,
                                         gna_lib_async_threads_num,
                                         gna_openmp_multithreading));
@@ -2399,8 +2407,33 @@ void GNAPlugin::Export(const std::string &fileName) {
 }
 
 void GNAPlugin::GetPerformanceCounts(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) {
-    if (performance_counting) {
+    if (!performance_counting) {
+        return;
+    }
+    if (gnadevice) {
         gnadevice->getGnaPerfCounters(perfMap);
+        return;
+    }
+
+    // software modes report the average time of components, the ones created for the same layer are summed up
+    if (dnn.num_propagations == 0) {
+        return;
+    }
+    auto componentForLayer = dnnComponentsForLayer.begin();
+    for (uint32_t i = 0; i < dnn.component_time_ns.size() && componentForLayer != dnnComponentsForLayer.end();
+         i++, componentForLayer++) {
+        auto layerInfo = perfMap.find(componentForLayer->first);
+        if (layerInfo == perfMap.end()) {
+            InferenceEngine::InferenceEngineProfileInfo info = {};
+            info.status = InferenceEngine::InferenceEngineProfileInfo::EXECUTED;
+            info.execution_index = i;
+            snprintf(info.exec_type, sizeof(info.exec_type), "%s", quantized_network ? "SW_HOST" : (sw_fp32 ? "SW_FP32" : "SW"));
+            snprintf(info.layer_type, sizeof(info.layer_type), "%s", intel_dnn_operation_name[dnn.component[i].operation]);
+            layerInfo = perfMap.emplace(componentForLayer->first, info).first;
+        }
+        auto &info = layerInfo->second;
+        info.realTime_uSec += dnn.component_time_ns[i] / dnn.num_propagations / 1000;
+        info.cpu_uSec = info.realTime_uSec;
     }
 }
 
@@ -2488,6 +2521,8 @@ void GNAPlugin::SetConfig(const std::map<std::string, std::string> &config) {
         if (procType == supported_values.end()) {
             if (value == GNA_CONFIG_VALUE(SW_FP32)) {
                 sw_fp32 = true;
+            } else if (value == GNA_CONFIG_VALUE(SW_HOST)) {
+                sw_host = true;
             } else {
                 THROW_GNA_EXCEPTION << "GNA device mode unsupported: " << value;
             }
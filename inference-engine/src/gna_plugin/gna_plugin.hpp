@@ -86,6 +86,9 @@ class GNAPlugin : public InferenceEngine::IInferencePluginInternal, public std::
     uint8_t gna_lib_async_threads_num = 1;
     bool gna_openmp_multithreading = false;
     bool sw_fp32 = false;
+    // quantized network is propagated by the integer host emulation instead of the GNA library
+    bool sw_host = false;
+    bool quantized_network = false;
     // precision of GNA hardware model
     InferenceEngine::Precision gnaPrecision = InferenceEngine::Precision::I16;
 
@@ -0,0 +1,410 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+// intmath.cpp : integer math routines emulating the quantized GNA pipeline on the host
+//
+
+#include "intmath.h"
+#include "pwl.h"
+#include "gna_plugin_log.hpp"
+#include <cstdint>
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <vector>
+#include <ie_parallel.hpp>
+#include <cpu_detector.hpp>
+
+#ifdef HAVE_AVX2
+#include "cpu_x86_avx2/intmath_avx2.hpp"
+#endif
+
+namespace {
+
+// matrix products smaller than this number of multiply-adds aren't split between threads
+constexpr size_t igemm_parallel_threshold = 1 << 15;
+constexpr int igemm_rows_block = 16;
+// PWL is split between threads starting from this number of elements
+constexpr size_t pwl_parallel_threshold = 1 << 12;
+constexpr uint32_t pwl_chunk_size = 1 << 10;
+// input buffer of the device in elements for 1..8 columns, it holds igemm_pass_size(N) inputs of every column
+constexpr uint32_t input_buffer_size[] = {12288, 12288, 12096, 12288, 12000, 12096, 12096, 12288};
+constexpr uint32_t max_buffered_columns = sizeof(input_buffer_size) / sizeof(input_buffer_size[0]);
+
+inline int32_t saturate32(int64_t value) {
+    return static_cast<int32_t>(std::min<int64_t>(std::max<int64_t>(value, std::numeric_limits<int32_t>::min()),
+                                                  std::numeric_limits<int32_t>::max()));
+}
+
+int64_t dot16_ref(const int16_t *a, const int16_t *b, int K) {
+    int64_t sum = 0;
+    for (int k = 0; k < K; k++) {
+        sum += static_cast<int32_t>(a[k]) * b[k];
+    }
+    return sum;
+}
+
+int64_t dot8_ref(const int8_t *a, const int16_t *b, int K) {
+    int64_t sum = 0;
+    for (int k = 0; k < K; k++) {
+        sum += static_cast<int32_t>(a[k]) * b[k];
+    }
+    return sum;
+}
+
+void sbmv16_ref(int N, const int16_t *a, const int16_t *x, int32_t *y) {
+    for (int i = 0; i < N; i++) {
+        y[i] = saturate32(static_cast<int64_t>(y[i]) + static_cast<int32_t>(a[i]) * x[i]);
+    }
+}
+
+void sbmv8_ref(int N, const int8_t *a, const intel_compound_bias_t *bias, const int16_t *x, int32_t *y) {
+    for (int i = 0; i < N; i++) {
+        y[i] = saturate32(bias[i].bias + static_cast<int64_t>(bias[i].multiplier) * a[i] * x[i]);
+    }
+}
+
+uint32_t pwl16_ref(int N, const int32_t *in, int16_t *out, const intel_pwl_segment_t *ptr_segment,
+                   uint32_t num_segments) {
+    uint32_t num_saturate = 0;
+    for (int j = 0; j < N; j++) {
+        int32_t xbase = (int32_t) (ptr_segment[0].xBase & XBASEMASK);
+        int32_t input = in[j];
+        if (input <= xbase) {
+            out[j] = ptr_segment[0].yBase;
+        } else {
+            uint32_t slope_shift;
+            int16_t slope, ybase;
+            int64_t diff, prod, prod_shift, sum;
+            uint32_t k = num_segments / 2;
+            uint32_t k_upper = num_segments;
+            uint32_t k_lower = 0;
+            while (k_upper > k_lower + 1) {
+                xbase = (int32_t) (ptr_segment[k].xBase & XBASEMASK);
+                if (xbase > input) {
+                    k_upper = k;
+                    k = (k + k_lower) / 2;
+                } else {
+                    k_lower = k;
+                    k = (k_upper + k) / 2;
+                }
+            }
+            xbase = (int32_t) (ptr_segment[k].xBase & XBASEMASK);
+            slope_shift = ((ptr_segment[k].xBase & ~XBASEMASK) + 1) * 8;
+            slope = ptr_segment[k].slope;
+            ybase = ptr_segment[k].yBase;
+            diff = (int64_t) input - (int64_t) xbase;
+            prod = diff * slope;
+            prod_shift = prod >> slope_shift;
+            sum = prod_shift + (int64_t) ybase;
+            if (sum > 32767LL) {
+                out[j] = 32767;
+                num_saturate++;
+            } else if (sum < -32768LL) {
+                out[j] = -32768;
+                num_saturate++;
+            } else {
+                out[j] = (int16_t) sum;
+            }
+        }
+    }
+    return num_saturate;
+}
+
+// SIMD kernels of the best instruction set the CPU supports, they are bit-exact with the scalar loops
+struct IntMathKernels {
+    int64_t (*dot16)(const int16_t *a, const int16_t *b, int K);
+    int64_t (*dot8)(const int8_t *a, const int16_t *b, int K);
+    void (*sbmv16)(int N, const int16_t *a, const int16_t *x, int32_t *y);
+    void (*sbmv8)(int N, const int8_t *a, const intel_compound_bias_t *bias, const int16_t *x, int32_t *y);
+    uint32_t (*pwl16)(int N, const int32_t *in, int16_t *out, const intel_pwl_segment_t *segments,
+                      uint32_t num_segments);
+};
+
+IntMathKernels selectKernels() {
+#ifdef HAVE_AVX2
+    if (InferenceEngine::with_cpu_x86_avx2()) {
+        using namespace GNAPluginNS::avx2;
+        return {dot16, dot8, sbmv16, sbmv8, pwl16};
+    }
+#endif
+    return {dot16_ref, dot8_ref, sbmv16_ref, sbmv8_ref, pwl16_ref};
+}
+
+const IntMathKernels &kernels() {
+    static const IntMathKernels selected = selectKernels();
+    return selected;
+}
+
+// C[l][j] = accumulate(row(l), ...accumulate(row(l), init(row(l), C[l][j]), pass_0)..., pass_P)
+// where pass_p = sum(A[row(l)][k] * B[k][j]) over the p-th pass of k < K and row(l) = rows ? rows[l] : l
+template <typename W, typename Dot, typename Init, typename Accumulate>
+void igemm_nn(int L, int N, int K, const W *A, int lda, const uint32_t *rows,
+              const int16_t *B, int ldb, int32_t *C, int ldc, Dot dot, Init init, Accumulate accumulate) {
+    if (L <= 0 || N <= 0)
+        return;
+
+    // dot products need inputs of an output column to be contiguous, so interleaved inputs are transposed
+    thread_local std::vector<int16_t> transposed;
+    const int16_t *columns = B;
+    if (N > 1 || ldb != 1) {
+        transposed.resize(static_cast<size_t>(N) * K);
+        for (int k = 0; k < K; k++) {
+            for (int j = 0; j < N; j++) {
+                transposed[static_cast<size_t>(j) * K + k] = B[static_cast<size_t>(k) * ldb + j];
+            }
+        }
+        columns = transposed.data();
+    }
+
+    const int pass = static_cast<int>(igemm_pass_size(N));
+    const int num_blocks = (L + igemm_rows_block - 1) / igemm_rows_block;
+    auto igemm_block = [&](int b) {
+        const int l_end = std::min(L, (b + 1) * igemm_rows_block);
+        for (int l = b * igemm_rows_block; l < l_end; l++) {
+            const uint32_t i = rows ? rows[l] : l;
+            const W *a = A + static_cast<size_t>(i) * lda;
+            int32_t *c = C + static_cast<size_t>(l) * ldc;
+            for (int j = 0; j < N; j++) {
+                const int16_t *x = columns + static_cast<size_t>(j) * K;
+                int32_t acc = init(i, c[j]);
+                for (int k = 0; k < K; k += pass) {
+                    acc = accumulate(i, acc, dot(a + k, x + k, std::min(pass, K - k)));
+                }
+                c[j] = acc;
+            }
+        }
+    };
+
+    if (static_cast<size_t>(L) * N * K < igemm_parallel_threshold) {
+        for (int b = 0; b < num_blocks; b++)
+            igemm_block(b);
+    } else {
+        InferenceEngine::parallel_for(num_blocks, igemm_block);
+    }
+}
+
+void igemm8(int L, int N, int K, const int8_t *A, int lda, const uint32_t *rows,
+            const int16_t *B, int ldb, const intel_compound_bias_t *bias, int32_t *C, int ldc) {
+    igemm_nn(L, N, K, A, lda, rows, B, ldb, C, ldc, kernels().dot8,
+             [bias](uint32_t i, int32_t) {
+                 return bias[i].bias;
+             },
+             [bias](uint32_t i, int32_t acc, int64_t sum) {
+                 return saturate32(acc + static_cast<int64_t>(bias[i].multiplier) * sum);
+             });
+}
+
+void igemm16(int L, int N, int K, const int16_t *A, int lda, const uint32_t *rows,
+             const int16_t *B, int ldb, int32_t *C, int ldc) {
+    igemm_nn(L, N, K, A, lda, rows, B, ldb, C, ldc, kernels().dot16,
+             [](uint32_t, int32_t c) {
+                 return c;
+             },
+             [](uint32_t, int32_t acc, int64_t sum) {
+                 return saturate32(acc + sum);
+             });
+}
+
+// applies func(row, column_j_of_B, column_j_of_C) to every column of the diagonal transform
+template <typename F>
+void isbmm_columns(uint32_t M, uint32_t N, const int16_t *B, uint32_t ldb, int32_t *C, uint32_t ldc, const F &func) {
+    if (ldb == 1 && ldc == 1) {
+        func(B, C);
+        return;
+    }
+    thread_local std::vector<int16_t> x;
+    thread_local std::vector<int32_t> y;
+    x.resize(M);
+    y.resize(M);
+    for (uint32_t j = 0; j < N; j++) {
+        for (uint32_t i = 0; i < M; i++) {
+            x[i] = B[i * ldb + j];
+            y[i] = C[i * ldc + j];
+        }
+        func(x.data(), y.data());
+        for (uint32_t i = 0; i < M; i++) {
+            C[i * ldc + j] = y[i];
+        }
+    }
+}
+
+}  // namespace
+
+uint32_t igemm_pass_size(const uint32_t N) {
+    if (N == 0)
+        return input_buffer_size[0];
+    if (N > max_buffered_columns)
+        return std::max(1u, input_buffer_size[max_buffered_columns - 1] / N);
+    return input_buffer_size[N - 1] / N;
+}
+
+void igemm8_gna(const uint32_t M, const uint32_t N, const uint32_t K,
+                const int8_t *A, const uint32_t lda,
+                const int16_t *B, const uint32_t ldb,
+                const intel_compound_bias_t *bias,
+                int32_t *C, const uint32_t ldc) {
+    igemm8(M, N, K, A, lda, nullptr, B, ldb, bias, C, ldc);
+}
+
+void igemm8_gna_subset(const uint32_t M, const uint32_t N, const uint32_t K,
+                       const int8_t *A, const uint32_t lda,
+                       const int16_t *B, const uint32_t ldb,
+                       const intel_compound_bias_t *bias,
+                       int32_t *C, const uint32_t ldc,
+                       const uint32_t *OutputList, const uint32_t L) {
+    igemm8(L, N, K, A, lda, OutputList, B, ldb, bias, C, ldc);
+}
+
+void cblas_igemm16(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
+                   const CBLAS_TRANSPOSE TransB, const MKL_INT M, const MKL_INT N,
+                   const MKL_INT K, const float alpha, const int16_t *A,
+                   const MKL_INT lda, const int16_t *B, const MKL_INT ldb,
+                   const float beta, int32_t *C, const MKL_INT ldc) {
+    if ((Layout != CblasRowMajor) || (TransA != CblasNoTrans) || (TransB != CblasNoTrans)
+        || (alpha != 1.0) || (beta != 1.0)) {
+        THROW_GNA_EXCEPTION << "Only row major, not transposed matrices with alpha = beta = 1 are supported in cblas_igemm16";
+    }
+    igemm16(M, N, K, A, lda, nullptr, B, ldb, C, ldc);
+}
+
+void cblas_igemm16_subset(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
+                          const CBLAS_TRANSPOSE TransB, const MKL_INT M, const MKL_INT N,
+                          const MKL_INT K, const float alpha, const int16_t *A,
+                          const MKL_INT lda, const int16_t *B, const MKL_INT ldb,
+                          const float beta, int32_t *C, const MKL_INT ldc,
+                          const uint32_t *OutputList, const MKL_INT L) {
+    if ((Layout != CblasRowMajor) || (TransA != CblasNoTrans) || (TransB != CblasNoTrans)
+        || (alpha != 1.0) || (beta != 1.0)) {
+        THROW_GNA_EXCEPTION << "Only row major, not transposed matrices with alpha = beta = 1 are supported in cblas_igemm16_subset";
+    }
+    igemm16(L, N, K, A, lda, OutputList, B, ldb, C, ldc);
+}
+
+void isbmm8_gna(const uint32_t M, const uint32_t N, const int8_t *A,
+                const int16_t *B, const uint32_t ldb,
+                const intel_compound_bias_t *bias,
+                int32_t *C, const uint32_t ldc) {
+    auto sbmv8 = kernels().sbmv8;
+    isbmm_columns(M, N, B, ldb, C, ldc, [&](const int16_t *x, int32_t *y) {
+        sbmv8(M, A, bias, x, y);
+    });
+}
+
+void cblas_isbmm16(const uint32_t M, const uint32_t N, const int16_t *A,
+                   const int16_t *B, const uint32_t ldb,
+                   int32_t *C, const uint32_t ldc) {
+    auto sbmv16 = kernels().sbmv16;
+    isbmm_columns(M, N, B, ldb, C, ldc, [&](const int16_t *x, int32_t *y) {
+        sbmv16(M, A, x, y);
+    });
+}
+
+void igemv8_gna_split(const uint32_t N, const uint32_t K1, const uint32_t K2,
+                      const int16_t *A1, const int16_t *A2, const int8_t *X,
+                      const intel_compound_bias_t *B, int32_t *C) {
+    // the output is a single column of weights X by concatenated inputs and feedbacks
+    thread_local std::vector<int16_t> inputs;
+    inputs.resize(K1 + K2);
+    std::copy(A1, A1 + K1, inputs.begin());
+    std::copy(A2, A2 + K2, inputs.begin() + K1);
+    igemm8(N, 1, K1 + K2, X, K1 + K2, nullptr, inputs.data(), 1, B, C, 1);
+}
+
+void igemv16_split(const uint32_t N, const uint32_t K1, const uint32_t K2,
+                   const int16_t *A1, const int16_t *A2, const int16_t *X,
+                   const int32_t *B, int32_t *C) {
+    thread_local std::vector<int16_t> inputs;
+    inputs.resize(K1 + K2);
+    std::copy(A1, A1 + K1, inputs.begin());
+    std::copy(A2, A2 + K2, inputs.begin() + K1);
+    std::copy(B, B + N, C);
+    igemm16(N, 1, K1 + K2, X, K1 + K2, nullptr, inputs.data(), 1, C, 1);
+}
+
+void CNNFilter16(intel_dnn_component_t *component) {
+    auto ptr_filters = reinterpret_cast<const int16_t *>(component->op.conv1D.ptr_filters);
+    auto ptr_biases = reinterpret_cast<const int32_t *>(component->op.conv1D.ptr_biases);
+    auto ptr_inputs = reinterpret_cast<const int16_t *>(component->ptr_inputs);
+    auto ptr_outputs = reinterpret_cast<int32_t *>(component->ptr_outputs);
+    uint32_t num_filter_outputs = component->op.conv1D.num_feature_map_rows - component->op.conv1D.num_filter_rows + 1;
+    uint32_t
+        num_inputs_band_stride = component->op.conv1D.num_feature_maps * component->op.conv1D.num_feature_map_columns;
+    uint32_t num_filter_coefficients = component->op.conv1D.num_filter_coefficients;
+    const uint32_t num_filters = component->op.conv1D.num_filters;
+
+    if ((component->num_rows_in != 1) || (component->num_rows_out != 1)
+        || (component->num_columns_out != num_filter_outputs * num_filters)) {
+        THROW_GNA_EXCEPTION << "Bad problem dimensions in CNNFilter16!";
+    }
+
+    // every output is a dot product of a filter and inputs starting at the band stride,
+    // the latter are already contiguous so filters play the role of the weights
+    auto dot16 = kernels().dot16;
+    const uint32_t pass = igemm_pass_size(1);
+    auto filter_output = [&](uint32_t j) {
+        const int16_t *inputs = ptr_inputs + j * num_inputs_band_stride;
+        int32_t *outputs = ptr_outputs + j * num_filters;
+        for (uint32_t i = 0; i < num_filters; i++) {
+            const int16_t *filter = ptr_filters + i * num_filter_coefficients;
+            int32_t acc = ptr_biases[i];
+            for (uint32_t k = 0; k < num_filter_coefficients; k += pass) {
+                acc = saturate32(acc + dot16(filter + k, inputs + k, std::min(pass, num_filter_coefficients - k)));
+            }
+            outputs[i] = acc;
+        }
+    };
+
+    if (static_cast<size_t>(num_filter_outputs) * num_filters * num_filter_coefficients < igemm_parallel_threshold) {
+        for (uint32_t j = 0; j < num_filter_outputs; j++)
+            filter_output(j);
+    } else {
+        InferenceEngine::parallel_for(num_filter_outputs, filter_output);
+    }
+}
+
+void PwlApply16(intel_dnn_component_t *component, uint32_t num_subset_size) {
+    if (component->orientation_in == kDnnInterleavedOrientation) {  // subsets only supported in interleaved orientation
+        PwlApply16(component, 0, num_subset_size - 1, 0, component->num_columns_in - 1);
+    } else {
+        PwlApply16(component, 0, component->num_rows_in - 1, 0, component->num_columns_in - 1);
+    }
+}
+
+void PwlApply16(intel_dnn_component_t *component,
+                uint32_t num_row_start,
+                uint32_t num_row_end,
+                uint32_t num_col_start,
+                uint32_t num_col_end) {
+    std::atomic<uint32_t> num_saturate{0};
+    uint32_t num_segments = component->op.pwl.num_segments;
+    if (num_segments > 0) {
+        const intel_pwl_segment_t *ptr_segment = component->op.pwl.ptr_segments;
+        const uint32_t num_columns = component->num_columns_in;
+        const uint32_t num_cols = num_col_end - num_col_start + 1;
+        const uint32_t chunks_per_row = (num_cols + pwl_chunk_size - 1) / pwl_chunk_size;
+        const uint32_t num_chunks = (num_row_end - num_row_start + 1) * chunks_per_row;
+        auto pwl16 = kernels().pwl16;
+
+        auto apply = [&](uint32_t c) {
+            const uint32_t i = num_row_start + c / chunks_per_row;
+            const uint32_t j = num_col_start + (c % chunks_per_row) * pwl_chunk_size;
+            const uint32_t count = std::min(pwl_chunk_size, num_col_end + 1 - j);
+            num_saturate += pwl16(count,
+                                  reinterpret_cast<const int32_t *>(component->ptr_inputs) + i * num_columns + j,
+                                  reinterpret_cast<int16_t *>(component->ptr_outputs) + i * num_columns + j,
+                                  ptr_segment, num_segments);
+        };
+
+        if (static_cast<size_t>(num_row_end - num_row_start + 1) * num_cols < pwl_parallel_threshold) {
+            for (uint32_t c = 0; c < num_chunks; c++)
+                apply(c);
+        } else {
+            InferenceEngine::parallel_for(num_chunks, apply);
+        }
+    }
+
+    if (num_saturate > 0) {
+        fprintf(stderr, "Warning:  %d saturations in PwlApply16!\n", num_saturate.load());
+    }
+}
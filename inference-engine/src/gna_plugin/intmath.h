@@ -0,0 +1,75 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <stdint.h>
+#include "floatmath.h"
+
+//------------------------------------------------------------------------
+//
+// Host emulation of the quantized GNA math: int16 inputs multiplied by int8 or int16 weights.
+// Like the device, outputs are accumulated in int32 with saturation. The device streams inputs
+// through its buffer in passes of igemm_pass_size(N) inputs per column. Products of a pass are summed
+// exactly and the accumulator, which starts from the bias, is saturated after every pass.
+// For 1-byte weights every pass is scaled by the multiplier of the row's compound bias:
+//     out = bias.bias; out = saturate(out + bias.multiplier * sum(w * x over the pass)) for every pass
+// For 2-byte weights the outputs must be initialized with biases beforehand:
+//     out = saturate(out + sum(w * x over the pass)) for every pass
+// Results don't depend on blocking or threading.
+//
+//------------------------------------------------------------------------
+
+// number of inputs of every column accumulated exactly before the int32 saturation, N is the number of columns
+uint32_t igemm_pass_size(const uint32_t N);
+
+// C[i][j] for i < M, j < N; A is MxK, B is KxN (interleaved inputs), C is MxN
+void igemm8_gna(const uint32_t M, const uint32_t N, const uint32_t K,
+                const int8_t *A, const uint32_t lda,
+                const int16_t *B, const uint32_t ldb,
+                const intel_compound_bias_t *bias,
+                int32_t *C, const uint32_t ldc);
+
+// same as igemm8_gna for rows OutputList[l] of A, the l-th of which is written to C[l]
+void igemm8_gna_subset(const uint32_t M, const uint32_t N, const uint32_t K,
+                       const int8_t *A, const uint32_t lda,
+                       const int16_t *B, const uint32_t ldb,
+                       const intel_compound_bias_t *bias,
+                       int32_t *C, const uint32_t ldc,
+                       const uint32_t *OutputList, const uint32_t L);
+
+void cblas_igemm16(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
+                   const CBLAS_TRANSPOSE TransB, const MKL_INT M, const MKL_INT N,
+                   const MKL_INT K, const float alpha, const int16_t *A,
+                   const MKL_INT lda, const int16_t *B, const MKL_INT ldb,
+                   const float beta, int32_t *C, const MKL_INT ldc);
+
+void cblas_igemm16_subset(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
+                          const CBLAS_TRANSPOSE TransB, const MKL_INT M, const MKL_INT N,
+                          const MKL_INT K, const float alpha, const int16_t *A,
+                          const MKL_INT lda, const int16_t *B, const MKL_INT ldb,
+                          const float beta, int32_t *C, const MKL_INT ldc,
+                          const uint32_t *OutputList, const MKL_INT L);
+
+// diagonal transform: C[i][j] for i < M, j < N, where row i of B is multiplied by A[i]
+void isbmm8_gna(const uint32_t M, const uint32_t N, const int8_t *A,
+                const int16_t *B, const uint32_t ldb,
+                const intel_compound_bias_t *bias,
+                int32_t *C, const uint32_t ldc);
+
+void cblas_isbmm16(const uint32_t M, const uint32_t N, const int16_t *A,
+                   const int16_t *B, const uint32_t ldb,
+                   int32_t *C, const uint32_t ldc);
+
+// recurrent transform: C[i] for i < N from the concatenation of inputs A1 (K1) and feedbacks A2 (K2),
+// row i of X holds K1 + K2 weights
+void igemv8_gna_split(const uint32_t N, const uint32_t K1, const uint32_t K2,
+                      const int16_t *A1, const int16_t *A2, const int8_t *X,
+                      const intel_compound_bias_t *B, int32_t *C);
+
+void igemv16_split(const uint32_t N, const uint32_t K1, const uint32_t K2,
+                   const int16_t *A1, const int16_t *A2, const int16_t *X,
+                   const int32_t *B, int32_t *C);
+
+void CNNFilter16(intel_dnn_component_t *component);
@@ -40,6 +40,7 @@ InferenceEngine::Blob::Ptr CreateBlobFromData(const InferenceEngine::DataPtr &da
         case InferenceEngine::Precision::Q78:
         case InferenceEngine::Precision::I16:
         case InferenceEngine::Precision::FP16:
+        case InferenceEngine::Precision::BF16:
             return std::make_shared<InferenceEngine::TBlob<short>>(desc);
         case InferenceEngine::Precision::U8:
             return std::make_shared<InferenceEngine::TBlob<uint8_t>>(desc);
@@ -7,6 +7,12 @@
 #ifdef HAVE_SSE
 #include "blob_transform_sse42.hpp"
 #endif
+#ifdef HAVE_AVX2
+#include "blob_transform_avx2.hpp"
+#endif
+#ifdef HAVE_AVX512
+#include "blob_transform_avx512.hpp"
+#endif
 
 #include <cstdint>
 #include <cstdlib>
@@ -53,6 +59,17 @@ static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
         && C_src_stride == 1 && W_src_stride == 3 && W_dst_stride == 1 &&
         with_cpu_x86_sse42()) {
         if (PRC == Precision::U8) {
+#ifdef HAVE_AVX2
+            if (with_cpu_x86_avx2()) {
+                avx::blob_copy_4d_split_u8c3(reinterpret_cast<const uint8_t*>(src_ptr),
+                                             reinterpret_cast<      uint8_t*>(dst_ptr),
+                                             N_src_stride, H_src_stride,
+                                             N_dst_stride, H_dst_stride, C_dst_stride,
+                                             static_cast<int>(N), static_cast<int>(H),
+                                             static_cast<int>(W));
+                return;
+            }
+#endif
             blob_copy_4d_split_u8c3(reinterpret_cast<const uint8_t*>(src_ptr),
                                     reinterpret_cast<      uint8_t*>(dst_ptr),
                                     N_src_stride, H_src_stride,
@@ -63,6 +80,28 @@ static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
         }
 
         if (PRC == Precision::FP32) {
+#ifdef HAVE_AVX512
+            if (with_cpu_x86_avx512f()) {
+                avx512::blob_copy_4d_split_f32c3(reinterpret_cast<const float*>(src_ptr),
+                                                 reinterpret_cast<      float*>(dst_ptr),
+                                                 N_src_stride, H_src_stride,
+                                                 N_dst_stride, H_dst_stride, C_dst_stride,
+                                                 static_cast<int>(N), static_cast<int>(H),
+                                                 static_cast<int>(W));
+                return;
+            }
+#endif
+#ifdef HAVE_AVX2
+            if (with_cpu_x86_avx2()) {
+                avx::blob_copy_4d_split_f32c3(reinterpret_cast<const float*>(src_ptr),
+                                              reinterpret_cast<      float*>(dst_ptr),
+                                              N_src_stride, H_src_stride,
+                                              N_dst_stride, H_dst_stride, C_dst_stride,
+                                              static_cast<int>(N), static_cast<int>(H),
+                                              static_cast<int>(W));
+                return;
+            }
+#endif
             blob_copy_4d_split_f32c3(reinterpret_cast<const float*>(src_ptr),
                                      reinterpret_cast<      float*>(dst_ptr),
                                      N_src_stride, H_src_stride,
@@ -77,6 +116,17 @@ static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
         C_dst_stride == 1 && W_dst_stride == 3 && W_src_stride == 1 &&
         with_cpu_x86_sse42()) {
         if (PRC == Precision::U8) {
+#ifdef HAVE_AVX2
+            if (with_cpu_x86_avx2()) {
+                avx::blob_copy_4d_merge_u8c3(reinterpret_cast<const uint8_t*>(src_ptr),
+                                             reinterpret_cast<      uint8_t*>(dst_ptr),
+                                             N_src_stride, H_src_stride, C_src_stride,
+                                             N_dst_stride, H_dst_stride,
+                                             static_cast<int>(N), static_cast<int>(H),
+                                             static_cast<int>(W));
+                return;
+            }
+#endif
             blob_copy_4d_merge_u8c3(reinterpret_cast<const uint8_t*>(src_ptr),
                                     reinterpret_cast<      uint8_t*>(dst_ptr),
                                     N_src_stride, H_src_stride, C_src_stride,
@@ -87,6 +137,28 @@ static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
         }
 
         if (PRC == Precision::FP32) {
+#ifdef HAVE_AVX512
+            if (with_cpu_x86_avx512f()) {
+                avx512::blob_copy_4d_merge_f32c3(reinterpret_cast<const float*>(src_ptr),
+                                                 reinterpret_cast<      float*>(dst_ptr),
+                                                 N_src_stride, H_src_stride, C_src_stride,
+                                                 N_dst_stride, H_dst_stride,
+                                                 static_cast<int>(N), static_cast<int>(H),
+                                                 static_cast<int>(W));
+                return;
+            }
+#endif
+#ifdef HAVE_AVX2
+            if (with_cpu_x86_avx2()) {
+                avx::blob_copy_4d_merge_f32c3(reinterpret_cast<const float*>(src_ptr),
+                                              reinterpret_cast<      float*>(dst_ptr),
+                                              N_src_stride, H_src_stride, C_src_stride,
+                                              N_dst_stride, H_dst_stride,
+                                              static_cast<int>(N), static_cast<int>(H),
+                                              static_cast<int>(W));
+                return;
+            }
+#endif
             blob_copy_4d_merge_f32c3(reinterpret_cast<const float*>(src_ptr),
                                      reinterpret_cast<      float*>(dst_ptr),
                                      N_src_stride, H_src_stride, C_src_stride,
@@ -8,6 +8,7 @@
 #include <map>
 #include <list>
 #include <string>
+#include <vector>
 #include <mutex>
 #include <exception>
 #include <cpp_interfaces/interface/ie_iinfer_async_request_internal.hpp>
@@ -255,6 +256,10 @@ public:
         _syncRequest->SetBatch(batch);
     }
 
+    std::vector<IMemoryStateInternal::Ptr> QueryState_ThreadUnsafe() override {
+        return _syncRequest->QueryState();
+    }
+
 protected:
     ITaskExecutor::Ptr _requestExecutor;
     TaskSynchronizer::Ptr _requestSynchronizer;
@@ -7,6 +7,7 @@
 #include <memory>
 #include <map>
 #include <string>
+#include <vector>
 #include <atomic>
 #include <cpp_interfaces/ie_task.hpp>
 #include "cpp_interfaces/interface/ie_iinfer_async_request_internal.hpp"
@@ -93,6 +94,11 @@ public:
         SetBatch_ThreadUnsafe(batch);
     };
 
+    std::vector<IMemoryStateInternal::Ptr> QueryState() override {
+        if (isRequestBusy()) THROW_IE_EXCEPTION << InferenceEngine::details::as_status << StatusCode::REQUEST_BUSY << REQUEST_BUSY_str;
+        return QueryState_ThreadUnsafe();
+    }
+
     /**
      * @brief methods with _ThreadUnsafe prefix are to implement in plugins
      * or in default wrapper (e.g. AsyncInferRequestThreadSafeDefault)
@@ -115,6 +121,8 @@ public:
     virtual void GetBlob_ThreadUnsafe(const char *name, Blob::Ptr &data) = 0;
 
     virtual void SetBatch_ThreadUnsafe(int batch) = 0;
+
+    virtual std::vector<IMemoryStateInternal::Ptr> QueryState_ThreadUnsafe() = 0;
 };
 
 }  // namespace InferenceEngine
@@ -8,6 +8,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 #include <blob_factory.hpp>
 #include <ie_input_info.hpp>
 #include <ie_icnn_network.hpp>
@@ -185,6 +186,11 @@ public:
         THROW_IE_EXCEPTION << "Dynamic batch is not supported";
     };
 
+    std::vector<IMemoryStateInternal::Ptr> QueryState() override {
+        // meaning base plugin reports as no state available - plugin owners need to create proper override of this
+        return {};
+    }
+
     /**
      * @brief Checks and executes input data pre-processing if needed.
      */
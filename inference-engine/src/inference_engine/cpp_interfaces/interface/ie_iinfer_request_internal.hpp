@@ -7,8 +7,10 @@
 #include <memory>
 #include <map>
 #include <string>
+#include <vector>
 #include <ie_common.h>
 #include <ie_blob.h>
+#include <cpp_interfaces/interface/ie_imemory_state_internal.hpp>
 
 namespace InferenceEngine {
 
@@ -55,6 +57,12 @@ public:
     * @param batch - new batch size to be used by all the following inference calls for this request.
     */
     virtual void SetBatch(int batch) = 0;
+
+    /**
+    * @brief Queries memory states of the request
+    * @return states of the memory layers, every request reads and updates its own ones
+    */
+    virtual std::vector<IMemoryStateInternal::Ptr> QueryState() = 0;
 };
 
 }  // namespace InferenceEngine
@@ -28,4 +28,29 @@ bool with_cpu_x86_sse42() {
 #endif
 }
 
+bool with_cpu_x86_avx2() {
+#ifdef ENABLE_MKL_DNN
+    return cpu.has(Xbyak::util::Cpu::tAVX2);
+#else
+    return false;
+#endif
+}
+
+bool with_cpu_x86_avx512f() {
+#ifdef ENABLE_MKL_DNN
+    return cpu.has(Xbyak::util::Cpu::tAVX512F) && cpu.has(Xbyak::util::Cpu::tAVX512BW);
+#else
+    return false;
+#endif
+}
+
+bool with_cpu_x86_avx512_core() {
+#ifdef ENABLE_MKL_DNN
+    return cpu.has(Xbyak::util::Cpu::tAVX512F) && cpu.has(Xbyak::util::Cpu::tAVX512BW) &&
+           cpu.has(Xbyak::util::Cpu::tAVX512DQ) && cpu.has(Xbyak::util::Cpu::tAVX512VL);
+#else
+    return false;
+#endif
+}
+
 }  // namespace InferenceEngine
@@ -0,0 +1,1304 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#include "ie_preprocess_gapi_kernels.hpp"
+#include "ie_preprocess_gapi_kernels_impl.hpp"
+#include "ie_preprocess_gapi_kernels_avx2.hpp"
+
+#include "intrin_avx2.hpp"
+
+namespace InferenceEngine {
+namespace gapi {
+namespace kernels {
+namespace avx {
+
+using namespace InferenceEngine::avx;
+
+//------------------------------------------------------------------------------
+//
+// NB: results must be bit-exact with SSE 4.2 versions of these kernels,
+//     so keep the order of operations: e.g. do not use FMA for floats
+//
+//------------------------------------------------------------------------------
+
+static inline __m256i mm256_load_expand_u8(const uint8_t* ptr) {
+    return _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr)));
+}
+
+// (s0 - s1)*alpha + s1, where alpha is Q1.15 (same as SSE's v_mulhrs)
+static inline __m256i mm256_lerp_q15(__m256i s0, __m256i s1, __m256i alpha) {
+    return _mm256_add_epi16(_mm256_mulhrs_epi16(_mm256_sub_epi16(s0, s1), alpha), s1);
+}
+
+// saturate 16 shorts into 16 bytes
+static inline __m128i mm256_pack_u8(__m256i v) {
+    __m256i p = _mm256_packus_epi16(v, v);
+    return _mm256_castsi256_si128(_mm256_permute4x64_epi64(p, _MM_SHUFFLE(3, 1, 2, 0)));
+}
+
+// load two 128-bit halves from unrelated addresses
+static inline __m256i mm256_loadu2_si128(const void* hi, const void* lo) {
+    __m256i v = _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(lo)));
+    return _mm256_inserti128_si256(v, _mm_loadu_si128(reinterpret_cast<const __m128i*>(hi)), 1);
+}
+
+// store 4 rows of 16 pixels as 16 groups of 4 bytes: one pixel per row
+static inline void mm_store_interleave_4rows(uint8_t* ptr, __m128i r0, __m128i r1,
+                                                           __m128i r2, __m128i r3) {
+    __m128i a0 = _mm_unpacklo_epi8(r0, r1);
+    __m128i a1 = _mm_unpackhi_epi8(r0, r1);
+    __m128i b0 = _mm_unpacklo_epi8(r2, r3);
+    __m128i b1 = _mm_unpackhi_epi8(r2, r3);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(ptr +  0), _mm_unpacklo_epi16(a0, b0));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(ptr + 16), _mm_unpackhi_epi16(a0, b0));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(ptr + 32), _mm_unpacklo_epi16(a1, b1));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(ptr + 48), _mm_unpackhi_epi16(a1, b1));
+}
+
+//------------------------------------------------------------------------------
+
+// vertical pass of 4 rows at once: tmp gets groups of 4 pixels (a pixel per row)
+static void vertLinear_4rows(uint8_t tmp[], const uint8_t *src0[], const uint8_t *src1[],
+                             const short beta[], int length) {
+    GAPI_DbgAssert(length >= 16);
+
+    __m256i b0 = _mm256_set1_epi16(beta[0]);
+    __m256i b1 = _mm256_set1_epi16(beta[1]);
+    __m256i b2 = _mm256_set1_epi16(beta[2]);
+    __m256i b3 = _mm256_set1_epi16(beta[3]);
+
+    for (int w = 0; w < length; ) {
+        for (; w <= length - 16; w += 16) {
+            __m128i r0 = mm256_pack_u8(mm256_lerp_q15(mm256_load_expand_u8(&src0[0][w]),
+                                                      mm256_load_expand_u8(&src1[0][w]), b0));
+            __m128i r1 = mm256_pack_u8(mm256_lerp_q15(mm256_load_expand_u8(&src0[1][w]),
+                                                      mm256_load_expand_u8(&src1[1][w]), b1));
+            __m128i r2 = mm256_pack_u8(mm256_lerp_q15(mm256_load_expand_u8(&src0[2][w]),
+                                                      mm256_load_expand_u8(&src1[2][w]), b2));
+            __m128i r3 = mm256_pack_u8(mm256_lerp_q15(mm256_load_expand_u8(&src0[3][w]),
+                                                      mm256_load_expand_u8(&src1[3][w]), b3));
+            mm_store_interleave_4rows(&tmp[4*w], r0, r1, r2, r3);
+        }
+
+        if (w < length) {
+            w = length - 16;
+        }
+    }
+}
+
+// same as above, but without vertical interpolation (if y-ratio is 1)
+static void copyLinear_4rows(uint8_t tmp[], const uint8_t *src0[], int length) {
+    GAPI_DbgAssert(length >= 16);
+
+    for (int w = 0; w < length; ) {
+        for (; w <= length - 16; w += 16) {
+            __m128i r0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&src0[0][w]));
+            __m128i r1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&src0[1][w]));
+            __m128i r2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&src0[2][w]));
+            __m128i r3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&src0[3][w]));
+            mm_store_interleave_4rows(&tmp[4*w], r0, r1, r2, r3);
+        }
+
+        if (w < length) {
+            w = length - 16;
+        }
+    }
+}
+
+// horizontal pass of 4 rows at once: tmp is groups of 4 pixels (a pixel per row),
+// chanNum groups per source pixel, so channel c of pixel sx is tmp[4*(chanNum*sx + c)]
+template<int chanNum>
+static void horzLinear_4rows(uint8_t *dst[], const uint8_t tmp[], const short clone[],
+                             const short mapsx[], int length, int c) {
+    GAPI_DbgAssert(length >= 16);
+
+    // gather groups for pixels sx0 and sx1=sx0+1 so that each 128-bit lane
+    // holds a pair of dst pixels: {sx0[x], sx0[x+1], sx1[x], sx1[x+1]}
+    const __m256i lo   = _mm256_setr_epi32(0, 1, 0, 1, 4, 5, 4, 5);
+    const __m256i hi   = _mm256_setr_epi32(2, 3, 2, 3, 6, 7, 6, 7);
+    const __m256i next = _mm256_setr_epi32(0, 0, 4*chanNum, 4*chanNum, 0, 0, 4*chanNum, 4*chanNum);
+    const __m256i step = _mm256_set1_epi32(4*chanNum);
+    const __m256i chan = _mm256_set1_epi32(4*c);
+
+    // transpose 4x4 bytes of each 32-bit quarter of a lane (rows <-> pixels)
+    const __m256i tr = _mm256_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15,
+                                        0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+    const __m256i ord = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    const __m256i zero = _mm256_setzero_si256();
+
+    const int* base = reinterpret_cast<const int*>(tmp);
+
+    for (int x = 0; x < length; ) {
+        for (; x <= length - 16; x += 16) {
+            __m256i sx = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&mapsx[x]));
+            __m256i i0 = _mm256_cvtepi16_epi32(_mm256_castsi256_si128(sx));       // x+0..x+7
+            __m256i i1 = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(sx, 1));  // x+8..x+15
+            i0 = _mm256_add_epi32(_mm256_mullo_epi32(i0, step), chan);
+            i1 = _mm256_add_epi32(_mm256_mullo_epi32(i1, step), chan);
+
+            // pixels: (x+0, x+1 | x+4, x+5), (x+2, x+3 | x+6, x+7), etc
+            __m256i t0 = _mm256_i32gather_epi32(base, _mm256_add_epi32(_mm256_permutevar8x32_epi32(i0, lo), next), 1);
+            __m256i t1 = _mm256_i32gather_epi32(base, _mm256_add_epi32(_mm256_permutevar8x32_epi32(i0, hi), next), 1);
+            __m256i t2 = _mm256_i32gather_epi32(base, _mm256_add_epi32(_mm256_permutevar8x32_epi32(i1, lo), next), 1);
+            __m256i t3 = _mm256_i32gather_epi32(base, _mm256_add_epi32(_mm256_permutevar8x32_epi32(i1, hi), next), 1);
+
+            // clone has 4 copies of each alpha, so 8 shorts per pair of dst pixels
+            __m256i a0 = mm256_loadu2_si128(&clone[4*(x +  4)], &clone[4*(x +  0)]);
+            __m256i a1 = mm256_loadu2_si128(&clone[4*(x +  6)], &clone[4*(x +  2)]);
+            __m256i a2 = mm256_loadu2_si128(&clone[4*(x + 12)], &clone[4*(x +  8)]);
+            __m256i a3 = mm256_loadu2_si128(&clone[4*(x + 14)], &clone[4*(x + 10)]);
+
+            __m256i r0 = mm256_lerp_q15(_mm256_unpacklo_epi8(t0, zero), _mm256_unpackhi_epi8(t0, zero), a0);
+            __m256i r1 = mm256_lerp_q15(_mm256_unpacklo_epi8(t1, zero), _mm256_unpackhi_epi8(t1, zero), a1);
+            __m256i r2 = mm256_lerp_q15(_mm256_unpacklo_epi8(t2, zero), _mm256_unpackhi_epi8(t2, zero), a2);
+            __m256i r3 = mm256_lerp_q15(_mm256_unpacklo_epi8(t3, zero), _mm256_unpackhi_epi8(t3, zero), a3);
+
+            // lanes: 4 rows of (x+0..x+3 | x+4..x+7), 4 rows of (x+8..x+11 | x+12..x+15)
+            __m256i p0 = _mm256_shuffle_epi8(_mm256_packus_epi16(r0, r1), tr);
+            __m256i p1 = _mm256_shuffle_epi8(_mm256_packus_epi16(r2, r3), tr);
+
+            __m256i q01 = _mm256_permutevar8x32_epi32(_mm256_unpacklo_epi32(p0, p1), ord);
+            __m256i q23 = _mm256_permutevar8x32_epi32(_mm256_unpackhi_epi32(p0, p1), ord);
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(&dst[0][x]), _mm256_castsi256_si128(q01));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(&dst[1][x]), _mm256_extracti128_si256(q01, 1));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(&dst[2][x]), _mm256_castsi256_si128(q23));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(&dst[3][x]), _mm256_extracti128_si256(q23, 1));
+        }
+
+        if (x < length) {
+            x = length - 16;
+        }
+    }
+}
+
+// vertical pass of a single row
+static void vertLinear_row(uint8_t dst[], const uint8_t src0[], const uint8_t src1[],
+                           short beta, int length) {
+    GAPI_DbgAssert(length >= 16);
+
+    __m256i b = _mm256_set1_epi16(beta);
+
+    for (int w = 0; w < length; ) {
+        for (; w <= length - 16; w += 16) {
+            __m256i t = mm256_lerp_q15(mm256_load_expand_u8(&src0[w]), mm256_load_expand_u8(&src1[w]), b);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(&dst[w]), mm256_pack_u8(t));
+        }
+
+        if (w < length) {
+            w = length - 16;
+        }
+    }
+}
+
+// horizontal pass of a single row, channel c of pixel sx is src[chanNum*sx + c]
+template<int chanNum>
+static void horzLinear_row(uint8_t dst[], const uint8_t src[], const short alpha[],
+                           const short mapsx[], int length, int c) {
+    GAPI_DbgAssert(length >= 16);
+
+    const __m256i mask = _mm256_set1_epi16(0xFF);
+
+    for (int x = 0; x < length; ) {
+        for (; x <= length - 16; x += 16) {
+            // pairs of pixels: sx0 in low byte, sx1=sx0+1 in high byte
+            alignas(32) uint16_t pairs[16];
+            for (int i = 0; i < 16; i++) {
+                const uint8_t* s = &src[chanNum*mapsx[x + i] + c];
+                pairs[i] = static_cast<uint16_t>(s[0] | (s[chanNum] << 8));
+            }
+
+            __m256i p = _mm256_load_si256(reinterpret_cast<const __m256i*>(pairs));
+            __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&alpha[x]));
+            __m256i d = mm256_lerp_q15(_mm256_and_si256(p, mask), _mm256_srli_epi16(p, 8), a);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(&dst[x]), mm256_pack_u8(d));
+        }
+
+        if (x < length) {
+            x = length - 16;
+        }
+    }
+}
+
+// Resize (bi-linear, 8U)
+void calcRowLinear_8U(uint8_t *dst[],
+                const uint8_t *src0[],
+                const uint8_t *src1[],
+                const short    alpha[],
+                const short    clone[],  // 4 clones of alpha
+                const short    mapsx[],
+                const short    beta[],
+                      uint8_t  tmp[],
+                const Size   & inSz,
+                const Size   & outSz,
+                      int      lpi) {
+    bool xRatioEq1 = inSz.width  == outSz.width;
+    bool yRatioEq1 = inSz.height == outSz.height;
+
+    if (!xRatioEq1 && !yRatioEq1) {
+        if (4 == lpi) {
+            vertLinear_4rows(tmp, src0, src1, beta, inSz.width);
+            horzLinear_4rows<1>(dst, tmp, clone, mapsx, outSz.width, 0);
+        } else {  // if any lpi
+            for (int l = 0; l < lpi; l++) {
+                vertLinear_row(tmp, src0[l], src1[l], beta[l], inSz.width);
+                horzLinear_row<1>(dst[l], tmp, alpha, mapsx, outSz.width, 0);
+            }
+        }
+
+    } else if (!xRatioEq1) {
+        GAPI_DbgAssert(yRatioEq1);
+
+        if (4 == lpi) {
+            copyLinear_4rows(tmp, src0, inSz.width);
+            horzLinear_4rows<1>(dst, tmp, clone, mapsx, outSz.width, 0);
+        } else {  // any LPI
+            for (int l = 0; l < lpi; l++) {
+                horzLinear_row<1>(dst[l], src0[l], alpha, mapsx, outSz.width, 0);
+            }
+        }
+
+    } else if (!yRatioEq1) {
+        GAPI_DbgAssert(xRatioEq1);
+        for (int l = 0; l < lpi; l++) {
+            vertLinear_row(dst[l], src0[l], src1[l], beta[l], inSz.width);
+        }
+
+    } else {
+        GAPI_DbgAssert(xRatioEq1 && yRatioEq1);
+        int length = inSz.width;  // == outSz.width
+
+        for (int l = 0; l < lpi; l++) {
+            memcpy(dst[l], src0[l], length);
+        }
+    }
+}
+
+// Resize (bi-linear, 8UC3)
+void calcRowLinear_8UC3(std::array<std::array<uint8_t*, 4>, 3> &dst,
+                  const uint8_t *src0[],
+                  const uint8_t *src1[],
+                  const short    alpha[],
+                  const short    clone[],  // 4 clones of alpha
+                  const short    mapsx[],
+                  const short    beta[],
+                        uint8_t  tmp[],
+                  const Size    &inSz,
+                  const Size    &outSz,
+                        int      lpi) {
+    constexpr const int chanNum = 3;
+
+    if (4 == lpi) {
+        vertLinear_4rows(tmp, src0, src1, beta, inSz.width*chanNum);
+        for (int c = 0; c < chanNum; c++) {
+            horzLinear_4rows<chanNum>(dst[c].data(), tmp, clone, mapsx, outSz.width, c);
+        }
+    } else {  // if any lpi
+        for (int l = 0; l < lpi; l++) {
+            vertLinear_row(tmp, src0[l], src1[l], beta[l], inSz.width*chanNum);
+            for (int c = 0; c < chanNum; c++) {
+                horzLinear_row<chanNum>(dst[c][l], tmp, alpha, mapsx, outSz.width, c);
+            }
+        }
+    }
+}
+
+// Resize (bi-linear, 32F)
+void calcRowLinear_32F(float *dst[],
+                 const float *src0[],
+                 const float *src1[],
+                 const float  alpha[],
+                 const int    mapsx[],
+                 const float  beta[],
+                 const Size & inSz,
+                 const Size & outSz,
+                       int    lpi) {
+    bool xRatioEq1 = inSz.width  == outSz.width;
+    bool yRatioEq1 = inSz.height == outSz.height;
+
+    if (!xRatioEq1 && !yRatioEq1) {
+        for (int l = 0; l < lpi; l++) {
+            float beta0 = beta[l];
+            float beta1 = 1 - beta0;
+            __m256 vbeta = _mm256_set1_ps(beta0);
+
+            int x = 0;
+
+            for (; x <= outSz.width - 8; x += 8) {
+                __m256 alpha0 = _mm256_loadu_ps(&alpha[x]);
+                __m256i sx0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&mapsx[x]));
+                __m256i sx1 = _mm256_add_epi32(sx0, _mm256_set1_epi32(1));
+
+                __m256 s00 = _mm256_i32gather_ps(src0[l], sx0, 4);
+                __m256 s01 = _mm256_i32gather_ps(src0[l], sx1, 4);
+                __m256 s10 = _mm256_i32gather_ps(src1[l], sx0, 4);
+                __m256 s11 = _mm256_i32gather_ps(src1[l], sx1, 4);
+
+                __m256 res0 = _mm256_add_ps(_mm256_mul_ps(_mm256_sub_ps(s00, s01), alpha0), s01);
+                __m256 res1 = _mm256_add_ps(_mm256_mul_ps(_mm256_sub_ps(s10, s11), alpha0), s11);
+                __m256 d = _mm256_add_ps(_mm256_mul_ps(_mm256_sub_ps(res0, res1), vbeta), res1);
+
+                _mm256_storeu_ps(&dst[l][x], d);
+            }
+
+            // NB: the scalar tail rounds differently, so keep it as short as in SSE 4.2 version
+            for (; x <= outSz.width - 4; x += 4) {
+                __m128 alpha0 = _mm_loadu_ps(&alpha[x]);
+                __m128i sx0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&mapsx[x]));
+                __m128i sx1 = _mm_add_epi32(sx0, _mm_set1_epi32(1));
+
+                __m128 s00 = _mm_i32gather_ps(src0[l], sx0, 4);
+                __m128 s01 = _mm_i32gather_ps(src0[l], sx1, 4);
+                __m128 s10 = _mm_i32gather_ps(src1[l], sx0, 4);
+                __m128 s11 = _mm_i32gather_ps(src1[l], sx1, 4);
+
+                __m128 res0 = _mm_add_ps(_mm_mul_ps(_mm_sub_ps(s00, s01), alpha0), s01);
+                __m128 res1 = _mm_add_ps(_mm_mul_ps(_mm_sub_ps(s10, s11), alpha0), s11);
+                __m128 d = _mm_add_ps(_mm_mul_ps(_mm_sub_ps(res0, res1), _mm256_castps256_ps128(vbeta)), res1);
+
+                _mm_storeu_ps(&dst[l][x], d);
+            }
+
+            for (; x < outSz.width; x++) {
+                float alpha0 = alpha[x];
+                float alpha1 = 1 - alpha0;
+                int   sx0 = mapsx[x];
+                int   sx1 = sx0 + 1;
+                float res0 = src0[l][sx0]*alpha0 + src0[l][sx1]*alpha1;
+                float res1 = src1[l][sx0]*alpha0 + src1[l][sx1]*alpha1;
+                dst[l][x] = beta0*res0 + beta1*res1;
+            }
+        }
+
+    } else if (!xRatioEq1) {
+        GAPI_DbgAssert(yRatioEq1);
+
+        for (int l = 0; l < lpi; l++) {
+            int x = 0;
+
+            for (; x <= outSz.width - 8; x += 8) {
+                __m256 alpha0 = _mm256_loadu_ps(&alpha[x]);
+                __m256i sx0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&mapsx[x]));
+                __m256i sx1 = _mm256_add_epi32(sx0, _mm256_set1_epi32(1));
+
+                __m256 s00 = _mm256_i32gather_ps(src0[l], sx0, 4);
+                __m256 s01 = _mm256_i32gather_ps(src0[l], sx1, 4);
+
+                __m256 d = _mm256_add_ps(_mm256_mul_ps(_mm256_sub_ps(s00, s01), alpha0), s01);
+
+                _mm256_storeu_ps(&dst[l][x], d);
+            }
+
+            for (; x <= outSz.width - 4; x += 4) {
+                __m128 alpha0 = _mm_loadu_ps(&alpha[x]);
+                __m128i sx0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&mapsx[x]));
+                __m128i sx1 = _mm_add_epi32(sx0, _mm_set1_epi32(1));
+
+                __m128 s00 = _mm_i32gather_ps(src0[l], sx0, 4);
+                __m128 s01 = _mm_i32gather_ps(src0[l], sx1, 4);
+
+                __m128 d = _mm_add_ps(_mm_mul_ps(_mm_sub_ps(s00, s01), alpha0), s01);
+
+                _mm_storeu_ps(&dst[l][x], d);
+            }
+
+            for (; x < outSz.width; x++) {
+                float alpha0 = alpha[x];
+                float alpha1 = 1 - alpha0;
+                int   sx0 = mapsx[x];
+                int   sx1 = sx0 + 1;
+                dst[l][x] = src0[l][sx0]*alpha0 + src0[l][sx1]*alpha1;
+            }
+        }
+
+    } else if (!yRatioEq1) {
+        GAPI_DbgAssert(xRatioEq1);
+        int length = inSz.width;  // == outSz.width
+
+        for (int l = 0; l < lpi; l++) {
+            float beta0 = beta[l];
+            float beta1 = 1 - beta0;
+            __m256 vbeta = _mm256_set1_ps(beta0);
+
+            int x = 0;
+
+            for (; x <= length - 8; x += 8) {
+                __m256 s0 = _mm256_loadu_ps(&src0[l][x]);
+                __m256 s1 = _mm256_loadu_ps(&src1[l][x]);
+                __m256 d = _mm256_add_ps(_mm256_mul_ps(_mm256_sub_ps(s0, s1), vbeta), s1);
+                _mm256_storeu_ps(&dst[l][x], d);
+            }
+
+            for (; x <= length - 4; x += 4) {
+                __m128 s0 = _mm_loadu_ps(&src0[l][x]);
+                __m128 s1 = _mm_loadu_ps(&src1[l][x]);
+                __m128 d = _mm_add_ps(_mm_mul_ps(_mm_sub_ps(s0, s1), _mm256_castps256_ps128(vbeta)), s1);
+                _mm_storeu_ps(&dst[l][x], d);
+            }
+
+            for (; x < length; x++) {
+                dst[l][x] = beta0*src0[l][x] + beta1*src1[l][x];
+            }
+        }
+
+    } else {
+        GAPI_DbgAssert(xRatioEq1 && yRatioEq1);
+        int length = inSz.width;  // == outSz.width
+        for (int l = 0; l < lpi; l++) {
+            memcpy(dst[l], src0[l], length * sizeof(float));
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+
+// vertical pass
+static inline void downy_vec(const uint8_t *src[], int w, int inWidth, const MapperUnit8U& ymap,
+                             Q0_16 yalpha, Q8_8 vbuf[], int y_1st, int ylast) {
+    __m256i a0 = _mm256_set1_epi16(static_cast<short>(ymap.alpha0));
+    __m256i a1 = _mm256_set1_epi16(static_cast<short>(ymap.alpha1));
+    for (; w <= inWidth - 16; w += 16) {
+        __m256i vsrc0 = _mm256_slli_epi16(mm256_load_expand_u8(&src[0][w]), 8);
+        __m256i vsrc1 = _mm256_slli_epi16(mm256_load_expand_u8(&src[ylast - y_1st][w]), 8);
+        __m256i vres = _mm256_add_epi16(_mm256_mulhi_epu16(vsrc0, a0),
+                                        _mm256_mulhi_epu16(vsrc1, a1));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&vbuf[w]), vres);
+    }
+    for (; w < inWidth; w++) {
+        vbuf[w] = mulas(ymap.alpha0, src[0][w])
+                + mulas(ymap.alpha1, src[ylast - y_1st][w]);
+    }
+
+    __m256i ya = _mm256_set1_epi16(static_cast<short>(yalpha));
+    for (int i = 1; i < ylast - y_1st; i++) {
+        int x = 0;
+        for (; x <= inWidth - 16; x += 16) {
+            __m256i vsrc = _mm256_slli_epi16(mm256_load_expand_u8(&src[i][x]), 8);
+            __m256i vres = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&vbuf[x]));
+            vres = _mm256_add_epi16(vres, _mm256_mulhi_epu16(vsrc, ya));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(&vbuf[x]), vres);
+        }
+        for (; x < inWidth; x++) {
+            vbuf[x] += mulas(yalpha, src[i][x]);
+        }
+    }
+}
+
+static inline void downy_vec(const float *src[], int w, int inWidth, const MapperUnit32F& ymap,
+                             float yalpha, float vbuf[], int y_1st, int ylast) {
+    __m256 a0 = _mm256_set1_ps(ymap.alpha0);
+    __m256 a1 = _mm256_set1_ps(ymap.alpha1);
+    for (; w <= inWidth - 8; w += 8) {
+        __m256 vres = _mm256_add_ps(_mm256_mul_ps(a0, _mm256_loadu_ps(&src[0][w])),
+                                    _mm256_mul_ps(a1, _mm256_loadu_ps(&src[ylast - y_1st][w])));
+        _mm256_storeu_ps(&vbuf[w], vres);
+    }
+    for (; w < inWidth; w++) {
+        vbuf[w] = mulas(ymap.alpha0, src[0][w])
+                + mulas(ymap.alpha1, src[ylast - y_1st][w]);
+    }
+
+    __m256 ya = _mm256_set1_ps(yalpha);
+    for (int i = 1; i < ylast - y_1st; i++) {
+        int x = 0;
+        for (; x <= inWidth - 8; x += 8) {
+            __m256 vres = _mm256_add_ps(_mm256_loadu_ps(&vbuf[x]),
+                                        _mm256_mul_ps(ya, _mm256_loadu_ps(&src[i][x])));
+            _mm256_storeu_ps(&vbuf[x], vres);
+        }
+        for (; x < inWidth; x++) {
+            vbuf[x] += mulas(yalpha, src[i][x]);
+        }
+    }
+}
+
+template<typename T, typename A, typename I, typename W>
+static inline void downy(const T *src[], int inWidth, const MapperUnit<A, I>& ymap, A yalpha,
+                         W vbuf[]) {
+    int y_1st = ymap.index0;
+    int ylast = ymap.index1 - 1;
+
+    // yratio > 1, so at least 2 rows
+    GAPI_DbgAssert(y_1st < ylast);
+
+    downy_vec(src, 0, inWidth, ymap, yalpha, vbuf, y_1st, ylast);
+}
+
+// horizontal pass
+template<typename T, typename A, typename I, typename W>
+static inline void downx(T dst[], int outWidth, int xmaxdf, const I xindex[], const A xalpha[],
+                         const W vbuf[]) {
+#define HSUM(xmaxdf) \
+    for (int x = 0; x < outWidth; x++) { \
+        int      index =  xindex[x]; \
+        const A *alpha = &xalpha[x * xmaxdf]; \
+\
+        W sum = 0; \
+        for (int i = 0; i < xmaxdf; i++) { \
+            sum += mulaw(alpha[i], vbuf[index + i]); \
+        } \
+\
+        dst[x] = convert_cast<T>(sum); \
+    }
+
+    if (2 == xmaxdf) {
+        HSUM(2);
+    } else if (3 == xmaxdf) {
+        HSUM(3);
+    } else if (4 == xmaxdf) {
+        HSUM(4);
+    } else if (5 == xmaxdf) {
+        HSUM(5);
+    } else if (6 == xmaxdf) {
+        HSUM(6);
+    } else if (7 == xmaxdf) {
+        HSUM(7);
+    } else if (8 == xmaxdf) {
+        HSUM(8);
+    } else {
+        HSUM(xmaxdf);
+    }
+#undef HSUM
+}
+
+template<typename T, typename A, typename I, typename W>
+static void calcRowArea_impl(T dst[], const T *src[], const Size& inSz, const Size& outSz,
+    A yalpha, const MapperUnit<A, I>& ymap, int xmaxdf, const I xindex[], const A xalpha[],
+    W vbuf[]) {
+    bool xRatioEq1 = inSz.width  == outSz.width;
+    bool yRatioEq1 = inSz.height == outSz.height;
+
+    if (!yRatioEq1 && !xRatioEq1) {
+        downy(src, inSz.width, ymap, yalpha, vbuf);
+        downx(dst, outSz.width, xmaxdf, xindex, xalpha, vbuf);
+
+    } else if (!yRatioEq1) {
+        GAPI_DbgAssert(xRatioEq1);
+        downy(src, inSz.width, ymap, yalpha, vbuf);
+        for (int x = 0; x < outSz.width; x++) {
+            dst[x] = convert_cast<T>(vbuf[x]);
+        }
+
+    } else if (!xRatioEq1) {
+        GAPI_DbgAssert(yRatioEq1);
+        for (int w = 0; w < inSz.width; w++) {
+            vbuf[w] = convert_cast<W>(src[0][w]);
+        }
+        downx(dst, outSz.width, xmaxdf, xindex, xalpha, vbuf);
+
+    } else {
+        GAPI_DbgAssert(xRatioEq1 && yRatioEq1);
+        memcpy(dst, src[0], outSz.width * sizeof(T));
+    }
+}
+
+void calcRowArea_8U(uchar dst[], const uchar *src[], const Size& inSz, const Size& outSz,
+    Q0_16 yalpha, const MapperUnit8U &ymap, int xmaxdf, const short xindex[], const Q0_16 xalpha[],
+    Q8_8 vbuf[]) {
+    calcRowArea_impl(dst, src, inSz, outSz, yalpha, ymap, xmaxdf, xindex, xalpha, vbuf);
+}
+
+void calcRowArea_32F(float dst[], const float *src[], const Size& inSz, const Size& outSz,
+    float yalpha, const MapperUnit32F& ymap, int xmaxdf, const int xindex[], const float xalpha[],
+    float vbuf[]) {
+    calcRowArea_impl(dst, src, inSz, outSz, yalpha, ymap, xmaxdf, xindex, xalpha, vbuf);
+}
+
+//------------------------------------------------------------------------------
+#if USE_CVKL
+
+static inline uint8_t saturateU32toU8(uint32_t v) {
+    return static_cast<uint8_t>(v > UINT8_MAX ? UINT8_MAX : v);
+}
+
+static inline uint16_t mulq16(uint16_t a, uint16_t b) {
+    return static_cast<uint16_t>(((uint32_t)a * (uint32_t)b) >> 16);
+}
+
+// horizontal pass for x_max_count = 2, 3, 4: same as SSE 4.2 version,
+// but two 8-pixel blocks at once (one block per 128-bit lane)
+template<int K>
+static void horzArea_CVKL_U8(uint8_t dst[], const uint16_t vert_sum[], const uint16_t xsi[],
+                             const uint16_t* const alpha[], const uint16_t* const sxid[],
+                             int dwidth, int& x) {
+    for (; x <= dwidth - 16; x += 16) {
+        __m256i res = _mm256_set1_epi16(1 << (8 - 1));
+
+        int id0 = xsi[x];
+        int id1 = xsi[x + 8];
+
+        __m256i chunk[K];
+        for (int j = 0; j < K; j++) {
+            chunk[j] = mm256_loadu2_si128(vert_sum + id1 + 8*j, vert_sum + id0 + 8*j);
+        }
+
+        for (int k = 0; k < K; k++) {
+            __m256i vsum = _mm256_setzero_si256();
+            for (int j = 0; j < K; j++) {
+                __m256i sx_id = mm256_loadu2_si128(sxid[k] + (x + 8) * K + 8*j, sxid[k] + x * K + 8*j);
+                vsum = _mm256_or_si256(vsum, _mm256_shuffle_epi8(chunk[j], sx_id));
+            }
+            __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(alpha[k] + x));
+            res = _mm256_add_epi16(res, _mm256_mulhi_epu16(a, vsum));
+        }
+
+        res = _mm256_srli_epi16(res, 8);
+        res = _mm256_packus_epi16(res, res);
+        res = _mm256_permute4x64_epi64(res, _MM_SHUFFLE(0, 0, 2, 0));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + x), _mm256_castsi256_si128(res));
+    }
+
+    // one more 8-pixel block (if any) exactly as SSE 4.2 version does
+    for (; x <= dwidth - 8; x += 8) {
+        __m128i res = _mm_set1_epi16(1 << (8 - 1));
+
+        int id0 = xsi[x];
+
+        __m128i chunk[K];
+        for (int j = 0; j < K; j++) {
+            chunk[j] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(vert_sum + id0 + 8*j));
+        }
+
+        for (int k = 0; k < K; k++) {
+            __m128i vsum = _mm_setzero_si128();
+            for (int j = 0; j < K; j++) {
+                __m128i sx_id = _mm_loadu_si128(reinterpret_cast<const __m128i*>(sxid[k] + x * K + 8*j));
+                vsum = _mm_or_si128(vsum, _mm_shuffle_epi8(chunk[j], sx_id));
+            }
+            __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(alpha[k] + x));
+            res = _mm_add_epi16(res, _mm_mulhi_epu16(a, vsum));
+        }
+
+        res = _mm_srli_epi16(res, 8);
+        res = _mm_packus_epi16(res, res);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + x), res);
+    }
+
+    for (; x < dwidth; x++) {
+        uint16_t res = 1 << (8 - 1);
+        int id = xsi[x];
+        for (int k = 0; k < K; k++) {
+            res += mulq16(alpha[k][x], vert_sum[id + k]);
+        }
+        dst[x] = saturateU32toU8(res >> 8);
+    }
+}
+
+void calcRowArea_CVKL_U8(const uchar  * src[],
+                               uchar    dst[],
+                         const Size   & inSz,
+                         const Size   & outSz,
+                               int      y,
+                         const uint16_t xsi[],
+                         const uint16_t ysi[],
+                         const uint16_t xalpha[],
+                         const uint16_t yalpha[],
+                               int      x_max_count,
+                               int      y_max_count,
+                               uint16_t vert_sum[]) {
+    int dwidth  = outSz.width;
+    int swidth  =  inSz.width;
+    int sheight =  inSz.height;
+
+    int vest_sum_size = 2*swidth;
+    uint16_t* alpha0 = vert_sum + vest_sum_size;
+    uint16_t* alpha1 = alpha0 + dwidth;
+    uint16_t* alpha2 = alpha1 + dwidth;
+    uint16_t* alpha3 = alpha2 + dwidth;
+    uint16_t* sxid0 = alpha3 + dwidth;
+    uint16_t* sxid1 = sxid0 + 4*dwidth;
+    uint16_t* sxid2 = sxid1 + 4*dwidth;
+    uint16_t* sxid3 = sxid2 + 4*dwidth;
+
+    uint8_t * pdst_row  = dst;
+    uint16_t* vert_sum_ = vert_sum;
+
+    int ysi_row = ysi[y];
+
+    memset(vert_sum_, 0, swidth * sizeof(uint16_t));
+
+    for (int dy = 0; dy < y_max_count; dy++) {
+        if (ysi_row + dy >= sheight)
+            break;
+
+        uint16_t yalpha_dy = yalpha[y * y_max_count + dy];
+        const uint8_t *sptr_dy = src[dy];
+
+        int x = 0;
+
+        __m256i yalpha_dy_avx = _mm256_set1_epi16(yalpha_dy);
+        for (; x <= swidth - 16; x += 16) {
+            // sptr_dy[x] << 8
+            __m256i sval_Q16 = _mm256_slli_epi16(mm256_load_expand_u8(sptr_dy + x), 8);
+
+            __m256i vsum = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(vert_sum_ + x));
+            vsum = _mm256_add_epi16(vsum, _mm256_mulhi_epu16(yalpha_dy_avx, sval_Q16));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(vert_sum_ + x), vsum);
+        }
+
+        for (; x < swidth; x++) {
+            vert_sum_[x] += mulq16(yalpha_dy, static_cast<uint16_t>(sptr_dy[x] << 8));
+        }
+    }
+
+    const uint16_t* const alpha[] = {alpha0, alpha1, alpha2, alpha3};
+    const uint16_t* const sxid[] = {sxid0, sxid1, sxid2, sxid3};
+
+    if (x_max_count == 2) {
+        int x = 0;
+        horzArea_CVKL_U8<2>(pdst_row, vert_sum_, xsi, alpha, sxid, dwidth, x);
+    } else if (x_max_count == 3) {
+        int x = 0;
+        horzArea_CVKL_U8<3>(pdst_row, vert_sum_, xsi, alpha, sxid, dwidth, x);
+    } else if (x_max_count == 4) {
+        int x = 0;
+        horzArea_CVKL_U8<4>(pdst_row, vert_sum_, xsi, alpha, sxid, dwidth, x);
+    } else if (x_max_count <= 7) {
+        int x = 0;
+        for (; x <= dwidth - 16; x += 16) {
+            __m256i res = _mm256_set1_epi16(1 << (16 - 8 - 1));
+            for (int i = 0; i < x_max_count; i++) {
+                alignas(32) uint16_t a[16], s[16];
+                for (int j = 0; j < 16; j++) {
+                    a[j] = xalpha[(x + j) * x_max_count + i];
+                    s[j] = vert_sum_[xsi[x + j] + i];
+                }
+                __m256i valpha = _mm256_load_si256(reinterpret_cast<const __m256i*>(a));
+                __m256i vvert_sum = _mm256_load_si256(reinterpret_cast<const __m256i*>(s));
+
+                res = _mm256_add_epi16(res, _mm256_mulhi_epu16(valpha, vvert_sum));
+            }
+            res = _mm256_srli_epi16(res, 8);
+            res = _mm256_packus_epi16(res, res);
+            res = _mm256_permute4x64_epi64(res, _MM_SHUFFLE(0, 0, 2, 0));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(pdst_row + x), _mm256_castsi256_si128(res));
+        }
+
+        for (; x < dwidth; x++) {
+            uint16_t res = 1 << (8 - 1);
+            for (int i = 0; i < x_max_count; i++) {
+                uint16_t a = xalpha[x * x_max_count + i];
+                int sx = xsi[x] + i;
+
+                res += mulq16(a, vert_sum_[sx]);
+            }
+            pdst_row[x] = saturateU32toU8(res >> 8);
+        }
+    } else {
+        for (int x = 0; x < dwidth; x++) {
+            uint16_t res = 1 << (8 - 1);
+            __m256i vres = _mm256_setzero_si256();
+            int id = xsi[x];
+
+            int i = 0;
+            for (; i <= x_max_count - 16; i += 16) {
+                __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(xalpha + x * x_max_count + i));
+                __m256i s = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(vert_sum_ + id + i));
+
+                vres = _mm256_add_epi16(vres, _mm256_mulhi_epu16(a, s));
+            }
+            // sums are modulo 2^16, so the order of additions does not matter
+            __m128i vsum = _mm_add_epi16(_mm256_castsi256_si128(vres), _mm256_extracti128_si256(vres, 1));
+            vsum = _mm_add_epi16(vsum, _mm_srli_si128(vsum, 8));
+            vsum = _mm_add_epi16(vsum, _mm_srli_si128(vsum, 4));
+            vsum = _mm_add_epi16(vsum, _mm_srli_si128(vsum, 2));
+            res += static_cast<uint16_t>(_mm_extract_epi16(vsum, 0));
+
+            for (; i < x_max_count; i++) {
+                uint16_t a = xalpha[x * x_max_count + i];
+                uint16_t s = vert_sum_[id + i];
+
+                res += mulq16(a, s);
+            }
+
+            pdst_row[x] = saturateU32toU8(res >> 8);
+        }
+    }
+}
+
+#endif  // CVKL
+
+//------------------------------------------------------------------------------
+
+void mergeRow_8UC2(const uint8_t in0[],
+                   const uint8_t in1[],
+                         uint8_t out[],
+                             int length) {
+    int l = 0;
+
+    for (; l <= length - 32; l += 32) {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&in0[l]));
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&in1[l]));
+        mm256_store_interleave(&out[2*l], a, b);
+    }
+
+    for (; l < length; l++) {
+        out[2*l + 0] = in0[l];
+        out[2*l + 1] = in1[l];
+    }
+}
+
+void mergeRow_8UC3(const uint8_t in0[],
+                   const uint8_t in1[],
+                   const uint8_t in2[],
+                         uint8_t out[],
+                             int length) {
+    int l = 0;
+
+    for (; l <= length - 32; l += 32) {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&in0[l]));
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&in1[l]));
+        __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&in2[l]));
+        mm256_store_interleave(&out[3*l], a, b, c);
+    }
+
+    for (; l < length; l++) {
+        out[3*l + 0] = in0[l];
+        out[3*l + 1] = in1[l];
+        out[3*l + 2] = in2[l];
+    }
+}
+
+void mergeRow_8UC4(const uint8_t in0[],
+                   const uint8_t in1[],
+                   const uint8_t in2[],
+                   const uint8_t in3[],
+                         uint8_t out[],
+                             int length) {
+    int l = 0;
+
+    for (; l <= length - 32; l += 32) {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&in0[l]));
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&in1[l]));
+        __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&in2[l]));
+        __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&in3[l]));
+        mm256_store_interleave(&out[4*l], a, b, c, d);
+    }
+
+    for (; l < length; l++) {
+        out[4*l + 0] = in0[l];
+        out[4*l + 1] = in1[l];
+        out[4*l + 2] = in2[l];
+        out[4*l + 3] = in3[l];
+    }
+}
+
+void mergeRow_32FC2(const float in0[],
+                    const float in1[],
+                          float out[],
+                            int length) {
+    int l = 0;
+
+    for (; l <= length - 8; l += 8) {
+        __m256 a = _mm256_loadu_ps(&in0[l]);
+        __m256 b = _mm256_loadu_ps(&in1[l]);
+        mm256_store_interleave(&out[2*l], a, b);
+    }
+
+    for (; l < length; l++) {
+        out[2*l + 0] = in0[l];
+        out[2*l + 1] = in1[l];
+    }
+}
+
+void mergeRow_32FC3(const float in0[],
+                    const float in1[],
+                    const float in2[],
+                          float out[],
+                            int length) {
+    int l = 0;
+
+    for (; l <= length - 8; l += 8) {
+        __m256 a = _mm256_loadu_ps(&in0[l]);
+        __m256 b = _mm256_loadu_ps(&in1[l]);
+        __m256 c = _mm256_loadu_ps(&in2[l]);
+        mm256_store_interleave(&out[3*l], a, b, c);
+    }
+
+    for (; l < length; l++) {
+        out[3*l + 0] = in0[l];
+        out[3*l + 1] = in1[l];
+        out[3*l + 2] = in2[l];
+    }
+}
+
+void mergeRow_32FC4(const float in0[],
+                    const float in1[],
+                    const float in2[],
+                    const float in3[],
+                          float out[],
+                            int length) {
+    int l = 0;
+
+    for (; l <= length - 8; l += 8) {
+        __m256 a = _mm256_loadu_ps(&in0[l]);
+        __m256 b = _mm256_loadu_ps(&in1[l]);
+        __m256 c = _mm256_loadu_ps(&in2[l]);
+        __m256 d = _mm256_loadu_ps(&in3[l]);
+        mm256_store_interleave(&out[4*l], a, b, c, d);
+    }
+
+    for (; l < length; l++) {
+        out[4*l + 0] = in0[l];
+        out[4*l + 1] = in1[l];
+        out[4*l + 2] = in2[l];
+        out[4*l + 3] = in3[l];
+    }
+}
+
+void splitRow_8UC2(const uint8_t in[],
+                         uint8_t out0[],
+                         uint8_t out1[],
+                             int length) {
+    int l = 0;
+
+    for (; l <= length - 32; l += 32) {
+        __m256i a, b;
+        mm256_load_deinterleave(&in[2*l], a, b);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&out0[l]), a);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&out1[l]), b);
+    }
+
+    for (; l < length; l++) {
+        out0[l] = in[2*l + 0];
+        out1[l] = in[2*l + 1];
+    }
+}
+
+void splitRow_8UC3(const uint8_t in[],
+                         uint8_t out0[],
+                         uint8_t out1[],
+                         uint8_t out2[],
+                             int length) {
+    int l = 0;
+
+    for (; l <= length - 32; l += 32) {
+        __m256i a, b, c;
+        mm256_load_deinterleave(&in[3*l], a, b, c);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&out0[l]), a);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&out1[l]), b);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&out2[l]), c);
+    }
+
+    for (; l < length; l++) {
+        out0[l] = in[3*l + 0];
+        out1[l] = in[3*l + 1];
+        out2[l] = in[3*l + 2];
+    }
+}
+
+void splitRow_8UC4(const uint8_t in[],
+                         uint8_t out0[],
+                         uint8_t out1[],
+                         uint8_t out2[],
+                         uint8_t out3[],
+                             int length) {
+    int l = 0;
+
+    for (; l <= length - 32; l += 32) {
+        __m256i a, b, c, d;
+        mm256_load_deinterleave(&in[4*l], a, b, c, d);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&out0[l]), a);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&out1[l]), b);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&out2[l]), c);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&out3[l]), d);
+    }
+
+    for (; l < length; l++) {
+        out0[l] = in[4*l + 0];
+        out1[l] = in[4*l + 1];
+        out2[l] = in[4*l + 2];
+        out3[l] = in[4*l + 3];
+    }
+}
+
+void splitRow_32FC2(const float in[],
+                          float out0[],
+                          float out1[],
+                            int length) {
+    int l = 0;
+
+    for (; l <= length - 8; l += 8) {
+        __m256 a, b;
+        mm256_load_deinterleave(&in[2*l], a, b);
+        _mm256_storeu_ps(&out0[l], a);
+        _mm256_storeu_ps(&out1[l], b);
+    }
+
+    for (; l < length; l++) {
+        out0[l] = in[2*l + 0];
+        out1[l] = in[2*l + 1];
+    }
+}
+
+void splitRow_32FC3(const float in[],
+                          float out0[],
+                          float out1[],
+                          float out2[],
+                            int length) {
+    int l = 0;
+
+    for (; l <= length - 8; l += 8) {
+        __m256 a, b, c;
+        mm256_load_deinterleave(&in[3*l], a, b, c);
+        _mm256_storeu_ps(&out0[l], a);
+        _mm256_storeu_ps(&out1[l], b);
+        _mm256_storeu_ps(&out2[l], c);
+    }
+
+    for (; l < length; l++) {
+        out0[l] = in[3*l + 0];
+        out1[l] = in[3*l + 1];
+        out2[l] = in[3*l + 2];
+    }
+}
+
+void splitRow_32FC4(const float in[],
+                          float out0[],
+                          float out1[],
+                          float out2[],
+                          float out3[],
+                            int length) {
+    int l = 0;
+
+    for (; l <= length - 8; l += 8) {
+        __m256 a, b, c, d;
+        mm256_load_deinterleave(&in[4*l], a, b, c, d);
+        _mm256_storeu_ps(&out0[l], a);
+        _mm256_storeu_ps(&out1[l], b);
+        _mm256_storeu_ps(&out2[l], c);
+        _mm256_storeu_ps(&out3[l], d);
+    }
+
+    for (; l < length; l++) {
+        out0[l] = in[4*l + 0];
+        out1[l] = in[4*l + 1];
+        out2[l] = in[4*l + 2];
+        out3[l] = in[4*l + 3];
+    }
+}
+
+//------------------------------------------------------------------------------
+
+static const int ITUR_BT_601_CY = 1220542;
+static const int ITUR_BT_601_CUB = 2116026;
+static const int ITUR_BT_601_CUG = -409993;
+static const int ITUR_BT_601_CVG = -852492;
+static const int ITUR_BT_601_CVR = 1673527;
+static const int ITUR_BT_601_SHIFT = 20;
+
+static inline void uvToRGBuv(const uchar u, const uchar v, int& ruv, int& guv, int& buv) {
+    int uu, vv;
+    uu = static_cast<int>(u) - 128;
+    vv = static_cast<int>(v) - 128;
+
+    ruv = (1 << (ITUR_BT_601_SHIFT - 1)) + ITUR_BT_601_CVR * vv;
+    guv = (1 << (ITUR_BT_601_SHIFT - 1)) + ITUR_BT_601_CVG * vv + ITUR_BT_601_CUG * uu;
+    buv = (1 << (ITUR_BT_601_SHIFT - 1)) + ITUR_BT_601_CUB * uu;
+}
+
+static inline void yRGBuvToRGB(const uchar vy, const int ruv, const int guv, const int buv,
+                                uchar& r, uchar& g, uchar& b) {
+    int yy = static_cast<int>(vy);
+    int y = std::max(0, yy - 16) * ITUR_BT_601_CY;
+    r = saturate_cast<uchar>((y + ruv) >> ITUR_BT_601_SHIFT);
+    g = saturate_cast<uchar>((y + guv) >> ITUR_BT_601_SHIFT);
+    b = saturate_cast<uchar>((y + buv) >> ITUR_BT_601_SHIFT);
+}
+
+// 8 int32 values of each of 4 registers into 32 uint8 values (in order)
+static inline __m256i mm256_pack_s32_u8(const __m256i (&v)[4]) {
+    __m256i lo = _mm256_permute4x64_epi64(_mm256_packs_epi32(v[0], v[1]), _MM_SHUFFLE(3, 1, 2, 0));
+    __m256i hi = _mm256_permute4x64_epi64(_mm256_packs_epi32(v[2], v[3]), _MM_SHUFFLE(3, 1, 2, 0));
+    return _mm256_permute4x64_epi64(_mm256_packus_epi16(lo, hi), _MM_SHUFFLE(3, 1, 2, 0));
+}
+
+// [a0, a1, ...], [b0, b1, ...] => [a0, b0, a1, b1, ...]
+static inline void mm256_zip(__m256i a, __m256i b, __m256i& lo, __m256i& hi) {
+    __m256i t0 = _mm256_unpacklo_epi8(a, b);
+    __m256i t1 = _mm256_unpackhi_epi8(a, b);
+    lo = _mm256_permute2x128_si256(t0, t1, 0x20);
+    hi = _mm256_permute2x128_si256(t0, t1, 0x31);
+}
+
+// 32 uint8 values into 4 registers of 8 int32 values (in order)
+static inline void mm256_expand_u8_s32(__m256i v, __m256i (&r)[4]) {
+    __m128i lo = _mm256_castsi256_si128(v);
+    __m128i hi = _mm256_extracti128_si256(v, 1);
+    r[0] = _mm256_cvtepu8_epi32(lo);
+    r[1] = _mm256_cvtepu8_epi32(_mm_srli_si128(lo, 8));
+    r[2] = _mm256_cvtepu8_epi32(hi);
+    r[3] = _mm256_cvtepu8_epi32(_mm_srli_si128(hi, 8));
+}
+
+static inline void mm256_expand_s8_s32(__m256i v, __m256i (&r)[4]) {
+    __m128i lo = _mm256_castsi256_si128(v);
+    __m128i hi = _mm256_extracti128_si256(v, 1);
+    r[0] = _mm256_cvtepi8_epi32(lo);
+    r[1] = _mm256_cvtepi8_epi32(_mm_srli_si128(lo, 8));
+    r[2] = _mm256_cvtepi8_epi32(hi);
+    r[3] = _mm256_cvtepi8_epi32(_mm_srli_si128(hi, 8));
+}
+
+static inline void uvToRGBuv(__m256i u, __m256i v,
+                             __m256i (&ruv)[4],
+                             __m256i (&guv)[4],
+                             __m256i (&buv)[4]) {
+    __m256i v128 = _mm256_set1_epi8(static_cast<char>(128));
+    __m256i uu[4], vv[4];
+    mm256_expand_s8_s32(_mm256_sub_epi8(u, v128), uu);
+    mm256_expand_s8_s32(_mm256_sub_epi8(v, v128), vv);
+
+    __m256i vshift = _mm256_set1_epi32(1 << (ITUR_BT_601_SHIFT - 1));
+    __m256i vr = _mm256_set1_epi32(ITUR_BT_601_CVR);
+    __m256i vg = _mm256_set1_epi32(ITUR_BT_601_CVG);
+    __m256i ug = _mm256_set1_epi32(ITUR_BT_601_CUG);
+    __m256i ub = _mm256_set1_epi32(ITUR_BT_601_CUB);
+
+    for (int k = 0; k < 4; k++) {
+        ruv[k] = _mm256_add_epi32(vshift, _mm256_mullo_epi32(vr, vv[k]));
+        guv[k] = _mm256_add_epi32(_mm256_add_epi32(vshift, _mm256_mullo_epi32(vg, vv[k])),
+                                  _mm256_mullo_epi32(ug, uu[k]));
+        buv[k] = _mm256_add_epi32(vshift, _mm256_mullo_epi32(ub, uu[k]));
+    }
+}
+
+static inline void yRGBuvToRGB(__m256i vy,
+                               const __m256i (&ruv)[4],
+                               const __m256i (&guv)[4],
+                               const __m256i (&buv)[4],
+                               __m256i& rr, __m256i& gg, __m256i& bb) {
+    __m256i yy[4];
+    mm256_expand_u8_s32(_mm256_subs_epu8(vy, _mm256_set1_epi8(16)), yy);
+
+    __m256i vcy = _mm256_set1_epi32(ITUR_BT_601_CY);
+
+    __m256i r[4], g[4], b[4];
+    for (int k = 0; k < 4; k++) {
+        __m256i y = _mm256_mullo_epi32(yy[k], vcy);
+        r[k] = _mm256_srai_epi32(_mm256_add_epi32(y, ruv[k]), ITUR_BT_601_SHIFT);
+        g[k] = _mm256_srai_epi32(_mm256_add_epi32(y, guv[k]), ITUR_BT_601_SHIFT);
+        b[k] = _mm256_srai_epi32(_mm256_add_epi32(y, buv[k]), ITUR_BT_601_SHIFT);
+    }
+
+    rr = mm256_pack_s32_u8(r);
+    gg = mm256_pack_s32_u8(g);
+    bb = mm256_pack_s32_u8(b);
+}
+
+void calculate_nv12_to_rgb(const  uchar **srcY,
+                           const  uchar *srcUV,
+                                  uchar **dstRGBx,
+                                    int width) {
+    int i = 0;
+
+    const int vsize = 32;
+
+    for ( ; i <= width - 2*vsize; i += 2*vsize) {
+        __m256i u, v;
+        mm256_load_deinterleave(srcUV + i, u, v);
+
+        // even and odd pixels of both rows
+        __m256i vy[4];
+        mm256_load_deinterleave(srcY[0] + i, vy[0], vy[1]);
+        mm256_load_deinterleave(srcY[1] + i, vy[2], vy[3]);
+
+        __m256i ruv[4], guv[4], buv[4];
+        uvToRGBuv(u, v, ruv, guv, buv);
+
+        __m256i r[4], g[4], b[4];
+        for (int k = 0; k < 4; k++) {
+            yRGBuvToRGB(vy[k], ruv, guv, buv, r[k], g[k], b[k]);
+        }
+
+        // [even...], [odd...] => [even, odd, even, odd...]
+        __m256i r0_0, r0_1, r1_0, r1_1;
+        __m256i g0_0, g0_1, g1_0, g1_1;
+        __m256i b0_0, b0_1, b1_0, b1_1;
+        mm256_zip(r[0], r[1], r0_0, r0_1);
+        mm256_zip(r[2], r[3], r1_0, r1_1);
+        mm256_zip(g[0], g[1], g0_0, g0_1);
+        mm256_zip(g[2], g[3], g1_0, g1_1);
+        mm256_zip(b[0], b[1], b0_0, b0_1);
+        mm256_zip(b[2], b[3], b1_0, b1_1);
+
+        mm256_store_interleave(dstRGBx[0] + i * 3, r0_0, g0_0, b0_0);
+        mm256_store_interleave(dstRGBx[0] + i * 3 + 3 * vsize, r0_1, g0_1, b0_1);
+
+        mm256_store_interleave(dstRGBx[1] + i * 3, r1_0, g1_0, b1_0);
+        mm256_store_interleave(dstRGBx[1] + i * 3 + 3 * vsize, r1_1, g1_1, b1_1);
+    }
+
+    for (; i < width; i += 2) {
+        uchar u = srcUV[i];
+        uchar v = srcUV[i + 1];
+        int ruv, guv, buv;
+        uvToRGBuv(u, v, ruv, guv, buv);
+
+        for (int y = 0; y < 2; y++) {
+            for (int x = 0; x < 2; x++) {
+                uchar vy = srcY[y][i + x];
+                uchar r, g, b;
+                yRGBuvToRGB(vy, ruv, guv, buv, r, g, b);
+
+                dstRGBx[y][3*(i + x)]     = r;
+                dstRGBx[y][3*(i + x) + 1] = g;
+                dstRGBx[y][3*(i + x) + 2] = b;
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void copyRow_8U(const uint8_t in[],
+                 uint8_t out[],
+                 int length) {
+    int l = 0;
+
+    for (; l <= length - 32; l += 32) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&out[l]),
+                            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&in[l])));
+    }
+
+    if (l < length && length >= 32) {
+        l = length - 32;
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&out[l]),
+                            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&in[l])));
+        l = length;
+    }
+
+    for (; l < length; l++) {
+        out[l] = in[l];
+    }
+}
+
+void copyRow_32F(const float in[],
+                 float out[],
+                 int length) {
+    int l = 0;
+
+    for (; l <= length - 8; l += 8) {
+        _mm256_storeu_ps(&out[l], _mm256_loadu_ps(&in[l]));
+    }
+
+    if (l < length && length >= 8) {
+        l = length - 8;
+        _mm256_storeu_ps(&out[l], _mm256_loadu_ps(&in[l]));
+        l = length;
+    }
+
+    for (; l < length; l++) {
+        out[l] = in[l];
+    }
+}
+
+}  // namespace avx
+}  // namespace kernels
+}  // namespace gapi
+}  // namespace InferenceEngine
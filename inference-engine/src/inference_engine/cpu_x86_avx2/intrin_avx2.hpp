@@ -0,0 +1,249 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <immintrin.h>  // AVX2
+
+#include <cstdint>
+
+namespace InferenceEngine {
+namespace avx {
+
+//------------------------------------------------------------------------
+//
+// Channel (de)interleaving helpers for AVX2, x86 specific.
+//
+// 256-bit shuffles operate on two independent 128-bit lanes, so every
+// helper first arranges data so that each lane holds a self-contained
+// group of pixels, applies the SSE 4.2 algorithm lane-wise and then
+// restores the element order with a cross-lane permute.
+//
+// NB: all helpers have internal linkage on purpose: this header is also
+// included into translation units compiled for AVX-512, and the copies
+// must not be merged by the linker.
+//
+//------------------------------------------------------------------------
+
+static inline
+void mm256_load_deinterleave(const uint8_t* ptr, __m256i& a, __m256i& b, __m256i& c) {
+    __m256i l0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));
+    __m256i l1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr + 32));
+    __m256i l2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr + 64));
+
+    // lane 0 takes bytes 0..47, lane 1 takes bytes 48..95
+    __m256i s0 = _mm256_permute2x128_si256(l0, l1, 0x30);
+    __m256i s1 = _mm256_permute2x128_si256(l0, l2, 0x21);
+    __m256i s2 = _mm256_permute2x128_si256(l1, l2, 0x30);
+
+    const __m256i m0 = _mm256_setr_epi8(0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0,
+                                        0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0);
+    const __m256i m1 = _mm256_setr_epi8(0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0,
+                                        0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0);
+    __m256i a0 = _mm256_blendv_epi8(_mm256_blendv_epi8(s0, s1, m0), s2, m1);
+    __m256i b0 = _mm256_blendv_epi8(_mm256_blendv_epi8(s1, s2, m0), s0, m1);
+    __m256i c0 = _mm256_blendv_epi8(_mm256_blendv_epi8(s2, s0, m0), s1, m1);
+
+    const __m256i sh_a = _mm256_setr_epi8(0, 3, 6, 9, 12, 15, 2, 5, 8, 11, 14, 1, 4, 7, 10, 13,
+                                          0, 3, 6, 9, 12, 15, 2, 5, 8, 11, 14, 1, 4, 7, 10, 13);
+    const __m256i sh_b = _mm256_setr_epi8(1, 4, 7, 10, 13, 0, 3, 6, 9, 12, 15, 2, 5, 8, 11, 14,
+                                          1, 4, 7, 10, 13, 0, 3, 6, 9, 12, 15, 2, 5, 8, 11, 14);
+    const __m256i sh_c = _mm256_setr_epi8(2, 5, 8, 11, 14, 1, 4, 7, 10, 13, 0, 3, 6, 9, 12, 15,
+                                          2, 5, 8, 11, 14, 1, 4, 7, 10, 13, 0, 3, 6, 9, 12, 15);
+    a = _mm256_shuffle_epi8(a0, sh_a);
+    b = _mm256_shuffle_epi8(b0, sh_b);
+    c = _mm256_shuffle_epi8(c0, sh_c);
+}
+
+static inline
+void mm256_store_interleave(uint8_t* ptr, __m256i a, __m256i b, __m256i c) {
+    const __m256i sh_a = _mm256_setr_epi8(0, 11, 6, 1, 12, 7, 2, 13, 8, 3, 14, 9, 4, 15, 10, 5,
+                                          0, 11, 6, 1, 12, 7, 2, 13, 8, 3, 14, 9, 4, 15, 10, 5);
+    const __m256i sh_b = _mm256_setr_epi8(5, 0, 11, 6, 1, 12, 7, 2, 13, 8, 3, 14, 9, 4, 15, 10,
+                                          5, 0, 11, 6, 1, 12, 7, 2, 13, 8, 3, 14, 9, 4, 15, 10);
+    const __m256i sh_c = _mm256_setr_epi8(10, 5, 0, 11, 6, 1, 12, 7, 2, 13, 8, 3, 14, 9, 4, 15,
+                                          10, 5, 0, 11, 6, 1, 12, 7, 2, 13, 8, 3, 14, 9, 4, 15);
+    __m256i a0 = _mm256_shuffle_epi8(a, sh_a);
+    __m256i b0 = _mm256_shuffle_epi8(b, sh_b);
+    __m256i c0 = _mm256_shuffle_epi8(c, sh_c);
+
+    const __m256i m0 = _mm256_setr_epi8(0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0,
+                                        0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0);
+    const __m256i m1 = _mm256_setr_epi8(0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0,
+                                        0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0);
+    __m256i v0 = _mm256_blendv_epi8(_mm256_blendv_epi8(a0, b0, m1), c0, m0);
+    __m256i v1 = _mm256_blendv_epi8(_mm256_blendv_epi8(b0, c0, m1), a0, m0);
+    __m256i v2 = _mm256_blendv_epi8(_mm256_blendv_epi8(c0, a0, m1), b0, m0);
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr),      _mm256_permute2x128_si256(v0, v1, 0x20));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr + 32), _mm256_permute2x128_si256(v2, v0, 0x30));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr + 64), _mm256_permute2x128_si256(v1, v2, 0x31));
+}
+
+static inline
+void mm256_load_deinterleave(const float* ptr, __m256& a, __m256& b, __m256& c) {
+    __m256 l0 = _mm256_loadu_ps(ptr);
+    __m256 l1 = _mm256_loadu_ps(ptr + 8);
+    __m256 l2 = _mm256_loadu_ps(ptr + 16);
+
+    // lane 0 takes floats 0..11, lane 1 takes floats 12..23
+    __m256 t0 = _mm256_permute2f128_ps(l0, l1, 0x30);
+    __m256 t1 = _mm256_permute2f128_ps(l0, l2, 0x21);
+    __m256 t2 = _mm256_permute2f128_ps(l1, l2, 0x30);
+
+    __m256 at12 = _mm256_shuffle_ps(t1, t2, _MM_SHUFFLE(0, 1, 0, 2));
+    a = _mm256_shuffle_ps(t0, at12, _MM_SHUFFLE(2, 0, 3, 0));
+
+    __m256 bt01 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(0, 0, 0, 1));
+    __m256 bt12 = _mm256_shuffle_ps(t1, t2, _MM_SHUFFLE(0, 2, 0, 3));
+    b = _mm256_shuffle_ps(bt01, bt12, _MM_SHUFFLE(2, 0, 2, 0));
+
+    __m256 ct01 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(0, 1, 0, 2));
+    c = _mm256_shuffle_ps(ct01, t2, _MM_SHUFFLE(3, 0, 2, 0));
+}
+
+static inline
+void mm256_store_interleave(float* ptr, __m256 a, __m256 b, __m256 c) {
+    __m256 u0 = _mm256_shuffle_ps(a , b , _MM_SHUFFLE(0, 0, 0, 0));
+    __m256 u1 = _mm256_shuffle_ps(c , a , _MM_SHUFFLE(1, 1, 0, 0));
+    __m256 v0 = _mm256_shuffle_ps(u0, u1, _MM_SHUFFLE(2, 0, 2, 0));
+    __m256 u2 = _mm256_shuffle_ps(b , c , _MM_SHUFFLE(1, 1, 1, 1));
+    __m256 u3 = _mm256_shuffle_ps(a , b , _MM_SHUFFLE(2, 2, 2, 2));
+    __m256 v1 = _mm256_shuffle_ps(u2, u3, _MM_SHUFFLE(2, 0, 2, 0));
+    __m256 u4 = _mm256_shuffle_ps(c , a , _MM_SHUFFLE(3, 3, 2, 2));
+    __m256 u5 = _mm256_shuffle_ps(b , c , _MM_SHUFFLE(3, 3, 3, 3));
+    __m256 v2 = _mm256_shuffle_ps(u4, u5, _MM_SHUFFLE(2, 0, 2, 0));
+
+    _mm256_storeu_ps(ptr,      _mm256_permute2f128_ps(v0, v1, 0x20));
+    _mm256_storeu_ps(ptr + 8,  _mm256_permute2f128_ps(v2, v0, 0x30));
+    _mm256_storeu_ps(ptr + 16, _mm256_permute2f128_ps(v1, v2, 0x31));
+}
+
+static inline
+void mm256_load_deinterleave(const uint8_t* ptr, __m256i& a, __m256i& b) {
+    const __m256i sh = _mm256_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15,
+                                        0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15);
+    __m256i l0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));
+    __m256i l1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr + 32));
+    l0 = _mm256_permute4x64_epi64(_mm256_shuffle_epi8(l0, sh), _MM_SHUFFLE(3, 1, 2, 0));
+    l1 = _mm256_permute4x64_epi64(_mm256_shuffle_epi8(l1, sh), _MM_SHUFFLE(3, 1, 2, 0));
+    a = _mm256_permute2x128_si256(l0, l1, 0x20);
+    b = _mm256_permute2x128_si256(l0, l1, 0x31);
+}
+
+static inline
+void mm256_store_interleave(uint8_t* ptr, __m256i a, __m256i b) {
+    __m256i lo = _mm256_unpacklo_epi8(a, b);
+    __m256i hi = _mm256_unpackhi_epi8(a, b);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr),      _mm256_permute2x128_si256(lo, hi, 0x20));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr + 32), _mm256_permute2x128_si256(lo, hi, 0x31));
+}
+
+static inline
+void mm256_load_deinterleave(const float* ptr, __m256& a, __m256& b) {
+    __m256 l0 = _mm256_loadu_ps(ptr);
+    __m256 l1 = _mm256_loadu_ps(ptr + 8);
+    __m256 a0 = _mm256_shuffle_ps(l0, l1, _MM_SHUFFLE(2, 0, 2, 0));
+    __m256 b0 = _mm256_shuffle_ps(l0, l1, _MM_SHUFFLE(3, 1, 3, 1));
+    a = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(a0), _MM_SHUFFLE(3, 1, 2, 0)));
+    b = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(b0), _MM_SHUFFLE(3, 1, 2, 0)));
+}
+
+static inline
+void mm256_store_interleave(float* ptr, __m256 a, __m256 b) {
+    __m256 lo = _mm256_unpacklo_ps(a, b);
+    __m256 hi = _mm256_unpackhi_ps(a, b);
+    _mm256_storeu_ps(ptr,     _mm256_permute2f128_ps(lo, hi, 0x20));
+    _mm256_storeu_ps(ptr + 8, _mm256_permute2f128_ps(lo, hi, 0x31));
+}
+
+static inline
+void mm256_load_deinterleave(const uint8_t* ptr, __m256i& a, __m256i& b, __m256i& c, __m256i& d) {
+    const __m256i sh = _mm256_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15,
+                                        0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+    const __m256i perm = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+    // each 64-bit element holds 8 pixels of one channel
+    __m256i l0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));
+    __m256i l1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr + 32));
+    __m256i l2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr + 64));
+    __m256i l3 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr + 96));
+    l0 = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(l0, sh), perm);
+    l1 = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(l1, sh), perm);
+    l2 = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(l2, sh), perm);
+    l3 = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(l3, sh), perm);
+
+    __m256i lo01 = _mm256_unpacklo_epi64(l0, l1);
+    __m256i hi01 = _mm256_unpackhi_epi64(l0, l1);
+    __m256i lo23 = _mm256_unpacklo_epi64(l2, l3);
+    __m256i hi23 = _mm256_unpackhi_epi64(l2, l3);
+
+    a = _mm256_permute2x128_si256(lo01, lo23, 0x20);
+    b = _mm256_permute2x128_si256(hi01, hi23, 0x20);
+    c = _mm256_permute2x128_si256(lo01, lo23, 0x31);
+    d = _mm256_permute2x128_si256(hi01, hi23, 0x31);
+}
+
+static inline
+void mm256_store_interleave(uint8_t* ptr, __m256i a, __m256i b, __m256i c, __m256i d) {
+    __m256i ab_lo = _mm256_unpacklo_epi8(a, b);
+    __m256i ab_hi = _mm256_unpackhi_epi8(a, b);
+    __m256i cd_lo = _mm256_unpacklo_epi8(c, d);
+    __m256i cd_hi = _mm256_unpackhi_epi8(c, d);
+
+    __m256i q0 = _mm256_unpacklo_epi16(ab_lo, cd_lo);
+    __m256i q1 = _mm256_unpackhi_epi16(ab_lo, cd_lo);
+    __m256i q2 = _mm256_unpacklo_epi16(ab_hi, cd_hi);
+    __m256i q3 = _mm256_unpackhi_epi16(ab_hi, cd_hi);
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr),      _mm256_permute2x128_si256(q0, q1, 0x20));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr + 32), _mm256_permute2x128_si256(q2, q3, 0x20));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr + 64), _mm256_permute2x128_si256(q0, q1, 0x31));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr + 96), _mm256_permute2x128_si256(q2, q3, 0x31));
+}
+
+static inline
+void mm256_load_deinterleave(const float* ptr, __m256& a, __m256& b, __m256& c, __m256& d) {
+    __m256 l0 = _mm256_loadu_ps(ptr);
+    __m256 l1 = _mm256_loadu_ps(ptr + 8);
+    __m256 l2 = _mm256_loadu_ps(ptr + 16);
+    __m256 l3 = _mm256_loadu_ps(ptr + 24);
+
+    // lane 0 takes pixels 0..3, lane 1 takes pixels 4..7
+    __m256 m0 = _mm256_permute2f128_ps(l0, l2, 0x20);
+    __m256 m1 = _mm256_permute2f128_ps(l0, l2, 0x31);
+    __m256 m2 = _mm256_permute2f128_ps(l1, l3, 0x20);
+    __m256 m3 = _mm256_permute2f128_ps(l1, l3, 0x31);
+
+    __m256 t0 = _mm256_unpacklo_ps(m0, m1);
+    __m256 t1 = _mm256_unpackhi_ps(m0, m1);
+    __m256 t2 = _mm256_unpacklo_ps(m2, m3);
+    __m256 t3 = _mm256_unpackhi_ps(m2, m3);
+
+    a = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+    b = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+    c = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+    d = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+}
+
+static inline
+void mm256_store_interleave(float* ptr, __m256 a, __m256 b, __m256 c, __m256 d) {
+    __m256 t0 = _mm256_unpacklo_ps(a, b);
+    __m256 t1 = _mm256_unpackhi_ps(a, b);
+    __m256 t2 = _mm256_unpacklo_ps(c, d);
+    __m256 t3 = _mm256_unpackhi_ps(c, d);
+
+    __m256 u0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+    __m256 u1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+    __m256 u2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+    __m256 u3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+
+    _mm256_storeu_ps(ptr,      _mm256_permute2f128_ps(u0, u1, 0x20));
+    _mm256_storeu_ps(ptr + 8,  _mm256_permute2f128_ps(u2, u3, 0x20));
+    _mm256_storeu_ps(ptr + 16, _mm256_permute2f128_ps(u0, u1, 0x31));
+    _mm256_storeu_ps(ptr + 24, _mm256_permute2f128_ps(u2, u3, 0x31));
+}
+
+}  // namespace avx
+}  // namespace InferenceEngine
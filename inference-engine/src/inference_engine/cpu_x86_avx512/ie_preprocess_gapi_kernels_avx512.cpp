@@ -0,0 +1,814 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#include "ie_preprocess_gapi_kernels.hpp"
+#include "ie_preprocess_gapi_kernels_impl.hpp"
+#include "ie_preprocess_gapi_kernels_avx2.hpp"
+#include "ie_preprocess_gapi_kernels_avx512.hpp"
+
+#include "intrin_avx512.hpp"
+
+namespace InferenceEngine {
+namespace gapi {
+namespace kernels {
+namespace avx512 {
+
+using namespace InferenceEngine::avx512;
+
+//------------------------------------------------------------------------------
+//
+// NB: results must be bit-exact with SSE 4.2 versions of these kernels,
+//     so keep the order of operations: e.g. do not use FMA for floats
+//
+//------------------------------------------------------------------------------
+
+static inline __m512i mm512_load_expand_u8(const uint8_t* ptr) {
+    return _mm512_cvtepu8_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr)));
+}
+
+// (s0 - s1)*alpha + s1, where alpha is Q1.15 (same as SSE's v_mulhrs)
+static inline __m512i mm512_lerp_q15(__m512i s0, __m512i s1, __m512i alpha) {
+    return _mm512_add_epi16(_mm512_mulhrs_epi16(_mm512_sub_epi16(s0, s1), alpha), s1);
+}
+
+// saturate 32 shorts into 32 bytes, same as packus
+static inline __m256i mm512_pack_u8(__m512i v) {
+    return _mm512_cvtusepi16_epi8(_mm512_max_epi16(v, _mm512_setzero_si512()));
+}
+
+// store 4 rows of 32 pixels as 32 groups of 4 bytes: one pixel per row
+static inline void mm256_store_interleave_4rows(uint8_t* ptr, __m256i r0, __m256i r1,
+                                                              __m256i r2, __m256i r3) {
+    __m256i a0 = _mm256_unpacklo_epi8(r0, r1);
+    __m256i a1 = _mm256_unpackhi_epi8(r0, r1);
+    __m256i b0 = _mm256_unpacklo_epi8(r2, r3);
+    __m256i b1 = _mm256_unpackhi_epi8(r2, r3);
+
+    // lanes: pixels 0..3 | 16..19, 4..7 | 20..23, 8..11 | 24..27, 12..15 | 28..31
+    __m256i d0 = _mm256_unpacklo_epi16(a0, b0);
+    __m256i d1 = _mm256_unpackhi_epi16(a0, b0);
+    __m256i d2 = _mm256_unpacklo_epi16(a1, b1);
+    __m256i d3 = _mm256_unpackhi_epi16(a1, b1);
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr +  0), _mm256_permute2x128_si256(d0, d1, 0x20));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr + 32), _mm256_permute2x128_si256(d2, d3, 0x20));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr + 64), _mm256_permute2x128_si256(d0, d1, 0x31));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr + 96), _mm256_permute2x128_si256(d2, d3, 0x31));
+}
+
+//------------------------------------------------------------------------------
+
+// vertical pass of 4 rows at once: tmp gets groups of 4 pixels (a pixel per row)
+static void vertLinear_4rows(uint8_t tmp[], const uint8_t *src0[], const uint8_t *src1[],
+                             const short beta[], int length) {
+    GAPI_DbgAssert(length >= 32);
+
+    __m512i b0 = _mm512_set1_epi16(beta[0]);
+    __m512i b1 = _mm512_set1_epi16(beta[1]);
+    __m512i b2 = _mm512_set1_epi16(beta[2]);
+    __m512i b3 = _mm512_set1_epi16(beta[3]);
+
+    for (int w = 0; w < length; ) {
+        for (; w <= length - 32; w += 32) {
+            __m256i r0 = mm512_pack_u8(mm512_lerp_q15(mm512_load_expand_u8(&src0[0][w]),
+                                                      mm512_load_expand_u8(&src1[0][w]), b0));
+            __m256i r1 = mm512_pack_u8(mm512_lerp_q15(mm512_load_expand_u8(&src0[1][w]),
+                                                      mm512_load_expand_u8(&src1[1][w]), b1));
+            __m256i r2 = mm512_pack_u8(mm512_lerp_q15(mm512_load_expand_u8(&src0[2][w]),
+                                                      mm512_load_expand_u8(&src1[2][w]), b2));
+            __m256i r3 = mm512_pack_u8(mm512_lerp_q15(mm512_load_expand_u8(&src0[3][w]),
+                                                      mm512_load_expand_u8(&src1[3][w]), b3));
+            mm256_store_interleave_4rows(&tmp[4*w], r0, r1, r2, r3);
+        }
+
+        if (w < length) {
+            w = length - 32;
+        }
+    }
+}
+
+// same as above, but without vertical interpolation (if y-ratio is 1)
+static void copyLinear_4rows(uint8_t tmp[], const uint8_t *src0[], int length) {
+    GAPI_DbgAssert(length >= 32);
+
+    for (int w = 0; w < length; ) {
+        for (; w <= length - 32; w += 32) {
+            __m256i r0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&src0[0][w]));
+            __m256i r1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&src0[1][w]));
+            __m256i r2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&src0[2][w]));
+            __m256i r3 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&src0[3][w]));
+            mm256_store_interleave_4rows(&tmp[4*w], r0, r1, r2, r3);
+        }
+
+        if (w < length) {
+            w = length - 32;
+        }
+    }
+}
+
+// horizontal pass of 4 rows at once: tmp is groups of 4 pixels (a pixel per row),
+// chanNum groups per source pixel, so channel c of pixel sx is tmp[4*(chanNum*sx + c)]
+template<int chanNum>
+static void horzLinear_4rows(uint8_t *dst[], const uint8_t tmp[], const short clone[],
+                             const short mapsx[], int length, int c) {
+    GAPI_DbgAssert(length >= 32);
+
+    // gather groups for pixels sx0 and sx1=sx0+1 so that each 128-bit lane
+    // holds a pair of dst pixels: {sx0[x], sx0[x+1], sx1[x], sx1[x+1]}
+    const __m512i lo   = _mm512_setr_epi32(0, 1, 0, 1, 4, 5, 4, 5, 8, 9, 8, 9, 12, 13, 12, 13);
+    const __m512i hi   = _mm512_setr_epi32(2, 3, 2, 3, 6, 7, 6, 7, 10, 11, 10, 11, 14, 15, 14, 15);
+    const int n = 4*chanNum;
+    const __m512i next = _mm512_setr_epi32(0, 0, n, n, 0, 0, n, n, 0, 0, n, n, 0, 0, n, n);
+    const __m512i step = _mm512_set1_epi32(4*chanNum);
+    const __m512i chan = _mm512_set1_epi32(4*c);
+
+    // transpose 4x4 bytes of each 32-bit quarter of a lane (rows <-> pixels)
+    const __m512i tr = _mm512_set4_epi32(0x0f0b0703, 0x0e0a0602, 0x0d090501, 0x0c080400);
+    const __m512i rows01 = _mm512_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28, 1, 5, 9, 13, 17, 21, 25, 29);
+    const __m512i rows23 = _mm512_setr_epi32(2, 6, 10, 14, 18, 22, 26, 30, 3, 7, 11, 15, 19, 23, 27, 31);
+    const __m512i zero = _mm512_setzero_si512();
+
+    for (int x = 0; x < length; ) {
+        for (; x <= length - 32; x += 32) {
+            __m512i sx = _mm512_loadu_si512(&mapsx[x]);
+            __m512i i0 = _mm512_cvtepi16_epi32(_mm512_castsi512_si256(sx));         // x+0..x+15
+            __m512i i1 = _mm512_cvtepi16_epi32(_mm512_extracti64x4_epi64(sx, 1));   // x+16..x+31
+            i0 = _mm512_add_epi32(_mm512_mullo_epi32(i0, step), chan);
+            i1 = _mm512_add_epi32(_mm512_mullo_epi32(i1, step), chan);
+
+            // pixels: (x+0, x+1 | x+4, x+5 | x+8, x+9 | x+12, x+13), etc
+            __m512i t0 = _mm512_i32gather_epi32(_mm512_add_epi32(_mm512_permutexvar_epi32(lo, i0), next), tmp, 1);
+            __m512i t1 = _mm512_i32gather_epi32(_mm512_add_epi32(_mm512_permutexvar_epi32(hi, i0), next), tmp, 1);
+            __m512i t2 = _mm512_i32gather_epi32(_mm512_add_epi32(_mm512_permutexvar_epi32(lo, i1), next), tmp, 1);
+            __m512i t3 = _mm512_i32gather_epi32(_mm512_add_epi32(_mm512_permutexvar_epi32(hi, i1), next), tmp, 1);
+
+            // clone has 4 copies of each alpha, so 8 shorts per pair of dst pixels
+            __m512i c0 = _mm512_loadu_si512(&clone[4*(x +  0)]);
+            __m512i c1 = _mm512_loadu_si512(&clone[4*(x +  8)]);
+            __m512i c2 = _mm512_loadu_si512(&clone[4*(x + 16)]);
+            __m512i c3 = _mm512_loadu_si512(&clone[4*(x + 24)]);
+            __m512i a0 = _mm512_shuffle_i64x2(c0, c1, _MM_SHUFFLE(2, 0, 2, 0));
+            __m512i a1 = _mm512_shuffle_i64x2(c0, c1, _MM_SHUFFLE(3, 1, 3, 1));
+            __m512i a2 = _mm512_shuffle_i64x2(c2, c3, _MM_SHUFFLE(2, 0, 2, 0));
+            __m512i a3 = _mm512_shuffle_i64x2(c2, c3, _MM_SHUFFLE(3, 1, 3, 1));
+
+            __m512i r0 = mm512_lerp_q15(_mm512_unpacklo_epi8(t0, zero), _mm512_unpackhi_epi8(t0, zero), a0);
+            __m512i r1 = mm512_lerp_q15(_mm512_unpacklo_epi8(t1, zero), _mm512_unpackhi_epi8(t1, zero), a1);
+            __m512i r2 = mm512_lerp_q15(_mm512_unpacklo_epi8(t2, zero), _mm512_unpackhi_epi8(t2, zero), a2);
+            __m512i r3 = mm512_lerp_q15(_mm512_unpacklo_epi8(t3, zero), _mm512_unpackhi_epi8(t3, zero), a3);
+
+            // lanes: 4 rows of x+0..x+3, x+4..x+7, etc
+            __m512i p0 = _mm512_shuffle_epi8(_mm512_packus_epi16(r0, r1), tr);
+            __m512i p1 = _mm512_shuffle_epi8(_mm512_packus_epi16(r2, r3), tr);
+
+            __m512i q01 = _mm512_permutex2var_epi32(p0, rows01, p1);
+            __m512i q23 = _mm512_permutex2var_epi32(p0, rows23, p1);
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(&dst[0][x]), _mm512_castsi512_si256(q01));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(&dst[1][x]), _mm512_extracti64x4_epi64(q01, 1));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(&dst[2][x]), _mm512_castsi512_si256(q23));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(&dst[3][x]), _mm512_extracti64x4_epi64(q23, 1));
+        }
+
+        if (x < length) {
+            x = length - 32;
+        }
+    }
+}
+
+// vertical pass of a single row
+static void vertLinear_row(uint8_t dst[], const uint8_t src0[], const uint8_t src1[],
+                           short beta, int length) {
+    GAPI_DbgAssert(length >= 32);
+
+    __m512i b = _mm512_set1_epi16(beta);
+
+    for (int w = 0; w < length; ) {
+        for (; w <= length - 32; w += 32) {
+            __m512i t = mm512_lerp_q15(mm512_load_expand_u8(&src0[w]), mm512_load_expand_u8(&src1[w]), b);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(&dst[w]), mm512_pack_u8(t));
+        }
+
+        if (w < length) {
+            w = length - 32;
+        }
+    }
+}
+
+// horizontal pass of a single row, channel c of pixel sx is src[chanNum*sx + c]
+template<int chanNum>
+static void horzLinear_row(uint8_t dst[], const uint8_t src[], const short alpha[],
+                           const short mapsx[], int length, int c) {
+    GAPI_DbgAssert(length >= 32);
+
+    const __m512i mask = _mm512_set1_epi16(0xFF);
+
+    for (int x = 0; x < length; ) {
+        for (; x <= length - 32; x += 32) {
+            // pairs of pixels: sx0 in low byte, sx1=sx0+1 in high byte
+            alignas(64) uint16_t pairs[32];
+            for (int i = 0; i < 32; i++) {
+                const uint8_t* s = &src[chanNum*mapsx[x + i] + c];
+                pairs[i] = static_cast<uint16_t>(s[0] | (s[chanNum] << 8));
+            }
+
+            __m512i p = _mm512_load_si512(pairs);
+            __m512i a = _mm512_loadu_si512(&alpha[x]);
+            __m512i d = mm512_lerp_q15(_mm512_and_si512(p, mask), _mm512_srli_epi16(p, 8), a);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(&dst[x]), mm512_pack_u8(d));
+        }
+
+        if (x < length) {
+            x = length - 32;
+        }
+    }
+}
+
+// Resize (bi-linear, 8U)
+void calcRowLinear_8U(uint8_t *dst[],
+                const uint8_t *src0[],
+                const uint8_t *src1[],
+                const short    alpha[],
+                const short    clone[],  // 4 clones of alpha
+                const short    mapsx[],
+                const short    beta[],
+                      uint8_t  tmp[],
+                const Size   & inSz,
+                const Size   & outSz,
+                      int      lpi) {
+    bool xRatioEq1 = inSz.width  == outSz.width;
+    bool yRatioEq1 = inSz.height == outSz.height;
+
+    if (!xRatioEq1 && !yRatioEq1) {
+        if (4 == lpi) {
+            vertLinear_4rows(tmp, src0, src1, beta, inSz.width);
+            horzLinear_4rows<1>(dst, tmp, clone, mapsx, outSz.width, 0);
+        } else {  // if any lpi
+            for (int l = 0; l < lpi; l++) {
+                vertLinear_row(tmp, src0[l], src1[l], beta[l], inSz.width);
+                horzLinear_row<1>(dst[l], tmp, alpha, mapsx, outSz.width, 0);
+            }
+        }
+
+    } else if (!xRatioEq1) {
+        GAPI_DbgAssert(yRatioEq1);
+
+        if (4 == lpi) {
+            copyLinear_4rows(tmp, src0, inSz.width);
+            horzLinear_4rows<1>(dst, tmp, clone, mapsx, outSz.width, 0);
+        } else {  // any LPI
+            for (int l = 0; l < lpi; l++) {
+                horzLinear_row<1>(dst[l], src0[l], alpha, mapsx, outSz.width, 0);
+            }
+        }
+
+    } else if (!yRatioEq1) {
+        GAPI_DbgAssert(xRatioEq1);
+        for (int l = 0; l < lpi; l++) {
+            vertLinear_row(dst[l], src0[l], src1[l], beta[l], inSz.width);
+        }
+
+    } else {
+        GAPI_DbgAssert(xRatioEq1 && yRatioEq1);
+        int length = inSz.width;  // == outSz.width
+
+        for (int l = 0; l < lpi; l++) {
+            memcpy(dst[l], src0[l], length);
+        }
+    }
+}
+
+// Resize (bi-linear, 8UC3)
+void calcRowLinear_8UC3(std::array<std::array<uint8_t*, 4>, 3> &dst,
+                  const uint8_t *src0[],
+                  const uint8_t *src1[],
+                  const short    alpha[],
+                  const short    clone[],  // 4 clones of alpha
+                  const short    mapsx[],
+                  const short    beta[],
+                        uint8_t  tmp[],
+                  const Size    &inSz,
+                  const Size    &outSz,
+                        int      lpi) {
+    constexpr const int chanNum = 3;
+
+    if (4 == lpi) {
+        vertLinear_4rows(tmp, src0, src1, beta, inSz.width*chanNum);
+        for (int c = 0; c < chanNum; c++) {
+            horzLinear_4rows<chanNum>(dst[c].data(), tmp, clone, mapsx, outSz.width, c);
+        }
+    } else {  // if any lpi
+        for (int l = 0; l < lpi; l++) {
+            vertLinear_row(tmp, src0[l], src1[l], beta[l], inSz.width*chanNum);
+            for (int c = 0; c < chanNum; c++) {
+                horzLinear_row<chanNum>(dst[c][l], tmp, alpha, mapsx, outSz.width, c);
+            }
+        }
+    }
+}
+
+// Resize (bi-linear, 32F)
+void calcRowLinear_32F(float *dst[],
+                 const float *src0[],
+                 const float *src1[],
+                 const float  alpha[],
+                 const int    mapsx[],
+                 const float  beta[],
+                 const Size & inSz,
+                 const Size & outSz,
+                       int    lpi) {
+    bool xRatioEq1 = inSz.width  == outSz.width;
+    bool yRatioEq1 = inSz.height == outSz.height;
+
+    if (!xRatioEq1 && !yRatioEq1) {
+        for (int l = 0; l < lpi; l++) {
+            float beta0 = beta[l];
+            float beta1 = 1 - beta0;
+            __m512 vbeta = _mm512_set1_ps(beta0);
+
+            int x = 0;
+
+            for (; x <= outSz.width - 16; x += 16) {
+                __m512 alpha0 = _mm512_loadu_ps(&alpha[x]);
+                __m512i sx0 = _mm512_loadu_si512(&mapsx[x]);
+                __m512i sx1 = _mm512_add_epi32(sx0, _mm512_set1_epi32(1));
+
+                __m512 s00 = _mm512_i32gather_ps(sx0, src0[l], 4);
+                __m512 s01 = _mm512_i32gather_ps(sx1, src0[l], 4);
+                __m512 s10 = _mm512_i32gather_ps(sx0, src1[l], 4);
+                __m512 s11 = _mm512_i32gather_ps(sx1, src1[l], 4);
+
+                __m512 res0 = _mm512_add_ps(_mm512_mul_ps(_mm512_sub_ps(s00, s01), alpha0), s01);
+                __m512 res1 = _mm512_add_ps(_mm512_mul_ps(_mm512_sub_ps(s10, s11), alpha0), s11);
+                __m512 d = _mm512_add_ps(_mm512_mul_ps(_mm512_sub_ps(res0, res1), vbeta), res1);
+
+                _mm512_storeu_ps(&dst[l][x], d);
+            }
+
+            // NB: the scalar tail rounds differently, so keep it as short as in SSE 4.2 version
+            for (; x <= outSz.width - 4; x += 4) {
+                __m128 alpha0 = _mm_loadu_ps(&alpha[x]);
+                __m128i sx0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&mapsx[x]));
+                __m128i sx1 = _mm_add_epi32(sx0, _mm_set1_epi32(1));
+
+                __m128 s00 = _mm_i32gather_ps(src0[l], sx0, 4);
+                __m128 s01 = _mm_i32gather_ps(src0[l], sx1, 4);
+                __m128 s10 = _mm_i32gather_ps(src1[l], sx0, 4);
+                __m128 s11 = _mm_i32gather_ps(src1[l], sx1, 4);
+
+                __m128 res0 = _mm_add_ps(_mm_mul_ps(_mm_sub_ps(s00, s01), alpha0), s01);
+                __m128 res1 = _mm_add_ps(_mm_mul_ps(_mm_sub_ps(s10, s11), alpha0), s11);
+                __m128 d = _mm_add_ps(_mm_mul_ps(_mm_sub_ps(res0, res1), _mm512_castps512_ps128(vbeta)), res1);
+
+                _mm_storeu_ps(&dst[l][x], d);
+            }
+
+            for (; x < outSz.width; x++) {
+                float alpha0 = alpha[x];
+                float alpha1 = 1 - alpha0;
+                int   sx0 = mapsx[x];
+                int   sx1 = sx0 + 1;
+                float res0 = src0[l][sx0]*alpha0 + src0[l][sx1]*alpha1;
+                float res1 = src1[l][sx0]*alpha0 + src1[l][sx1]*alpha1;
+                dst[l][x] = beta0*res0 + beta1*res1;
+            }
+        }
+
+    } else if (!xRatioEq1) {
+        GAPI_DbgAssert(yRatioEq1);
+
+        for (int l = 0; l < lpi; l++) {
+            int x = 0;
+
+            for (; x <= outSz.width - 16; x += 16) {
+                __m512 alpha0 = _mm512_loadu_ps(&alpha[x]);
+                __m512i sx0 = _mm512_loadu_si512(&mapsx[x]);
+                __m512i sx1 = _mm512_add_epi32(sx0, _mm512_set1_epi32(1));
+
+                __m512 s00 = _mm512_i32gather_ps(sx0, src0[l], 4);
+                __m512 s01 = _mm512_i32gather_ps(sx1, src0[l], 4);
+
+                __m512 d = _mm512_add_ps(_mm512_mul_ps(_mm512_sub_ps(s00, s01), alpha0), s01);
+
+                _mm512_storeu_ps(&dst[l][x], d);
+            }
+
+            for (; x <= outSz.width - 4; x += 4) {
+                __m128 alpha0 = _mm_loadu_ps(&alpha[x]);
+                __m128i sx0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&mapsx[x]));
+                __m128i sx1 = _mm_add_epi32(sx0, _mm_set1_epi32(1));
+
+                __m128 s00 = _mm_i32gather_ps(src0[l], sx0, 4);
+                __m128 s01 = _mm_i32gather_ps(src0[l], sx1, 4);
+
+                __m128 d = _mm_add_ps(_mm_mul_ps(_mm_sub_ps(s00, s01), alpha0), s01);
+
+                _mm_storeu_ps(&dst[l][x], d);
+            }
+
+            for (; x < outSz.width; x++) {
+                float alpha0 = alpha[x];
+                float alpha1 = 1 - alpha0;
+                int   sx0 = mapsx[x];
+                int   sx1 = sx0 + 1;
+                dst[l][x] = src0[l][sx0]*alpha0 + src0[l][sx1]*alpha1;
+            }
+        }
+
+    } else if (!yRatioEq1) {
+        GAPI_DbgAssert(xRatioEq1);
+        int length = inSz.width;  // == outSz.width
+
+        for (int l = 0; l < lpi; l++) {
+            float beta0 = beta[l];
+            float beta1 = 1 - beta0;
+            __m512 vbeta = _mm512_set1_ps(beta0);
+
+            int x = 0;
+
+            for (; x <= length - 16; x += 16) {
+                __m512 s0 = _mm512_loadu_ps(&src0[l][x]);
+                __m512 s1 = _mm512_loadu_ps(&src1[l][x]);
+                __m512 d = _mm512_add_ps(_mm512_mul_ps(_mm512_sub_ps(s0, s1), vbeta), s1);
+                _mm512_storeu_ps(&dst[l][x], d);
+            }
+
+            for (; x <= length - 4; x += 4) {
+                __m128 s0 = _mm_loadu_ps(&src0[l][x]);
+                __m128 s1 = _mm_loadu_ps(&src1[l][x]);
+                __m128 d = _mm_add_ps(_mm_mul_ps(_mm_sub_ps(s0, s1), _mm512_castps512_ps128(vbeta)), s1);
+                _mm_storeu_ps(&dst[l][x], d);
+            }
+
+            for (; x < length; x++) {
+                dst[l][x] = beta0*src0[l][x] + beta1*src1[l][x];
+            }
+        }
+
+    } else {
+        GAPI_DbgAssert(xRatioEq1 && yRatioEq1);
+        int length = inSz.width;  // == outSz.width
+        for (int l = 0; l < lpi; l++) {
+            memcpy(dst[l], src0[l], length * sizeof(float));
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+#if USE_CVKL
+
+static inline uint8_t saturateU32toU8(uint32_t v) {
+    return static_cast<uint8_t>(v > UINT8_MAX ? UINT8_MAX : v);
+}
+
+static inline uint16_t mulq16(uint16_t a, uint16_t b) {
+    return static_cast<uint16_t>(((uint32_t)a * (uint32_t)b) >> 16);
+}
+
+// load four 128-bit quarters from unrelated addresses
+static inline __m512i mm512_loadu4_si128(const uint16_t* p0, const uint16_t* p1,
+                                         const uint16_t* p2, const uint16_t* p3) {
+    __m512i v = _mm512_castsi128_si512(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p0)));
+    v = _mm512_inserti32x4(v, _mm_loadu_si128(reinterpret_cast<const __m128i*>(p1)), 1);
+    v = _mm512_inserti32x4(v, _mm_loadu_si128(reinterpret_cast<const __m128i*>(p2)), 2);
+    v = _mm512_inserti32x4(v, _mm_loadu_si128(reinterpret_cast<const __m128i*>(p3)), 3);
+    return v;
+}
+
+// horizontal pass for x_max_count = 2, 3, 4: same as SSE 4.2 version,
+// but four 8-pixel blocks at once (one block per 128-bit lane)
+template<int K>
+static void horzArea_CVKL_U8(uint8_t dst[], const uint16_t vert_sum[], const uint16_t xsi[],
+                             const uint16_t* const alpha[], const uint16_t* const sxid[],
+                             int dwidth) {
+    const __m512i blocks = _mm512_setr_epi64(0, 2, 4, 6, 0, 2, 4, 6);
+
+    int x = 0;
+    for (; x <= dwidth - 32; x += 32) {
+        __m512i res = _mm512_set1_epi16(1 << (8 - 1));
+
+        const uint16_t* vs0 = vert_sum + xsi[x +  0];
+        const uint16_t* vs1 = vert_sum + xsi[x +  8];
+        const uint16_t* vs2 = vert_sum + xsi[x + 16];
+        const uint16_t* vs3 = vert_sum + xsi[x + 24];
+
+        __m512i chunk[K];
+        for (int j = 0; j < K; j++) {
+            chunk[j] = mm512_loadu4_si128(vs0 + 8*j, vs1 + 8*j, vs2 + 8*j, vs3 + 8*j);
+        }
+
+        for (int k = 0; k < K; k++) {
+            const uint16_t* id = sxid[k] + x * K;
+            __m512i vsum = _mm512_setzero_si512();
+            for (int j = 0; j < K; j++) {
+                __m512i sx_id = mm512_loadu4_si128(id + 8*j,         id + 8*K + 8*j,
+                                                   id + 16*K + 8*j,  id + 24*K + 8*j);
+                vsum = _mm512_or_si512(vsum, _mm512_shuffle_epi8(chunk[j], sx_id));
+            }
+            __m512i a = _mm512_loadu_si512(alpha[k] + x);
+            res = _mm512_add_epi16(res, _mm512_mulhi_epu16(a, vsum));
+        }
+
+        res = _mm512_srli_epi16(res, 8);
+        res = _mm512_packus_epi16(res, res);
+        res = _mm512_permutexvar_epi64(blocks, res);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + x), _mm512_castsi512_si256(res));
+    }
+
+    // remaining 8-pixel blocks (if any) exactly as SSE 4.2 version does
+    for (; x <= dwidth - 8; x += 8) {
+        __m128i res = _mm_set1_epi16(1 << (8 - 1));
+
+        int id0 = xsi[x];
+
+        __m128i chunk[K];
+        for (int j = 0; j < K; j++) {
+            chunk[j] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(vert_sum + id0 + 8*j));
+        }
+
+        for (int k = 0; k < K; k++) {
+            __m128i vsum = _mm_setzero_si128();
+            for (int j = 0; j < K; j++) {
+                __m128i sx_id = _mm_loadu_si128(reinterpret_cast<const __m128i*>(sxid[k] + x * K + 8*j));
+                vsum = _mm_or_si128(vsum, _mm_shuffle_epi8(chunk[j], sx_id));
+            }
+            __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(alpha[k] + x));
+            res = _mm_add_epi16(res, _mm_mulhi_epu16(a, vsum));
+        }
+
+        res = _mm_srli_epi16(res, 8);
+        res = _mm_packus_epi16(res, res);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + x), res);
+    }
+
+    for (; x < dwidth; x++) {
+        uint16_t res = 1 << (8 - 1);
+        int id = xsi[x];
+        for (int k = 0; k < K; k++) {
+            res += mulq16(alpha[k][x], vert_sum[id + k]);
+        }
+        dst[x] = saturateU32toU8(res >> 8);
+    }
+}
+
+void calcRowArea_CVKL_U8(const uchar  * src[],
+                               uchar    dst[],
+                         const Size   & inSz,
+                         const Size   & outSz,
+                               int      y,
+                         const uint16_t xsi[],
+                         const uint16_t ysi[],
+                         const uint16_t xalpha[],
+                         const uint16_t yalpha[],
+                               int      x_max_count,
+                               int      y_max_count,
+                               uint16_t vert_sum[]) {
+    if (x_max_count > 4) {
+        // horizontal pass gathers pixel by pixel, so wider vectors do not help
+        avx::calcRowArea_CVKL_U8(src, dst, inSz, outSz, y, xsi, ysi, xalpha, yalpha,
+                                 x_max_count, y_max_count, vert_sum);
+        return;
+    }
+
+    int dwidth  = outSz.width;
+    int swidth  =  inSz.width;
+    int sheight =  inSz.height;
+
+    int vest_sum_size = 2*swidth;
+    uint16_t* alpha0 = vert_sum + vest_sum_size;
+    uint16_t* alpha1 = alpha0 + dwidth;
+    uint16_t* alpha2 = alpha1 + dwidth;
+    uint16_t* alpha3 = alpha2 + dwidth;
+    uint16_t* sxid0 = alpha3 + dwidth;
+    uint16_t* sxid1 = sxid0 + 4*dwidth;
+    uint16_t* sxid2 = sxid1 + 4*dwidth;
+    uint16_t* sxid3 = sxid2 + 4*dwidth;
+
+    uint8_t * pdst_row  = dst;
+    uint16_t* vert_sum_ = vert_sum;
+
+    int ysi_row = ysi[y];
+
+    memset(vert_sum_, 0, swidth * sizeof(uint16_t));
+
+    for (int dy = 0; dy < y_max_count; dy++) {
+        if (ysi_row + dy >= sheight)
+            break;
+
+        uint16_t yalpha_dy = yalpha[y * y_max_count + dy];
+        const uint8_t *sptr_dy = src[dy];
+
+        int x = 0;
+
+        __m512i yalpha_dy_avx = _mm512_set1_epi16(yalpha_dy);
+        for (; x <= swidth - 32; x += 32) {
+            // sptr_dy[x] << 8
+            __m512i sval_Q16 = _mm512_slli_epi16(mm512_load_expand_u8(sptr_dy + x), 8);
+
+            __m512i vsum = _mm512_loadu_si512(vert_sum_ + x);
+            vsum = _mm512_add_epi16(vsum, _mm512_mulhi_epu16(yalpha_dy_avx, sval_Q16));
+            _mm512_storeu_si512(vert_sum_ + x, vsum);
+        }
+
+        for (; x < swidth; x++) {
+            vert_sum_[x] += mulq16(yalpha_dy, static_cast<uint16_t>(sptr_dy[x] << 8));
+        }
+    }
+
+    const uint16_t* const alpha[] = {alpha0, alpha1, alpha2, alpha3};
+    const uint16_t* const sxid[] = {sxid0, sxid1, sxid2, sxid3};
+
+    if (x_max_count == 2) {
+        horzArea_CVKL_U8<2>(pdst_row, vert_sum_, xsi, alpha, sxid, dwidth);
+    } else if (x_max_count == 3) {
+        horzArea_CVKL_U8<3>(pdst_row, vert_sum_, xsi, alpha, sxid, dwidth);
+    } else {
+        GAPI_DbgAssert(x_max_count == 4);
+        horzArea_CVKL_U8<4>(pdst_row, vert_sum_, xsi, alpha, sxid, dwidth);
+    }
+}
+
+#endif  // CVKL
+
+//------------------------------------------------------------------------------
+
+void mergeRow_32FC2(const float in0[],
+                    const float in1[],
+                          float out[],
+                            int length) {
+    int l = 0;
+
+    for (; l <= length - 16; l += 16) {
+        __m512 a = _mm512_loadu_ps(&in0[l]);
+        __m512 b = _mm512_loadu_ps(&in1[l]);
+        mm512_store_interleave(&out[2*l], a, b);
+    }
+
+    for (; l < length; l++) {
+        out[2*l + 0] = in0[l];
+        out[2*l + 1] = in1[l];
+    }
+}
+
+void mergeRow_32FC3(const float in0[],
+                    const float in1[],
+                    const float in2[],
+                          float out[],
+                            int length) {
+    int l = 0;
+
+    for (; l <= length - 16; l += 16) {
+        __m512 a = _mm512_loadu_ps(&in0[l]);
+        __m512 b = _mm512_loadu_ps(&in1[l]);
+        __m512 c = _mm512_loadu_ps(&in2[l]);
+        mm512_store_interleave(&out[3*l], a, b, c);
+    }
+
+    for (; l < length; l++) {
+        out[3*l + 0] = in0[l];
+        out[3*l + 1] = in1[l];
+        out[3*l + 2] = in2[l];
+    }
+}
+
+void mergeRow_32FC4(const float in0[],
+                    const float in1[],
+                    const float in2[],
+                    const float in3[],
+                          float out[],
+                            int length) {
+    int l = 0;
+
+    for (; l <= length - 16; l += 16) {
+        __m512 a = _mm512_loadu_ps(&in0[l]);
+        __m512 b = _mm512_loadu_ps(&in1[l]);
+        __m512 c = _mm512_loadu_ps(&in2[l]);
+        __m512 d = _mm512_loadu_ps(&in3[l]);
+        mm512_store_interleave(&out[4*l], a, b, c, d);
+    }
+
+    for (; l < length; l++) {
+        out[4*l + 0] = in0[l];
+        out[4*l + 1] = in1[l];
+        out[4*l + 2] = in2[l];
+        out[4*l + 3] = in3[l];
+    }
+}
+
+void splitRow_32FC2(const float in[],
+                          float out0[],
+                          float out1[],
+                            int length) {
+    int l = 0;
+
+    for (; l <= length - 16; l += 16) {
+        __m512 a, b;
+        mm512_load_deinterleave(&in[2*l], a, b);
+        _mm512_storeu_ps(&out0[l], a);
+        _mm512_storeu_ps(&out1[l], b);
+    }
+
+    for (; l < length; l++) {
+        out0[l] = in[2*l + 0];
+        out1[l] = in[2*l + 1];
+    }
+}
+
+void splitRow_32FC3(const float in[],
+                          float out0[],
+                          float out1[],
+                          float out2[],
+                            int length) {
+    int l = 0;
+
+    for (; l <= length - 16; l += 16) {
+        __m512 a, b, c;
+        mm512_load_deinterleave(&in[3*l], a, b, c);
+        _mm512_storeu_ps(&out0[l], a);
+        _mm512_storeu_ps(&out1[l], b);
+        _mm512_storeu_ps(&out2[l], c);
+    }
+
+    for (; l < length; l++) {
+        out0[l] = in[3*l + 0];
+        out1[l] = in[3*l + 1];
+        out2[l] = in[3*l + 2];
+    }
+}
+
+void splitRow_32FC4(const float in[],
+                          float out0[],
+                          float out1[],
+                          float out2[],
+                          float out3[],
+                            int length) {
+    int l = 0;
+
+    for (; l <= length - 16; l += 16) {
+        __m512 a, b, c, d;
+        mm512_load_deinterleave(&in[4*l], a, b, c, d);
+        _mm512_storeu_ps(&out0[l], a);
+        _mm512_storeu_ps(&out1[l], b);
+        _mm512_storeu_ps(&out2[l], c);
+        _mm512_storeu_ps(&out3[l], d);
+    }
+
+    for (; l < length; l++) {
+        out0[l] = in[4*l + 0];
+        out1[l] = in[4*l + 1];
+        out2[l] = in[4*l + 2];
+        out3[l] = in[4*l + 3];
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void copyRow_8U(const uint8_t in[],
+                 uint8_t out[],
+                 int length) {
+    int l = 0;
+
+    for (; l <= length - 64; l += 64) {
+        _mm512_storeu_si512(&out[l], _mm512_loadu_si512(&in[l]));
+    }
+
+    if (l < length && length >= 64) {
+        l = length - 64;
+        _mm512_storeu_si512(&out[l], _mm512_loadu_si512(&in[l]));
+        l = length;
+    }
+
+    for (; l < length; l++) {
+        out[l] = in[l];
+    }
+}
+
+void copyRow_32F(const float in[],
+                 float out[],
+                 int length) {
+    int l = 0;
+
+    for (; l <= length - 16; l += 16) {
+        _mm512_storeu_ps(&out[l], _mm512_loadu_ps(&in[l]));
+    }
+
+    if (l < length && length >= 16) {
+        l = length - 16;
+        _mm512_storeu_ps(&out[l], _mm512_loadu_ps(&in[l]));
+        l = length;
+    }
+
+    for (; l < length; l++) {
+        out[l] = in[l];
+    }
+}
+
+}  // namespace avx512
+}  // namespace kernels
+}  // namespace gapi
+}  // namespace InferenceEngine
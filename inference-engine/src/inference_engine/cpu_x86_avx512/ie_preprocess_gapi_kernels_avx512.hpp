@@ -0,0 +1,127 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "ie_preprocess_gapi_kernels.hpp"
+#include "ie_preprocess_gapi_kernels_impl.hpp"
+
+namespace InferenceEngine {
+namespace gapi {
+namespace kernels {
+
+//----------------------------------------------------------------------
+
+namespace avx512 {
+
+// NB: these kernels mirror the SSE 4.2 ones in interface and results,
+// only the vector width differs (see ie_preprocess_gapi_kernels_sse42.hpp)
+//
+// Kernels not listed here gain nothing from 512-bit vectors (generic area
+// resize is bound by its scalar horizontal pass, 8-bit channel shuffles
+// would need AVX-512 VBMI), so AVX2 versions are used for them instead
+
+#if USE_CVKL
+void calcRowArea_CVKL_U8(const uchar  * src[],
+                               uchar    dst[],
+                         const Size   & inSz,
+                         const Size   & outSz,
+                               int      y,
+                         const uint16_t xsi[],
+                         const uint16_t ysi[],
+                         const uint16_t xalpha[],
+                         const uint16_t yalpha[],
+                               int      x_max_count,
+                               int      y_max_count,
+                               uint16_t vert_sum[]);
+#endif
+
+//----------------------------------------------------------------------
+
+// Resize (bi-linear, 8U)
+void calcRowLinear_8U(uint8_t *dst[],
+                const uint8_t *src0[],
+                const uint8_t *src1[],
+                const short    alpha[],
+                const short    clone[],
+                const short    mapsx[],
+                const short    beta[],
+                      uint8_t  tmp[],
+                const Size   & inSz,
+                const Size   & outSz,
+                      int      lpi);
+
+void calcRowLinear_8UC3(std::array<std::array<uint8_t*, 4>, 3> &dst,
+                  const uint8_t *src0[],
+                  const uint8_t *src1[],
+                  const short    alpha[],
+                  const short    clone[],
+                  const short    mapsx[],
+                  const short    beta[],
+                        uint8_t  tmp[],
+                  const Size    &inSz,
+                  const Size    &outSz,
+                        int      lpi);
+
+// Resize (bi-linear, 32F)
+void calcRowLinear_32F(float *dst[],
+                 const float *src0[],
+                 const float *src1[],
+                 const float  alpha[],
+                 const int    mapsx[],
+                 const float  beta[],
+                 const Size & inSz,
+                 const Size & outSz,
+                       int    lpi);
+
+//----------------------------------------------------------------------
+
+void mergeRow_32FC2(const float in0[],
+                    const float in1[],
+                          float out[],
+                            int length);
+
+void mergeRow_32FC3(const float in0[],
+                    const float in1[],
+                    const float in2[],
+                          float out[],
+                            int length);
+
+void mergeRow_32FC4(const float in0[],
+                    const float in1[],
+                    const float in2[],
+                    const float in3[],
+                          float out[],
+                            int length);
+
+void splitRow_32FC2(const float in[],
+                          float out0[],
+                          float out1[],
+                            int length);
+
+void splitRow_32FC3(const float in[],
+                          float out0[],
+                          float out1[],
+                          float out2[],
+                            int length);
+
+void splitRow_32FC4(const float in[],
+                          float out0[],
+                          float out1[],
+                          float out2[],
+                          float out3[],
+                            int length);
+
+void copyRow_8U(const uint8_t in[],
+                uint8_t out[],
+                int length);
+
+void copyRow_32F(const float in[],
+                 float out[],
+                 int length);
+
+}  // namespace avx512
+}  // namespace kernels
+}  // namespace gapi
+}  // namespace InferenceEngine
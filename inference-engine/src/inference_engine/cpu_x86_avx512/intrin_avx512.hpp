@@ -0,0 +1,108 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <immintrin.h>  // AVX-512
+
+namespace InferenceEngine {
+namespace avx512 {
+
+//------------------------------------------------------------------------
+//
+// Channel (de)interleaving helpers for AVX-512F, x86 specific.
+//
+// Unlike AVX2, two-source permutes (vpermt2ps/vpermt2q) work across the
+// whole register, so each helper is a fixed set of table lookups.
+//
+//------------------------------------------------------------------------
+
+static inline
+void mm512_load_deinterleave(const float* ptr, __m512& a, __m512& b) {
+    const __m512i even = _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30);
+    const __m512i odd  = _mm512_setr_epi32(1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31);
+    __m512 t0 = _mm512_loadu_ps(ptr);
+    __m512 t1 = _mm512_loadu_ps(ptr + 16);
+    a = _mm512_permutex2var_ps(t0, even, t1);
+    b = _mm512_permutex2var_ps(t0, odd,  t1);
+}
+
+static inline
+void mm512_store_interleave(float* ptr, __m512 a, __m512 b) {
+    const __m512i lo = _mm512_setr_epi32(0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+    const __m512i hi = _mm512_setr_epi32(8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+    _mm512_storeu_ps(ptr,      _mm512_permutex2var_ps(a, lo, b));
+    _mm512_storeu_ps(ptr + 16, _mm512_permutex2var_ps(a, hi, b));
+}
+
+static inline
+void mm512_load_deinterleave(const float* ptr, __m512& a, __m512& b, __m512& c) {
+    // 1st step picks elements from t0 and t1, 2nd step from t2 (if any)
+    const __m512i a1 = _mm512_setr_epi32(0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30, 0, 0, 0, 0, 0);
+    const __m512i a2 = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 17, 20, 23, 26, 29);
+    const __m512i b1 = _mm512_setr_epi32(1, 4, 7, 10, 13, 16, 19, 22, 25, 28, 31, 0, 0, 0, 0, 0);
+    const __m512i b2 = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 18, 21, 24, 27, 30);
+    const __m512i c1 = _mm512_setr_epi32(2, 5, 8, 11, 14, 17, 20, 23, 26, 29, 0, 0, 0, 0, 0, 0);
+    const __m512i c2 = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 16, 19, 22, 25, 28, 31);
+    __m512 t0 = _mm512_loadu_ps(ptr);
+    __m512 t1 = _mm512_loadu_ps(ptr + 16);
+    __m512 t2 = _mm512_loadu_ps(ptr + 32);
+    a = _mm512_permutex2var_ps(_mm512_permutex2var_ps(t0, a1, t1), a2, t2);
+    b = _mm512_permutex2var_ps(_mm512_permutex2var_ps(t0, b1, t1), b2, t2);
+    c = _mm512_permutex2var_ps(_mm512_permutex2var_ps(t0, c1, t1), c2, t2);
+}
+
+static inline
+void mm512_store_interleave(float* ptr, __m512 a, __m512 b, __m512 c) {
+    // 1st step picks elements from a and b, 2nd step from c
+    const __m512i i01 = _mm512_setr_epi32(0, 16, 0, 1, 17, 0, 2, 18, 0, 3, 19, 0, 4, 20, 0, 5);
+    const __m512i i02 = _mm512_setr_epi32(0, 1, 16, 3, 4, 17, 6, 7, 18, 9, 10, 19, 12, 13, 20, 15);
+    const __m512i i11 = _mm512_setr_epi32(21, 0, 6, 22, 0, 7, 23, 0, 8, 24, 0, 9, 25, 0, 10, 26);
+    const __m512i i12 = _mm512_setr_epi32(0, 21, 2, 3, 22, 5, 6, 23, 8, 9, 24, 11, 12, 25, 14, 15);
+    const __m512i i21 = _mm512_setr_epi32(0, 11, 27, 0, 12, 28, 0, 13, 29, 0, 14, 30, 0, 15, 31, 0);
+    const __m512i i22 = _mm512_setr_epi32(26, 1, 2, 27, 4, 5, 28, 7, 8, 29, 10, 11, 30, 13, 14, 31);
+    _mm512_storeu_ps(ptr,      _mm512_permutex2var_ps(_mm512_permutex2var_ps(a, i01, b), i02, c));
+    _mm512_storeu_ps(ptr + 16, _mm512_permutex2var_ps(_mm512_permutex2var_ps(a, i11, b), i12, c));
+    _mm512_storeu_ps(ptr + 32, _mm512_permutex2var_ps(_mm512_permutex2var_ps(a, i21, b), i22, c));
+}
+
+static inline
+void mm512_load_deinterleave(const float* ptr, __m512& a, __m512& b, __m512& c, __m512& d) {
+    // split pairs {a, b} and {c, d} as 64-bit items first
+    const __m512i even64 = _mm512_setr_epi64(0, 2, 4, 6, 8, 10, 12, 14);
+    const __m512i odd64  = _mm512_setr_epi64(1, 3, 5, 7, 9, 11, 13, 15);
+    const __m512i even = _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30);
+    const __m512i odd  = _mm512_setr_epi32(1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31);
+    __m512i t0 = _mm512_castps_si512(_mm512_loadu_ps(ptr));
+    __m512i t1 = _mm512_castps_si512(_mm512_loadu_ps(ptr + 16));
+    __m512i t2 = _mm512_castps_si512(_mm512_loadu_ps(ptr + 32));
+    __m512i t3 = _mm512_castps_si512(_mm512_loadu_ps(ptr + 48));
+    __m512 ab0 = _mm512_castsi512_ps(_mm512_permutex2var_epi64(t0, even64, t1));
+    __m512 cd0 = _mm512_castsi512_ps(_mm512_permutex2var_epi64(t0, odd64,  t1));
+    __m512 ab1 = _mm512_castsi512_ps(_mm512_permutex2var_epi64(t2, even64, t3));
+    __m512 cd1 = _mm512_castsi512_ps(_mm512_permutex2var_epi64(t2, odd64,  t3));
+    a = _mm512_permutex2var_ps(ab0, even, ab1);
+    b = _mm512_permutex2var_ps(ab0, odd,  ab1);
+    c = _mm512_permutex2var_ps(cd0, even, cd1);
+    d = _mm512_permutex2var_ps(cd0, odd,  cd1);
+}
+
+static inline
+void mm512_store_interleave(float* ptr, __m512 a, __m512 b, __m512 c, __m512 d) {
+    const __m512i lo = _mm512_setr_epi32(0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+    const __m512i hi = _mm512_setr_epi32(8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+    const __m512i lo64 = _mm512_setr_epi64(0, 8, 1, 9, 2, 10, 3, 11);
+    const __m512i hi64 = _mm512_setr_epi64(4, 12, 5, 13, 6, 14, 7, 15);
+    __m512i ab0 = _mm512_castps_si512(_mm512_permutex2var_ps(a, lo, b));
+    __m512i ab1 = _mm512_castps_si512(_mm512_permutex2var_ps(a, hi, b));
+    __m512i cd0 = _mm512_castps_si512(_mm512_permutex2var_ps(c, lo, d));
+    __m512i cd1 = _mm512_castps_si512(_mm512_permutex2var_ps(c, hi, d));
+    _mm512_storeu_ps(ptr,      _mm512_castsi512_ps(_mm512_permutex2var_epi64(ab0, lo64, cd0)));
+    _mm512_storeu_ps(ptr + 16, _mm512_castsi512_ps(_mm512_permutex2var_epi64(ab0, hi64, cd0)));
+    _mm512_storeu_ps(ptr + 32, _mm512_castsi512_ps(_mm512_permutex2var_epi64(ab1, lo64, cd1)));
+    _mm512_storeu_ps(ptr + 48, _mm512_castsi512_ps(_mm512_permutex2var_epi64(ab1, hi64, cd1)));
+}
+
+}  // namespace avx512
+}  // namespace InferenceEngine
@@ -16,42 +16,29 @@ HeteroAsyncInferRequest::HeteroAsyncInferRequest(HeteroInferRequest::Ptr request
                                                  const ITaskExecutor::Ptr &callbackExecutor)
         : AsyncInferRequestThreadSafeDefault(request, taskExecutor, taskSynchronizer, callbackExecutor),
           _heteroInferRequest(request) {
-    _heteroInferRequest->setCallbackSequence();
-
-    std::function<void(InferRequest, StatusCode)> f =
-        [&](InferRequest /*request*/, StatusCode /*sts*/) {
-            setIsRequestBusy(false);
-        };
+}
 
-    _heteroInferRequest->setCallbackForLastRequest(f);
+HeteroAsyncInferRequest::~HeteroAsyncInferRequest() {
+    // the completion handler of the pipeline refers to this request
+    _heteroInferRequest->waitPipelined(IInferRequest::WaitMode::RESULT_READY);
 }
 
-void HeteroAsyncInferRequest::StartAsync() {
+void HeteroAsyncInferRequest::StartAsync_ThreadUnsafe() {
     IE_PROFILING_AUTO_SCOPE(Hetero_Async)
-    if (isRequestBusy())
-        THROW_IE_EXCEPTION << InferenceEngine::details::as_status << StatusCode::REQUEST_BUSY << REQUEST_BUSY_str;
-    setIsRequestBusy(true);
-    _heteroInferRequest->updateInOutIfNeeded();
-    _heteroInferRequest->startFirstAsyncRequest();
+    _heteroInferRequest->checkBlobs();
+    _callbackManager.reset();
+    _heteroInferRequest->startPipelined([this](StatusCode sts) {
+        setIsRequestBusy(false);
+        _callbackManager.set_requestStatus(sts);
+        _callbackManager.runCallback();
+    });
 }
 
 InferenceEngine::StatusCode HeteroAsyncInferRequest::Wait(int64_t millis_timeout) {
-    auto sts = _heteroInferRequest->waitAllRequests(millis_timeout);
-    if (sts != StatusCode::RESULT_NOT_READY && sts != StatusCode::REQUEST_BUSY) {
-        setIsRequestBusy(false);
+    if (millis_timeout < IInferRequest::WaitMode::RESULT_READY) {
+        THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str + "Timeout can't be less "
+                           << IInferRequest::WaitMode::RESULT_READY
+                           << " for InferRequest::Wait\n";
     }
-    return sts;
-}
-
-void HeteroAsyncInferRequest::SetCompletionCallback(IInferRequest::CompletionCallback callback) {
-    AsyncInferRequestThreadSafeDefault::SetCompletionCallback(callback);
-
-    std::function<void(InferRequest, StatusCode)> f =
-            [&](InferRequest /*request*/, StatusCode sts) {
-                setIsRequestBusy(false);
-                _callbackManager.set_requestStatus(sts);
-                _callbackManager.runCallback();
-            };
-
-    _heteroInferRequest->setCallbackForLastRequest(f);
+    return _heteroInferRequest->waitPipelined(millis_timeout);
 }
@@ -29,11 +29,11 @@ public:
                             const InferenceEngine::TaskSynchronizer::Ptr &taskSynchronizer,
                             const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor);
 
-    void StartAsync() override;
+    ~HeteroAsyncInferRequest() override;
 
-    InferenceEngine::StatusCode Wait(int64_t millis_timeout) override;
+    void StartAsync_ThreadUnsafe() override;
 
-    void SetCompletionCallback(InferenceEngine::IInferRequest::CompletionCallback callback) override;
+    InferenceEngine::StatusCode Wait(int64_t millis_timeout) override;
 
 private:
     HeteroInferRequest::Ptr _heteroInferRequest;
@@ -310,33 +310,35 @@ void HeteroExecutableNetwork::load(InferenceEngine::ICNNNetwork &network_,
 
 
     networks = std::move(descs);
+
+    std::vector<HeteroPipeline::StageDesc> stages;
+    for (auto &&desc : networks) {
+        stages.push_back({desc.network, desc._iNames, desc._oNames});
+    }
+    std::unordered_set<std::string> outputNames;
+    for (auto &&output : externalOutputsData) {
+        outputNames.insert(output.first);
+    }
+    auto itPerfCount = config.find(KEY_PERF_COUNT);
+    bool perfCount = itPerfCount != config.end() && itPerfCount->second == YES;
+    _pipeline = std::make_shared<HeteroPipeline>(stages, outputNames, perfCount);
 }
 
 InferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(
         InputsDataMap networkInputs,
         OutputsDataMap networkOutputs) {
-    HeteroInferRequest::SubRequestsList inferRequests;
-    int index = 0;
-    for (auto i : networks) {
-        HeteroInferRequest::SubRequestDesc desc;
-        desc._network = i.network;
-        desc._iNames = i._iNames;
-        desc._oNames = i._oNames;
-        desc._profilingTask = ProfilingTask{"Infer" + std::to_string(index++)};
-
-        inferRequests.push_back(desc);
-    }
     return std::make_shared<HeteroInferRequest>(networkInputs,
                                                 networkOutputs,
-                                                inferRequests);
+                                                _pipeline);
 }
 
 void HeteroExecutableNetwork::CreateInferRequest(IInferRequest::Ptr &asyncRequest) {
     auto heteroInferRequest = std::dynamic_pointer_cast<HeteroInferRequest>(
             CreateInferRequestImpl(_networkInputs, _networkOutputs));
     heteroInferRequest->setPointerToExecutableNetworkInternal(shared_from_this());
+    // requests of the network are ordered by the pipeline, they must not wait for each other to start
     auto asyncTreadSafeImpl = std::make_shared<HeteroAsyncInferRequest>(
-            heteroInferRequest, _taskExecutor, _taskSynchronizer, _callbackExecutor);
+            heteroInferRequest, _taskExecutor, std::make_shared<TaskSynchronizer>(), _callbackExecutor);
     asyncRequest.reset(new InferRequestBase<HeteroAsyncInferRequest>(asyncTreadSafeImpl),
                        [](IInferRequest *p) { p->Release(); });
     asyncTreadSafeImpl->SetPointerToPublicInterface(asyncRequest);
@@ -376,6 +378,8 @@ void HeteroExecutableNetwork::GetMetric(const std::string &name, InferenceEngine
         for (auto&& desc : networks) {
             value = std::max(value, desc.network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
         }
+        // one request per subgraph keeps all stages of the pipeline busy
+        value = std::max(value, static_cast<unsigned int>(networks.size()));
         result = IE_SET_METRIC(OPTIMAL_NUMBER_OF_INFER_REQUESTS, value);
     } else {
         THROW_IE_EXCEPTION << "Unsupported ExecutableNetwork metric: " << name;
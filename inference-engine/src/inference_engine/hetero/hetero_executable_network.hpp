@@ -20,6 +20,7 @@
 #include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
 
 #include "hetero_infer_request.hpp"
+#include "hetero_pipeline.hpp"
 #include "ie_icore.hpp"
 #include "cnn_network_impl.hpp"
 #include "hetero_async_infer_request.hpp"
@@ -80,6 +81,7 @@ private:
         std::unordered_set<std::string> _iNames;
     };
     std::vector<NetworkDesc> networks;
+    HeteroPipeline::Ptr _pipeline;
 
     InferenceEngine::MapDeviceLoaders &_deviceLoaders;
     std::string _name;
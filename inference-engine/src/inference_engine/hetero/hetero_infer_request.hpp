@@ -13,12 +13,14 @@
 #include <string>
 #include <vector>
 #include <memory>
-#include <unordered_set>
+#include <mutex>
+#include <functional>
 #include <ie_common.h>
 #include <cpp_interfaces/impl/ie_infer_request_internal.hpp>
 #include <cpp_interfaces/impl/ie_executable_network_internal.hpp>
 #include <cpp/ie_infer_request.hpp>
 #include <cpp/ie_executable_network.hpp>
+#include "hetero_pipeline.hpp"
 
 namespace HeteroPlugin {
 
@@ -26,40 +28,31 @@ class HeteroInferRequest : public InferenceEngine::InferRequestInternal {
 public:
     typedef std::shared_ptr<HeteroInferRequest> Ptr;
 
-    struct SubRequestDesc {
-        InferenceEngine::ExecutableNetwork::Ptr _network;
-        InferenceEngine::InferRequest::Ptr _request;
-        std::unordered_set<std::string> _iNames;
-        std::unordered_set<std::string> _oNames;
-        InferenceEngine::ProfilingTask _profilingTask;
-    };
-    using SubRequestsList = std::vector<SubRequestDesc>;
-
     explicit HeteroInferRequest(InferenceEngine::InputsDataMap networkInputs,
                                 InferenceEngine::OutputsDataMap networkOutputs,
-                                const SubRequestsList &inferRequests);
+                                const HeteroPipeline::Ptr &pipeline);
 
     void InferImpl() override;
 
     void
     GetPerformanceCounts(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const override;
 
-    void updateInOutIfNeeded();
-
-    void setCallbackSequence();
-
-    void startFirstAsyncRequest();
+    /**
+     * @brief Queues the request to the pipeline, onDone is called from a sub-request callback thread
+     */
+    void startPipelined(const std::function<void(InferenceEngine::StatusCode)> &onDone);
 
-    InferenceEngine::StatusCode waitAllRequests(int64_t millis_timeout);
+    InferenceEngine::StatusCode waitPipelined(int64_t millis_timeout);
 
-    void setCallbackForLastRequest(std::function<void(InferenceEngine::InferRequest, InferenceEngine::StatusCode)>& callback);
+private:
+    HeteroPipeline::Job::Ptr createJob();
 
-    bool isAnyRequestBusy();
+    HeteroPipeline::Job::Ptr lastJob() const;
 
-private:
-    SubRequestsList _inferRequests;
-    std::map<std::string, InferenceEngine::Blob::Ptr> _blobs;
+    HeteroPipeline::Ptr _pipeline;
+    // the last started run, it may be replaced from the completion callback of the previous one
+    HeteroPipeline::Job::Ptr _job;
+    mutable std::mutex _jobMutex;
 };
 
 }  // namespace HeteroPlugin
-
@@ -0,0 +1,234 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "hetero_pipeline.hpp"
+#include <blob_factory.hpp>
+#include <ie_profiling.hpp>
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace HeteroPlugin;
+using namespace InferenceEngine;
+
+HeteroPipeline::HeteroPipeline(const std::vector<StageDesc> &stages,
+                               const std::unordered_set<std::string> &networkOutputs,
+                               bool collectPerfCounts) :
+        _collectPerfCounts(collectPerfCounts) {
+    if (stages.empty()) {
+        THROW_IE_EXCEPTION << "Internal error: hetero network has no subgraphs";
+    }
+
+    // Requests pass the stages in order and one stage holds one request, so a blob produced by stage i
+    // and consumed by stage j is in use by at most j - i + 1 consecutive requests
+    size_t maxDistance = 0;
+    for (size_t j = 0; j < stages.size(); j++) {
+        for (auto &&name : stages[j]._iNames) {
+            for (size_t i = 0; i < j; i++) {
+                if (stages[i]._oNames.count(name) != 0) {
+                    maxDistance = std::max(maxDistance, j - i);
+                }
+            }
+        }
+    }
+    _slots = maxDistance + 1;
+
+    _stages.resize(stages.size());
+    for (size_t k = 0; k < stages.size(); k++) {
+        auto &stage = _stages[k];
+        stage._desc = stages[k];
+        stage._bound.resize(_slots);
+        for (size_t s = 0; s < _slots; s++) {
+            auto request = stage._desc._network->CreateInferRequestPtr();
+            request->SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
+                    [this, k](InferRequest request, StatusCode sts) {
+                        IE_PROFILING_AUTO_SCOPE(Callback)
+                        onStageDone(k, sts, {}, &request);
+                    });
+            stage._requests.push_back(request);
+        }
+        // taken once, later the sub-requests may be busy with other requests
+        for (auto &&name : stage._desc._iNames) {
+            _descs.emplace(name, stage._requests.front()->GetBlob(name.c_str())->getTensorDesc());
+        }
+        for (auto &&name : stage._desc._oNames) {
+            _descs.emplace(name, stage._requests.front()->GetBlob(name.c_str())->getTensorDesc());
+        }
+    }
+
+    // intermediate blobs are allocated by the producer and shared with the consumers of the same slot
+    for (size_t s = 0; s < _slots; s++) {
+        for (size_t i = 0; i < _stages.size(); i++) {
+            for (auto &&name : _stages[i]._desc._oNames) {
+                if (networkOutputs.count(name) != 0) {
+                    continue;
+                }
+                auto blob = _stages[i]._requests[s]->GetBlob(name.c_str());
+                for (size_t j = i + 1; j < _stages.size(); j++) {
+                    if (_stages[j]._desc._iNames.count(name) != 0) {
+                        _stages[j]._requests[s]->SetBlob(name.c_str(), blob);
+                    }
+                }
+            }
+        }
+    }
+}
+
+HeteroPipeline::~HeteroPipeline() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _jobDone.wait(lock, [this] { return _jobsInFlight == 0; });
+}
+
+Blob::Ptr HeteroPipeline::createBlob(const std::string &name) const {
+    auto it = _descs.find(name);
+    if (it == _descs.end()) {
+        THROW_IE_EXCEPTION << "Internal error: no subgraph has input or output '" << name << "'";
+    }
+    auto blob = make_blob_with_precision(it->second);
+    blob->allocate();
+    return blob;
+}
+
+void HeteroPipeline::start(const Job::Ptr &job) {
+    std::vector<Launch> launches;
+    std::vector<Job::Ptr> completed;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        job->_done = false;
+        job->_status = StatusCode::OK;
+        job->_error.clear();
+        job->_perfCounts.clear();
+        _queue.push_back(job);
+        _jobsInFlight++;
+        schedule(launches, completed);
+    }
+    launch(launches);
+}
+
+StatusCode HeteroPipeline::wait(const Job::Ptr &job, int64_t millis_timeout) {
+    std::unique_lock<std::mutex> lock(_mutex);
+    auto isDone = [&] { return job->_done; };
+    if (millis_timeout == IInferRequest::WaitMode::RESULT_READY) {
+        _jobDone.wait(lock, isDone);
+    } else if (millis_timeout > 0) {
+        _jobDone.wait_for(lock, std::chrono::milliseconds(millis_timeout), isDone);
+    }
+    if (!job->_done) {
+        return millis_timeout == IInferRequest::WaitMode::STATUS_ONLY ? StatusCode::REQUEST_BUSY
+                                                                       : StatusCode::RESULT_NOT_READY;
+    }
+    return job->_status;
+}
+
+void HeteroPipeline::run(const Job::Ptr &job) {
+    start(job);
+    auto status = wait(job, IInferRequest::WaitMode::RESULT_READY);
+    if (status != StatusCode::OK) {
+        THROW_IE_EXCEPTION << details::as_status << status << job->_error;
+    }
+}
+
+void HeteroPipeline::onStageDone(size_t k, StatusCode status, const std::string &error, InferRequest *request) {
+    std::map<std::string, InferenceEngineProfileInfo> perfCounts;
+    if (_collectPerfCounts && status == StatusCode::OK && request != nullptr) {
+        perfCounts = request->GetPerformanceCounts();
+    }
+
+    std::vector<Launch> launches;
+    std::vector<Job::Ptr> completed;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto &stage = _stages[k];
+        auto &job = stage._job;
+        if (status != StatusCode::OK && job->_status == StatusCode::OK) {
+            job->_status = status;
+            job->_error = !error.empty() ? error
+                                         : "Subgraph " + std::to_string(k) + " failed with status " +
+                                           std::to_string(static_cast<int>(status));
+        }
+        for (auto &&counter : perfCounts) {
+            job->_perfCounts["subgraph" + std::to_string(k) + ": " + counter.first] = counter.second;
+        }
+        stage._finished = true;
+        schedule(launches, completed);
+    }
+    launch(launches);
+    complete(completed);
+}
+
+void HeteroPipeline::schedule(std::vector<Launch> &launches, std::vector<Job::Ptr> &completed) {
+    // jobs are moved forward starting from the last stage, so a stage freed on the way can take the next job
+    for (size_t k = _stages.size(); k-- > 0;) {
+        auto &stage = _stages[k];
+        if (!stage._job || !stage._finished) {
+            continue;
+        }
+        if (k + 1 == _stages.size() || stage._job->_status != StatusCode::OK) {
+            completed.push_back(stage._job);
+        } else if (!_stages[k + 1]._job) {
+            _stages[k + 1]._job = stage._job;
+            _stages[k + 1]._finished = false;
+            launches.emplace_back(k + 1, stage._job);
+        } else {
+            continue;
+        }
+        stage._job = nullptr;
+        stage._finished = false;
+    }
+
+    if (!_stages.front()._job && !_queue.empty()) {
+        auto job = _queue.front();
+        _queue.pop_front();
+        job->_slot = _jobsStarted++ % _slots;
+        _stages.front()._job = job;
+        _stages.front()._finished = false;
+        launches.emplace_back(0, job);
+    }
+}
+
+void HeteroPipeline::launch(const std::vector<Launch> &launches) {
+    for (auto &&launch : launches) {
+        auto &stage = _stages[launch.first];
+        auto &job = launch.second;
+        // the stage and the slot belong to the job until it is passed further, no lock is needed
+        auto &request = stage._requests[job->_slot];
+        auto &bound = stage._bound[job->_slot];
+        try {
+            auto bind = [&](const std::string &name) {
+                auto it = job->_blobs.find(name);
+                if (it != job->_blobs.end() && bound[name] != it->second) {
+                    request->SetBlob(name.c_str(), it->second);
+                    bound[name] = it->second;
+                }
+            };
+            for (auto &&name : stage._desc._iNames) {
+                bind(name);
+            }
+            for (auto &&name : stage._desc._oNames) {
+                bind(name);
+            }
+            request->StartAsync();
+        } catch (const details::InferenceEngineException &e) {
+            onStageDone(launch.first, e.hasStatus() ? e.getStatus() : StatusCode::GENERAL_ERROR, e.what(), nullptr);
+        } catch (const std::exception &e) {
+            onStageDone(launch.first, StatusCode::GENERAL_ERROR, e.what(), nullptr);
+        }
+    }
+}
+
+void HeteroPipeline::complete(const std::vector<Job::Ptr> &completed) {
+    for (auto &&job : completed) {
+        if (job->_onDone) {
+            try {
+                job->_onDone(job->_status);
+            } catch (...) {}
+        }
+        std::lock_guard<std::mutex> lock(_mutex);
+        job->_done = true;
+        _jobsInFlight--;
+        _jobDone.notify_all();
+    }
+}
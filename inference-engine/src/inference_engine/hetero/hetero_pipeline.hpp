@@ -0,0 +1,137 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief a header file for the pipeline of hetero subgraphs
+ * @file hetero_pipeline.hpp
+ */
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <functional>
+#include <condition_variable>
+#include <unordered_set>
+#include <ie_common.h>
+#include <cpp/ie_infer_request.hpp>
+#include <cpp/ie_executable_network.hpp>
+
+namespace HeteroPlugin {
+
+/**
+ * @brief Executes infer requests of a hetero network by passing them through the subgraphs as through
+ * the stages of a pipeline.
+ *
+ * Every stage runs one request at a time and hands it over to the next stage as soon as the latter is free,
+ * so stage k of a request overlaps stage k-1 of the following one. The sub-requests are shared by all infer
+ * requests of the network: a stage has a sub-request per slot and consecutive requests take the slots in turn.
+ * Intermediate blobs are bound once per slot, only network inputs and outputs are set to the sub-requests
+ * when they change.
+ */
+class HeteroPipeline {
+public:
+    typedef std::shared_ptr<HeteroPipeline> Ptr;
+
+    struct StageDesc {
+        InferenceEngine::ExecutableNetwork::Ptr _network;
+        std::unordered_set<std::string> _iNames;
+        std::unordered_set<std::string> _oNames;
+    };
+
+    /**
+     * @brief A single run of an infer request through the pipeline
+     */
+    struct Job {
+        typedef std::shared_ptr<Job> Ptr;
+
+        // network inputs and outputs of the request, must not change while the job is running
+        std::map<std::string, InferenceEngine::Blob::Ptr> _blobs;
+        // called from the thread of the last executed stage before the job is reported as done
+        std::function<void(InferenceEngine::StatusCode)> _onDone;
+
+        // the rest is set by the pipeline
+        size_t _slot = 0;
+        bool _done = false;
+        InferenceEngine::StatusCode _status = InferenceEngine::StatusCode::OK;
+        std::string _error;
+        std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> _perfCounts;
+    };
+
+    /**
+     * @param stages subgraphs in the order of execution
+     * @param networkOutputs names of the hetero network outputs, they are never treated as intermediate blobs
+     * @param collectPerfCounts gather performance counters of every stage into the job
+     */
+    HeteroPipeline(const std::vector<StageDesc> &stages,
+                   const std::unordered_set<std::string> &networkOutputs,
+                   bool collectPerfCounts);
+
+    ~HeteroPipeline();
+
+    /**
+     * @brief Queues the job, the stages are started from the caller and the sub-request callback threads
+     */
+    void start(const Job::Ptr &job);
+
+    InferenceEngine::StatusCode wait(const Job::Ptr &job, int64_t millis_timeout);
+
+    /**
+     * @brief Starts the job and waits for it, throws if any of the stages fails
+     */
+    void run(const Job::Ptr &job);
+
+    /**
+     * @brief Allocates a blob matching the network input or output of the subgraphs
+     */
+    InferenceEngine::Blob::Ptr createBlob(const std::string &name) const;
+
+    size_t slotsCount() const {
+        return _slots;
+    }
+
+    size_t stagesCount() const {
+        return _stages.size();
+    }
+
+private:
+    struct Stage {
+        StageDesc _desc;
+        // per slot
+        std::vector<InferenceEngine::InferRequest::Ptr> _requests;
+        std::vector<std::map<std::string, InferenceEngine::Blob::Ptr>> _bound;
+        // the job occupying the stage, it keeps the stage until the next one takes it
+        Job::Ptr _job;
+        bool _finished = false;
+    };
+
+    using Launch = std::pair<size_t, Job::Ptr>;
+
+    void onStageDone(size_t stage, InferenceEngine::StatusCode status, const std::string &error,
+                     InferenceEngine::InferRequest *request);
+
+    void schedule(std::vector<Launch> &launches, std::vector<Job::Ptr> &completed);
+
+    void launch(const std::vector<Launch> &launches);
+
+    void complete(const std::vector<Job::Ptr> &completed);
+
+    std::vector<Stage> _stages;
+    std::map<std::string, InferenceEngine::TensorDesc> _descs;
+    size_t _slots = 1;
+    bool _collectPerfCounts = false;
+
+    std::mutex _mutex;
+    std::condition_variable _jobDone;
+    std::deque<Job::Ptr> _queue;
+    size_t _jobsStarted = 0;
+    size_t _jobsInFlight = 0;
+};
+
+}  // namespace HeteroPlugin
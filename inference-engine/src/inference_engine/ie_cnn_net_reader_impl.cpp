@@ -13,6 +13,7 @@
 #include <ie_cnn_net_reader_impl.h>
 #include "ie_format_parser.h"
 #include <file_utils.h>
+#include "mmap_allocator.hpp"
 #include <ie_plugin.hpp>
 #include "xml_parse_utils.h"
 #include "details/os/os_filesystem.hpp"
@@ -70,12 +71,9 @@ StatusCode CNNNetReaderImpl::ReadWeights(const char* filepath, ResponseDesc* res
         return DescriptionBuffer(resp) << "network is empty";
     }
 
-    auto ulFileSize = static_cast<size_t>(fileSize);
-
     try {
-        TBlob<uint8_t>::Ptr weightsPtr(new TBlob<uint8_t>(TensorDesc(Precision::U8, {ulFileSize}, Layout::C)));
-        weightsPtr->allocate();
-        FileUtils::readAllFile(filepath, weightsPtr->buffer(), ulFileSize);
+        // layer blobs are proxies into this one, so mapping the file keeps only touched pages resident
+        TBlob<uint8_t>::Ptr weightsPtr = readFileToBlob(filepath);
         return SetWeights(weightsPtr, resp);
     } catch (const InferenceEngineException& ex) {
         return DescriptionBuffer(resp) << ex.what();
@@ -11,11 +11,17 @@
 
 #include "hetero/hetero_plugin.hpp"
 #include "ie_util_internal.hpp"
+#include "network_serializer.h"
 #include "file_utils.h"
 #include "ie_icore.hpp"
+#include "details/ie_cnn_network_tools.h"
 #include "cpp_interfaces/ie_itask_executor.hpp"
 
+#include <chrono>
+#include <cstdio>
 #include <fstream>
+#include <iomanip>
+#include <set>
 #include <sstream>
 #include <functional>
 #include <string>
@@ -23,6 +29,7 @@
 #include <vector>
 #include <utility>
 #include <map>
+#include <mutex>
 
 #include "xml_parse_utils.h"
 
@@ -46,6 +53,179 @@ IInferencePluginAPI * getInferencePluginAPIInterface(InferencePlugin plugin) {
     return getInferencePluginAPIInterface(static_cast<InferenceEnginePluginPtr>(plugin));
 }
 
+/**
+ * @brief Stream buffer computing 64-bit FNV-1a hash of everything written into it without storing the data
+ */
+class HashStreamBuf : public std::streambuf {
+public:
+    uint64_t getHash() const {
+        return hash;
+    }
+
+protected:
+    int_type overflow(int_type c) override {
+        if (!traits_type::eq_int_type(c, traits_type::eof())) {
+            char ch = traits_type::to_char_type(c);
+            update(&ch, 1);
+        }
+        return traits_type::not_eof(c);
+    }
+
+    std::streamsize xsputn(const char * s, std::streamsize n) override {
+        update(s, static_cast<size_t>(n));
+        return n;
+    }
+
+private:
+    void update(const char * s, size_t n) {
+        for (size_t i = 0; i < n; i++) {
+            hash ^= static_cast<uint8_t>(s[i]);
+            hash *= 0x100000001b3ull;
+        }
+    }
+
+    uint64_t hash = 0xcbf29ce484222325ull;
+};
+
+/**
+ * @brief Computes a hash of the serialized topology and weights of the network
+ */
+uint64_t computeNetworkHash(const ICNNNetwork & network) {
+    HashStreamBuf hashBuf;
+    std::ostream hashStream(&hashBuf);
+
+    // serializer fills layer params from the typed fields, so work on a copy sharing the weights
+    auto clonedNetwork = cloneNet(network);
+    details::NetworkSerializer::serialize(hashStream, hashStream, *clonedNetwork);
+    hashStream.flush();
+    return hashBuf.getHash();
+}
+
+/**
+ * @brief Network hash remembered for a network object. It stays valid while the network holds the same layers
+ * with the same weights blobs, weights changed in place are not tracked.
+ */
+struct NetworkHash {
+    std::vector<std::weak_ptr<CNNLayer>> layers;
+    std::vector<std::weak_ptr<Blob>> blobs;
+    uint64_t hash = 0;
+
+    NetworkHash() = default;
+
+    NetworkHash(const std::vector<CNNLayerPtr> & networkLayers, uint64_t hash) : hash(hash) {
+        for (auto && layer : networkLayers) {
+            layers.emplace_back(layer);
+            for (auto && blob : layer->blobs) {
+                blobs.emplace_back(blob.second);
+            }
+        }
+    }
+
+    bool isExpired() const {
+        return layers.empty() || layers.front().expired();
+    }
+
+    bool matches(const std::vector<CNNLayerPtr> & networkLayers) const {
+        if (networkLayers.size() != layers.size())
+            return false;
+        size_t blobIdx = 0;
+        for (size_t i = 0; i < networkLayers.size(); i++) {
+            if (layers[i].lock() != networkLayers[i])
+                return false;
+            for (auto && blob : networkLayers[i]->blobs) {
+                if (blobIdx >= blobs.size() || blobs[blobIdx++].lock() != blob.second)
+                    return false;
+            }
+        }
+        return blobIdx == blobs.size();
+    }
+};
+
+/**
+ * @brief Describes an extension by its version and the layer types it implements
+ */
+std::string getExtensionIdentity(const IExtensionPtr & extension) {
+    std::stringstream identity;
+    const Version * version = nullptr;
+    extension->GetVersion(version);
+    if (version != nullptr) {
+        identity << version->apiVersion.major << '.' << version->apiVersion.minor << ' '
+                 << (version->buildNumber ? version->buildNumber : "") << ' '
+                 << (version->description ? version->description : "");
+    }
+
+    char ** types = nullptr;
+    unsigned int size = 0;
+    ResponseDesc resp;
+    std::set<std::string> typesSet;
+    if (extension->getPrimitiveTypes(types, size, &resp) == OK) {
+        for (unsigned int i = 0; i < size; i++) {
+            typesSet.insert(types[i]);
+            delete[] types[i];
+        }
+        delete[] types;
+    }
+    for (auto && type : typesSet) {
+        identity << ' ' << type;
+    }
+    return identity.str();
+}
+
+/**
+ * @brief Computes a name of the compiled networks cache entry for the network loaded with the given parameters
+ */
+std::string computeCacheEntryName(uint64_t networkHash, const std::vector<CNNLayerPtr> & layers,
+                                  const ICNNNetwork & network, const std::string & deviceName,
+                                  const Version * version, const std::map<std::string, std::string> & config,
+                                  const std::vector<std::string> & extensions) {
+    HashStreamBuf hashBuf;
+    std::ostream hashStream(&hashBuf);
+
+    hashStream << networkHash << '\n';
+
+    // shapes are hashed on every call as the remembered network hash survives reshape of the same network
+    for (auto && layer : layers) {
+        for (auto && data : layer->outData) {
+            for (auto dim : data->getTensorDesc().getDims())
+                hashStream << dim << ' ';
+            hashStream << '\n';
+        }
+    }
+
+    InputsDataMap inputs;
+    network.getInputsInfo(inputs);
+    for (auto && input : inputs) {
+        hashStream << input.first << ' ' << input.second->getPrecision().name() << ' '
+                   << input.second->getTensorDesc().getLayout() << ' '
+                   << input.second->getPreProcess().getResizeAlgorithm() << ' '
+                   << input.second->getPreProcess().getColorFormat() << '\n';
+    }
+    OutputsDataMap outputs;
+    network.getOutputsInfo(outputs);
+    for (auto && output : outputs) {
+        hashStream << output.first << ' ' << output.second->getPrecision().name() << ' '
+                   << output.second->getTensorDesc().getLayout() << '\n';
+    }
+
+    hashStream << deviceName << '\n';
+    if (version != nullptr) {
+        hashStream << version->apiVersion.major << '.' << version->apiVersion.minor << ' '
+                   << (version->buildNumber ? version->buildNumber : "") << ' '
+                   << (version->description ? version->description : "") << '\n';
+    }
+    for (auto && item : config) {
+        hashStream << item.first << '=' << item.second << '\n';
+    }
+    for (auto && extension : extensions) {
+        hashStream << extension << '\n';
+    }
+    hashStream.flush();
+
+    std::stringstream name;
+    name << std::hex << std::setw(16) << std::setfill('0') << hashBuf.getHash() << ".blob";
+    return name.str();
+}
+
 }  // namespace
 
 DeviceIDParser::DeviceIDParser(const std::string & deviceNameWithID) {
@@ -114,6 +294,22 @@ class Core::Impl : public ICore {
     std::map<std::string, PluginDescriptor, details::CaselessLess<std::string> > pluginRegistry;
     IErrorListener * listener = nullptr;
 
+    struct CacheStatistics {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+    };
+    // cache directory per device, empty device name holds the value set for all devices
+    std::map<std::string, std::string, details::CaselessLess<std::string> > cacheDirs;
+    std::map<std::string, CacheStatistics, details::CaselessLess<std::string> > cacheStatistics;
+    // devices which failed to export a network, they are never cached again
+    std::set<std::string, details::CaselessLess<std::string> > notExportableDevices;
+    // identities of extensions added to each device, compiled networks depend on them
+    mutable std::map<std::string, std::vector<std::string>, details::CaselessLess<std::string> > extensionIdentities;
+    // hashes of already loaded network objects, so loading the same network again does not serialize it
+    std::map<const ICNNNetwork *, NetworkHash> networkHashes;
+    // guards the cache fields above, networks can be loaded from several threads
+    mutable std::mutex cacheMutex;
+
 public:
     /**
      * @brief Constructs Impl with HETERO plugin only
@@ -265,7 +461,9 @@ public:
                     cppPlugin.SetConfig(desc.defaultConfig);
 
                     for (auto && extensionLocation : desc.listOfExtentions) {
-                        cppPlugin.AddExtension(make_so_pointer<IExtension>(extensionLocation));
+                        IExtensionPtr extension = make_so_pointer<IExtension>(extensionLocation);
+                        cppPlugin.AddExtension(extension);
+                        AddExtensionIdentity(deviceName, extension);
                     }
 
                     if (listener)
@@ -351,6 +549,140 @@ public:
         }
     }
 
+    void SetCacheDir(const std::string & cacheDir, const std::string & deviceName) {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        if (deviceName.empty()) {
+            cacheDirs.clear();
+        }
+        cacheDirs[deviceName] = cacheDir;
+    }
+
+    std::string GetCacheDir(const std::string & deviceName) const {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        auto it = cacheDirs.find(deviceName);
+        if (it == cacheDirs.end())
+            it = cacheDirs.find(std::string());
+        return it == cacheDirs.end() ? std::string() : it->second;
+    }
+
+    CacheStatistics GetCacheStatistics(const std::string & deviceName) const {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        auto it = cacheStatistics.find(deviceName);
+        return it == cacheStatistics.end() ? CacheStatistics() : it->second;
+    }
+
+    bool IsExportable(const std::string & deviceName) const {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        return notExportableDevices.count(deviceName) == 0;
+    }
+
+    void AddExtensionIdentity(const std::string & deviceName, const IExtensionPtr & extension) const {
+        auto identity = getExtensionIdentity(extension);
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        extensionIdentities[deviceName].push_back(identity);
+    }
+
+    std::vector<std::string> GetExtensionIdentities(const std::string & deviceName) const {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        auto it = extensionIdentities.find(deviceName);
+        return it == extensionIdentities.end() ? std::vector<std::string>() : it->second;
+    }
+
+    /**
+     * @brief Returns the hash of the network topology and weights, serializes the network only
+     * if this network object was not hashed before or its layers were replaced since then
+     */
+    uint64_t GetNetworkHash(const ICNNNetwork & network, const std::vector<CNNLayerPtr> & layers) {
+        {
+            std::lock_guard<std::mutex> lock(cacheMutex);
+            auto it = networkHashes.find(&network);
+            if (it != networkHashes.end() && it->second.matches(layers))
+                return it->second.hash;
+        }
+
+        uint64_t hash = computeNetworkHash(network);
+
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        for (auto it = networkHashes.begin(); it != networkHashes.end();) {
+            it = it->second.isExpired() ? networkHashes.erase(it) : std::next(it);
+        }
+        networkHashes[&network] = NetworkHash(layers, hash);
+        return hash;
+    }
+
+    void UpdateCacheStatistics(const std::string & deviceName, bool hit) {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        auto & statistics = cacheStatistics[deviceName];
+        if (hit) {
+            statistics.hits++;
+        } else {
+            statistics.misses++;
+        }
+    }
+
+    /**
+     * @brief Loads network via compiled networks cache: imports it if the cache has an entry for the network,
+     * otherwise compiles it and exports to the cache
+     */
+    ExecutableNetwork LoadNetworkWithCache(CNNNetwork network, const std::string & deviceName,
+                                           const std::map<std::string, std::string> & config,
+                                           const std::string & cacheDir) {
+        InferencePlugin plugin = GetCPPPluginByName(deviceName);
+        if (!IsExportable(deviceName)) {
+            return plugin.LoadNetwork(network, config);
+        }
+
+        std::string entryPath;
+        try {
+            // compile config is a mix of the plugin defaults set via Core and the passed config
+            std::map<std::string, std::string> fullConfig;
+            auto it = pluginRegistry.find(deviceName);
+            if (it != pluginRegistry.end()) {
+                fullConfig = it->second.defaultConfig;
+            }
+            for (auto && item : config) {
+                fullConfig[item.first] = item.second;
+            }
+            auto layers = details::CNNNetSortTopologically(network);
+            entryPath = FileUtils::makePath(cacheDir,
+                computeCacheEntryName(GetNetworkHash(network, layers), layers, network, deviceName,
+                                      plugin.GetVersion(), fullConfig, GetExtensionIdentities(deviceName)));
+        } catch (const std::exception &) {
+            // network cannot be serialized (e.g. has layers not covered by IR writer), nothing to cache
+            return plugin.LoadNetwork(network, config);
+        }
+
+        if (FileUtils::fileExist(entryPath)) {
+            try {
+                auto exeNetwork = plugin.ImportNetwork(entryPath, config);
+                UpdateCacheStatistics(deviceName, true);
+                return exeNetwork;
+            } catch (const std::exception &) {
+                // stale or corrupted entry, recompile it
+                std::remove(entryPath.c_str());
+            }
+        }
+
+        UpdateCacheStatistics(deviceName, false);
+        auto exeNetwork = plugin.LoadNetwork(network, config);
+
+        // write into a temporary file first so other processes never see a partially written entry
+        std::string tmpPath = entryPath + ".tmp" +
+            std::to_string(std::chrono::steady_clock::now().time_since_epoch().count());
+        try {
+            exeNetwork.Export(tmpPath);
+            if (std::rename(tmpPath.c_str(), entryPath.c_str()) != 0)
+                std::remove(tmpPath.c_str());
+        } catch (const NotImplemented &) {
+            std::lock_guard<std::mutex> lock(cacheMutex);
+            notExportableDevices.insert(deviceName);
+        } catch (const std::exception &) {
+            // e.g. cache directory is not writable, the network is usable anyway
+            std::remove(tmpPath.c_str());
+        }
+        return exeNetwork;
+    }
+
     void SetErrorListener(IErrorListener * list) {
         listener = list;
 
@@ -423,6 +755,18 @@ ExecutableNetwork Core::LoadNetwork(CNNNetwork network, const std::string & devi
         }
     }
 
+    std::string cacheDir = _impl->GetCacheDir(deviceName_);
+    auto cacheDirIt = config_.find(KEY_CACHE_DIR);
+    if (cacheDirIt != config_.end()) {
+        cacheDir = cacheDirIt->second;
+        config_.erase(cacheDirIt);
+    }
+
+    // HETERO cannot be imported, so it is never cached
+    if (!cacheDir.empty() && deviceName_ != "HETERO") {
+        return _impl->LoadNetworkWithCache(network, deviceName_, config_, cacheDir);
+    }
+
     return _impl->GetCPPPluginByName(deviceName_).LoadNetwork(network, config_);
 }
 
@@ -435,6 +779,7 @@ void Core::AddExtension(IExtensionPtr extension, const std::string & deviceName_
     std::string deviceName = parser.getDeviceName();
 
     _impl->GetCPPPluginByName(deviceName).AddExtension(extension);
+    _impl->AddExtensionIdentity(deviceName, extension);
 }
 
 ExecutableNetwork Core::ImportNetwork(const std::string &modelFileName, const std::string & deviceName_,
@@ -480,7 +825,19 @@ QueryNetworkResult Core::QueryNetwork(const ICNNNetwork &network, const std::str
     return res;
 }
 
-void Core::SetConfig(const std::map<std::string, std::string> & config_, const std::string & deviceName_) {
+void Core::SetConfig(const std::map<std::string, std::string> & configWithCache, const std::string & deviceName_) {
+    auto config_ = configWithCache;
+    auto cacheDirIt = config_.find(KEY_CACHE_DIR);
+    if (cacheDirIt != config_.end()) {
+        if (deviceName_.find("HETERO") == 0) {
+            THROW_IE_EXCEPTION << "HETERO device does not support " << KEY_CACHE_DIR;
+        }
+        _impl->SetCacheDir(cacheDirIt->second, DeviceIDParser(deviceName_).getDeviceName());
+        config_.erase(cacheDirIt);
+        if (config_.empty())
+            return;
+    }
+
     // HETERO case
     {
         if (deviceName_.find("HETERO:") == 0) {
@@ -526,6 +883,10 @@ Parameter Core::GetConfig(const std::string & deviceName_, const std::string & n
     std::string deviceName = device.getDeviceName();
     std::string deviceID = device.getDeviceID();
 
+    if (name == KEY_CACHE_DIR) {
+        return _impl->GetCacheDir(deviceName);
+    }
+
     auto pluginAPIInterface = getInferencePluginAPIInterface(_impl->GetCPPPluginByName(deviceName));
 
     if (pluginAPIInterface == nullptr) {
@@ -555,6 +916,12 @@ Parameter Core::GetMetric(const std::string & deviceName_, const std::string & n
     std::string deviceName = device.getDeviceName();
     std::string deviceID = device.getDeviceID();
 
+    if (name == METRIC_KEY(CACHE_HITS)) {
+        return _impl->GetCacheStatistics(deviceName).hits;
+    } else if (name == METRIC_KEY(CACHE_MISSES)) {
+        return _impl->GetCacheStatistics(deviceName).misses;
+    }
+
     auto pluginAPIInterface = getInferencePluginAPIInterface(_impl->GetCPPPluginByName(deviceName));
 
     if (pluginAPIInterface == nullptr) {
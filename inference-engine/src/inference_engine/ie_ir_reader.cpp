@@ -90,6 +90,7 @@
 #include "cnn_network_impl.hpp"
 #include "description_buffer.hpp"
 #include "ie_ir_parser.hpp"
+#include "mmap_allocator.hpp"
 #include <file_utils.h>
 #include <ngraph.hpp>
 
@@ -120,17 +121,7 @@ std::shared_ptr<ngraph::Function> IRReader::read(const std::string& modelPath, c
 
     Blob::Ptr weights;
     if (!binPath.empty()) {
-        int64_t fileSize = FileUtils::fileSize(binPath);
-
-        if (fileSize < 0)
-            THROW_IE_EXCEPTION << "Filesize for: " << binPath << " - " << fileSize
-                << " < 0. Please, check weights file existence.";
-
-        size_t ulFileSize = static_cast<size_t>(fileSize);
-
-        weights = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {ulFileSize}, Layout::C));
-        weights->allocate();
-        FileUtils::readAllFile(binPath, weights->buffer(), ulFileSize);
+        weights = readFileToBlob(binPath);
     }
 
     return read(modelBuf.str(), weights);
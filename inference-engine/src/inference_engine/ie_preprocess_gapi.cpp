@@ -514,25 +514,22 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
 }
 }  // anonymous namespace
 
-PreprocEngine::PreprocEngine() : _lastComp(parallel_get_max_threads()) {}
+constexpr size_t PreprocEngine::maxCompiledCalls;
 
-PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) const {
+PreprocEngine::PreprocEngine() {}
+
+PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &lastCall, const CallDesc &newCallOrig) {
     // Given our knowledge about Fluid, full graph rebuild is required
     // if and only if:
-    // 0. This is the first call ever
     // 1. precision has changed (affects kernel versions)
     // 2. layout has changed (affects graph topology)
     // 3. algorithm has changed (affects kernel version)
     // 4. dimensions have changed from downscale to upscale or vice-versa if interpolation is AREA
     // 5. color format has changed (affects graph topology)
-    if (!_lastCall) {
-        return Update::REBUILD;
-    }
-
     BlobDesc last_in;
     BlobDesc last_out;
     ResizeAlgorithm last_algo = ResizeAlgorithm::NO_RESIZE;
-    std::tie(last_in, last_out, last_algo) = *_lastCall;
+    std::tie(last_in, last_out, last_algo) = lastCall;
 
     CallDesc newCall = newCallOrig;
     BlobDesc new_in;
@@ -587,6 +584,44 @@ PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) con
     return Update::NOTHING;
 }
 
+PreprocEngine::CompiledCall& PreprocEngine::getCompiledCall(const CallDesc &call,
+    const std::function<cv::GComputation()> &build, Update &update) {
+    auto found = std::find_if(_compiled.begin(), _compiled.end(),
+                              [&](const CompiledCall &c) { return c.call == call; });
+    if (found != _compiled.end()) {
+        _compiled.splice(_compiled.begin(), _compiled, found);
+        update = Update::NOTHING;
+        return _compiled.front();
+    }
+
+    // the graph of a call which differs only in the input sizes is compiled for this call as well
+    auto similar = std::find_if(_compiled.begin(), _compiled.end(),
+                                [&](const CompiledCall &c) { return needUpdate(c.call, call) == Update::RESHAPE; });
+    auto computation = [&]() {
+        return similar != _compiled.end() ? similar->computation : cv::util::make_optional(build());
+    };
+
+    if (_compiled.size() < maxCompiledCalls) {
+        CompiledCall compiled;
+        compiled.call = call;
+        compiled.computation = computation();
+        compiled.slices.resize(parallel_get_max_threads());
+        _compiled.push_front(std::move(compiled));
+        update = Update::REBUILD;
+        return _compiled.front();
+    }
+
+    // replace the least recently used graph, reshaping is cheaper than compiling when it is applicable
+    auto& lru = _compiled.back();
+    update = needUpdate(lru.call, call);
+    if (Update::REBUILD == update) {
+        lru.computation = computation();
+    }
+    lru.call = call;
+    _compiled.splice(_compiled.begin(), _compiled, std::prev(_compiled.end()));
+    return _compiled.front();
+}
+
 bool PreprocEngine::useGAPI() {
     static const bool NO_GAPI = [](const char *str) -> bool {
         std::string var(str ? str : "");
@@ -652,7 +687,7 @@ int PreprocEngine::getCorrectBatchSize(int batch, const Blob::Ptr& blob) {
     return batch;
 }
 
-void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
+void PreprocEngine::executeGraph(CompiledCall& compiledCall,
     const std::vector<std::vector<cv::gapi::own::Mat>>& batched_input_plane_mats,
     std::vector<std::vector<cv::gapi::own::Mat>>& batched_output_plane_mats, int batch_size, bool omp_serial,
     Update update) {
@@ -675,7 +710,7 @@ void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
     parallel_nt_static(thread_num, [&, this](int slice_n, const int total_slices) {
         IE_PROFILING_AUTO_SCOPE_TASK(_perf_exec_tile);
 
-        auto& compiled = _lastComp[slice_n];
+        auto& compiled = compiledCall.slices[slice_n];
         if (Update::REBUILD == update || Update::RESHAPE == update) {
             //  need to compile (or reshape) own object for a particular ROI
             IE_PROFILING_AUTO_SCOPE_TASK(_perf_graph_compiling);
@@ -706,11 +741,11 @@ void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
             auto roi = Rect{0, roi_y, output_plane_mats[0].cols, lines_per_thread};
             std::vector<Rect> rois(output_plane_mats.size(), roi);
 
-            // TODO: make a ROI a runtime argument to avoid
-            // recompilations
+            // the output ROIs depend only on the output size and the number of slices, so they stay
+            // the same while the compiled call is reused for other inputs of the same size
             auto args = cv::compile_args(gapi::preprocKernels(), cv::GFluidOutputRois{std::move(rois)});
             if (Update::REBUILD == update) {
-                auto& computation = lastComputation.value();
+                auto& computation = compiledCall.computation.value();
                 compiled = computation.compile(descr_of(input_plane_mats), std::move(args));
             } else {
                 IE_ASSERT(compiled);
@@ -772,31 +807,24 @@ bool PreprocEngine::preprocessBlob(const MemoryBlob::Ptr &inBlob, MemoryBlob::Pt
                                             out_desc_ie.getDims(),
                                             out_fmt },
                                   algorithm };
-    const Update update = needUpdate(thisCall);
-
-    Opt<cv::GComputation> _lastComputation;
-    if (Update::REBUILD == update || Update::RESHAPE == update) {
-        _lastCall = cv::util::make_optional(std::move(thisCall));
-
-        if (Update::REBUILD == update) {
-            //  rebuild the graph
-            IE_PROFILING_AUTO_SCOPE_TASK(_perf_graph_building);
-            _lastComputation = cv::util::make_optional(
-                buildGraph(in_desc,
-                           out_desc,
-                           in_layout,
-                           out_layout,
-                           algorithm,
-                           in_fmt,
-                           out_fmt,
-                           get_cv_depth(in_desc_ie)));
-        }
-    }
+    Update update = Update::NOTHING;
+    auto& compiledCall = getCompiledCall(thisCall, [&]() {
+        //  rebuild the graph
+        IE_PROFILING_AUTO_SCOPE_TASK(_perf_graph_building);
+        return buildGraph(in_desc,
+                          out_desc,
+                          in_layout,
+                          out_layout,
+                          algorithm,
+                          in_fmt,
+                          out_fmt,
+                          get_cv_depth(in_desc_ie));
+    }, update);
 
     auto batched_input_plane_mats  = bind_to_blob(inBlob, batch_size);
     auto batched_output_plane_mats = bind_to_blob(outBlob, batch_size);
 
-    executeGraph(_lastComputation, batched_input_plane_mats, batched_output_plane_mats, batch_size,
+    executeGraph(compiledCall, batched_input_plane_mats, batched_output_plane_mats, batch_size,
         omp_serial, update);
 
     return true;
@@ -851,30 +879,23 @@ bool PreprocEngine::preprocessBlob(const NV12Blob::Ptr &inBlob, MemoryBlob::Ptr
                                             out_desc_ie.getDims(),
                                             out_fmt },
                                   algorithm };
-    const Update update = needUpdate(thisCall);
-
-    Opt<cv::GComputation> _lastComputation;
-    if (Update::REBUILD == update || Update::RESHAPE == update) {
-        _lastCall = cv::util::make_optional(std::move(thisCall));
-
-        if (Update::REBUILD == update) {
-            //  rebuild the graph
-            IE_PROFILING_AUTO_SCOPE_TASK(_perf_graph_building);
-            // FIXME: what is a correct G::Desc to be passed?
-            auto nv12_desc = G::Desc{};
-            nv12_desc.d = in_desc_y.d;
-            nv12_desc.d.C = 2;
-            _lastComputation = cv::util::make_optional(
-                buildGraph(nv12_desc,
-                           out_desc,
-                           in_layout,
-                           out_layout,
-                           algorithm,
-                           in_fmt,
-                           out_fmt,
-                           CV_8U));
-        }
-    }
+    Update update = Update::NOTHING;
+    auto& compiledCall = getCompiledCall(thisCall, [&]() {
+        //  rebuild the graph
+        IE_PROFILING_AUTO_SCOPE_TASK(_perf_graph_building);
+        // FIXME: what is a correct G::Desc to be passed?
+        auto nv12_desc = G::Desc{};
+        nv12_desc.d = in_desc_y.d;
+        nv12_desc.d.C = 2;
+        return buildGraph(nv12_desc,
+                          out_desc,
+                          in_layout,
+                          out_layout,
+                          algorithm,
+                          in_fmt,
+                          out_fmt,
+                          CV_8U);
+    }, update);
 
     // convert Y and UV plane blobs to Mats _separately_
     auto batched_y_plane_mats = bind_to_blob(y_blob, batch_size);
@@ -891,7 +912,7 @@ bool PreprocEngine::preprocessBlob(const NV12Blob::Ptr &inBlob, MemoryBlob::Ptr
     // process output blob as usual
     auto batched_output_plane_mats = bind_to_blob(outBlob, batch_size);
 
-    executeGraph(_lastComputation, batched_input_plane_mats, batched_output_plane_mats, batch_size,
+    executeGraph(compiledCall, batched_input_plane_mats, batched_output_plane_mats, batch_size,
         omp_serial, update);
 
     return true;
@@ -8,6 +8,8 @@
 #include "ie_compound_blob.h"
 #include "ie_input_info.hpp"
 
+#include <functional>
+#include <list>
 #include <tuple>
 #include <vector>
 #include <opencv2/gapi/gcompiled.hpp>
@@ -25,8 +27,17 @@ class PreprocEngine {
     using CallDesc = std::tuple<BlobDesc, BlobDesc, ResizeAlgorithm>;
     template<typename T> using Opt = cv::util::optional<T>;
 
-    Opt<CallDesc> _lastCall;
-    std::vector<cv::GCompiled> _lastComp;
+    // The graph compiled for a call, one compiled object per slice of the output
+    struct CompiledCall {
+        CallDesc call;
+        Opt<cv::GComputation> computation;
+        std::vector<cv::GCompiled> slices;
+    };
+
+    // Most recently used first. The input sizes are a part of the call descriptor, so the calls alternating
+    // between several resolutions or ROI sizes run their own compiled graphs without recompiling them
+    std::list<CompiledCall> _compiled;
+    static constexpr size_t maxCompiledCalls = 4;
 
     ProfilingTask _perf_graph_building {"Preproc Graph Building"};
     ProfilingTask _perf_exec_tile  {"Preproc Calc Tile"};
@@ -34,9 +45,12 @@ class PreprocEngine {
     ProfilingTask _perf_graph_compiling {"Preproc Graph compiling"};
 
     enum class Update { REBUILD, RESHAPE, NOTHING };
-    Update needUpdate(const CallDesc &newCall) const;
+    static Update needUpdate(const CallDesc &lastCall, const CallDesc &newCall);
+
+    CompiledCall& getCompiledCall(const CallDesc &call, const std::function<cv::GComputation()> &build,
+                                  Update &update);
 
-    void executeGraph(Opt<cv::GComputation>& lastComputation,
+    void executeGraph(CompiledCall& compiledCall,
                       const std::vector<std::vector<cv::gapi::own::Mat>>& src,
                       std::vector<std::vector<cv::gapi::own::Mat>>& dst,
                       int batch_size,
@@ -10,6 +10,12 @@
 #if MANUAL_SIMD
   #include "cpu_detector.hpp"
   #include "ie_preprocess_gapi_kernels_sse42.hpp"
+  #ifdef HAVE_AVX2
+    #include "ie_preprocess_gapi_kernels_avx2.hpp"
+  #endif
+  #ifdef HAVE_AVX512
+    #include "ie_preprocess_gapi_kernels_avx512.hpp"
+  #endif
 #endif
 
 #include <opencv2/gapi/opencv_includes.hpp>
@@ -28,6 +34,77 @@ namespace kernels {
 
 template<typename T, int chs> static
 void mergeRow(const std::array<const uint8_t*, chs>& ins, uint8_t* out, int length) {
+#ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512f()) {
+        if (std::is_same<T, float>::value && chs == 2) {
+            avx512::mergeRow_32FC2(reinterpret_cast<const float*>(ins[0]),
+                                   reinterpret_cast<const float*>(ins[1]),
+                                   reinterpret_cast<float*>(out), length);
+            return;
+        }
+
+        if (std::is_same<T, float>::value && chs == 3) {
+            avx512::mergeRow_32FC3(reinterpret_cast<const float*>(ins[0]),
+                                   reinterpret_cast<const float*>(ins[1]),
+                                   reinterpret_cast<const float*>(ins[2]),
+                                   reinterpret_cast<float*>(out), length);
+            return;
+        }
+
+        if (std::is_same<T, float>::value && chs == 4) {
+            avx512::mergeRow_32FC4(reinterpret_cast<const float*>(ins[0]),
+                                   reinterpret_cast<const float*>(ins[1]),
+                                   reinterpret_cast<const float*>(ins[2]),
+                                   reinterpret_cast<const float*>(ins[3]),
+                                   reinterpret_cast<float*>(out), length);
+            return;
+        }
+    }
+#endif
+
+#ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        if (std::is_same<T, uint8_t>::value && chs == 2) {
+            avx::mergeRow_8UC2(ins[0], ins[1], out, length);
+            return;
+        }
+
+        if (std::is_same<T, uint8_t>::value && chs == 3) {
+            avx::mergeRow_8UC3(ins[0], ins[1], ins[2], out, length);
+            return;
+        }
+
+        if (std::is_same<T, uint8_t>::value && chs == 4) {
+            avx::mergeRow_8UC4(ins[0], ins[1], ins[2], ins[3], out, length);
+            return;
+        }
+
+        if (std::is_same<T, float>::value && chs == 2) {
+            avx::mergeRow_32FC2(reinterpret_cast<const float*>(ins[0]),
+                                reinterpret_cast<const float*>(ins[1]),
+                                reinterpret_cast<float*>(out), length);
+            return;
+        }
+
+        if (std::is_same<T, float>::value && chs == 3) {
+            avx::mergeRow_32FC3(reinterpret_cast<const float*>(ins[0]),
+                                reinterpret_cast<const float*>(ins[1]),
+                                reinterpret_cast<const float*>(ins[2]),
+                                reinterpret_cast<float*>(out), length);
+            return;
+        }
+
+        if (std::is_same<T, float>::value && chs == 4) {
+            avx::mergeRow_32FC4(reinterpret_cast<const float*>(ins[0]),
+                                reinterpret_cast<const float*>(ins[1]),
+                                reinterpret_cast<const float*>(ins[2]),
+                                reinterpret_cast<const float*>(ins[3]),
+                                reinterpret_cast<float*>(out), length);
+            return;
+        }
+    }
+#endif
+
 #if MANUAL_SIMD
     if (with_cpu_x86_sse42()) {
         if (std::is_same<T, uint8_t>::value && chs == 2) {
@@ -86,6 +163,83 @@ void mergeRow(const std::array<const uint8_t*, chs>& ins, uint8_t* out, int leng
 
 template<typename T, int chs> static
 void splitRow(const uint8_t* in, std::array<uint8_t*, chs>& outs, int length) {
+#ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512f()) {
+        if (std::is_same<T, float>::value && chs == 2) {
+            avx512::splitRow_32FC2(reinterpret_cast<const float*>(in),
+                                   reinterpret_cast<float*>(outs[0]),
+                                   reinterpret_cast<float*>(outs[1]),
+                                   length);
+            return;
+        }
+
+        if (std::is_same<T, float>::value && chs == 3) {
+            avx512::splitRow_32FC3(reinterpret_cast<const float*>(in),
+                                   reinterpret_cast<float*>(outs[0]),
+                                   reinterpret_cast<float*>(outs[1]),
+                                   reinterpret_cast<float*>(outs[2]),
+                                   length);
+            return;
+        }
+
+        if (std::is_same<T, float>::value && chs == 4) {
+            avx512::splitRow_32FC4(reinterpret_cast<const float*>(in),
+                                   reinterpret_cast<float*>(outs[0]),
+                                   reinterpret_cast<float*>(outs[1]),
+                                   reinterpret_cast<float*>(outs[2]),
+                                   reinterpret_cast<float*>(outs[3]),
+                                   length);
+            return;
+        }
+    }
+#endif
+
+#ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        if (std::is_same<T, uint8_t>::value && chs == 2) {
+            avx::splitRow_8UC2(in, outs[0], outs[1], length);
+            return;
+        }
+
+        if (std::is_same<T, uint8_t>::value && chs == 3) {
+            avx::splitRow_8UC3(in, outs[0], outs[1], outs[2], length);
+            return;
+        }
+
+        if (std::is_same<T, uint8_t>::value && chs == 4) {
+            avx::splitRow_8UC4(in, outs[0], outs[1], outs[2], outs[3], length);
+            return;
+        }
+
+        if (std::is_same<T, float>::value && chs == 2) {
+            avx::splitRow_32FC2(reinterpret_cast<const float*>(in),
+                                reinterpret_cast<float*>(outs[0]),
+                                reinterpret_cast<float*>(outs[1]),
+                                length);
+            return;
+        }
+
+        if (std::is_same<T, float>::value && chs == 3) {
+            avx::splitRow_32FC3(reinterpret_cast<const float*>(in),
+                                reinterpret_cast<float*>(outs[0]),
+                                reinterpret_cast<float*>(outs[1]),
+                                reinterpret_cast<float*>(outs[2]),
+                                length);
+            return;
+        }
+
+        if (std::is_same<T, float>::value && chs == 4) {
+            avx::splitRow_32FC4(reinterpret_cast<const float*>(in),
+                                reinterpret_cast<float*>(outs[0]),
+                                reinterpret_cast<float*>(outs[1]),
+                                reinterpret_cast<float*>(outs[2]),
+                                reinterpret_cast<float*>(outs[3]),
+                                length);
+            return;
+        }
+    }
+#endif
+
 #if MANUAL_SIMD
     if (with_cpu_x86_sse42()) {
         if (std::is_same<T, uint8_t>::value && chs == 2) {
@@ -269,6 +423,38 @@ GAPI_FLUID_KERNEL(FSplit4, Split4, false) {
 
 template<typename T>
 static void chanToPlaneRow(const uint8_t* in, int chan, int chs, uint8_t* out, int length) {
+#ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512f()) {
+        if (std::is_same<T, uint8_t>::value && chs == 1) {
+            avx512::copyRow_8U(in, out, length);
+            return;
+        }
+
+        if (std::is_same<T, float>::value && chs == 1) {
+            avx512::copyRow_32F(reinterpret_cast<const float*>(in),
+                                reinterpret_cast<float*>(out),
+                                length);
+            return;
+        }
+    }
+#endif
+
+#ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        if (std::is_same<T, uint8_t>::value && chs == 1) {
+            avx::copyRow_8U(in, out, length);
+            return;
+        }
+
+        if (std::is_same<T, float>::value && chs == 1) {
+            avx::copyRow_32F(reinterpret_cast<const float*>(in),
+                             reinterpret_cast<float*>(out),
+                             length);
+            return;
+        }
+    }
+#endif
+
 #if MANUAL_SIMD
     if (with_cpu_x86_sse42()) {
         if (std::is_same<T, uint8_t>::value && chs == 1) {
@@ -577,6 +763,66 @@ static void calcRowLinear(const cv::gapi::fluid::View  & in,
         dst[l] = out.OutLine<T>(l);
     }
 
+#ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512f()) {
+        if (std::is_same<T, uint8_t>::value) {
+            if (inSz.width >= 32 && outSz.width >= 32) {
+                avx512::calcRowLinear_8U(reinterpret_cast<uint8_t**>(dst),
+                                         reinterpret_cast<const uint8_t**>(src0),
+                                         reinterpret_cast<const uint8_t**>(src1),
+                                         reinterpret_cast<const short*>(alpha),
+                                         reinterpret_cast<const short*>(clone),
+                                         reinterpret_cast<const short*>(mapsx),
+                                         reinterpret_cast<const short*>(beta),
+                                         reinterpret_cast<uint8_t*>(tmp),
+                                         inSz, outSz, lpi);
+                return;
+            }
+        }
+
+        if (std::is_same<T, float>::value) {
+            avx512::calcRowLinear_32F(reinterpret_cast<float**>(dst),
+                                      reinterpret_cast<const float**>(src0),
+                                      reinterpret_cast<const float**>(src1),
+                                      reinterpret_cast<const float*>(alpha),
+                                      reinterpret_cast<const int*>(mapsx),
+                                      reinterpret_cast<const float*>(beta),
+                                      inSz, outSz, lpi);
+            return;
+        }
+    }
+#endif
+
+#ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        if (std::is_same<T, uint8_t>::value) {
+            if (inSz.width >= 16 && outSz.width >= 16) {
+                avx::calcRowLinear_8U(reinterpret_cast<uint8_t**>(dst),
+                                      reinterpret_cast<const uint8_t**>(src0),
+                                      reinterpret_cast<const uint8_t**>(src1),
+                                      reinterpret_cast<const short*>(alpha),
+                                      reinterpret_cast<const short*>(clone),
+                                      reinterpret_cast<const short*>(mapsx),
+                                      reinterpret_cast<const short*>(beta),
+                                      reinterpret_cast<uint8_t*>(tmp),
+                                      inSz, outSz, lpi);
+                return;
+            }
+        }
+
+        if (std::is_same<T, float>::value) {
+            avx::calcRowLinear_32F(reinterpret_cast<float**>(dst),
+                                   reinterpret_cast<const float**>(src0),
+                                   reinterpret_cast<const float**>(src1),
+                                   reinterpret_cast<const float*>(alpha),
+                                   reinterpret_cast<const int*>(mapsx),
+                                   reinterpret_cast<const float*>(beta),
+                                   inSz, outSz, lpi);
+            return;
+        }
+    }
+#endif
+
 #if MANUAL_SIMD
     if (with_cpu_x86_sse42()) {
         if (std::is_same<T, uint8_t>::value) {
@@ -667,6 +913,40 @@ static void calcRowLinearC3(const cv::gapi::fluid::View  & in,
         dst[2][l] = out2.OutLine<T>(l);
     }
 
+#ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512f()) {
+        if (inSz.width >= 32 && outSz.width >= 32) {
+            avx512::calcRowLinear_8UC3(dst,
+                                       reinterpret_cast<const uint8_t**>(src0),
+                                       reinterpret_cast<const uint8_t**>(src1),
+                                       reinterpret_cast<const short*>(alpha),
+                                       reinterpret_cast<const short*>(clone),
+                                       reinterpret_cast<const short*>(mapsx),
+                                       reinterpret_cast<const short*>(beta),
+                                       reinterpret_cast<uint8_t*>(tmp),
+                                       inSz, outSz, lpi);
+            return;
+        }
+    }
+#endif
+
+#ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        if (inSz.width >= 16 && outSz.width >= 16) {
+            avx::calcRowLinear_8UC3(dst,
+                                    reinterpret_cast<const uint8_t**>(src0),
+                                    reinterpret_cast<const uint8_t**>(src1),
+                                    reinterpret_cast<const short*>(alpha),
+                                    reinterpret_cast<const short*>(clone),
+                                    reinterpret_cast<const short*>(mapsx),
+                                    reinterpret_cast<const short*>(beta),
+                                    reinterpret_cast<uint8_t*>(tmp),
+                                    inSz, outSz, lpi);
+            return;
+        }
+    }
+#endif
+
 #if MANUAL_SIMD
     if (with_cpu_x86_sse42()) {
         if (inSz.width >= 16 && outSz.width >= 8) {
@@ -1015,6 +1295,36 @@ static void calcAreaRow(const cv::gapi::fluid::View& in, cv::gapi::fluid::Buffer
 
         auto dst = out.OutLine<T>(l);
 
+#ifdef HAVE_AVX2
+        if (with_cpu_x86_avx2()) {
+            if (std::is_same<T, uchar>::value) {
+                avx::calcRowArea_8U(reinterpret_cast<uchar*>(dst),
+                                    reinterpret_cast<const uchar**>(src),
+                                    inSz, outSz,
+                                    static_cast<Q0_16>(ymapper.alpha),
+                                    reinterpret_cast<const MapperUnit8U&>(ymap),
+                                    xmaxdf[0],
+                                    reinterpret_cast<const short*>(xindex),
+                                    reinterpret_cast<const Q0_16*>(xalpha),
+                                    reinterpret_cast<Q8_8*>(vbuf));
+                continue;  // next l = 0, ..., lpi-1
+            }
+
+            if (std::is_same<T, float>::value) {
+                avx::calcRowArea_32F(reinterpret_cast<float*>(dst),
+                                     reinterpret_cast<const float**>(src),
+                                     inSz, outSz,
+                                     static_cast<float>(ymapper.alpha),
+                                     reinterpret_cast<const MapperUnit32F&>(ymap),
+                                     xmaxdf[0],
+                                     reinterpret_cast<const int*>(xindex),
+                                     reinterpret_cast<const float*>(xalpha),
+                                     reinterpret_cast<float*>(vbuf));
+                continue;
+            }
+        }
+#endif
+
 #if MANUAL_SIMD
         if (with_cpu_x86_sse42()) {
             if (std::is_same<T, uchar>::value) {
@@ -1353,6 +1663,21 @@ static void calcAreaRow_CVKL_U8(const cv::gapi::fluid::View   & in,
 
         uint8_t *dst = out.OutLine<uint8_t>(l);
 
+    #ifdef HAVE_AVX512
+        if (with_cpu_x86_avx512f()) {
+            avx512::calcRowArea_CVKL_U8(src, dst, inSz, outSz, y + l, xsi, ysi,
+                          xalpha, yalpha, x_max_count, y_max_count, vert_sum);
+            continue;
+        }
+    #endif
+    #ifdef HAVE_AVX2
+        if (with_cpu_x86_avx2()) {
+            avx::calcRowArea_CVKL_U8(src, dst, inSz, outSz, y + l, xsi, ysi,
+                          xalpha, yalpha, x_max_count, y_max_count, vert_sum);
+            continue;
+        }
+    #endif
+
         calcRowArea_CVKL_U8_SSE42(src, dst, inSz, outSz, y + l, xsi, ysi,
                       xalpha, yalpha, x_max_count, y_max_count, vert_sum);
     }
@@ -1596,6 +1921,12 @@ GAPI_FLUID_KERNEL(FNV12toRGB, NV12toRGB, false) {
         int buf_width = out.length();
 
         #if MANUAL_SIMD
+          #ifdef HAVE_AVX2
+            if (with_cpu_x86_avx2()) {
+                avx::calculate_nv12_to_rgb(y_rows, uv_row, out_rows, buf_width);
+                return;
+            }
+          #endif
             calculate_nv12_to_rgb(y_rows, uv_row, out_rows, buf_width);
         #else
             calculate_nv12_to_rgb_fallback(y_rows, uv_row, out_rows, buf_width);
@@ -0,0 +1,134 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mmap_allocator.hpp"
+
+#include <memory>
+#include <string>
+
+#include <file_utils.h>
+#include "details/ie_exception.hpp"
+#include "details/ie_irelease.hpp"
+#include "details/os/os_filesystem.hpp"
+
+#ifdef _WIN32
+# ifndef NOMINMAX
+#  define NOMINMAX
+# endif
+# include <windows.h>
+#else
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+namespace InferenceEngine {
+namespace details {
+
+#ifdef _WIN32
+
+void * MmapAllocator::alloc(size_t size) noexcept {
+    if (size == 0 || _size != 0)
+        return nullptr;
+#if defined(ENABLE_UNICODE_PATH_SUPPORT)
+    std::wstring fileName = multiByteCharToWString(_filePath.c_str());
+    HANDLE file = CreateFileW(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+#else
+    HANDLE file = CreateFileA(_filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+#endif
+    if (file == INVALID_HANDLE_VALUE)
+        return nullptr;
+
+    LARGE_INTEGER fileSize;
+    void * ptr = nullptr;
+    if (GetFileSizeEx(file, &fileSize) && static_cast<unsigned long long>(fileSize.QuadPart) >= size) {
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        if (mapping != nullptr) {
+            ptr = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, size);
+            if (ptr == nullptr) {
+                CloseHandle(mapping);
+            } else {
+                _mapping = mapping;
+                _size = size;
+            }
+        }
+    }
+    // the view keeps the file open on its own
+    CloseHandle(file);
+    return ptr;
+}
+
+bool MmapAllocator::free(void* handle) noexcept {
+    if (handle == nullptr || _size == 0)
+        return false;
+    UnmapViewOfFile(handle);
+    CloseHandle(_mapping);
+    _mapping = nullptr;
+    _size = 0;
+    return true;
+}
+
+#else
+
+void * MmapAllocator::alloc(size_t size) noexcept {
+    if (size == 0 || _size != 0)
+        return nullptr;
+    int fd = open(_filePath.c_str(), O_RDONLY);
+    if (fd < 0)
+        return nullptr;
+
+    struct stat st;
+    void * ptr = nullptr;
+    if (fstat(fd, &st) == 0 && static_cast<size_t>(st.st_size) >= size) {
+        // private writable mapping: consumers may patch weights in place without touching the file
+        ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        if (ptr == MAP_FAILED) {
+            ptr = nullptr;
+        } else {
+            _size = size;
+        }
+    }
+    // the mapping keeps the file referenced on its own
+    close(fd);
+    return ptr;
+}
+
+bool MmapAllocator::free(void* handle) noexcept {
+    if (handle == nullptr || _size == 0)
+        return false;
+    munmap(handle, _size);
+    _size = 0;
+    return true;
+}
+
+#endif
+
+TBlob<uint8_t>::Ptr readFileToBlob(const std::string& filePath) {
+    int64_t fileSize = FileUtils::fileSize(filePath);
+    if (fileSize < 0)
+        THROW_IE_EXCEPTION << "Filesize for: " << filePath << " - " << fileSize
+            << " < 0. Please, check weights file existence.";
+
+    auto ulFileSize = static_cast<size_t>(fileSize);
+    TensorDesc desc(Precision::U8, {ulFileSize}, Layout::C);
+
+    if (ulFileSize != 0) {
+        auto allocator = shared_from_irelease(static_cast<IAllocator*>(new MmapAllocator(filePath)));
+        TBlob<uint8_t>::Ptr mapped(new TBlob<uint8_t>(desc, allocator));
+        mapped->allocate();
+        if (mapped->buffer().as<uint8_t*>() != nullptr)
+            return mapped;
+    }
+
+    TBlob<uint8_t>::Ptr blob(new TBlob<uint8_t>(desc));
+    blob->allocate();
+    FileUtils::readAllFile(filePath, blob->buffer(), ulFileSize);
+    return blob;
+}
+
+}  // namespace details
+}  // namespace InferenceEngine
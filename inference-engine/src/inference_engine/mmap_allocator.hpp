@@ -0,0 +1,58 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+
+#include "ie_allocator.hpp"
+#include "ie_blob.h"
+
+namespace InferenceEngine {
+namespace details {
+
+/**
+ * @brief Allocator which backs a blob by a private mapping of a file instead of heap memory.
+ * Pages are loaded on first access only; writes are copy-on-write and never reach the file.
+ */
+class MmapAllocator : public IAllocator {
+public:
+    explicit MmapAllocator(const std::string& filePath) : _filePath(filePath) {}
+
+    void Release() noexcept override {
+        delete this;
+    }
+
+    void * lock(void * handle, LockOp = LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+
+    void unlock(void * a) noexcept override {}
+
+    /**
+     * @brief Maps the first size bytes of the file
+     * @return nullptr if the file cannot be mapped or is shorter than size
+     */
+    void * alloc(size_t size) noexcept override;
+
+    bool free(void* handle) noexcept override;
+
+private:
+    std::string _filePath;
+    size_t _size = 0;
+#ifdef _WIN32
+    void * _mapping = nullptr;
+#endif
+};
+
+/**
+ * @brief Creates a U8 blob holding the whole content of the file.
+ * The blob is backed by a file mapping when the platform allows it, otherwise the file is read into memory.
+ * @param filePath - path to the file
+ * @return blob with the file content
+ */
+INFERENCE_ENGINE_API_CPP(TBlob<uint8_t>::Ptr) readFileToBlob(const std::string& filePath);
+
+}  // namespace details
+}  // namespace InferenceEngine
@@ -35,18 +35,61 @@ template<typename T> std::string arrayRevertToIRProperty(const T& property) {
 }
 
 
+static bool isExecGraphInfo(const std::vector<CNNLayerPtr> &ordered) {
+    // If first layer has perfCounter parameter set then it's executable graph info serialization.
+    return !ordered.empty() &&
+        ordered[0]->params.find(ExecGraphInfoSerialization::PERF_COUNTER) != ordered[0]->params.end();
+}
+
 void NetworkSerializer::serialize(
     const std::string &xmlPath,
     const std::string &binPath,
     const InferenceEngine::ICNNNetwork& network) {
+    std::ofstream ofsBin;
+    if (!binPath.empty() && !isExecGraphInfo(CNNNetSortTopologically(network))) {
+        ofsBin.open(binPath, std::ofstream::out | std::ofstream::binary);
+        if (!ofsBin) {
+            THROW_IE_EXCEPTION << "File '" << binPath << "' is not opened as out file stream";
+        }
+    }
+
+    pugi::xml_document doc;
+    fillXmlDoc(doc, ofsBin.is_open() ? &ofsBin : nullptr, network);
+
+    if (ofsBin.is_open()) {
+        ofsBin.close();
+        if (!ofsBin.good()) {
+            THROW_IE_EXCEPTION << "Error during '" << binPath << "' closing";
+        }
+    }
+
+    if (!doc.save_file(xmlPath.c_str())) {
+        THROW_IE_EXCEPTION << "file '" << xmlPath << "' was not serialized";
+    }
+}
+
+void NetworkSerializer::serialize(
+    std::ostream &xmlStream,
+    std::ostream &binStream,
+    const InferenceEngine::ICNNNetwork& network) {
+    pugi::xml_document doc;
+    fillXmlDoc(doc, &binStream, network);
+    doc.save(xmlStream);
+    if (!xmlStream.good()) {
+        THROW_IE_EXCEPTION << "Error during IR writing";
+    }
+}
+
+void NetworkSerializer::fillXmlDoc(
+    pugi::xml_document &doc,
+    std::ostream *binStream,
+    const InferenceEngine::ICNNNetwork& network) {
     const std::vector<CNNLayerPtr> ordered = CNNNetSortTopologically(network);
 
     // A flag for serializing executable graph information (not complete IR)
-    bool execGraphInfoSerialization = false;
-    // If first layer has perfCounter parameter set then it's executable graph info serialization.
-    // All other layers must also have this parameter set.
-    if (ordered[0]->params.find(ExecGraphInfoSerialization::PERF_COUNTER) != ordered[0]->params.end()) {
-        execGraphInfoSerialization = true;
+    bool execGraphInfoSerialization = isExecGraphInfo(ordered);
+    // All layers must have perfCounter parameter set in case of executable graph info serialization.
+    if (execGraphInfoSerialization) {
         for (const auto &layer : ordered) {
             if (layer->params.find(ExecGraphInfoSerialization::PERF_COUNTER) == layer->params.end()) {
                 THROW_IE_EXCEPTION << "Each node must have " << ExecGraphInfoSerialization::PERF_COUNTER
@@ -55,16 +98,8 @@ void NetworkSerializer::serialize(
         }
     }
 
-    bool dumpWeights = !execGraphInfoSerialization & !binPath.empty();
-    std::ofstream ofsBin;
-    if (dumpWeights) {
-        ofsBin.open(binPath, std::ofstream::out | std::ofstream::binary);
-        if (!ofsBin) {
-            THROW_IE_EXCEPTION << "File '" << binPath << "' is not opened as out file stream";
-        }
-    }
+    bool dumpWeights = !execGraphInfoSerialization && binStream != nullptr;
 
-    pugi::xml_document doc;
     pugi::xml_node netXml = doc.append_child("net");
     netXml.append_attribute("name").set_value(network.getName().c_str());
 
@@ -114,6 +149,9 @@ void NetworkSerializer::serialize(
                 pugi::xml_node port = input.append_child("port");
 
                 port.append_attribute("id").set_value(iport);
+                if (d->getPrecision() != precision) {
+                    port.append_attribute("precision").set_value(d->getPrecision().name());
+                }
 
                 for (auto dim : d->getDims()) {
                     port.append_child("dim").text().set(dim);
@@ -126,6 +164,9 @@ void NetworkSerializer::serialize(
                 pugi::xml_node port = input.append_child("port");
 
                 port.append_attribute("id").set_value(node->insData.size() + oport);
+                if (node->outData[oport]->getPrecision() != precision) {
+                    port.append_attribute("precision").set_value(node->outData[oport]->getPrecision().name());
+                }
 
                 for (const auto dim : node->outData[oport]->getDims()) {
                     port.append_child("dim").text().set(dim);
@@ -141,23 +182,19 @@ void NetworkSerializer::serialize(
                 pugi::xml_node data = blobsNode.append_child(dataIt.first.c_str());
                 data.append_attribute("offset").set_value(dataOffset);
                 data.append_attribute("size").set_value(dataSize);
+                if (dataIt.second->getTensorDesc().getPrecision() != precision) {
+                    data.append_attribute("precision").set_value(dataIt.second->getTensorDesc().getPrecision().name());
+                }
 
                 dataOffset += dataSize;
-                ofsBin.write(dataPtr, dataSize);
-                if (!ofsBin.good()) {
-                    THROW_IE_EXCEPTION << "Error during '" << binPath << "' writing";
+                binStream->write(dataPtr, dataSize);
+                if (!binStream->good()) {
+                    THROW_IE_EXCEPTION << "Error during weights writing";
                 }
             }
         }
     }
 
-    if (dumpWeights) {
-        ofsBin.close();
-        if (!ofsBin.good()) {
-            THROW_IE_EXCEPTION << "Error during '" << binPath << "' closing";
-        }
-    }
-
     pugi::xml_node edges = netXml.append_child("edges");
 
     for (const auto &ord : ordered) {
@@ -204,10 +241,6 @@ void NetworkSerializer::serialize(
         updatePreProcInfo(network, netXml);
         updateStatisticsInfo(network, netXml);
     }
-
-    if (!doc.save_file(xmlPath.c_str())) {
-        THROW_IE_EXCEPTION << "file '" << xmlPath << "' was not serialized";
-    }
 }
 
 void NetworkSerializer::updateStdLayerParams(const CNNLayer::Ptr &layer) {
@@ -4,9 +4,16 @@
 
 #pragma once
 
+#include <ostream>
 #include <string>
 
-#include "xml_parse_utils.h"
+#include "ie_icnn_network.hpp"
+#include "ie_layers.h"
+
+namespace pugi {
+class xml_document;
+class xml_node;
+}  // namespace pugi
 
 namespace InferenceEngine {
 namespace details {
@@ -14,11 +21,17 @@ namespace details {
 /**
 * Class for serialization of model been presented as ICNNNetwork to the disk
 */
-class NetworkSerializer {
+class INFERENCE_ENGINE_API_CLASS(NetworkSerializer) {
 public:
     static void serialize(const std::string &xmlPath, const std::string &binPath, const InferenceEngine::ICNNNetwork& network);
 
+    /**
+     * Writes IR of the network into the given streams. Weights are always dumped into binStream.
+     */
+    static void serialize(std::ostream &xmlStream, std::ostream &binStream, const InferenceEngine::ICNNNetwork& network);
+
 private:
+    static void fillXmlDoc(pugi::xml_document &doc, std::ostream *binStream, const InferenceEngine::ICNNNetwork& network);
     static void updateStdLayerParams(const InferenceEngine::CNNLayer::Ptr &layer);
     static void updatePreProcInfo(const InferenceEngine::ICNNNetwork& network, pugi::xml_node &netXml);
     static void updateStatisticsInfo(const InferenceEngine::ICNNNetwork& network, pugi::xml_node &netXml);
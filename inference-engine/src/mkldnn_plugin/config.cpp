@@ -16,6 +16,7 @@
 #include <stdexcept>
 
 #include <cpp_interfaces/exception2status.hpp>
+#include <cpu_detector.hpp>
 #include <thread>
 #include <ie_parallel.hpp>
 #include "mkldnn/omp_manager.h"
@@ -91,6 +92,54 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_THREADS_NUM
                                    << ". Expected only positive numbers (#threads)";
             threadsNum = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_BATCHING_MAX_BATCH) {
+            int val_i;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_BATCHING_MAX_BATCH
+                                   << ". Expected only positive numbers (max batch)";
+            }
+            if (val_i < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_BATCHING_MAX_BATCH
+                                   << ". Expected only positive numbers (max batch)";
+            batchingMaxBatch = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_BATCHING_TIMEOUT) {
+            int val_i;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_BATCHING_TIMEOUT
+                                   << ". Expected only positive numbers (microseconds)";
+            }
+            if (val_i < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_BATCHING_TIMEOUT
+                                   << ". Expected only positive numbers (microseconds)";
+            batchingTimeout = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_PARALLEL_BRANCHES) {
+            if (val == PluginConfigParams::YES) parallelBranches = true;
+            else if (val == PluginConfigParams::NO) parallelBranches = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_PARALLEL_BRANCHES
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_ENFORCE_BF16) {
+            if (val == PluginConfigParams::YES) {
+                if (!with_cpu_x86_avx512_core())
+                    THROW_IE_EXCEPTION << "Platform doesn't support BF16 format, " << PluginConfigParams::KEY_ENFORCE_BF16
+                                       << " requires a CPU with AVX-512";
+                enforceBF16 = true;
+            } else if (val == PluginConfigParams::NO) {
+                enforceBF16 = false;
+            } else {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_ENFORCE_BF16
+                                   << ". Expected only YES/NO";
+            }
+        } else if (key == PluginConfigParams::KEY_CPU_PERF_TRACE) {
+            if (val == PluginConfigParams::YES) perfTrace = true;
+            else if (val == PluginConfigParams::NO) perfTrace = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_PERF_TRACE
+                                   << ". Expected only YES/NO";
         } else if (key.compare(PluginConfigParams::KEY_DYN_BATCH_ENABLED) == 0) {
             if (val.compare(PluginConfigParams::YES) == 0)
                 enableDynamicBatch = true;
@@ -135,6 +184,20 @@ void Config::updateProperties() {
         _config.insert({ PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, std::to_string(throughputStreams) });
         _config.insert({ PluginConfigParams::KEY_CPU_THREADS_NUM, std::to_string(threadsNum) });
         _config.insert({ PluginConfigParams::KEY_DUMP_EXEC_GRAPH_AS_DOT, dumpToDot });
+        _config.insert({ PluginConfigParams::KEY_CPU_BATCHING_MAX_BATCH, std::to_string(batchingMaxBatch) });
+        _config.insert({ PluginConfigParams::KEY_CPU_BATCHING_TIMEOUT, std::to_string(batchingTimeout) });
+        if (parallelBranches == true)
+            _config.insert({ PluginConfigParams::KEY_CPU_PARALLEL_BRANCHES, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_PARALLEL_BRANCHES, PluginConfigParams::NO });
+        if (enforceBF16 == true)
+            _config.insert({ PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::NO });
+        if (perfTrace == true)
+            _config.insert({ PluginConfigParams::KEY_CPU_PERF_TRACE, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_PERF_TRACE, PluginConfigParams::NO });
     }
 }
 
@@ -22,6 +22,11 @@ struct Config {
     int batchLimit = 0;
     int throughputStreams = 1;
     int threadsNum = 0;
+    int batchingMaxBatch = 0;
+    int batchingTimeout = 1000;
+    bool parallelBranches = false;
+    bool enforceBF16 = false;
+    bool perfTrace = false;
 
     void readProperties(const std::map<std::string, std::string> &config);
     void updateProperties();
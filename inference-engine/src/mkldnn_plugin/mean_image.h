@@ -7,6 +7,7 @@
 #include "inference_engine.hpp"
 #include "mkldnn_dims.h"
 #include "ie_parallel.hpp"
+#include <algorithm>
 #include <vector>
 #include <limits>
 
@@ -71,6 +72,72 @@ public:
         }
     }
 
+    /**
+     * Converts an integral input to FP32 and subtracts the mean in one pass over the data,
+     * plain conversion is done if there is no mean to subtract
+     */
+    template<typename T, typename std::enable_if<std::is_integral<T>::value>::type* = nullptr>
+    void ConvertAndSubtract(const MKLDNNDims &inputDims, const T *input, float *output, InferenceEngine::Layout layout) const {
+        IE_ASSERT(input != nullptr && output != nullptr);
+
+        // plain conversion doesn't depend on the layout, so blobs of any rank are taken
+        if (!(meanBuffer && meanBuffer->size()) && meanValues.empty()) {
+            const size_t size = inputDims.size();
+            const size_t blockSize = 4096;
+            InferenceEngine::parallel_for((size + blockSize - 1) / blockSize, [&](size_t b) {
+                const size_t end = std::min(size, (b + 1) * blockSize);
+                for (size_t i = b * blockSize; i < end; i++)
+                    output[i] = static_cast<float>(input[i]);
+            });
+            return;
+        }
+
+        if (inputDims.ndims() != 4) {
+            THROW_IE_EXCEPTION << "Expecting input as 4 dimension blob with format NxCxHxW.";
+        }
+
+        if (layout != InferenceEngine::NCHW && layout != InferenceEngine::NHWC) {
+            THROW_IE_EXCEPTION << "Expecting input layout NCHW or NHWC.";
+        }
+
+        int MB = inputDims[0];
+        int C = inputDims[1];
+        int H = inputDims[2];
+        int W = inputDims[3];
+        int srcSize = inputDims.size() / MB;
+        int rowSize = layout == InferenceEngine::NHWC ? W * C : W;
+        int rows = srcSize / rowSize;
+
+        // rows are independent and contiguous, so inner loops are vectorized by the compiler
+        if (meanBuffer && meanBuffer->size()) {
+            const float * meanBufferValues = meanBuffer->readOnly();
+
+            InferenceEngine::parallel_for2d(MB, rows, [&](int mb, int r) {
+                const T *src = input + srcSize * mb + rowSize * r;
+                float *dst = output + srcSize * mb + rowSize * r;
+                const float *mean = meanBufferValues + rowSize * r;
+                for (int i = 0; i < rowSize; i++)
+                    dst[i] = static_cast<float>(src[i]) - mean[i];
+            });
+        } else if (!meanValues.empty() && layout == InferenceEngine::NCHW) {
+            InferenceEngine::parallel_for3d(MB, C, H, [&](int mb, int c, int h) {
+                const T *src = input + srcSize * mb + rowSize * (c * H + h);
+                float *dst = output + srcSize * mb + rowSize * (c * H + h);
+                const float mean = meanValues[c];
+                for (int i = 0; i < rowSize; i++)
+                    dst[i] = static_cast<float>(src[i]) - mean;
+            });
+        } else {
+            InferenceEngine::parallel_for2d(MB, H, [&](int mb, int h) {
+                const T *src = input + srcSize * mb + rowSize * h;
+                float *dst = output + srcSize * mb + rowSize * h;
+                for (int i = 0; i < rowSize; i += C)
+                    for (int c = 0; c < C; c++)
+                        dst[i + c] = static_cast<float>(src[i + c]) - meanValues[c];
+            });
+        }
+    }
+
 private:
     std::vector<float> meanValues;
 
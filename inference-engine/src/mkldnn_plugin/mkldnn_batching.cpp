@@ -0,0 +1,176 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_batching.h"
+#include "mkldnn_streams.h"
+#include <blob_factory.hpp>
+#include <ie_memcpy.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+static const size_t waitHistogramSize = 32;
+
+// samples are packed one after another, so the batch must be the outermost dimension of a dense blob
+static bool isBatchOuter(const TensorDesc &desc) {
+    switch (desc.getLayout()) {
+        case NC:
+        case NCHW:
+        case NHWC:
+        case NCDHW:
+        case NDHWC:
+            return desc.getBlockingDesc() == BlockingDesc(desc.getDims(), desc.getLayout());
+        default:
+            return false;
+    }
+}
+
+static TensorDesc withBatch(const TensorDesc &desc, size_t batch) {
+    SizeVector dims = desc.getDims();
+    dims[0] = batch;
+    return TensorDesc(desc.getPrecision(), dims, desc.getLayout());
+}
+
+MKLDNNRequestsBatcher::MKLDNNRequestsBatcher(const MKLDNNGraph::Ptr &graph, int maxBatch, int timeoutUs)
+        : graph(graph), maxBatch(maxBatch), timeout(timeoutUs),
+          waitHistogram(waitHistogramSize, 0), batchHistogram(maxBatch + 1, 0) {
+    BlobMap outputs;
+    graph->getOutputBlobs(outputs);
+    for (auto &output : outputs) {
+        // output memory is copied as is, the same as PullOutputData does
+        const SizeVector &dims = output.second->getTensorDesc().getDims();
+        const TensorDesc desc(output.second->getTensorDesc().getPrecision(), dims, TensorDesc::getLayoutByDims(dims));
+        if (!isBatchOuter(desc) || dims[0] != this->maxBatch)
+            THROW_IE_EXCEPTION << "Output " << output.first << " doesn't allow CPU batching";
+        batchedOutputs[output.first] = make_blob_with_precision(desc);
+        batchedOutputs[output.first]->allocate();
+    }
+}
+
+void MKLDNNRequestsBatcher::Infer(const BlobMap &inputs, BlobMap &outputs) {
+    Request request = {&inputs, &outputs, clock::now(), false, nullptr};
+
+    std::unique_lock<std::mutex> lock(queueMutex);
+    queue.push_back(&request);
+    if (queue.size() >= maxBatch)
+        queueCondVar.notify_all();
+
+    while (!request.done) {
+        if (hasLeader) {
+            queueCondVar.wait(lock);
+            continue;
+        }
+
+        // become the leader: collect the batch and execute it, possibly without own request
+        // if older requests fill the batch, then the loop continues with the next batch
+        hasLeader = true;
+        auto deadline = queue.front()->arrival + timeout;
+        queueCondVar.wait_until(lock, deadline, [&] { return queue.size() >= maxBatch; });
+
+        size_t batchSize = std::min(queue.size(), maxBatch);
+        std::vector<Request *> batch(queue.begin(), queue.begin() + batchSize);
+        queue.erase(queue.begin(), queue.begin() + batchSize);
+        lock.unlock();
+
+        try {
+            ExecuteInArena(batch);
+        } catch (...) {
+            for (auto r : batch)
+                r->exception = std::current_exception();
+        }
+
+        lock.lock();
+        for (auto r : batch)
+            r->done = true;
+        hasLeader = false;
+        queueCondVar.notify_all();
+    }
+    lock.unlock();
+
+    if (request.exception)
+        std::rethrow_exception(request.exception);
+}
+
+void MKLDNNRequestsBatcher::ExecuteInArena(const std::vector<Request *> &batch) {
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    auto_scope_observing observer(graph->ptrObserver);
+    // a TBB arena is made "this" for Infer call via executing lambda for the arena
+    graph->ptrArena->execute([&] { Execute(batch); });
+#else
+    Execute(batch);
+#endif
+}
+
+void MKLDNNRequestsBatcher::Execute(const std::vector<Request *> &batch) {
+    const auto start = clock::now();
+    const size_t batchSize = batch.size();
+
+    for (auto &input : *batch[0]->inputs) {
+        const std::string &name = input.first;
+        const TensorDesc &desc = input.second->getTensorDesc();
+        if (!isBatchOuter(desc) || desc.getDims()[0] != 1)
+            THROW_IE_EXCEPTION << "Input " << name << " of layout " << desc.getLayout() << " can't be batched";
+
+        const TensorDesc batchedDesc = withBatch(desc, maxBatch);
+        Blob::Ptr &batched = batchedInputs[name];
+        if (!batched || !(batched->getTensorDesc() == batchedDesc)) {
+            batched = make_blob_with_precision(batchedDesc);
+            batched->allocate();
+        }
+
+        const size_t sampleSize = input.second->byteSize();
+        uint8_t *dst = batched->buffer().as<uint8_t *>();
+        for (size_t i = 0; i < batchSize; i++) {
+            auto sample = batch[i]->inputs->find(name);
+            if (sample == batch[i]->inputs->end() || !(sample->second->getTensorDesc() == desc))
+                THROW_IE_EXCEPTION << "Input " << name << " differs between batched requests";
+            ie_memcpy(dst + i * sampleSize, batched->byteSize() - i * sampleSize,
+                      sample->second->cbuffer().as<const uint8_t *>(), sampleSize);
+        }
+        graph->PushInputData(name, batched);
+    }
+
+    graph->Infer(static_cast<int>(batchSize));
+    graph->PullOutputData(batchedOutputs);
+
+    for (auto &output : batchedOutputs) {
+        const TensorDesc sampleDesc = withBatch(output.second->getTensorDesc(), 1);
+        const size_t sampleSize = output.second->byteSize() / maxBatch;
+        const uint8_t *src = output.second->cbuffer().as<const uint8_t *>();
+        for (size_t i = 0; i < batchSize; i++) {
+            Blob::Ptr &sample = (*batch[i]->outputs)[output.first];
+            if (!sample) {
+                sample = make_blob_with_precision(sampleDesc);
+                sample->allocate();
+            }
+            if (sample->byteSize() != sampleSize)
+                THROW_IE_EXCEPTION << "Output blob size is not equal network output size ("
+                                   << sample->byteSize() << "!=" << sampleSize << ").";
+            ie_memcpy(sample->buffer().as<uint8_t *>(), sample->byteSize(), src + i * sampleSize, sampleSize);
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(statsMutex);
+    batchHistogram[batchSize]++;
+    for (auto r : batch) {
+        auto wait = std::chrono::duration_cast<std::chrono::microseconds>(start - r->arrival).count();
+        size_t bucket = 0;
+        while (bucket < waitHistogramSize - 1 && (1ll << bucket) <= wait)
+            bucket++;
+        waitHistogram[bucket]++;
+    }
+}
+
+std::vector<uint64_t> MKLDNNRequestsBatcher::GetWaitHistogram() const {
+    std::lock_guard<std::mutex> lock(statsMutex);
+    return waitHistogram;
+}
+
+std::vector<uint64_t> MKLDNNRequestsBatcher::GetBatchHistogram() const {
+    std::lock_guard<std::mutex> lock(statsMutex);
+    return batchHistogram;
+}
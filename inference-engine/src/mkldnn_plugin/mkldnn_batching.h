@@ -0,0 +1,74 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <ie_blob.h>
+#include "mkldnn_graph.h"
+
+namespace MKLDNNPlugin {
+
+/* Coalesces concurrent batch-1 Infer Requests into a single dynamic-batch execution of the graph.
+ * The graph is compiled for the max batch. The first request of a batch (the leader) waits for others
+ * until the batch is full or the timeout since its arrival expires, then packs inputs of all collected
+ * requests into the batched input memory, runs the graph with the dynamic batch limit and scatters outputs
+ * back. The rest of requests are blocked until their batch is done. */
+class MKLDNNRequestsBatcher {
+public:
+    typedef std::shared_ptr<MKLDNNRequestsBatcher> Ptr;
+
+    MKLDNNRequestsBatcher(const MKLDNNGraph::Ptr &graph, int maxBatch, int timeoutUs);
+
+    /**
+     * @brief Executes a request as a part of some batch, blocks until the batch is executed
+     * @param inputs - batch-1 inputs of the request (after pre-processing)
+     * @param outputs - batch-1 outputs of the request, missed blobs are allocated
+     */
+    void Infer(const InferenceEngine::BlobMap &inputs, InferenceEngine::BlobMap &outputs);
+
+    // element i counts requests waited for the batch start less than 2^i us, the last one counts the rest
+    std::vector<uint64_t> GetWaitHistogram() const;
+    // element i counts executions of i requests
+    std::vector<uint64_t> GetBatchHistogram() const;
+
+private:
+    typedef std::chrono::steady_clock clock;
+
+    struct Request {
+        const InferenceEngine::BlobMap *inputs;
+        InferenceEngine::BlobMap *outputs;
+        clock::time_point arrival;
+        bool done;
+        std::exception_ptr exception;
+    };
+
+    void Execute(const std::vector<Request *> &batch);
+    void ExecuteInArena(const std::vector<Request *> &batch);
+
+    MKLDNNGraph::Ptr graph;
+    const size_t maxBatch;
+    const std::chrono::microseconds timeout;
+
+    std::mutex queueMutex;
+    std::condition_variable queueCondVar;
+    std::deque<Request *> queue;
+    bool hasLeader = false;
+
+    // batched input/output data, accessed by the leader only
+    InferenceEngine::BlobMap batchedInputs;
+    InferenceEngine::BlobMap batchedOutputs;
+
+    mutable std::mutex statsMutex;
+    std::vector<uint64_t> waitHistogram;
+    std::vector<uint64_t> batchHistogram;
+};
+
+}  // namespace MKLDNNPlugin
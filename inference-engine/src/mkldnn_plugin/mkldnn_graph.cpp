@@ -12,6 +12,7 @@
 #include <unordered_map>
 #include <memory>
 #include <utility>
+#include <atomic>
 
 #include "details/caseless.hpp"
 
@@ -23,6 +24,7 @@
 #include <nodes/mkldnn_reorder_node.h>
 #include <nodes/mkldnn_depthwise_node.h>
 #include <nodes/mkldnn_conv_node.h>
+#include <nodes/mkldnn_memory_node.hpp>
 
 #include "mkldnn_extension_utils.h"
 #include "mkldnn_extension_mngr.h"
@@ -33,6 +35,7 @@
 #include "memory_solver.hpp"
 #include "mkldnn_infer_request.h"
 #include "mkldnn_async_infer_request.h"
+#include "mkldnn_batching.h"
 #include <blob_factory.hpp>
 #include <ie_util_internal.hpp>
 #include <net_pass.h>
@@ -50,6 +53,7 @@
 #define XBYAK_NO_OP_NAMES
 #define XBYAK_UNDEF_JNL
 #include "../../thirdparty/mkl-dnn/src/cpu/xbyak/xbyak_util.h"
+#include "../../thirdparty/mkl-dnn/src/common/scratchpad.hpp"
 
 #include "cnn_network_stats_impl.hpp"
 
@@ -282,6 +286,26 @@ void MKLDNNGraph::Replicate(const ICNNNetwork &network, const MKLDNNExtensionMan
         }
     }
 
+    // memory layers are paired by id within the graph, so the graphs of different streams don't share the state
+    for (auto &node : graphNodes) {
+        if (node->getType() == MemoryInput)
+            memoryNodes[dynamic_cast<MKLDNNMemoryNode *>(node.get())->getId()].first = node;
+    }
+    for (auto &node : graphNodes) {
+        if (node->getType() != MemoryOutput)
+            continue;
+        auto memoryNode = dynamic_cast<MKLDNNMemoryNode *>(node.get());
+        auto &pair = memoryNodes[memoryNode->getId()];
+        if (!pair.first)
+            THROW_IE_EXCEPTION << "Memory layer " << node->getName() << " has no pair with id " << memoryNode->getId();
+        memoryNode->setInputNode(pair.first.get());
+        pair.second = node;
+    }
+    for (auto &pair : memoryNodes) {
+        if (!pair.second.second)
+            THROW_IE_EXCEPTION << "Memory layer " << pair.second.first->getName() << " has no pair with id " << pair.first;
+    }
+
     std::map<std::string, DataPtr> outputs;
     network.getOutputsInfo(outputs);
 
@@ -355,6 +379,9 @@ void MKLDNNGraph::InitGraph() {
 
     SortTopologically();
 
+    // memory reuse depends on the order nodes are executed in, so the schedule must be known before allocation
+    InitParallelSchedule();
+
     Allocate();
 
     CreatePrimitives();
@@ -403,6 +430,10 @@ void MKLDNNGraph::InitGraph() {
     }
 #endif
 
+    // Shared constants are already computed by the graph which owns the arena
+    if (!fillConstants)
+        return;
+
     mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
     for (auto &graphNode : graphNodes) {
         if (!graphNode->isConstant())
@@ -418,13 +449,29 @@ void MKLDNNGraph::InitNodes() {
             if (inputNode)
                 inputNode->withMeanImage();
         }
+        node->setEnforceBF16(config.enforceBF16);
         node->getSupportedDescriptors();
 
         node->initSupportedPrimitiveDescriptors();
     }
 
     for (auto &node : graphNodes) {
-        node->selectOptimalPrimitiveDescriptor();
+        auto selected = primitivesSelection.find(node->getName());
+        const auto &supported = node->getSupportedPrimitiveDescriptors();
+        if (selected != primitivesSelection.end() &&
+                selected->second.index >= 0 && selected->second.index < supported.size() &&
+                supported[selected->second.index].getImplementationType() == selected->second.type) {
+            node->selectPrimitiveDescriptorByIndex(selected->second.index);
+        } else {
+            node->selectOptimalPrimitiveDescriptor();
+        }
+
+        // remember the choice to be able to export it
+        auto selectedPD = node->getSelectedPrimitiveDescriptor();
+        if (selectedPD) {
+            primitivesSelection[node->getName()] = {static_cast<int>(selectedPD - &supported[0]),
+                                                    selectedPD->getImplementationType()};
+        }
     }
 }
 
@@ -567,12 +614,16 @@ void MKLDNNGraph::AllocateWithReuse() {
     const int64_t alignment = 32;  // 32 bytes
 
     std::vector<MemorySolver::Box> boxes(edge_clasters.size());
+    // Clusters which hold pure constant data (filled once on load and only read during inference).
+    // They can be placed into the read-only arena shared between all graphs of the executable network.
+    std::vector<bool> sharedConstClasters(edge_clasters.size(), false);
+    bool allConstsShareable = true;
     for (int i = 0; i < edge_clasters.size(); i++) {
         MemorySolver::Box &box = boxes[i];
         box = { std::numeric_limits<int>::max(), 0, 0, i };
         for (auto &edge : edge_clasters[i]) {
-            int e_start = edge->getParent()->execIndex;
-            int e_finish = edge->getChild()->execIndex;
+            int e_start = getExecTimestamp(edge->getParent());
+            int e_finish = getExecTimestamp(edge->getChild());
 
             const BlockingDesc block_desk = edge->getDesc().getBlockingDesc();
 
@@ -591,14 +642,25 @@ void MKLDNNGraph::AllocateWithReuse() {
         // So we need it untouchable during all execution time
         // -1 is a place holder for a max timestamp.
         bool isConst = false, isOutput = false, isInput = false;
+        bool isPureConst = true, isMemory = false, isNetInput = false;
         for (auto &edge : edge_clasters[i]) {
             isConst  |= isConstOutput(edge);
             isOutput |= edge->getChild()->getType() == Output;
             isInput  |= edge->getParent()->getType() == Input;
 
+            isPureConst &= edge->getParent()->isConstant();
+            isNetInput  |= edge->getParent()->getType() == Input && !edge->getParent()->isConstant();
+
             // WA. MemoryOutput will keep data in that edge
             // So need to make it immortal..
-            isConst |= edge->getParent()->getType() == MemoryInput;
+            isMemory |= edge->getParent()->getType() == MemoryInput;
+        }
+        isConst |= isMemory;
+
+        if (isConst && !isMemory) {
+            bool isShareable = isPureConst && !isNetInput && !isOutput;
+            sharedConstClasters[i] = isShareable;
+            allConstsShareable &= isShareable;
         }
 
         if (reuse_io_tensors) {
@@ -614,21 +676,62 @@ void MKLDNNGraph::AllocateWithReuse() {
         box.size = div_up(box.size, alignment);
     }
 
-    MemorySolver memSolver(boxes);
+    // Constants are shared only if the whole constant data of the graph can be moved into the arena.
+    // Otherwise the graph keeps its own copy, so that constant nodes can be executed without
+    // synchronization with the other graphs.
+    const bool shareConstants = !sharedConstKey.empty() && allConstsShareable;
+
+    std::vector<MemorySolver::Box> privateBoxes;
+    std::vector<int64_t> constOffsets(edge_clasters.size(), 0);
+    int64_t const_size = 0;
+    for (int i = 0; i < edge_clasters.size(); i++) {
+        if (shareConstants && sharedConstClasters[i]) {
+            // all constants are alive during the whole execution, so there is no reuse inside the arena
+            constOffsets[i] = const_size;
+            const_size += boxes[i].size;
+        } else {
+            privateBoxes.push_back(boxes[i]);
+        }
+    }
+
+    MemorySolver memSolver(privateBoxes);
     size_t total_size = static_cast<size_t>(memSolver.solve()) * alignment;
 
     memWorkspace = std::make_shared<MKLDNNMemory>(eng);
     memWorkspace->Create(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {total_size}, Layout::C)));
     auto* workspace_ptr = static_cast<int8_t*>(memWorkspace->GetData());
 
+    memConstWorkspace.reset();
+    fillConstants = true;
+    int8_t* const_workspace_ptr = nullptr;
+    if (shareConstants && const_size > 0) {
+        size_t const_total_size = static_cast<size_t>(const_size) * alignment;
+        bool created = false;
+        // The first graph (per socket) which requests the arena owns it: allocates it (so the pages are local
+        // to the NUMA node the graph's stream is pinned to) and fills it by executing the constant nodes.
+        memConstWorkspace = Engine::GetWeightsSharing(socket)->findOrCreate(
+                sharedConstKey + "_" + std::to_string(const_total_size), [&] () {
+                    created = true;
+                    MKLDNNMemoryPtr _ptr = std::make_shared<MKLDNNMemory>(eng);
+                    _ptr->Create(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {const_total_size}, Layout::C)));
+                    return _ptr;
+                });
+        fillConstants = created;
+        const_workspace_ptr = static_cast<int8_t*>(memConstWorkspace->GetData());
+    }
+
     for (int i = 0; i < edge_clasters.size(); i++) {
         int count = 0;
         for (auto &edge : edge_clasters[i]) {
             if (edge->getStatus() == MKLDNNEdge::Status::NeedAllocation) {
-                int64_t offset = memSolver.getOffset(i);
-                // !! Fallback to individual memory allocation !!
-                // if you like to check infer without reuse just call this function without arguments.
-                edge->allocate(workspace_ptr + offset * alignment);  // alignment in byte
+                if (const_workspace_ptr && sharedConstClasters[i]) {
+                    edge->allocate(const_workspace_ptr + constOffsets[i] * alignment);
+                } else {
+                    int64_t offset = memSolver.getOffset(i);
+                    // !! Fallback to individual memory allocation !!
+                    // if you like to check infer without reuse just call this function without arguments.
+                    edge->allocate(workspace_ptr + offset * alignment);  // alignment in byte
+                }
                 count++;
             }
         }
@@ -658,32 +761,88 @@ void MKLDNNGraph::CreatePrimitives() {
     }
 }
 
+template <typename T>
+static void convertInputToFloat(const InferenceEngine::Blob::Ptr &in, float *dst, const MKLDNNDims &dims,
+                                InferenceEngine::Layout layout, const MeanImage &mean) {
+    mean.ConvertAndSubtract(dims, in->cbuffer().as<const T *>(), dst, layout);
+}
+
 void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in) {
     if (!IsReady()) THROW_IE_EXCEPTION<< "Wrong state. Topology not ready.";
 
     auto input = inputNodes.find(name);
     if (input != inputNodes.end()) {
         MKLDNNDims outDims = input->second->getChildEdgeAt(0)->getDims();
+        const MKLDNNMemory &inter_mem = input->second->getChildEdgeAt(0)->getMemory();
 
         const void *ext_data_ptr = in->cbuffer();
-        void *inter_data_ptr = input->second->getChildEdgeAt(0)->getMemory().GetData();
+        void *inter_data_ptr = inter_mem.GetData();
+
+        auto l = in->getTensorDesc().getLayout();
+        if (l == CHW && outDims.ndims() == 4)
+            l = NCHW;
+
+        auto prec = in->getTensorDesc().getPrecision();
+        auto meanImage = _meanImages.find(name);
+
+        // Integral inputs feeding FP32 input memory (U16 one or any with mean image) are converted and
+        // mean-subtracted in a single pass. Dense blobs of the same layout go right to the input memory,
+        // the rest through a persistent FP32 buffer and a reorder.
+        if (prec != Precision::FP32 && inter_mem.GetDataType() == memory::f32) {
+            if (prec != Precision::U8 && prec != Precision::I16 && prec != Precision::U16)
+                THROW_IE_EXCEPTION << "Input of type " << prec.name() << " can't be converted to FP32";
+
+            const TensorDesc &desc = in->getTensorDesc();
+            bool direct = inter_mem.GetFormat() == MKLDNNMemory::Convert(l) &&
+                          desc.getBlockingDesc() == BlockingDesc(desc.getDims(), desc.getLayout()) &&
+                          in->size() * sizeof(float) == inter_mem.GetSize();
+
+            float *dst = reinterpret_cast<float *>(inter_data_ptr);
+            if (!direct) {
+                auto &buffer = _inputConvertBuffers[name];
+                if (!buffer || buffer->getTensorDesc().getDims() != desc.getDims() ||
+                        buffer->getTensorDesc().getLayout() != desc.getLayout()) {
+                    buffer = make_shared_blob<float>({Precision::FP32, desc.getDims(), desc.getLayout()});
+                    buffer->allocate();
+                }
+                dst = buffer->data();
+            }
 
-        if (ext_data_ptr != inter_data_ptr) {
-            auto l = in->getTensorDesc().getLayout();
-            if (l == CHW && input->second->getChildEdgeAt(0)->getDims().ndims() == 4)
-                l = NCHW;
+            // the mean is subtracted from 4D inputs only, plain conversion takes the blob of any rank as is
+            MeanImage noMean;
+            const MeanImage &mean = meanImage != _meanImages.end() ? meanImage->second : noMean;
+            MKLDNNDims dims = meanImage != _meanImages.end() ? outDims : MKLDNNDims(desc.getDims());
+            switch (prec) {
+                case Precision::U8:
+                    convertInputToFloat<uint8_t>(in, dst, dims, l, mean);
+                    break;
+                case Precision::I16:
+                    convertInputToFloat<int16_t>(in, dst, dims, l, mean);
+                    break;
+                default:
+                    convertInputToFloat<uint16_t>(in, dst, dims, l, mean);
+                    break;
+            }
+
+            if (!direct) {
+                inter_mem.SetData(memory::f32, MKLDNNMemory::Convert(l), dst, in->size() * sizeof(float), false);
+            }
+            copiedBytes += in->size() * sizeof(float);
+            return;
+        }
 
-            input->second->getChildEdgeAt(0)->getMemory().SetData(
-                    MKLDNNExtensionUtils::IEPrecisionToDataType(in->getTensorDesc().getPrecision()),
-                    MKLDNNMemory::Convert(l), ext_data_ptr, in->byteSize(), false);
+        if (ext_data_ptr != inter_data_ptr) {
+            inter_mem.SetData(MKLDNNExtensionUtils::IEPrecisionToDataType(prec), MKLDNNMemory::Convert(l),
+                              ext_data_ptr, in->byteSize(), false);
+            copiedBytes += in->byteSize();
         }
 
         // todo: make sure 'name' exists in this map...
-        if (_meanImages.find(name) != _meanImages.end()) {
-            if (in->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32) {
-                _meanImages[name].Subtract(outDims, reinterpret_cast<float *>(inter_data_ptr), in->getTensorDesc().getLayout());
+        if (meanImage != _meanImages.end()) {
+            if (prec == InferenceEngine::Precision::FP32) {
+                meanImage->second.Subtract(outDims, reinterpret_cast<float *>(inter_data_ptr), in->getTensorDesc().getLayout());
             } else {
-                THROW_IE_EXCEPTION << "Mean image of type " << in->getTensorDesc().getPrecision().name() << " is unsupported";
+                THROW_IE_EXCEPTION << "Mean image of type " << prec.name() << " is unsupported";
             }
         }
     } else {
@@ -733,7 +892,96 @@ void MKLDNNGraph::PullOutputData(BlobMap &out) {
         size_t size_to_copy = intr_blob.GetSize() * MB_to_process / MB;
 
         ie_memcpy(ext_blob_ptr, ext_blob->byteSize(), intr_blob_ptr, size_to_copy);
+        copiedBytes += size_to_copy;
+    }
+}
+
+void MKLDNNGraph::InitParallelSchedule() {
+    execLevels.assign(graphNodes.size(), 0);
+    parallelLevels.clear();
+
+    for (auto &node : graphNodes) {
+        int level = 0;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++)
+            level = std::max(level, execLevels[node->getParentEdgeAt(i)->getParent()->execIndex] + 1);
+        execLevels[node->execIndex] = level;
+    }
+
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    // OpenMP doesn't allow nested parallel regions of the branches to use more than one thread each
+    if (!config.parallelBranches)
+        return;
+
+    for (auto &node : graphNodes) {
+        // memory state is read and written in the order of the sequential schedule
+        if (node->getType() == MemoryInput || node->getType() == MemoryOutput)
+            return;
+    }
+
+    std::vector<std::vector<MKLDNNNodePtr>> levels;
+    for (auto &node : graphNodes) {
+        if (node->isConstant())
+            continue;
+        size_t level = static_cast<size_t>(execLevels[node->execIndex]);
+        if (levels.size() <= level)
+            levels.resize(level + 1);
+        levels[level].push_back(node);
+    }
+
+    bool hasBranches = false;
+    for (auto &level : levels)
+        hasBranches |= level.size() > 1;
+    if (!hasBranches)
+        return;
+
+    for (auto &level : levels) {
+        if (!level.empty())
+            parallelLevels.push_back(level);
+    }
+#endif
+}
+
+int MKLDNNGraph::getExecTimestamp(const MKLDNNNodePtr &node) const {
+    // nodes of one level run simultaneously, so the level is the time point of all of them
+    return parallelLevels.empty() ? node->execIndex : execLevels[node->execIndex];
+}
+
+/**
+ * MKL-DNN primitives use the global scratchpad of the thread executing them, which is sized by the primitives created
+ * on that thread. Branch workers don't create the primitives they execute, so each of them keeps a scratchpad of
+ * the largest size it has needed alive until the thread exits.
+ */
+static void reserveThreadScratchpad(size_t size) {
+    static thread_local std::unique_ptr<mkldnn::impl::scratchpad_t> scratchpad;
+    static thread_local size_t reservedSize = 0;
+    if (!scratchpad || size > reservedSize) {
+        // the new one is created before the old one is released, so the buffer is only reallocated if it grows
+        scratchpad.reset(mkldnn::impl::create_scratchpad(size));
+        reservedSize = size;
+    }
+}
+
+size_t MKLDNNGraph::GetScratchpadSize() {
+    size_t size = 0;
+    for (auto &node : graphNodes)
+        size = std::max(size, node->getScratchpadSize());
+    return size;
+}
+
+void MKLDNNGraph::ExecuteNode(const MKLDNNNodePtr &node, mkldnn::stream &stream, int batch) {
+    PERF(node);
+
+    if (batch > 0)
+        node->setDynamicBatchLim(batch);
+
+    ENABLE_DUMP(do_before(DUMP_DIR, node));
+
+    if (!node->isConstant()) {
+        IE_PROFILING_AUTO_SCOPE_TASK(node->profilingTask)
+        node->execute(stream);
     }
+
+    ENABLE_DUMP(do_after(DUMP_DIR, node));
 }
 
 void MKLDNNGraph::Infer(int batch) {
@@ -742,20 +990,36 @@ void MKLDNNGraph::Infer(int batch) {
     }
 
     mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
-    for (int i = 0; i < graphNodes.size(); i++) {
-        PERF(graphNodes[i]);
-
-        if (batch > 0)
-            graphNodes[i]->setDynamicBatchLim(batch);
-
-        ENABLE_DUMP(do_before(DUMP_DIR, graphNodes[i]));
-
-        if (!graphNodes[i]->isConstant()) {
-            IE_PROFILING_AUTO_SCOPE_TASK(graphNodes[i]->profilingTask)
-            graphNodes[i]->execute(stream);
+    if (parallelLevels.empty()) {
+        for (int i = 0; i < graphNodes.size(); i++)
+            ExecuteNode(graphNodes[i], stream, batch);
+    } else {
+        // constant nodes are not executed, but keep the dynamic batch limit the same as the rest of nodes have
+        if (batch > 0) {
+            for (auto &node : graphNodes) {
+                if (node->isConstant())
+                    node->setDynamicBatchLim(batch);
+            }
         }
 
-        ENABLE_DUMP(do_after(DUMP_DIR, graphNodes[i]));
+        // the levels are executed one by one, nodes of a level are executed concurrently within the current arena
+        for (auto &level : parallelLevels) {
+            if (level.size() == 1) {
+                ExecuteNode(level[0], stream, batch);
+                continue;
+            }
+            parallel_for(level.size(), [&](size_t i) {
+                const MKLDNNNodePtr &node = level[i];
+                reserveThreadScratchpad(node->getScratchpadSize());
+                mkldnn::stream branchStream = mkldnn::stream(stream::kind::eager);
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+                // a thread waiting inside the node must not take another branch, both would use its scratchpad
+                tbb::this_task_arena::isolate([&] { ExecuteNode(node, branchStream, batch); });
+#else
+                ExecuteNode(node, branchStream, batch);
+#endif
+            });
+        }
     }
 
     if (infer_count != -1) infer_count++;
@@ -845,6 +1109,12 @@ void MKLDNNGraph::SortTopologically() {
     }
 }
 
+size_t MKLDNNGraph::GetReordersCount() const {
+    return std::count_if(graphNodes.begin(), graphNodes.end(), [](const MKLDNNNodePtr& node) {
+        return node->getType() == Reorder;
+    });
+}
+
 void MKLDNNGraph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const {
     unsigned i = 0;
     std::function<void(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &, const MKLDNNNodePtr&)>
@@ -877,6 +1147,73 @@ void MKLDNNGraph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEn
     if (!config.dumpToDot.empty()) dumpToDotFile(config.dumpToDot + "_perf.dot");
 }
 
+void MKLDNNGraph::EnablePerfTrace(int streamId) {
+    // executions of the same node follow each other, so the latest thousand of them cover many inferences
+    const size_t eventsPerNode = 1024;
+    for (auto &node : graphNodes)
+        node->PerfCounter().enableTrace(streamId, eventsPerNode);
+}
+
+void MKLDNNGraph::GetPerfTrace(std::vector<PerfTraceNode> &nodes) const {
+    for (auto &node : graphNodes) {
+        auto trace = node->PerfCounter().trace();
+        if (!trace || node->isConstant())
+            continue;
+        PerfTraceNode traceNode;
+        traceNode.name = node->getName();
+        traceNode.type = node->typeStr;
+        traceNode.execType = node->getPrimitiveDescriptorType();
+        trace->snapshot(traceNode.events);
+        nodes.push_back(traceNode);
+    }
+}
+
+std::vector<MKLDNNMemoryState::Ptr> MKLDNNGraph::CreateMemoryStates() const {
+    std::vector<MKLDNNMemoryState::Ptr> states;
+    for (auto &pair : memoryNodes) {
+        auto &memory = pair.second.first->getChildEdgeAt(0)->getMemory();
+        auto memDims = memory.GetDims();
+        SizeVector dims(memDims.begin(), memDims.end());
+        TensorDesc desc(MKLDNNExtensionUtils::DataTypeToIEPrecision(memory.GetDataType()), dims,
+                        MKLDNNMemory::GetPlainLayout(memDims));
+        states.push_back(std::make_shared<MKLDNNMemoryState>(pair.first, desc));
+    }
+    return states;
+}
+
+size_t MKLDNNGraph::BindMemoryStates(const std::vector<MKLDNNMemoryState::Ptr> &states) {
+    size_t copied = 0;
+    for (auto &state : states) {
+        auto nodes = memoryNodes.find(state->GetName());
+        if (nodes == memoryNodes.end())
+            THROW_IE_EXCEPTION << "Cannot find memory layer with id " << state->GetName();
+        auto &input = nodes->second.first;
+        auto output = std::dynamic_pointer_cast<MKLDNNMemoryOutputNode>(nodes->second.second);
+
+        auto &memory = input->getChildEdgeAt(0)->getMemory();
+        if (memory.GetSize() != state->byteSize())
+            THROW_IE_EXCEPTION << "State of memory layer " << state->GetName() << " doesn't match the graph memory";
+
+        std::vector<MKLDNNEdgePtr> views;
+        bool bound = true;
+        for (size_t i = 0; i < input->getChildEdges().size() && bound; i++)
+            bound = collectInputViews(input->getChildEdgeAt(i), views);
+        if (bound) {
+            for (auto &edge : views)
+                edge->getMemory().GetPrimitivePtr()->set_data_handle(state->currentBuffer());
+        } else {
+            // a consumer works in place, so the state is copied into the graph own memory
+            auto data = reinterpret_cast<uint8_t *>(memory.GetData()) +
+                    memory.GetDescriptor().data.layout_desc.blocking.offset_padding *
+                    MKLDNNExtensionUtils::sizeOfDataType(memory.GetDataType());
+            ie_memcpy(data, memory.GetSize(), state->currentBuffer(), state->byteSize());
+            copied += state->byteSize();
+        }
+        output->setStateBuffer(state->nextBuffer());
+    }
+    return copied;
+}
+
 void MKLDNNGraph::setConfig(const Config &cfg) {
     config = cfg;
 }
@@ -1081,6 +1418,10 @@ InferenceEngine::ICNNNetwork::Ptr MKLDNNGraph::dump() const {
     return dump_graph_as_ie_net(*this);
 }
 
+bool MKLDNNExecNetwork::IsBatchingEnabled(const Config &cfg) {
+    return cfg.batchingMaxBatch > 1 && cfg.throughputStreams == 1 && !cfg.exclusiveAsyncRequests;
+}
+
 bool MKLDNNExecNetwork::CanProcessDynBatch(const InferenceEngine::ICNNNetwork &network) const {
     InputsDataMap inputs;
     network.getInputsInfo(inputs);
@@ -1143,7 +1484,7 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
     ICNNNetworkStats* pstats = nullptr;
     StatusCode s = network.getStats(&pstats, nullptr);
     // we are cloning network if we have statistics and we can transform network.
-    auto clonedNetwork = cloneNet(network);
+    clonedNetwork = cloneNet(network);
 
     if (Precision::FP16 == network.getPrecision()) {
         clonedNetwork->setPrecision(Precision::FP32);
@@ -1162,6 +1503,35 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
 
     MKLDNNGraph::ApplyUnrollPasses(*clonedNetwork);
 
+    if (IsBatchingEnabled(cfg)) {
+        if (clonedNetwork->getBatchSize() != 1)
+            THROW_IE_EXCEPTION << "CPU batching requires a network of batch 1, but got " << clonedNetwork->getBatchSize();
+        ResponseDesc resp;
+        if (clonedNetwork->setBatchSize(cfg.batchingMaxBatch, &resp) != OK)
+            THROW_IE_EXCEPTION << "CPU batching cannot set network batch: " << resp.msg;
+    }
+
+    CreateGraphs(cfg, {});
+}
+
+MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &preparedNetwork,
+                                     const Config &cfg,
+                                     const MKLDNNExtensionManager::Ptr& extMgr,
+                                     const PrimitivesSelection &selection) : extensionManager(extMgr) {
+    clonedNetwork = cloneNet(preparedNetwork);
+    CreateGraphs(cfg, selection);
+}
+
+void MKLDNNExecNetwork::CreateGraphs(const Config &userCfg, const PrimitivesSelection &selection) {
+    Config cfg = userCfg;
+    // batching of concurrent requests runs the single graph compiled for the max batch with dynamic batch limit
+    const bool batching = IsBatchingEnabled(cfg);
+    if (batching) {
+        if (clonedNetwork->getBatchSize() != cfg.batchingMaxBatch)
+            THROW_IE_EXCEPTION << "CPU batching requires the network reshaped to the max batch";
+        cfg.enableDynamicBatch = true;
+        cfg.batchLimit = cfg.batchingMaxBatch;
+    }
     if (cfg.batchLimit > 1) {
         // check topology for applicability
         if (!CanProcessDynBatch(*clonedNetwork)) {
@@ -1179,13 +1549,19 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
     const int threads = cfg.threadsNum ? cfg.threadsNum : (env_threads ? env_threads : hw_cores);
     const int threads_per_stream = std::max(1, threads/cfg.throughputStreams);
 
+    // all streams (graphs) of the network read the same constant data, so keep a single copy of it per socket
+    static std::atomic<uint64_t> networksCounter(0);
+    const std::string constantsKey = cfg.throughputStreams > 1
+            ? "constants_" + clonedNetwork->getName() + "_" + std::to_string(networksCounter++)
+            : std::string();
+
     // graph(s) initialization in taskExecutor threads (streams), in parallel (in case of streams)
     std::vector<Task::Ptr> tasks;
     const int workers_per_socket = std::max(1, static_cast<int>(std::ceil(static_cast<float>(cfg.throughputStreams)/sockets)));
     for (int n = 0; n < cfg.throughputStreams; n++) {
         MKLDNNGraph::Ptr _graph = std::make_shared<MKLDNNGraph>();
         graphs.push_back(_graph);
-        auto task = std::make_shared<InferenceEngine::Task>([=, &cfg, &network]() {
+        auto task = std::make_shared<InferenceEngine::Task>([=, &cfg, &selection]() {
             _graph->CreateArena(threads_per_stream);
 
             if (bPinningRequested) {
@@ -1193,8 +1569,12 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
             }
 
             _graph->setConfig(cfg);
+            _graph->SetConstantsSharingKey(constantsKey);
+            _graph->SetPrimitivesSelection(selection);
             int socket = n / workers_per_socket;
             _graph->CreateGraph(*clonedNetwork, extensionManager, socket);
+            if (cfg.perfTrace)
+                _graph->EnablePerfTrace(n);
             if (cfg.throughputStreams > 1)  // for streams, each worker thread has it's own graph
                 MKLDNNPlugin::MultiWorkerTaskExecutor::ptrContext.ptrGraph = _graph;
         });
@@ -1215,6 +1595,33 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
     }
     for (auto t : tasks)
         t->checkException();
+
+    // the states are owned by the requests, the network ones reach the states of all its requests
+    for (auto &state : graphs[0]->CreateMemoryStates())
+        memoryStates.push_back(std::make_shared<MKLDNNNetworkMemoryState>(state->GetName()));
+
+    if (batching) {
+        if (!memoryStates.empty())
+            THROW_IE_EXCEPTION << "CPU batching doesn't support networks with memory layers";
+        batcher = std::make_shared<MKLDNNRequestsBatcher>(graphs[0], cfg.batchingMaxBatch, cfg.batchingTimeout);
+        // requests wait for their batch inside the executor, so it has a thread per request of the batch
+        std::vector<Task::Ptr> workers;
+        for (int n = 0; n < cfg.batchingMaxBatch; n++)
+            workers.push_back(std::make_shared<InferenceEngine::Task>([] {}));
+        _taskExecutor = std::make_shared<MultiWorkerTaskExecutor>(workers, "CPUBatching");
+    }
+}
+
+void MKLDNNExecNetwork::Export(const std::string &modelFileName) {
+    if (graphs.empty())
+        THROW_IE_EXCEPTION << NETWORK_NOT_LOADED_str;
+
+    std::ofstream outStream(modelFileName, std::ios_base::out | std::ios_base::binary);
+    if (!outStream.is_open())
+        THROW_IE_EXCEPTION << "Cannot open file to export model: " << modelFileName;
+
+    MKLDNNModelSerial::Export(outStream, *clonedNetwork, _networkInputs, _networkOutputs,
+                              graphs[0]->getProperty()._config, graphs[0]->GetPrimitivesSelection());
 }
 
 void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &properties) {
@@ -1232,11 +1639,23 @@ void MKLDNNExecNetwork::CreateInferRequest(InferenceEngine::IInferRequest::Ptr &
 
     asyncRequestImpl->SetPointerToPublicInterface(asyncRequest);
 
+    auto states = graphs[0]->CreateMemoryStates();
+    for (size_t i = 0; i < states.size(); i++)
+        memoryStates[i]->addRequestState(states[i]);
+
     if (graphs.size() == 1) {  // single-stream (legacy/hetero) case - single graph for all requests
         auto mkldnnSyncRequest = dynamic_cast<MKLDNNInferRequest *>(syncRequestImpl.get());
         if (!mkldnnSyncRequest)
             THROW_IE_EXCEPTION << " Cannot get mkldnn sync request.";
+        // the batcher goes first, so that the request allocates single-sample outputs instead of batched ones
+        mkldnnSyncRequest->SetBatcher(batcher);
         mkldnnSyncRequest->SetGraph(graphs[0]);
+        mkldnnSyncRequest->SetMemoryStates(states);
+    } else {
+        auto graphlessRequest = dynamic_cast<MKLDNNGraphlessInferRequest *>(syncRequestImpl.get());
+        if (!graphlessRequest)
+            THROW_IE_EXCEPTION << " Cannot get mkldnn graphless request.";
+        graphlessRequest->SetMemoryStates(states);
     }
 }
 
@@ -1263,6 +1682,17 @@ void MKLDNNExecNetwork::GetMetric(const std::string &name, Parameter &result, Re
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        metrics.push_back(METRIC_KEY(CPU_STREAM_MEMORY_SIZE));
+        metrics.push_back(METRIC_KEY(CPU_SHARED_CONSTANTS_MEMORY_SIZE));
+        metrics.push_back(METRIC_KEY(CPU_REORDERS_COUNT));
+        if (batcher) {
+            metrics.push_back(METRIC_KEY(CPU_BATCHING_WAIT_HISTOGRAM));
+            metrics.push_back(METRIC_KEY(CPU_BATCHING_BATCH_HISTOGRAM));
+        }
+        if (graphs[0]->getProperty().perfTrace) {
+            metrics.push_back(METRIC_KEY(CPU_PERF_TRACE));
+            metrics.push_back(METRIC_KEY(CPU_PERF_TRACE_PERCENTILES));
+        }
         result = IE_SET_METRIC(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -1275,6 +1705,33 @@ void MKLDNNExecNetwork::GetMetric(const std::string &name, Parameter &result, Re
         auto option = engConfig._config.find(CONFIG_KEY(CPU_THROUGHPUT_STREAMS));
         IE_ASSERT(option != engConfig._config.end());
         result = IE_SET_METRIC(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(std::stoi(option->second)));
+    } else if (name == METRIC_KEY(CPU_STREAM_MEMORY_SIZE)) {
+        result = IE_SET_METRIC(CPU_STREAM_MEMORY_SIZE, static_cast<uint64_t>(graphs[0]->GetWorkspaceSize()));
+    } else if (name == METRIC_KEY(CPU_SHARED_CONSTANTS_MEMORY_SIZE)) {
+        // graphs of the same socket refer to the same arena, count each arena once
+        std::unordered_set<MKLDNNMemory*> arenas;
+        uint64_t sharedSize = 0;
+        for (auto &graph : graphs) {
+            auto &arena = graph->GetSharedConstantsWorkspace();
+            if (arena && arenas.insert(arena.get()).second)
+                sharedSize += arena->GetSize();
+        }
+        result = IE_SET_METRIC(CPU_SHARED_CONSTANTS_MEMORY_SIZE, sharedSize);
+    } else if (name == METRIC_KEY(CPU_REORDERS_COUNT)) {
+        result = IE_SET_METRIC(CPU_REORDERS_COUNT, static_cast<uint64_t>(graphs[0]->GetReordersCount()));
+    } else if (name == METRIC_KEY(CPU_BATCHING_WAIT_HISTOGRAM) && batcher) {
+        result = IE_SET_METRIC(CPU_BATCHING_WAIT_HISTOGRAM, batcher->GetWaitHistogram());
+    } else if (name == METRIC_KEY(CPU_BATCHING_BATCH_HISTOGRAM) && batcher) {
+        result = IE_SET_METRIC(CPU_BATCHING_BATCH_HISTOGRAM, batcher->GetBatchHistogram());
+    } else if ((name == METRIC_KEY(CPU_PERF_TRACE) || name == METRIC_KEY(CPU_PERF_TRACE_PERCENTILES)) &&
+               graphs[0]->getProperty().perfTrace) {
+        std::vector<PerfTraceNode> nodes;
+        for (auto &graph : graphs)
+            graph->GetPerfTrace(nodes);
+        if (name == METRIC_KEY(CPU_PERF_TRACE))
+            result = IE_SET_METRIC(CPU_PERF_TRACE, PerfTraceToChromeJson(nodes));
+        else
+            result = IE_SET_METRIC(CPU_PERF_TRACE_PERCENTILES, PerfTracePercentiles(nodes, {50.f, 90.f, 99.f}));
     } else {
         THROW_IE_EXCEPTION << "Unsupported ExecutableNetwork metric: " << name;
     }
@@ -9,20 +9,26 @@
 #include <vector>
 #include <memory>
 #include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
+#include <cnn_network_impl.hpp>
 
 #include "ie_parallel.hpp"
 #include "mkldnn_memory.h"
 #include "config.h"
 #include "perf_count.h"
+#include "perf_trace.h"
 #include "mkldnn_dims.h"
 #include "mean_image.h"
 #include "mkldnn_node.h"
 #include "mkldnn_edge.h"
 #include "mkldnn_extension_utils.h"
 #include "mkldnn_streams.h"
+#include "mkldnn_model_serial.h"
+#include "mkldnn_memory_state.h"
 
 namespace MKLDNNPlugin {
 
+class MKLDNNRequestsBatcher;
+
 class MKLDNNGraph {
 public:
     typedef std::shared_ptr<MKLDNNGraph> Ptr;
@@ -62,8 +68,20 @@ public:
     void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in);
     void PullOutputData(InferenceEngine::BlobMap &out);
 
+    // Bytes copied by PushInputData/PullOutputData since the last reset, zero-copy bound blobs add nothing
+    void ResetCopiedBytes() {
+        copiedBytes = 0;
+    }
+
+    size_t GetCopiedBytes() const {
+        return copiedBytes;
+    }
+
     void Infer(int batch = -1);
 
+    // The largest global scratchpad the nodes take from the thread executing them
+    size_t GetScratchpadSize();
+
     std::vector<MKLDNNNodePtr>& GetNodes() {
         return graphNodes;
     }
@@ -82,6 +100,25 @@ public:
 
     void GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const;
 
+    /**
+     * Starts recording every execution of the nodes with nanosecond timestamps (see CONFIG_KEY(CPU_PERF_TRACE)).
+     * Should be called after CreateGraph.
+     */
+    void EnablePerfTrace(int streamId);
+    // Appends the recorded executions of the nodes, empty if the trace isn't enabled
+    void GetPerfTrace(std::vector<PerfTraceNode> &nodes) const;
+
+    /**
+     * Creates the states of the memory layers for an infer request, the graph doesn't keep them
+     */
+    std::vector<MKLDNNMemoryState::Ptr> CreateMemoryStates() const;
+    /**
+     * Makes the next inference read the states and write the new ones into their spare buffers,
+     * the caller swaps the buffers of the states after the inference.
+     * Returns the number of bytes copied for the states which can't be read in place.
+     */
+    size_t BindMemoryStates(const std::vector<MKLDNNMemoryState::Ptr> &states);
+
     void RemoveDroppedNodes();
     void RemoveDroppedEdges();
     void DropNode(const MKLDNNNodePtr& node);
@@ -122,6 +159,36 @@ public:
 
     void ResetInferCount() { infer_count = 0; }
 
+    /**
+     * Enables placing of the constant data into the read-only arena shared between all graphs
+     * created with the same key (per socket). Should be called before CreateGraph.
+     */
+    void SetConstantsSharingKey(const std::string& key) { sharedConstKey = key; }
+
+    size_t GetWorkspaceSize() const {
+        return memWorkspace ? memWorkspace->GetSize() : 0;
+    }
+
+    /**
+     * Number of reorders left in the graph after the optimizations, they convert the data between the nodes
+     * which selected different layouts or precisions
+     */
+    size_t GetReordersCount() const;
+
+    const MKLDNNMemoryPtr& GetSharedConstantsWorkspace() const {
+        return memConstWorkspace;
+    }
+
+    /**
+     * Primitive descriptors to use instead of selecting the optimal ones, if they are still supported.
+     * Should be called before CreateGraph.
+     */
+    void SetPrimitivesSelection(const PrimitivesSelection& selection) { primitivesSelection = selection; }
+
+    const PrimitivesSelection& GetPrimitivesSelection() const {
+        return primitivesSelection;
+    }
+
 protected:
     void VisitNode(MKLDNNNodePtr node, std::vector<MKLDNNNodePtr>& sortedNodes);
     void SortTopologically();
@@ -132,9 +199,13 @@ protected:
 
         inputNodes.clear();
         outputNodes.clear();
+        memoryNodes.clear();
         graphNodes.clear();
         graphEdges.clear();
         _meanImages.clear();
+        _inputConvertBuffers.clear();
+        execLevels.clear();
+        parallelLevels.clear();
     }
     Status status;
     Config config;
@@ -145,16 +216,35 @@ protected:
 
     bool reuse_io_tensors = true;
 
+    size_t copiedBytes = 0;
+
     MKLDNNMemoryPtr memWorkspace;
 
+    std::string sharedConstKey;
+    MKLDNNMemoryPtr memConstWorkspace;
+    // false if constant data lives in the shared arena which was filled by another graph
+    bool fillConstants = true;
+
+    PrimitivesSelection primitivesSelection;
+
     std::map<std::string, MKLDNNNodePtr> inputNodes;
     std::vector<MKLDNNNodePtr> outputNodes;
+    // MemoryInput and MemoryOutput nodes by the memory id
+    std::map<std::string, std::pair<MKLDNNNodePtr, MKLDNNNodePtr>> memoryNodes;
     std::vector<MKLDNNNodePtr> graphNodes;
     std::vector<MKLDNNEdgePtr> graphEdges;
 
     std::map<std::string, MeanImage> _meanImages;
+    // FP32 copies of integral inputs which can't be converted right into the input memory, kept between Infer calls
+    std::map<std::string, InferenceEngine::TBlob<float>::Ptr> _inputConvertBuffers;
     std::string _name;
 
+    // Level of each node (indexed by execIndex): the longest path from the graph inputs.
+    // Nodes of the same level don't depend on each other.
+    std::vector<int> execLevels;
+    // Nodes grouped by levels when independent branches are executed in parallel, empty for sequential execution
+    std::vector<std::vector<MKLDNNNodePtr>> parallelLevels;
+
     #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
     std::unique_ptr<tbb::task_arena> ptrArena;
     std::unique_ptr<tbb::task_scheduler_observer> ptrObserver;
@@ -169,12 +259,17 @@ protected:
     void Allocate();
     void AllocateWithReuse();
     void CreatePrimitives();
+    void InitParallelSchedule();
+    // Position of the node in the execution schedule used for the memory reuse
+    int getExecTimestamp(const MKLDNNNodePtr &node) const;
+    void ExecuteNode(const MKLDNNNodePtr &node, mkldnn::stream &stream, int batch);
 
     void do_before(const std::string &dir, const MKLDNNNodePtr &node);
     void do_after(const std::string &dir, const MKLDNNNodePtr &node);
 
     friend class MKLDNNInferRequest;
     friend class MKLDNNGraphlessInferRequest;
+    friend class MKLDNNRequestsBatcher;
     friend std::shared_ptr<InferenceEngine::ICNNNetwork> dump_graph_as_ie_net(const MKLDNNGraph &graph);
 
 private:
@@ -199,7 +294,15 @@ public:
     MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network, const Config &cfg,
                       const MKLDNNExtensionManager::Ptr& extMgr);
 
+    /**
+     * Creates executable network from the network which has already been transformed by the plugin,
+     * e.g. the one restored by MKLDNNModelSerial::Import
+     */
+    MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &preparedNetwork, const Config &cfg,
+                      const MKLDNNExtensionManager::Ptr& extMgr, const PrimitivesSelection &selection);
+
     ~MKLDNNExecNetwork() {
+        batcher.reset();
         graphs.clear();
         extensionManager.reset();
     }
@@ -212,11 +315,27 @@ public:
 
     void GetExecGraphInfo(InferenceEngine::ICNNNetwork::Ptr &graphPtr) override;
 
+    void Export(const std::string &modelFileName) override;
+
+    /**
+     * @brief States of the memory layers, they reset and set the states of all requests created by the network
+     */
+    std::vector<InferenceEngine::IMemoryStateInternal::Ptr> QueryState() override {
+        return {memoryStates.begin(), memoryStates.end()};
+    }
+
 protected:
     std::vector<MKLDNNGraph::Ptr> graphs;
+    std::vector<MKLDNNNetworkMemoryState::Ptr> memoryStates;
     MKLDNNExtensionManager::Ptr extensionManager;
+    // coalesces concurrent requests when CPU batching is enabled
+    std::shared_ptr<MKLDNNRequestsBatcher> batcher;
+    // network after plugin transformations, graphs are created from it
+    InferenceEngine::details::CNNNetworkImplPtr clonedNetwork;
 
     bool CanProcessDynBatch(const InferenceEngine::ICNNNetwork &network) const;
+    static bool IsBatchingEnabled(const Config &cfg);
+    void CreateGraphs(const Config &cfg, const PrimitivesSelection &selection);
 };
 
 }  // namespace MKLDNNPlugin
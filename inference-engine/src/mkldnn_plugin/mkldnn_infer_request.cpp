@@ -10,6 +10,7 @@
 #include <map>
 #include <blob_factory.hpp>
 #include <nodes/mkldnn_concat_node.h>
+#include <nodes/mkldnn_reshape_node.h>
 #include <nodes/mkldnn_split_node.h>
 #include <ie_compound_blob.h>
 
@@ -37,13 +38,26 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
     if (!graph || !graph->IsReady()) {
         THROW_IE_EXCEPTION << "Network not loaded.";
     }
+    if (batcher) {
+        // the request is executed as a part of a batch, the graph is driven by the batcher
+        execDataPreprocessing(_inputs);
+        for (auto input : _inputs) {
+            if (!_networkInputs[input.first]) {
+                THROW_IE_EXCEPTION <<
+                                   "input blobs map contains not registered during IInferencePlugin::LoadNetwork blob with name "
+                                   << input.first;
+            }
+        }
+        batcher->Infer(_inputs, _outputs);
+        return;
+    }
+
     auto infer = [this] {
         // execute input pre-processing.
         execDataPreprocessing(_inputs);
 
         changeDefaultPtr();
-        // need to retain converted blobs until infer finish
-        std::vector<InferenceEngine::Blob::Ptr> convertedInputs;
+        graph->ResetCopiedBytes();
         for (auto input : _inputs) {
             if (!_networkInputs[input.first]) {
                 THROW_IE_EXCEPTION <<
@@ -51,8 +65,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
                                    << input.first;
             }
 
-            InferenceEngine::Blob::Ptr iconv;
-            InferenceEngine::TBlob<float> *in_f = nullptr;
+            // U16 inputs and U8/I16 ones with mean image are converted to FP32 by the graph itself
             switch (input.second->getTensorDesc().getPrecision()) {
                 case InferenceEngine::Precision::FP32:
                     pushInput<float>(input.first, input.second);
@@ -64,60 +77,24 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
                     pushInput<int8_t>(input.first, input.second);
                     break;
                 case InferenceEngine::Precision::U16:
-                    // U16 is unsupported by mkldnn, so here we convert the blob and send FP32
-                    iconv = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32,
-                                                                      input.second->getTensorDesc().getDims(),
-                                                                      input.second->getTensorDesc().getLayout()});
-                    convertedInputs.push_back(iconv);
-                    iconv->allocate();
-                    in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                    if (in_f == nullptr)
-                        THROW_IE_EXCEPTION << "Cannot get TBlob";
-                    InferenceEngine::copyToFloat<uint16_t>(in_f->data(), input.second.get());
-                    pushInput<float>(input.first, iconv);
+                    pushInput<uint16_t>(input.first, input.second);
                     break;
                 case InferenceEngine::Precision::I16:
-                    if (graph->hasMeanImageFor(input.first)) {
-                        // If a mean image exists, we convert the blob and send FP32
-                        iconv = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32,
-                                                                          input.second->getTensorDesc().getDims(),
-                                                                          input.second->getTensorDesc().getLayout()});
-                        convertedInputs.push_back(iconv);
-                        iconv->allocate();
-                        in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                        if (in_f == nullptr)
-                            THROW_IE_EXCEPTION << "Cannot get TBlob";
-                        InferenceEngine::copyToFloat<int16_t>(in_f->data(), input.second.get());
-                        pushInput<float>(input.first, iconv);
-                    } else {
-                        // Instead we can send I16 directly
-                        pushInput<int16_t>(input.first, input.second);
-                    }
+                    pushInput<int16_t>(input.first, input.second);
                     break;
                 case InferenceEngine::Precision::U8:
-                    if (graph->hasMeanImageFor(input.first)) {
-                        // If a mean image exists, we convert the blob and send FP32
-                        iconv = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32,
-                                                                          input.second->getTensorDesc().getDims(),
-                                                                          input.second->getTensorDesc().getLayout()});
-                        convertedInputs.push_back(iconv);
-                        iconv->allocate();
-                        in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                        if (in_f == nullptr)
-                            THROW_IE_EXCEPTION << "Cannot get TBlob";
-                        InferenceEngine::copyToFloat<uint8_t>(in_f->data(), input.second.get());
-                        pushInput<float>(input.first, iconv);
-                    } else {
-                        // Instead we can send I8 directly
-                        pushInput<uint8_t>(input.first, input.second);
-                    }
+                    pushInput<uint8_t>(input.first, input.second);
                     break;
                 default:
                     THROW_IE_EXCEPTION << "Unsupported input precision " << input.second->getTensorDesc().getPrecision();
             }
         }
+        size_t stateBytes = graph->BindMemoryStates(memoryStates);
         graph->Infer(m_curBatch);
         graph->PullOutputData(_outputs);
+        for (auto &state : memoryStates)
+            state->swap();
+        copiedBytes = graph->GetCopiedBytes() + stateBytes;
     };
 #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
     auto_scope_observing observer(graph->ptrObserver);
@@ -168,8 +145,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
 
         _inputs[name] = make_blob_with_precision(desc);
         _inputs[name]->allocate();
-        if (desc.getPrecision() == originPrecision &&
-                graph->_meanImages.find(name) == graph->_meanImages.end() && !graph->getProperty().batchLimit) {
+        if (desc.getPrecision() == originPrecision && canBeBound(name, _inputs[name], true)) {
             externalPtr[name] = _inputs[name]->buffer();
         }
         data = _inputs[name];
@@ -186,10 +162,11 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
             return;
         }
 
-        _outputs[name] = make_blob_with_precision(blobs[name]->getTensorDesc());
+        // with batching the graph outputs hold the whole batch, while the request gets a single sample
+        _outputs[name] = make_blob_with_precision(batcher ? _networkOutputs[name]->getTensorDesc()
+                                                          : blobs[name]->getTensorDesc());
         _outputs[name]->allocate();
-        if (blobs[name]->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
-                !graph->getProperty().batchLimit) {
+        if (canBeBound(name, _outputs[name], false)) {
             externalPtr[name] = _outputs[name]->buffer();
         }
         data = _outputs[name];
@@ -243,8 +220,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const Inference
                 THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set input Blob. Dimensions mismatch.";
             }
 
-            if (data->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
-                graph->_meanImages.find(name) == graph->_meanImages.end() && !graph->getProperty().batchLimit) {
+            if (canBeBound(name, data, true)) {
                 externalPtr[name] = data->buffer();
             } else if (externalPtr.find(name) != externalPtr.end()) {
                 externalPtr.erase(name);
@@ -268,8 +244,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const Inference
             THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str
                                << "Failed to set Blob with precision not corresponding to user output precision";
         }
-        if (data->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
-                !graph->getProperty().batchLimit) {
+        if (canBeBound(name, data, false)) {
             externalPtr[name] = data->buffer();
         } else if (externalPtr.find(name) != externalPtr.end()) {
             externalPtr.erase(name);
@@ -278,78 +253,167 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const Inference
     }
 }
 
+static inline void *getEdgePtr(const MKLDNNPlugin::MKLDNNEdgePtr &edge) {
+    return edge->getMemory().GetPrimitive().get_data_handle();
+}
+
 static inline void changeEdgePtr(const MKLDNNPlugin::MKLDNNEdgePtr &edge, void *newPtr) {
     edge->getMemory().GetPrimitivePtr()->set_data_handle(newPtr);
 }
 
-void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
-    for (auto& it : externalPtr) {
-        auto input = graph->inputNodes.find(it.first);
-        if (input != graph->inputNodes.end()) {
-            if (input->second->getChildEdgeAt(0)->getMemory().GetPrimitive().get_data_handle() == it.second)
-                continue;
-            // Input cannot be in-place with other primitives
-            bool canBeInPlace = true;
-            for (size_t i = 0; canBeInPlace && i < input->second->getChildEdges().size(); i++) {
-                auto& child = input->second->getChildEdgeAt(i)->getChild();
-                if (child->isConstant())
-                    canBeInPlace = false;
-                auto* concat = dynamic_cast<MKLDNNConcatNode *>(child.get());
-                if (canBeInPlace && concat && concat->isOptimized())
-                    canBeInPlace = false;
-                // Cannot be in-place before split because split is using different ptrs without offsets
-                auto* split = dynamic_cast<MKLDNNSplitNode *>(child.get());
-                if (canBeInPlace && split)
-                    canBeInPlace = false;
-
-                if (child->isInplace())
-                    canBeInPlace = false;
-                for (size_t j = 0; canBeInPlace && j < child->getChildEdges().size(); j++) {
-                    if (child->getChildEdgeAt(j)->getMemory().GetPrimitive().get_data_handle() ==
-                            input->second->getChildEdgeAt(i)->getMemory().GetPrimitive().get_data_handle())
-                        canBeInPlace = false;
-                }
-            }
-            for (size_t i = 0; canBeInPlace && i < input->second->getChildEdges().size(); i++) {
-                changeEdgePtr(input->second->getChildEdgeAt(i), it.second);
-            }
+// True if the node neither writes into nor aliases the memory it reads
+static bool readsOnly(const MKLDNNPlugin::MKLDNNNodePtr &node, void *ptr) {
+    if (node->isInplace())
+        return false;
+    for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+        if (getEdgePtr(node->getChildEdgeAt(i)) == ptr)
+            return false;
+    }
+    return true;
+}
+
+// True if the node only reinterprets the dims of its input, so its output is the same memory
+static bool isAlias(const MKLDNNPlugin::MKLDNNNodePtr &node) {
+    return dynamic_cast<MKLDNNPlugin::MKLDNNReshapeNode *>(node.get()) && node->isInplace() &&
+           getEdgePtr(node->getParentEdgeAt(0)) == getEdgePtr(node->getChildEdgeAt(0));
+}
+
+// Outputs of an optimized Split are views of its input with offsets kept in memory descriptors,
+// so they move to the new pointer together with it. The same holds for outputs of an in place Reshape.
+bool MKLDNNPlugin::collectInputViews(const MKLDNNEdgePtr &edge, std::vector<MKLDNNEdgePtr> &views) {
+    auto child = edge->getChild();
+    if (child->isConstant())
+        return false;
+
+    void *ptr = getEdgePtr(edge);
+    auto* split = dynamic_cast<MKLDNNPlugin::MKLDNNSplitNode *>(child.get());
+    if ((split && split->isOptimized()) || isAlias(child)) {
+        for (size_t i = 0; i < child->getChildEdges().size(); i++) {
+            auto childEdge = child->getChildEdgeAt(i);
+            if (getEdgePtr(childEdge) != ptr || !collectInputViews(childEdge, views))
+                return false;
+        }
+    } else if (!readsOnly(child, ptr)) {
+        // e.g. an optimized Concat would need the input right in its own memory
+        return false;
+    }
+    views.push_back(edge);
+    return true;
+}
+
+// Inputs of an optimized Concat are views of its output with offsets kept in memory descriptors,
+// so their producers write right into the new pointer. An in place Reshape passes the memory of its producer.
+bool MKLDNNPlugin::collectOutputViews(const MKLDNNEdgePtr &edge, std::vector<MKLDNNEdgePtr> &views) {
+    auto parent = edge->getParent();
+    if (parent->isConstant())
+        return false;
+
+    void *ptr = getEdgePtr(edge);
+    for (size_t i = 0; i < parent->getChildEdges().size(); i++) {
+        auto sibling = parent->getChildEdgeAt(i);
+        if (sibling == edge || getEdgePtr(sibling) != ptr)
+            continue;
+        if (isAlias(sibling->getChild())) {
+            if (!collectInputViews(sibling, views))
+                return false;
             continue;
         }
+        if (!readsOnly(sibling->getChild(), ptr))
+            return false;
+        views.push_back(sibling);
+    }
 
+    auto* concat = dynamic_cast<MKLDNNPlugin::MKLDNNConcatNode *>(parent.get());
+    if (concat && concat->isOptimized()) {
+        for (size_t i = 0; i < concat->getParentEdges().size(); i++) {
+            auto concatEdge = concat->getParentEdgeAt(i);
+            if (!concatEdge || getEdgePtr(concatEdge) != ptr || !collectOutputViews(concatEdge, views))
+                return false;
+        }
+    } else if (isAlias(parent)) {
+        if (!collectOutputViews(parent->getParentEdgeAt(0), views))
+            return false;
+    } else if (parent->isInplace()) {
+        return false;
+    }
+    views.push_back(edge);
+    return true;
+}
+
+bool MKLDNNPlugin::MKLDNNInferRequest::canBeBound(const std::string &name, const InferenceEngine::Blob::Ptr &blob,
+                                                  bool isInput) const {
+    MKLDNNEdgePtr edge;
+    if (isInput) {
+        // mean image is subtracted in place, that must not change user data
+        auto input = graph->inputNodes.find(name);
+        if (input == graph->inputNodes.end() || graph->_meanImages.find(name) != graph->_meanImages.end())
+            return false;
+        edge = input->second->getChildEdgeAt(0);
+    } else {
+        for (auto &out : graph->outputNodes) {
+            if (out->getName() == "out_" + name) {
+                edge = out->getParentEdgeAt(0);
+                break;
+            }
+        }
+        if (!edge)
+            return false;
+    }
+
+    // the user blob must be laid out exactly as the graph memory it replaces
+    const InferenceEngine::TensorDesc &desc = blob->getTensorDesc();
+    InferenceEngine::TensorDesc edgeDesc;
+    try {
+        edgeDesc = MKLDNNMemoryDesc(edge->getMemory().GetDescriptor());
+    } catch (const InferenceEngine::details::InferenceEngineException&) {
+        // memory format or precision which has no TensorDesc counterpart
+        return false;
+    }
+    return desc.getPrecision() == edgeDesc.getPrecision() &&
+           desc.getBlockingDesc() == edgeDesc.getBlockingDesc() &&
+           blob->byteSize() == edge->getMemory().GetSize();
+}
+
+bool MKLDNNPlugin::MKLDNNInferRequest::changeEdgesPtr(const std::string &name, void *ptr) {
+    std::vector<MKLDNNEdgePtr> views;
+
+    auto input = graph->inputNodes.find(name);
+    if (input != graph->inputNodes.end()) {
+        for (size_t i = 0; i < input->second->getChildEdges().size(); i++) {
+            if (!collectInputViews(input->second->getChildEdgeAt(i), views))
+                return false;
+        }
+    } else {
         MKLDNNNodePtr output;
         for (auto& out : graph->outputNodes) {
-            if (out->getName() == "out_" + it.first) {
+            if (out->getName() == "out_" + name) {
                 output = out;
                 break;
             }
         }
-        if (output) {
-            if (output->getParentEdgeAt(0)->getMemory().GetPrimitive().get_data_handle() == it.second)
-                continue;
-            bool canBeInPlace = true;
-            void * defaultPtr = output->getParentEdgeAt(0)->getMemory().GetPrimitivePtr()->get_data_handle();
-            // Cannot be in-place after concat because concat is using different ptrs without offsets
-            auto parent = output->getParentEdgeAt(0)->getParent();
-            MKLDNNNodePtr previousParent;
-            do {
-                previousParent = parent;
-                if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInplace()) {
-                    canBeInPlace = false;
-                    break;
-                }
-
-                for (size_t i = 0; i < parent->getParentEdges().size(); i++) {
-                    if (parent->getParentEdgeAt(i)->getMemory().GetPrimitivePtr()->get_data_handle() == defaultPtr) {
-                        parent = parent->getParentEdgeAt(i)->getParent();
-                        break;
-                    }
-                }
-            } while (previousParent != parent);
-            if (canBeInPlace)
-                changeEdgePtr(output->getParentEdgeAt(0), it.second);
-            continue;
-        }
-        THROW_IE_EXCEPTION << "Cannot find input/output blob: " << it.first;
+        if (!output)
+            THROW_IE_EXCEPTION << "Cannot find input/output blob: " << name;
+        if (!collectOutputViews(output->getParentEdgeAt(0), views))
+            return false;
+    }
+
+    if (views.empty() || getEdgePtr(views.back()) == ptr)
+        return true;
+
+    // remember the graph own memory to switch back to it when another blob is set
+    defaultPtr.insert({name, getEdgePtr(views.back())});
+    for (auto &edge : views)
+        changeEdgePtr(edge, ptr);
+    return true;
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
+    for (auto& it : defaultPtr) {
+        if (externalPtr.find(it.first) == externalPtr.end())
+            changeEdgesPtr(it.first, it.second);
+    }
+    for (auto& it : externalPtr) {
+        changeEdgesPtr(it.first, it.second);
     }
 }
 
@@ -370,7 +434,13 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetGraph(const MKLDNNPlugin::MKLDNNGraph:
     }
 }
 
+void MKLDNNPlugin::MKLDNNInferRequest::SetBatcher(const MKLDNNRequestsBatcher::Ptr& batcher) {
+    this->batcher = batcher;
+}
+
 void MKLDNNPlugin::MKLDNNInferRequest::SetBatch(int new_batch) {
+    if (batcher)
+        THROW_IE_EXCEPTION << "Dynamic batch is not supported together with CPU batching.";
     if (!graph->getProperty().enableDynamicBatch)
         THROW_IE_EXCEPTION << "Dynamic batch is not enabled.";
 
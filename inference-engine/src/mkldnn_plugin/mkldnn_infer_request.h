@@ -5,13 +5,27 @@
 #pragma once
 
 #include "mkldnn_graph.h"
+#include "mkldnn_batching.h"
 #include <memory>
 #include <string>
 #include <map>
+#include <vector>
 #include <cpp_interfaces/impl/ie_infer_request_internal.hpp>
 
 namespace MKLDNNPlugin {
 
+/**
+ * @brief Collects edges sharing the memory of an input edge (of the network or a memory layer) which can be
+ * switched to another pointer, false if some consumer writes into the memory or works in place
+ */
+bool collectInputViews(const MKLDNNEdgePtr &edge, std::vector<MKLDNNEdgePtr> &views);
+
+/**
+ * @brief Collects edges sharing the memory of an output edge (of the network or a subgraph) which can be
+ * switched to another pointer, false if the memory is shared with a node working in place
+ */
+bool collectOutputViews(const MKLDNNEdgePtr &edge, std::vector<MKLDNNEdgePtr> &views);
+
 class MKLDNNInferRequest : public InferenceEngine::InferRequestInternal {
 public:
     typedef std::shared_ptr<MKLDNNInferRequest> Ptr;
@@ -38,13 +52,40 @@ public:
 
     void SetGraph(const MKLDNNGraph::Ptr& graph);
 
+    void SetBatcher(const MKLDNNRequestsBatcher::Ptr& batcher);
+
     void SetBatch(int batch = -1) override;
 
+    /**
+     * @brief Sets the states of the memory layers owned by the request
+     */
+    void SetMemoryStates(const std::vector<MKLDNNMemoryState::Ptr> &states) {
+        memoryStates = states;
+    }
+
+    std::vector<InferenceEngine::IMemoryStateInternal::Ptr> QueryState() override {
+        return {memoryStates.begin(), memoryStates.end()};
+    }
+
+    /**
+     * @brief Returns the number of input, output and memory state bytes copied by the last inference
+     */
+    size_t GetCopiedBytes() const {
+        return copiedBytes;
+    }
+
 private:
     template <typename T> void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob);
 
+    bool canBeBound(const std::string& name, const InferenceEngine::Blob::Ptr& blob, bool isInput) const;
+    bool changeEdgesPtr(const std::string& name, void* ptr);
     void changeDefaultPtr();
     MKLDNNGraph::Ptr graph;
+    MKLDNNRequestsBatcher::Ptr batcher;
+    // user blobs bound to graph edges instead of copying, and graph own pointers of those edges
     std::map<std::string, void*> externalPtr;
+    std::map<std::string, void*> defaultPtr;
+    std::vector<MKLDNNMemoryState::Ptr> memoryStates;
+    size_t copiedBytes = 0;
 };
 }  // namespace MKLDNNPlugin
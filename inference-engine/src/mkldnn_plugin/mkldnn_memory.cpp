@@ -99,7 +99,7 @@ void MKLDNNMemory::SetData(memory::data_type dataType, memory::format format, co
         memcpy(dataPtr, data, size);
     }
 
-    if (ftz && dataType == mkldnn_f32) {
+    if (ftz && dataType == mkldnn_f32 && GetDataType() == mkldnn_f32) {
         // Internal blobs haven't strides yet.
         auto *memData = static_cast<float *>(GetData());
         memData += prim->get_primitive_desc().desc().data.layout_desc.blocking.offset_padding;
@@ -116,7 +116,8 @@ void MKLDNNMemory::SetData(const MKLDNNMemory& memory, bool ftz) const {
     mkldnn::reorder reorderPrim(memory.GetPrimitive(), GetPrimitive());
     mkldnn::stream(stream::kind::eager).submit({reorderPrim});
 
-    if (ftz && memory.GetDataType() == mkldnn::memory::f32 && GetFormat() != mkldnn::memory::wino_fmt) {
+    if (ftz && memory.GetDataType() == mkldnn::memory::f32 && GetDataType() == mkldnn::memory::f32 &&
+            GetFormat() != mkldnn::memory::wino_fmt) {
         // Internal blobs haven't strides yet.
         auto *memData = static_cast<float *>(GetData());
         memData += prim->get_primitive_desc().desc().data.layout_desc.blocking.offset_padding;
@@ -458,6 +459,9 @@ MKLDNNMemoryDesc::operator InferenceEngine::TensorDesc() const {
         case mkldnn_s16:
             precision = Precision::I16;
             break;
+        case mkldnn_bf16:
+            precision = Precision::BF16;
+            break;
         case mkldnn_s32:
             precision = Precision::I32;
             break;
@@ -632,6 +636,9 @@ MKLDNNMemoryDesc::MKLDNNMemoryDesc(const TensorDesc& tDesc):
         case Precision::I16:
             data_type = mkldnn::memory::data_type::s16;
             break;
+        case Precision::BF16:
+            data_type = mkldnn::memory::data_type::bf16;
+            break;
         case Precision::I32:
             data_type = mkldnn::memory::data_type::s32;
             break;
@@ -0,0 +1,82 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_memory_state.h"
+#include <atomic>
+#include <cstring>
+#include <algorithm>
+#include <blob_factory.hpp>
+#include <ie_memcpy.h>
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+MKLDNNMemoryState::MKLDNNMemoryState(const std::string &name, const TensorDesc &desc) : name(name) {
+    current = make_blob_with_precision(desc);
+    current->allocate();
+    next = make_blob_with_precision(desc);
+    next->allocate();
+    Reset();
+}
+
+void MKLDNNMemoryState::Reset() {
+    std::memset(current->buffer(), 0, current->byteSize());
+}
+
+void MKLDNNMemoryState::SetState(Blob::Ptr newState) {
+    if (!newState || newState->cbuffer() == nullptr)
+        THROW_IE_EXCEPTION << "Cannot set empty state of memory layer " << name;
+    if (newState->getTensorDesc().getPrecision() != current->getTensorDesc().getPrecision() ||
+        newState->byteSize() != current->byteSize())
+        THROW_IE_EXCEPTION << "State of memory layer " << name << " must be " << current->size() << " elements of "
+                           << current->getTensorDesc().getPrecision() << ", but got " << newState->size()
+                           << " elements of " << newState->getTensorDesc().getPrecision();
+    ie_memcpy(current->buffer(), current->byteSize(), newState->cbuffer(), newState->byteSize());
+}
+
+void MKLDNNMemoryState::swap() {
+    static std::atomic<uint64_t> updates(0);
+    std::swap(current, next);
+    updated = ++updates;
+}
+
+void MKLDNNNetworkMemoryState::addRequestState(const MKLDNNMemoryState::Ptr &state) {
+    std::lock_guard<std::mutex> lock(mutex);
+    // forget the states of the released requests
+    states.erase(std::remove_if(states.begin(), states.end(), [](const std::weak_ptr<MKLDNNMemoryState> &s) {
+        return s.expired();
+    }), states.end());
+    states.push_back(state);
+}
+
+std::vector<MKLDNNMemoryState::Ptr> MKLDNNNetworkMemoryState::aliveStates() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<MKLDNNMemoryState::Ptr> result;
+    for (auto &state : states) {
+        if (auto s = state.lock())
+            result.push_back(s);
+    }
+    return result;
+}
+
+void MKLDNNNetworkMemoryState::Reset() {
+    for (auto &state : aliveStates())
+        state->Reset();
+}
+
+void MKLDNNNetworkMemoryState::SetState(Blob::Ptr newState) {
+    for (auto &state : aliveStates())
+        state->SetState(newState);
+}
+
+Blob::CPtr MKLDNNNetworkMemoryState::GetLastState() const {
+    MKLDNNMemoryState::Ptr last;
+    for (auto &state : aliveStates()) {
+        if (!last || state->lastUpdate() > last->lastUpdate())
+            last = state;
+    }
+    if (!last)
+        THROW_IE_EXCEPTION << "There are no infer requests holding the state of memory layer " << name;
+    return last->GetLastState();
+}
@@ -0,0 +1,114 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <ie_blob.h>
+#include <cpp_interfaces/interface/ie_imemory_state_internal.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief State of a memory layer owned by an infer request.
+ *
+ * The state has two buffers: the current one is read by the MemoryInput node and the MemoryOutput node writes
+ * the new state into the other one, after the inference the buffers are swapped. So the graph shared by
+ * the requests reads and updates the state of the running request without copying it in and out.
+ */
+class MKLDNNMemoryState : public InferenceEngine::IMemoryStateInternal {
+public:
+    typedef std::shared_ptr<MKLDNNMemoryState> Ptr;
+
+    MKLDNNMemoryState(const std::string &name, const InferenceEngine::TensorDesc &desc);
+
+    std::string GetName() const override {
+        return name;
+    }
+
+    void Reset() override;
+
+    void SetState(InferenceEngine::Blob::Ptr newState) override;
+
+    /**
+     * @note the blob is valid until the next inference of the request, it keeps the state written by the last one
+     */
+    InferenceEngine::Blob::CPtr GetLastState() const override {
+        return current;
+    }
+
+    void *currentBuffer() const {
+        return current->buffer();
+    }
+
+    void *nextBuffer() const {
+        return next->buffer();
+    }
+
+    size_t byteSize() const {
+        return current->byteSize();
+    }
+
+    /**
+     * @brief Makes the state written by the inference current
+     */
+    void swap();
+
+    /**
+     * @brief Sequence number of the last update among the states of all requests, 0 if never updated
+     */
+    uint64_t lastUpdate() const {
+        return updated;
+    }
+
+private:
+    std::string name;
+    InferenceEngine::Blob::Ptr current;
+    InferenceEngine::Blob::Ptr next;
+    uint64_t updated = 0;
+};
+
+/**
+ * @brief State of a memory layer as seen from the executable network, the states of all requests created
+ * by the network. It must not be used while the requests are running.
+ */
+class MKLDNNNetworkMemoryState : public InferenceEngine::IMemoryStateInternal {
+public:
+    typedef std::shared_ptr<MKLDNNNetworkMemoryState> Ptr;
+
+    explicit MKLDNNNetworkMemoryState(const std::string &name) : name(name) {}
+
+    void addRequestState(const MKLDNNMemoryState::Ptr &state);
+
+    std::string GetName() const override {
+        return name;
+    }
+
+    /**
+     * @brief Resets the state of every request
+     */
+    void Reset() override;
+
+    /**
+     * @brief Sets the state of every request
+     */
+    void SetState(InferenceEngine::Blob::Ptr newState) override;
+
+    /**
+     * @brief The state of the request which was inferred the last
+     */
+    InferenceEngine::Blob::CPtr GetLastState() const override;
+
+private:
+    std::vector<MKLDNNMemoryState::Ptr> aliveStates() const;
+
+    std::string name;
+    mutable std::mutex mutex;
+    std::vector<std::weak_ptr<MKLDNNMemoryState>> states;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,222 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_model_serial.h"
+
+#include <cstring>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include <ie_icnn_net_reader.h>
+#include <details/ie_exception.hpp>
+#include <details/ie_irelease.hpp>
+#include "network_serializer.h"
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+
+const char mkldnnHeaderMagic[4] = {'M', 'K', 'D', 'N'};
+
+template <class T>
+inline void writeBits(const T & obj, std::ostream & os) {
+    os.write(reinterpret_cast<const char *>(&obj), sizeof(T));
+}
+
+template <class T>
+inline void readBits(T & obj, std::istream & is) {
+    is.read(reinterpret_cast<char *>(&obj), sizeof(T));
+}
+
+inline void writeString(const std::string & str, std::ostream & os) {
+    writeBits(static_cast<uint64_t>(str.size()), os);
+    os.write(str.data(), str.size());
+}
+
+inline std::string readString(std::istream & is) {
+    uint64_t size = 0ull;
+    readBits(size, is);
+    std::string str(static_cast<size_t>(size), '\0');
+    is.read(&str[0], size);
+    return str;
+}
+
+}  // namespace
+
+void MKLDNNModelSerial::Export(std::ostream &os,
+                               const ICNNNetwork &network,
+                               const InputsDataMap &inputs,
+                               const OutputsDataMap &outputs,
+                               const std::map<std::string, std::string> &config,
+                               const PrimitivesSelection &selection) {
+    std::stringstream xml, weights;
+    details::NetworkSerializer::serialize(xml, weights, network);
+    const std::string xmlStr = xml.str();
+    const std::string weightsStr = weights.str();
+
+    MKLDNNModelHeader header;
+    std::memcpy(header.magic, mkldnnHeaderMagic, sizeof(header.magic));
+    header.headerSize = sizeof(header);
+    header.version.major = MKLDNN_HEADER_MAJOR;
+    header.version.minor = MKLDNN_HEADER_MINOR;
+    header.xmlSize = xmlStr.size();
+    header.weightsSize = weightsStr.size();
+    writeBits(header, os);
+
+    writeBits(static_cast<uint32_t>(config.size()), os);
+    for (const auto &item : config) {
+        writeString(item.first, os);
+        writeString(item.second, os);
+    }
+
+    writeBits(static_cast<uint32_t>(inputs.size()), os);
+    for (const auto &input : inputs) {
+        writeString(input.first, os);
+        writeString(input.second->getPrecision().name(), os);
+        writeBits(static_cast<int32_t>(input.second->getLayout()), os);
+        writeBits(static_cast<int32_t>(input.second->getPreProcess().getResizeAlgorithm()), os);
+        writeBits(static_cast<int32_t>(input.second->getPreProcess().getColorFormat()), os);
+    }
+
+    writeBits(static_cast<uint32_t>(outputs.size()), os);
+    for (const auto &output : outputs) {
+        writeString(output.first, os);
+        writeString(output.second->getPrecision().name(), os);
+        writeBits(static_cast<int32_t>(output.second->getLayout()), os);
+    }
+
+    writeBits(static_cast<uint32_t>(selection.size()), os);
+    for (const auto &item : selection) {
+        writeString(item.first, os);
+        writeBits(static_cast<int32_t>(item.second.index), os);
+        writeBits(static_cast<int32_t>(item.second.type), os);
+    }
+
+    os.write(xmlStr.data(), xmlStr.size());
+    os.write(weightsStr.data(), weightsStr.size());
+    if (!os.good())
+        THROW_IE_EXCEPTION << "Cannot write exported model";
+}
+
+MKLDNNModelSerial::ImportedModel MKLDNNModelSerial::Import(std::istream &is) {
+    is.exceptions(std::istream::failbit);
+
+    MKLDNNModelHeader header;
+    readBits(header, is);
+    if (std::memcmp(header.magic, mkldnnHeaderMagic, sizeof(header.magic)) != 0) {
+        THROW_IE_EXCEPTION << "Imported file unsupported: magic number should be MKDN";
+    }
+    if (header.version.major != MKLDNN_HEADER_MAJOR) {
+        THROW_IE_EXCEPTION << "Imported file unsupported: major version should be " << MKLDNN_HEADER_MAJOR
+                           << ", but was " << header.version.major;
+    }
+    if (header.headerSize < sizeof(header)) {
+        THROW_IE_EXCEPTION << "Unsupported header size minimal value is : " << sizeof(header)
+                           << ", but read: " << header.headerSize;
+    }
+    //  forward compatible
+    if (header.headerSize > sizeof(header)) {
+        is.seekg(header.headerSize - sizeof(header), std::ios_base::cur);
+    }
+
+    ImportedModel model;
+
+    uint32_t count = 0u;
+    readBits(count, is);
+    for (uint32_t i = 0; i < count; i++) {
+        auto key = readString(is);
+        model.config[key] = readString(is);
+    }
+
+    struct PortInfo {
+        Precision precision;
+        Layout layout;
+        ResizeAlgorithm resizeAlgorithm;
+        ColorFormat colorFormat;
+    };
+    std::map<std::string, PortInfo> inputs, outputs;
+
+    readBits(count, is);
+    for (uint32_t i = 0; i < count; i++) {
+        auto name = readString(is);
+        PortInfo &info = inputs[name];
+        info.precision = Precision::FromStr(readString(is));
+        int32_t value = 0;
+        readBits(value, is);
+        info.layout = static_cast<Layout>(value);
+        readBits(value, is);
+        info.resizeAlgorithm = static_cast<ResizeAlgorithm>(value);
+        readBits(value, is);
+        info.colorFormat = static_cast<ColorFormat>(value);
+    }
+
+    readBits(count, is);
+    for (uint32_t i = 0; i < count; i++) {
+        auto name = readString(is);
+        PortInfo &info = outputs[name];
+        info.precision = Precision::FromStr(readString(is));
+        int32_t value = 0;
+        readBits(value, is);
+        info.layout = static_cast<Layout>(value);
+    }
+
+    readBits(count, is);
+    for (uint32_t i = 0; i < count; i++) {
+        auto name = readString(is);
+        int32_t index = 0, type = 0;
+        readBits(index, is);
+        readBits(type, is);
+        model.selection[name] = {index, static_cast<impl_desc_type>(type)};
+    }
+
+    std::string xml(static_cast<size_t>(header.xmlSize), '\0');
+    is.read(&xml[0], header.xmlSize);
+
+    auto weightsSize = static_cast<size_t>(header.weightsSize);
+    TBlob<uint8_t>::Ptr weights = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {weightsSize}, Layout::C));
+    weights->allocate();
+    is.read(weights->buffer().as<char *>(), weightsSize);
+
+    auto reader = details::shared_from_irelease(CreateCNNNetReader());
+    ResponseDesc resp;
+    if (reader->ReadNetwork(xml.data(), xml.size(), &resp) != OK)
+        THROW_IE_EXCEPTION << resp.msg;
+    if (reader->SetWeights(weights, &resp) != OK)
+        THROW_IE_EXCEPTION << resp.msg;
+    model.network = CNNNetwork(reader);
+
+    InputsDataMap networkInputs = model.network.getInputsInfo();
+    for (const auto &input : inputs) {
+        auto found = networkInputs.find(input.first);
+        if (found == networkInputs.end())
+            THROW_IE_EXCEPTION << "Imported model has no input " << input.first;
+        found->second->setPrecision(input.second.precision);
+        found->second->setLayout(input.second.layout);
+        found->second->getPreProcess().setResizeAlgorithm(input.second.resizeAlgorithm);
+        found->second->getPreProcess().setColorFormat(input.second.colorFormat);
+    }
+
+    // intermediate outputs are not distinguishable in IR, so mark them explicitly
+    for (const auto &layer : model.network) {
+        for (size_t port = 0; port < layer->outData.size(); port++) {
+            auto &data = layer->outData[port];
+            if (outputs.find(data->getName()) != outputs.end() && !data->getInputTo().empty())
+                model.network.addOutput(layer->name, port);
+        }
+    }
+
+    OutputsDataMap networkOutputs = model.network.getOutputsInfo();
+    for (const auto &output : outputs) {
+        auto found = networkOutputs.find(output.first);
+        if (found == networkOutputs.end())
+            THROW_IE_EXCEPTION << "Imported model has no output " << output.first;
+        found->second->setPrecision(output.second.precision);
+        found->second->setLayout(output.second.layout);
+    }
+
+    return model;
+}
@@ -0,0 +1,97 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <istream>
+#include <ostream>
+#include <map>
+#include <string>
+
+#include <ie_icnn_network.hpp>
+#include <cpp/ie_cnn_network.h>
+#include "mkldnn/iml_type_mapper.h"
+
+/**
+ * version history
+ * 1.0 - transformed IR, config and selected primitive descriptors
+ */
+
+#define MKLDNN_HEADER_MAJOR 1
+#define MKLDNN_HEADER_MINOR 0
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Primitive descriptor chosen for a graph node: index in the list of supported descriptors
+ * and its implementation type which is used to check that the index is still valid on the target machine
+ */
+struct SelectedPrimitive {
+    int index;
+    impl_desc_type type;
+};
+
+typedef std::map<std::string, SelectedPrimitive> PrimitivesSelection;
+
+#pragma pack(push, 1)
+
+struct MKLDNNModelHeader {
+    /**
+     * @brief MagicNumber – MKDN in ascii table
+     */
+    char magic[4];
+    /**
+     * @brief Size of the header, bigger values mean that header was extended by a newer version
+     */
+    uint32_t headerSize = 0u;
+    struct Version {
+        /**
+         * @brief Any change of the layout of the sections requires increment of major version
+         */
+        uint16_t major = 0u;
+        uint32_t minor = 0u;
+    } version;
+    /**
+     * @brief Size of the IR xml section
+     */
+    uint64_t xmlSize = 0ull;
+    /**
+     * @brief Size of the IR weights section
+     */
+    uint64_t weightsSize = 0ull;
+};
+
+#pragma pack(pop)
+
+/**
+ * @brief Serializes network prepared by the CPU plugin for graph creation so it can be imported
+ * without applying network level transformations and primitive descriptors selection again
+ */
+class MKLDNNModelSerial {
+public:
+    struct ImportedModel {
+        InferenceEngine::CNNNetwork network;
+        std::map<std::string, std::string> config;
+        PrimitivesSelection selection;
+    };
+
+    /**
+     * @brief Writes the model into the stream
+     * @param network - network after all plugin transformations
+     * @param inputs - inputs info as set by user, describes precision, layout and preprocessing of the inputs
+     * @param outputs - outputs info as set by user
+     * @param config - configuration the network was compiled with
+     * @param selection - primitive descriptors selected for the graph nodes
+     */
+    static void Export(std::ostream &os,
+                       const InferenceEngine::ICNNNetwork &network,
+                       const InferenceEngine::InputsDataMap &inputs,
+                       const InferenceEngine::OutputsDataMap &outputs,
+                       const std::map<std::string, std::string> &config,
+                       const PrimitivesSelection &selection);
+
+    static ImportedModel Import(std::istream &is);
+};
+
+}  // namespace MKLDNNPlugin
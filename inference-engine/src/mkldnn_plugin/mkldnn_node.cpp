@@ -44,6 +44,7 @@
 #include "mkldnn_extension_utils.h"
 #include "mkldnn_plugin.h"
 #include "ie_memcpy.h"
+#include "../../thirdparty/mkl-dnn/src/common/primitive.hpp"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -395,6 +396,13 @@ std::vector<memory::format> MKLDNNNode::getAvailableFormatsForDims(const MKLDNND
     return {memory::format::any};
 }
 
+size_t MKLDNNNode::getScratchpadSize() {
+    if (!prim)
+        return 0;
+    const mkldnn_primitive *primitive = (*prim).get();
+    return primitive ? primitive->pd()->scratchpad_registry().size() : 0;
+}
+
 void MKLDNNNode::execute(mkldnn::stream strm) {
     if (prim) {
         strm.submit({*prim});
@@ -617,9 +625,11 @@ void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::pri
 
         const uint64_t data_hash = Engine::GetWeightsSharing(socket)->GetHashFunc().hash(
                 internalBlob->buffer(), internalBlob->byteSize());
+        // the same weights are stored differently by networks loaded in FP32 and BF16
         const std::string string_hash = name + "_" + std::to_string(i)
                                      + "_" + std::to_string(internalBlob->byteSize())
-                                     + "_" + std::to_string(data_hash);
+                                     + "_" + std::to_string(data_hash)
+                                     + "_" + std::to_string(intDescs[i].getDataType());
         MKLDNNMemoryPtr ptr =
                 Engine::GetWeightsSharing(socket)->findOrCreate(string_hash, [&] () {
                     MKLDNNMemoryPtr _ptr = MKLDNNMemoryPtr(new MKLDNNMemory(engine));
@@ -922,6 +932,19 @@ MKLDNNMemoryDesc MKLDNNNode::getDstMemDesc(mkldnn::primitive_desc_iterator &prim
                                                             desc.getBlockingDesc()));
 }
 
+bool MKLDNNNode::hasImplementations(const mkldnn::primitive_attr &attr) const {
+    for (auto& desc : descs) {
+        try {
+            desc.createPrimitiveDescriptorIterator(engine, attr);
+            return true;
+        } catch (std::exception& e) {
+            // it throw exception in case of no implementation found
+            continue;
+        }
+    }
+    return false;
+}
+
 int MKLDNNNode::batchToProcess() {
     return dynBatchLim == 0 ? getMaxBatch() : std::min<int>(getMaxBatch(), dynBatchLim);
 }
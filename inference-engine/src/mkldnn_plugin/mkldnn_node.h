@@ -365,8 +365,19 @@ public:
 
     virtual void setDynamicBatchLim(int lim);
 
+    /**
+     * @brief Lets the node run its FP32 computations in bfloat16 if it has such kernels
+     */
+    void setEnforceBF16(bool enforce) {
+        enforceBF16 = enforce;
+    }
+
     void resolveNotAllocatedEdges();
     virtual void execute(mkldnn::stream strm);
+    /**
+     * @brief Size of the global scratchpad the primitives of the node take from the thread executing them
+     */
+    virtual size_t getScratchpadSize();
     virtual void initSupportedPrimitiveDescriptors();
     virtual void createPrimitive() = 0;
 
@@ -467,6 +478,11 @@ protected:
 
     virtual std::shared_ptr<mkldnn::primitive_attr> initPrimitiveAttr() const { return nullptr; }
 
+    /**
+     * @brief Checks whether mkl-dnn has an implementation for any of the created descriptors
+     */
+    bool hasImplementations(const mkldnn::primitive_attr &attr) const;
+
     typedef std::function<MKLDNNMemoryDesc (mkldnn::primitive_desc_iterator &primitive_desc_it, size_t idx)>
             GetPrimitiveMemoryFormatFunc;
     std::vector<GetPrimitiveMemoryFormatFunc> internalBlobDesc;
@@ -483,6 +499,7 @@ protected:
     bool permanent = false;
     bool temporary = false;
     int dynBatchLim = 0;
+    bool enforceBF16 = false;
     enum class ConstantType {
         Unknown,
         Const,
@@ -5,9 +5,13 @@
 #include "ie_metric_helpers.hpp"
 #include "mkldnn_plugin.h"
 #include "mkldnn_extension_mngr.h"
+#include "mkldnn_model_serial.h"
 #include <cpp_interfaces/base/ie_plugin_base.hpp>
+#include <cpp_interfaces/base/ie_executable_network_base.hpp>
+#include <fstream>
 #include <memory>
 #include <ie_plugin_config.hpp>
+#include <cpu_detector.hpp>
 #include <vector>
 #include <tuple>
 
@@ -78,6 +82,48 @@ Engine::LoadExeNetworkImpl(const ICore * /*core*/, InferenceEngine::ICNNNetwork
     return std::make_shared<MKLDNNExecNetwork>(network, conf, extensionManager);
 }
 
+IExecutableNetwork::Ptr
+Engine::ImportNetwork(const std::string &modelFileName, const std::map<std::string, std::string> &config) {
+    std::ifstream inputStream(modelFileName, std::ios_base::in | std::ios_base::binary);
+    if (!inputStream.is_open())
+        THROW_IE_EXCEPTION << "Cannot open file to import model: " << modelFileName;
+
+    auto model = MKLDNNModelSerial::Import(inputStream);
+
+    // settings of the export are the base, explicitly passed ones take precedence
+    Config conf = engConfig;
+    conf.readProperties(model.config);
+    conf.readProperties(config);
+
+    if (conf.enableDynamicBatch) {
+        conf.batchLimit = static_cast<int>(model.network.getBatchSize());
+    }
+
+    ExecutableNetworkInternal::Ptr impl =
+            std::make_shared<MKLDNNExecNetwork>(model.network, conf, extensionManager, model.selection);
+
+    InputsDataMap networkInputs;
+    for (const auto &input : model.network.getInputsInfo()) {
+        InputInfo::Ptr info = std::make_shared<InputInfo>();
+        DataPtr data = std::make_shared<Data>(*input.second->getInputData());
+        data->getInputTo().clear();
+        info->setInputData(data);
+        info->getPreProcess() = input.second->getPreProcess();
+        networkInputs[input.first] = info;
+    }
+    OutputsDataMap networkOutputs;
+    for (const auto &output : model.network.getOutputsInfo()) {
+        DataPtr data = std::make_shared<Data>(*output.second);
+        data->getInputTo().clear();
+        networkOutputs[output.first] = data;
+    }
+    impl->setNetworkInputs(networkInputs);
+    impl->setNetworkOutputs(networkOutputs);
+    impl->SetPointerToPluginInternal(shared_from_this());
+
+    return make_executable_network(impl);
+}
+
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
     // accumulate config parameters on engine level
     engConfig.readProperties(config);
@@ -164,6 +210,8 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
         capabilities.push_back(METRIC_VALUE(FP32));
         capabilities.push_back(METRIC_VALUE(INT8));
         capabilities.push_back(METRIC_VALUE(BIN));
+        if (with_cpu_x86_avx512_core())
+            capabilities.push_back(METRIC_VALUE(BF16));
         IE_SET_METRIC_RETURN(OPTIMIZATION_CAPABILITIES, capabilities);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -71,6 +71,9 @@ public:
     LoadExeNetworkImpl(const ICore * core, InferenceEngine::ICNNNetwork &network,
                        const std::map<std::string, std::string> &config) override;
 
+    InferenceEngine::IExecutableNetwork::Ptr
+    ImportNetwork(const std::string &modelFileName, const std::map<std::string, std::string> &config) override;
+
     void AddExtension(InferenceEngine::IExtensionPtr extension) override;
     /**
      * @deprecated
@@ -9,6 +9,8 @@
 #include <chrono>
 #include <climits>
 #include <memory>
+#include <algorithm>
+#include <functional>
 
 #include "mkldnn_graph.h"
 #include "ie_parallel.hpp"
@@ -132,37 +134,55 @@ bool pin_current_thread_to_socket(int socket) {
 }
 #endif  // !(defined(__APPLE__) || defined(_WIN32))
 
+// executor and stream of the current worker thread, tasks submitted by workers go to their own queues
+static thread_local std::pair<const MultiWorkerTaskExecutor*, int> currentStream {nullptr, -1};
+
 MultiWorkerTaskExecutor::MultiWorkerTaskExecutor(const std::vector<Task::Ptr>& init_tasks, std::string name) :
-        _isStopped(false), _name(name), _initCount(0) {
+        _pendingCount(0), _sleepingCount(0), _isStopped(false), _name(name), _initCount(0) {
+    const int streams = init_tasks.size();
     const int sockets = MKLDNNPlugin::cpu::getNumberOfCPUSockets();
-    const int worker_per_sockets = init_tasks.size() / sockets;
-    for (int t= 0; t < init_tasks.size(); t++) {
+    const int worker_per_sockets = std::max(1, streams / sockets);
+    auto socketOf = [&](int t) { return std::min(t / worker_per_sockets, sockets - 1); };
+
+    for (int t = 0; t < streams; t++) {
+        _streams.emplace_back(new Stream);
+        for (int k = 1; k < streams; k++) {
+            int victim = (t + k) % streams;
+            if (socketOf(victim) == socketOf(t))
+                _streams[t]->victims.push_back(victim);
+        }
+        for (int k = 1; k < streams; k++) {
+            int victim = (t + k) % streams;
+            if (socketOf(victim) != socketOf(t))
+                _streams[t]->victims.push_back(victim);
+        }
+    }
+
+    for (int t = 0; t < streams; t++) {
         _threads.push_back(std::thread([&, t, init_tasks] {
-            int socket = t/worker_per_sockets;
-            pin_current_thread_to_socket(socket);
+            pin_current_thread_to_socket(socketOf(t));
+            currentStream = {this, t};
             // initialization (no contention, every worker thread is doing it's own task)
             init_tasks[t]->runNoThrowNoBusyCheck();
             _initCount++;
 
+            Stream& stream = *_streams[t];
             while (!_isStopped) {
-                bool isQueueEmpty;
-                Task::Ptr currentTask = nullptr;
-                {  // waiting for the new task or for stop signal
-                    std::unique_lock<std::mutex> lock(_queueMutex);
-                    _queueCondVar.wait(lock, [&]() { return !_taskQueue.empty() || _isStopped; });
-                    isQueueEmpty = _taskQueue.empty();
-                    if (!isQueueEmpty) {
-                        currentTask = _taskQueue.front();
-                        _taskQueue.pop();
-                        isQueueEmpty = _taskQueue.empty();
-                    }
-                }
-                if (currentTask)
+                Task::Ptr currentTask = findTask(t);
+                if (currentTask) {
                     currentTask->runNoThrowNoBusyCheck();
-                if (_isStopped)
-                    break;
-                if (isQueueEmpty)  // notify dtor, that all tasks were completed
-                    _queueCondVar.notify_all();
+                    continue;
+                }
+                // waiting for the new task or for stop signal
+                std::unique_lock<std::mutex> lock(_sleepMutex);
+                _sleepingCount++;
+                while (_pendingCount == 0 && !_isStopped) {
+                    // the notifying thread resets the flag, so the next task wakes up another worker
+                    stream.isSleeping = true;
+                    stream.wakeUpCondVar.wait(lock);
+                }
+                stream.isSleeping = false;
+                _sleepingCount--;
             }
         }));
     }
@@ -173,12 +193,11 @@ MultiWorkerTaskExecutor::MultiWorkerTaskExecutor(const std::vector<Task::Ptr>& i
 
 MultiWorkerTaskExecutor::~MultiWorkerTaskExecutor() {
     {
-        std::unique_lock<std::mutex> lock(_queueMutex);
-        if (!_taskQueue.empty()) {
-            _queueCondVar.wait(lock, [this]() { return _taskQueue.empty(); });
-        }
+        std::unique_lock<std::mutex> lock(_sleepMutex);
+        _drainCondVar.wait(lock, [this]() { return _pendingCount == 0; });
         _isStopped = true;
-        _queueCondVar.notify_all();
+        for (auto& stream : _streams)
+            stream->wakeUpCondVar.notify_all();
     }
     for (auto& thread : _threads) {
         if (thread.joinable()) {
@@ -187,11 +206,57 @@ MultiWorkerTaskExecutor::~MultiWorkerTaskExecutor() {
     }
 }
 
+Task::Ptr MultiWorkerTaskExecutor::popTask(Stream& stream) {
+    std::lock_guard<std::mutex> lock(stream.queueMutex);
+    if (stream.taskQueue.empty())
+        return nullptr;
+    Task::Ptr task = stream.taskQueue.front();
+    stream.taskQueue.pop_front();
+    _pendingCount--;
+    return task;
+}
+
+Task::Ptr MultiWorkerTaskExecutor::findTask(int streamId) {
+    // both own and stolen tasks are taken from the front to keep the submission order
+    Task::Ptr task = popTask(*_streams[streamId]);
+    for (size_t i = 0; !task && i < _streams[streamId]->victims.size(); i++)
+        task = popTask(*_streams[_streams[streamId]->victims[i]]);
+
+    if (task && _pendingCount == 0) {  // notify dtor, that all tasks were taken
+        std::lock_guard<std::mutex> lock(_sleepMutex);
+        _drainCondVar.notify_all();
+    }
+    return task;
+}
+
+int MultiWorkerTaskExecutor::submitStreamId() const {
+    if (currentStream.first == this)
+        return currentStream.second;
+    return std::hash<std::thread::id>()(std::this_thread::get_id()) % _streams.size();
+}
+
 bool MultiWorkerTaskExecutor::startTask(Task::Ptr task) {
     if (!task->occupy()) return false;
-    std::unique_lock<std::mutex> lock(_queueMutex);
-    _taskQueue.push(task);
-    _queueCondVar.notify_one();
+    const int streamId = submitStreamId();
+    Stream& stream = *_streams[streamId];
+    {
+        std::lock_guard<std::mutex> lock(stream.queueMutex);
+        stream.taskQueue.push_back(task);
+        _pendingCount++;
+    }
+    // the lock is taken only when some worker is idle, busy streams will find the task themselves
+    if (_sleepingCount > 0) {
+        std::lock_guard<std::mutex> lock(_sleepMutex);
+        Stream* sleeping = stream.isSleeping ? &stream : nullptr;
+        for (size_t i = 0; !sleeping && i < stream.victims.size(); i++) {
+            if (_streams[stream.victims[i]]->isSleeping)
+                sleeping = _streams[stream.victims[i]].get();
+        }
+        if (sleeping) {
+            sleeping->isSleeping = false;
+            sleeping->wakeUpCondVar.notify_one();
+        }
+    }
     return true;
 }
 
@@ -229,77 +294,33 @@ void MKLDNNPlugin::MKLDNNGraphlessInferRequest::InferImpl() {
         // execute input pre-processing.
         execDataPreprocessing(_inputs);
 
-        // need to retain converted blobs until infer finish
-        std::vector<InferenceEngine::Blob::Ptr> convertedInputs;
+        graph->ResetCopiedBytes();
         for (auto input : _inputs) {
             if (!_networkInputs[input.first]) {
                 THROW_IE_EXCEPTION <<
                                    "input blobs map contains not registered during IInferencePlugin::LoadNetwork blob with name "
                                    << input.first;
             }
-            InferenceEngine::Blob::Ptr iconv;
-            InferenceEngine::TBlob<float> *in_f = nullptr;
+            // U16 inputs and U8/I16 ones with mean image are converted to FP32 by the graph itself
             switch (input.second->getTensorDesc().getPrecision()) {
                 case InferenceEngine::Precision::FP32:
                 case InferenceEngine::Precision::I32:
                 case InferenceEngine::Precision::I8:
-                    graph->PushInputData(input.first, input.second);
-                    break;
                 case InferenceEngine::Precision::U16:
-                    // U16 is unsupported by mkldnn, so here we convert the blob and send FP32
-                    iconv = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32,
-                                                                      input.second->getTensorDesc().getDims(),
-                                                                      input.second->getTensorDesc().getLayout()});
-                    convertedInputs.push_back(iconv);
-                    iconv->allocate();
-                    in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                    if (in_f == nullptr)
-                        THROW_IE_EXCEPTION << "Cannot get TBlob";
-                    InferenceEngine::copyToFloat<uint16_t>(in_f->data(), input.second.get());
-                    graph->PushInputData(input.first, iconv);
-                    break;
                 case InferenceEngine::Precision::I16:
-                    if (graph->hasMeanImageFor(input.first)) {
-                        // If a mean image exists, we convert the blob and send FP32
-                        iconv = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32,
-                                                                          input.second->getTensorDesc().getDims(),
-                                                                          input.second->getTensorDesc().getLayout()});
-                        convertedInputs.push_back(iconv);
-                        iconv->allocate();
-                        in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                        if (in_f == nullptr)
-                            THROW_IE_EXCEPTION << "Cannot get TBlob";
-                        InferenceEngine::copyToFloat<int16_t>(in_f->data(), input.second.get());
-                        graph->PushInputData(input.first, iconv);
-                    } else {
-                        // Instead we can send I16 directly
-                        graph->PushInputData(input.first, input.second);
-                    }
-                    break;
                 case InferenceEngine::Precision::U8:
-                    if (graph->hasMeanImageFor(input.first)) {
-                        // If a mean image exists, we convert the blob and send FP32
-                        iconv = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32,
-                                                                          input.second->getTensorDesc().getDims(),
-                                                                          input.second->getTensorDesc().getLayout()});
-                        convertedInputs.push_back(iconv);
-                        iconv->allocate();
-                        in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                        if (in_f == nullptr)
-                            THROW_IE_EXCEPTION << "Cannot get TBlob";
-                        InferenceEngine::copyToFloat<uint8_t>(in_f->data(), input.second.get());
-                        graph->PushInputData(input.first, iconv);
-                    } else {
-                        // Instead we can send I8 directly
-                        graph->PushInputData(input.first, input.second);
-                    }
+                    graph->PushInputData(input.first, input.second);
                     break;
                 default:
                     THROW_IE_EXCEPTION << "Unsupported input precision " << input.second->getTensorDesc().getPrecision();
             }
         }
+        size_t stateBytes = graph->BindMemoryStates(m_memoryStates);
         graph->Infer(m_curBatch);
         graph->PullOutputData(_outputs);
+        for (auto &state : m_memoryStates)
+            state->swap();
+        m_copiedBytes = graph->GetCopiedBytes() + stateBytes;
         if (graph->getProperty().collectPerfCounters) {
             m_perfMap.clear();
             graph->GetPerfData(m_perfMap);
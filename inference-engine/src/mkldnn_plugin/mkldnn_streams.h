@@ -8,13 +8,17 @@
 #include <vector>
 #include <atomic>
 #include <map>
-#include <queue>
+#include <deque>
 #include <memory>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
 #include <climits>
 #include <cpp_interfaces/impl/ie_infer_request_internal.hpp>
 #include <cpp_interfaces/ie_task_executor.hpp>
 #include "ie_parallel.hpp"
 #include "mkldnn/omp_manager.h"
+#include "mkldnn_memory_state.h"
 
 /* CPU "streams" implement a feature that allows multiple Infer Requests to be efficiently run simultaneously.
  * To avoid potential oversubscription the CPU execution resources are divided accordingly.
@@ -27,9 +31,9 @@
  * application logic, helping to saturate the CPU by multiple requests instead.
  * Implementation-wise, the "streams" constitute the following:
  *  - Pure "graph-less" Infer Requests that are not connected to the specific MKLDNNGraph (which is regular/legacy approach)
- *  - Just like regular requests, the graph-less go to the common (per ExecutableNetwork) queue
+ *  - Just like regular requests, the graph-less go to the per ExecutableNetwork executor
  *  - But unlike conventional case, there are multiple threads that grab the requests (see MultiWorkerTaskExecutor)
- *  - So every stream is in fact is independent "worker" thread that monitors the queue.
+ *  - So every stream is in fact is independent "worker" thread that monitors its own queue and steals from others.
  *  - Every worker thread (stream) has it's own copy of the graph (which handles intermediate data required for execution)
  *  - While the Infer Requests just keep only input/output data
 */
@@ -113,7 +117,10 @@ protected:
 };
 #endif  // IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
 
-/* Class wrapping multiple worker threads that monitors the same queue with Infer Requests. */
+/* Class wrapping multiple worker threads (streams) executing Infer Requests.
+ * Every stream has its own queue, so submitting threads and workers don't contend on a single lock.
+ * A thread always submits to the same queue (a worker - to its own one), which keeps FIFO order per submitting thread.
+ * An idle worker steals from the queues of other streams, the streams pinned to the same socket first. */
 class MultiWorkerTaskExecutor : public ITaskExecutor {
 public:
     typedef std::shared_ptr<MultiWorkerTaskExecutor> Ptr;
@@ -123,8 +130,8 @@ public:
     ~MultiWorkerTaskExecutor();
 
     /**
-    * @brief Adds task for execution and notifies one of the working threads about the new task.
-    * @note can be called from multiple threads - tasks will be added to the queue and executed one-by-one in FIFO mode.
+    * @brief Adds task for execution and notifies one of the idle working threads about the new task.
+    * @note can be called from multiple threads - tasks from the same thread are started in FIFO mode.
     * @param task - shared pointer to the task
     *  @return true if succeed to add task, otherwise - false
     */
@@ -133,10 +140,27 @@ public:
     static thread_local MultiWorkerTaskContext ptrContext;
 
 private:
+    struct Stream {
+        std::mutex queueMutex;
+        std::deque<Task::Ptr> taskQueue;
+        // streams to steal from, the ones on the same socket go first
+        std::vector<int> victims;
+        // guarded by _sleepMutex
+        std::condition_variable wakeUpCondVar;
+        bool isSleeping = false;
+    };
+
+    Task::Ptr popTask(Stream& stream);
+    Task::Ptr findTask(int streamId);
+    int submitStreamId() const;
+
     std::vector<std::thread> _threads;
-    std::mutex _queueMutex;
-    std::condition_variable _queueCondVar;
-    std::queue<Task::Ptr> _taskQueue;
+    std::vector<std::unique_ptr<Stream>> _streams;
+    // number of tasks in all queues, changed under the queue mutex
+    std::atomic<int> _pendingCount;
+    std::atomic<int> _sleepingCount;
+    std::mutex _sleepMutex;
+    std::condition_variable _drainCondVar;
     std::atomic<bool> _isStopped;
     std::string _name;
     std::atomic<int> _initCount;
@@ -170,8 +194,29 @@ public:
 
     void SetBatch(int batch = -1) override;
 
+    /**
+     * @brief Sets the states of the memory layers owned by the request, they are bound to the graph of
+     * the stream which executes the request
+     */
+    void SetMemoryStates(const std::vector<MKLDNNMemoryState::Ptr> &states) {
+        m_memoryStates = states;
+    }
+
+    std::vector<InferenceEngine::IMemoryStateInternal::Ptr> QueryState() override {
+        return {m_memoryStates.begin(), m_memoryStates.end()};
+    }
+
+    /**
+     * @brief Returns the number of input, output and memory state bytes copied by the last inference
+     */
+    size_t GetCopiedBytes() const {
+        return m_copiedBytes;
+    }
+
 private:
     int m_curBatch;
+    size_t m_copiedBytes = 0;
+    std::vector<MKLDNNMemoryState::Ptr> m_memoryStates;
     std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> m_perfMap;
 };
 
@@ -184,53 +184,65 @@ void MKLDNNConvolutionNode::getSupportedDescriptors() {
         MKLDNNMemoryDesc out_candidate = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType, memory::nhwc);
         createDescriptor({in_candidate}, {out_candidate});
     } else {
-        // If the weights aren't quantized, the only precision we support is FP32
-        inputDataType = memory::f32;
-        outputDataType = memory::f32;
-
-        Layout layout = convLayer->input()->getLayout();
-
-        if (layout == NCHW || layout == NHWC) {
-            MKLDNNMemoryDesc in_candidate(getParentEdgeAt(0)->getDims(), inputDataType,
-                    layout == NCHW ? memory::nchw : memory::nhwc);
-            MKLDNNMemoryDesc out_candidate(getChildEdgeAt(0)->getDims(), outputDataType,
-                    layout == NCHW ? memory::nchw : memory::nhwc);
-            createDescriptor({in_candidate}, {out_candidate});
-
-            if (IC == 3 || IC == 1) {
-                out_candidate = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType, memory::nChw16c);
-                createDescriptor({in_candidate}, {out_candidate});
-                out_candidate = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType, memory::nChw8c);
-                createDescriptor({in_candidate}, {out_candidate});
-            } else {
-                in_candidate = MKLDNNMemoryDesc(getParentEdgeAt(0)->getDims(), inputDataType, memory::nChw16c);
-                out_candidate = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType, memory::nChw16c);
-                createDescriptor({in_candidate}, {out_candidate});
-                in_candidate = MKLDNNMemoryDesc(getParentEdgeAt(0)->getDims(), inputDataType, memory::nChw8c);
-                out_candidate = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType, memory::nChw8c);
-                createDescriptor({in_candidate}, {out_candidate});
-            }
-        } else if (layout == NCDHW || layout == NDHWC) {
-            MKLDNNMemoryDesc in_candidate(getParentEdgeAt(0)->getDims(), inputDataType,
-                    layout == NCDHW ? memory::ncdhw : memory::ndhwc);
-            MKLDNNMemoryDesc out_candidate(getChildEdgeAt(0)->getDims(), outputDataType,
-                    layout == NCDHW ? memory::ncdhw : memory::ndhwc);
-            createDescriptor({in_candidate}, {out_candidate});
-
-            if (IC == 3 || IC == 1) {
-                out_candidate = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType, memory::nCdhw16c);
+        // If the weights aren't quantized, the only precisions we support are FP32 and BF16
+        auto createDescriptors = [&](memory::data_type srcDataType, memory::data_type dstDataType) {
+            Layout layout = convLayer->input()->getLayout();
+
+            if (layout == NCHW || layout == NHWC) {
+                MKLDNNMemoryDesc in_candidate(getParentEdgeAt(0)->getDims(), srcDataType,
+                        layout == NCHW ? memory::nchw : memory::nhwc);
+                MKLDNNMemoryDesc out_candidate(getChildEdgeAt(0)->getDims(), dstDataType,
+                        layout == NCHW ? memory::nchw : memory::nhwc);
                 createDescriptor({in_candidate}, {out_candidate});
-                out_candidate = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType, memory::nCdhw8c);
-                createDescriptor({in_candidate}, {out_candidate});
-            } else {
-                in_candidate = MKLDNNMemoryDesc(getParentEdgeAt(0)->getDims(), inputDataType, memory::nCdhw16c);
-                out_candidate = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType, memory::nCdhw16c);
-                createDescriptor({in_candidate}, {out_candidate});
-                in_candidate = MKLDNNMemoryDesc(getParentEdgeAt(0)->getDims(), inputDataType, memory::nCdhw8c);
-                out_candidate = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType, memory::nCdhw8c);
+
+                if (IC == 3 || IC == 1) {
+                    out_candidate = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), dstDataType, memory::nChw16c);
+                    createDescriptor({in_candidate}, {out_candidate});
+                    out_candidate = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), dstDataType, memory::nChw8c);
+                    createDescriptor({in_candidate}, {out_candidate});
+                } else {
+                    in_candidate = MKLDNNMemoryDesc(getParentEdgeAt(0)->getDims(), srcDataType, memory::nChw16c);
+                    out_candidate = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), dstDataType, memory::nChw16c);
+                    createDescriptor({in_candidate}, {out_candidate});
+                    in_candidate = MKLDNNMemoryDesc(getParentEdgeAt(0)->getDims(), srcDataType, memory::nChw8c);
+                    out_candidate = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), dstDataType, memory::nChw8c);
+                    createDescriptor({in_candidate}, {out_candidate});
+                }
+            } else if (layout == NCDHW || layout == NDHWC) {
+                MKLDNNMemoryDesc in_candidate(getParentEdgeAt(0)->getDims(), srcDataType,
+                        layout == NCDHW ? memory::ncdhw : memory::ndhwc);
+                MKLDNNMemoryDesc out_candidate(getChildEdgeAt(0)->getDims(), dstDataType,
+                        layout == NCDHW ? memory::ncdhw : memory::ndhwc);
                 createDescriptor({in_candidate}, {out_candidate});
+
+                if (IC == 3 || IC == 1) {
+                    out_candidate = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), dstDataType, memory::nCdhw16c);
+                    createDescriptor({in_candidate}, {out_candidate});
+                    out_candidate = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), dstDataType, memory::nCdhw8c);
+                    createDescriptor({in_candidate}, {out_candidate});
+                } else {
+                    in_candidate = MKLDNNMemoryDesc(getParentEdgeAt(0)->getDims(), srcDataType, memory::nCdhw16c);
+                    out_candidate = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), dstDataType, memory::nCdhw16c);
+                    createDescriptor({in_candidate}, {out_candidate});
+                    in_candidate = MKLDNNMemoryDesc(getParentEdgeAt(0)->getDims(), srcDataType, memory::nCdhw8c);
+                    out_candidate = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), dstDataType, memory::nCdhw8c);
+                    createDescriptor({in_candidate}, {out_candidate});
+                }
             }
+        };
+
+        if (enforceBF16) {
+            // bfloat16 kernels read the activations and the weights in bfloat16, accumulate and write the output
+            // in FP32, so the neighbours keep FP32 and only the input is converted by a reorder
+            createDescriptors(memory::bf16, memory::f32);
+            mkldnn::primitive_attr attr;
+            setPostOps(attr, false);
+            if (hasImplementations(attr))
+                return;
+            // e.g. the fused post-ops aren't supported by the bfloat16 kernels
+            descs.clear();
         }
+        createDescriptors(memory::f32, memory::f32);
     }
 }
 
@@ -561,6 +573,9 @@ void MKLDNNConvolutionNode::createDescriptor(const std::vector<InferenceEngine::
     TensorDesc inDesc = inputDesc[0], outDesc = outputDesc[0];
     mkldnn::memory::data_type wdt = MKLDNNExtensionUtils::IEPrecisionToDataType(inDesc.getPrecision());
     mkldnn::memory::data_type bdt = MKLDNNExtensionUtils::IEPrecisionToDataType(inDesc.getPrecision());
+    // bfloat16 kernels take the biases in FP32
+    if (bdt == memory::bf16)
+        bdt = memory::f32;
 
     Blob::Ptr weights = this->getCnnLayer()->blobs.find("weights")->second;
 
@@ -12,11 +12,345 @@
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
 #include "ie_parallel.hpp"
+#include "jit_generator.hpp"
 #include <map>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
+using namespace mkldnn::impl::cpu;
+using namespace Xbyak;
+
+#define GET_OFF(field) offsetof(jit_eltwise_call_args, field)
+
+template <cpu_isa_t isa>
+struct jit_uni_eltwise_generic : public jit_uni_eltwise_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_eltwise_generic)
+
+    explicit jit_uni_eltwise_generic(jit_eltwise_params jep) : jit_uni_eltwise_kernel(jep), jit_generator() {
+        is_i32 = jep.dst_prc == Precision::I32;
+
+        this->preamble();
+
+        for (size_t i = 0; i < jep.inputs_num; i++)
+            mov(get_src_reg(i), ptr[reg_params + GET_OFF(src_ptr) + i * sizeof(void *)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+
+        if (!is_i32) {
+            uni_vpxor(vmm_zero, vmm_zero, vmm_zero);
+            load_imm(vmm_one, 1.0f);
+        }
+
+        // broadcast operands and scales don't change along the run, keep them in registers
+        for (size_t i = 0; i < jep.inputs_num; i++) {
+            Vmm vmm_inv = get_inv_vmm(i);
+            switch (jep.src_kind[i]) {
+                case jit_eltwise_src_kind::full:
+                    if (with_scale(i))
+                        load_imm(vmm_inv, jep.scales[i]);
+                    break;
+                case jit_eltwise_src_kind::scalar:
+                    load_scalar(vmm_inv, get_src_reg(i), jep.src_prc[i]);
+                    uni_vbroadcastss(vmm_inv, Xmm(vmm_inv.getIdx()));
+                    apply_scale(vmm_inv, i);
+                    break;
+                case jit_eltwise_src_kind::periodic:
+                    load_vector(vmm_inv, get_src_reg(i), jep.src_prc[i]);
+                    apply_scale(vmm_inv, i);
+                    break;
+            }
+        }
+
+        Label main_loop_label;
+        Label tail_loop_label;
+        Label exit_label;
+
+        L(main_loop_label);
+        {
+            cmp(reg_work_amount, simd_w);
+            jl(tail_loop_label, T_NEAR);
+
+            compute(false);
+            advance(simd_w);
+
+            sub(reg_work_amount, simd_w);
+            jmp(main_loop_label, T_NEAR);
+        }
+
+        // the driver never splits a periodic run, so only full and scalar operands get here
+        L(tail_loop_label);
+        {
+            cmp(reg_work_amount, 1);
+            jl(exit_label, T_NEAR);
+
+            compute(true);
+            advance(1);
+
+            sub(reg_work_amount, 1);
+            jmp(tail_loop_label, T_NEAR);
+        }
+
+        L(exit_label);
+
+        this->postamble();
+
+        ker_ = (decltype(ker_))this->getCode();
+    }
+
+private:
+    using Vmm = typename mkldnn::impl::utils::conditional3<isa == cpu_isa_t::sse42, Xmm, isa == cpu_isa_t::avx2, Ymm, Zmm>::type;
+    const int simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+
+    Reg64 get_src_reg(size_t i) {
+        return Reg64(r8.getIdx() + i);
+    }
+
+    Vmm get_inv_vmm(size_t i) {
+        return Vmm(5 + i);
+    }
+
+    Reg64 reg_dst = r15;
+    Reg64 reg_work_amount = rdx;
+    Reg64 reg_params = abi_param1;
+
+    Reg32 reg_tmp_32 = eax;
+
+    Vmm vmm_dst = Vmm(0);
+    Vmm vmm_src = Vmm(1);
+    Vmm vmm_aux = Vmm(2);
+    Vmm vmm_zero = Vmm(3);
+    Vmm vmm_one = Vmm(4);
+
+    Opmask k_mask = k1;
+    Opmask k_mask_aux = k2;
+
+    bool is_i32 = false;
+
+    bool with_scale(size_t i) {
+        assert(!is_i32 || jep_.scales[i] == 1.0f);
+        return jep_.op == EltwiseLayer::Sum && jep_.scales[i] != 1.0f;
+    }
+
+    void load_imm(const Vmm &vmm, float value) {
+        Xmm xmm = Xmm(vmm.getIdx());
+        mov(reg_tmp_32, float2int(value));
+        if (isa == cpu_isa_t::sse42)
+            movd(xmm, reg_tmp_32);
+        else
+            vmovd(xmm, reg_tmp_32);
+        uni_vbroadcastss(vmm, xmm);
+    }
+
+    void apply_scale(const Vmm &vmm, size_t i) {
+        if (with_scale(i)) {
+            load_imm(vmm_aux, jep_.scales[i]);
+            uni_vmulps(vmm, vmm, vmm_aux);
+        }
+    }
+
+    void load_vector(const Vmm &vmm, const Reg64 &reg, Precision prc) {
+        switch (prc) {
+            case Precision::FP32: uni_vmovups(vmm, ptr[reg]); break;
+            case Precision::I32: uni_vmovdqu(vmm, ptr[reg]); break;
+            case Precision::I8: uni_vpmovsxbd(vmm, ptr[reg]); break;
+            case Precision::U8: uni_vpmovzxbd(vmm, ptr[reg]); break;
+            default: assert(!"unsupported precision");
+        }
+        if (!is_i32 && prc != Precision::FP32)
+            uni_vcvtdq2ps(vmm, vmm);
+    }
+
+    // fills the lowest lane only, the rest of the register is computed along and thrown away
+    void load_scalar(const Vmm &vmm, const Reg64 &reg, Precision prc) {
+        Xmm xmm = Xmm(vmm.getIdx());
+        switch (prc) {
+            case Precision::FP32:
+            case Precision::I32:
+                if (isa == cpu_isa_t::sse42)
+                    movss(xmm, ptr[reg]);
+                else
+                    vmovss(xmm, ptr[reg]);
+                break;
+            case Precision::I8:
+            case Precision::U8:
+                if (prc == Precision::I8)
+                    movsx(reg_tmp_32, byte[reg]);
+                else
+                    movzx(reg_tmp_32, byte[reg]);
+                if (isa == cpu_isa_t::sse42)
+                    movd(xmm, reg_tmp_32);
+                else
+                    vmovd(xmm, reg_tmp_32);
+                break;
+            default: assert(!"unsupported precision");
+        }
+        if (!is_i32 && prc != Precision::FP32)
+            uni_vcvtdq2ps(vmm, vmm);
+    }
+
+    void store(const Vmm &vmm, bool scalar) {
+        Xmm xmm = Xmm(vmm.getIdx());
+        if (scalar) {
+            if (isa == cpu_isa_t::sse42)
+                movss(ptr[reg_dst], xmm);
+            else
+                vmovss(ptr[reg_dst], xmm);
+        } else if (is_i32) {
+            uni_vmovdqu(ptr[reg_dst], vmm);
+        } else {
+            uni_vmovups(ptr[reg_dst], vmm);
+        }
+    }
+
+    void compute(bool scalar) {
+        for (size_t i = 0; i < jep_.inputs_num; i++) {
+            Vmm vmm = i == 0 ? vmm_dst : vmm_src;
+            if (jep_.src_kind[i] == jit_eltwise_src_kind::full) {
+                if (scalar)
+                    load_scalar(vmm, get_src_reg(i), jep_.src_prc[i]);
+                else
+                    load_vector(vmm, get_src_reg(i), jep_.src_prc[i]);
+                if (with_scale(i))
+                    uni_vmulps(vmm, vmm, get_inv_vmm(i));
+            } else {
+                uni_vmovups(vmm, get_inv_vmm(i));
+            }
+
+            if (i > 0) {
+                if (is_i32)
+                    apply_op_i32(vmm_dst, vmm_src);
+                else
+                    apply_op_f32(vmm_dst, vmm_src);
+            }
+        }
+        store(vmm_dst, scalar);
+    }
+
+    void advance(int step) {
+        for (size_t i = 0; i < jep_.inputs_num; i++) {
+            if (jep_.src_kind[i] == jit_eltwise_src_kind::full)
+                add(get_src_reg(i), step * jep_.src_prc[i].size());
+        }
+        add(reg_dst, step * jep_.dst_prc.size());
+    }
+
+    // dst = (dst cmp src) ? 1.f : 0.f, swapped operands give the greater-than forms
+    void compare(const Vmm &dst, const Vmm &src, int cmp_predicate, bool swap) {
+        const Vmm &lhs = swap ? src : dst;
+        const Vmm &rhs = swap ? dst : src;
+        if (isa == cpu_isa_t::avx512_common) {
+            vcmpps(k_mask, lhs, rhs, cmp_predicate);
+            vblendmps(dst | k_mask, vmm_zero, vmm_one);
+        } else if (isa == cpu_isa_t::avx2) {
+            vcmpps(dst, lhs, rhs, cmp_predicate);
+            vandps(dst, dst, vmm_one);
+        } else {
+            if (swap) {
+                movups(vmm_aux, src);
+                cmpps(vmm_aux, dst, cmp_predicate);
+                movups(dst, vmm_aux);
+            } else {
+                cmpps(dst, src, cmp_predicate);
+            }
+            andps(dst, vmm_one);
+        }
+    }
+
+    void logical(const Vmm &dst, const Vmm &src, EltwiseLayer::eOperation op) {
+        if (isa == cpu_isa_t::avx512_common) {
+            vcmpps(k_mask, dst, vmm_zero, _cmp_neq_uq);
+            vcmpps(k_mask_aux, src, vmm_zero, _cmp_neq_uq);
+            switch (op) {
+                case EltwiseLayer::Logical_AND: kandw(k_mask, k_mask, k_mask_aux); break;
+                case EltwiseLayer::Logical_OR: korw(k_mask, k_mask, k_mask_aux); break;
+                default: kxorw(k_mask, k_mask, k_mask_aux); break;
+            }
+            vblendmps(dst | k_mask, vmm_zero, vmm_one);
+        } else {
+            uni_vmovups(vmm_aux, src);
+            if (isa == cpu_isa_t::avx2) {
+                vcmpps(dst, dst, vmm_zero, _cmp_neq_uq);
+                vcmpps(vmm_aux, vmm_aux, vmm_zero, _cmp_neq_uq);
+            } else {
+                cmpps(dst, vmm_zero, _cmp_neq_uq);
+                cmpps(vmm_aux, vmm_zero, _cmp_neq_uq);
+            }
+            switch (op) {
+                case EltwiseLayer::Logical_AND: uni_vandps(dst, dst, vmm_aux); break;
+                case EltwiseLayer::Logical_OR: uni_vorps(dst, dst, vmm_aux); break;
+                default:
+                    if (isa == cpu_isa_t::sse42)
+                        xorps(dst, vmm_aux);
+                    else
+                        vxorps(dst, dst, vmm_aux);
+                    break;
+            }
+            uni_vandps(dst, dst, vmm_one);
+        }
+    }
+
+    void apply_op_f32(const Vmm &dst, const Vmm &src) {
+        switch (jep_.op) {
+            case EltwiseLayer::Sum: uni_vaddps(dst, dst, src); break;
+            case EltwiseLayer::Prod: uni_vmulps(dst, dst, src); break;
+            case EltwiseLayer::Max: uni_vmaxps(dst, dst, src); break;
+            case EltwiseLayer::Min: uni_vminps(dst, dst, src); break;
+            case EltwiseLayer::Sub: uni_vsubps(dst, dst, src); break;
+            case EltwiseLayer::Div: uni_vdivps(dst, dst, src); break;
+            case EltwiseLayer::Squared_diff:
+                uni_vsubps(dst, dst, src);
+                uni_vmulps(dst, dst, dst);
+                break;
+            case EltwiseLayer::Equal: compare(dst, src, _cmp_eq_oq, false); break;
+            case EltwiseLayer::Not_equal: compare(dst, src, _cmp_neq_uq, false); break;
+            case EltwiseLayer::Less: compare(dst, src, _cmp_lt_os, false); break;
+            case EltwiseLayer::Less_equal: compare(dst, src, _cmp_le_os, false); break;
+            case EltwiseLayer::Greater: compare(dst, src, _cmp_lt_os, true); break;
+            case EltwiseLayer::Greater_equal: compare(dst, src, _cmp_le_os, true); break;
+            case EltwiseLayer::Logical_AND:
+            case EltwiseLayer::Logical_OR:
+            case EltwiseLayer::Logical_XOR: logical(dst, src, jep_.op); break;
+            default: assert(!"unsupported operation");
+        }
+    }
+
+    void apply_op_i32(const Vmm &dst, const Vmm &src) {
+        switch (jep_.op) {
+            case EltwiseLayer::Sum: uni_vpaddd(dst, dst, src); break;
+            case EltwiseLayer::Prod: uni_vpmulld(dst, dst, src); break;
+            case EltwiseLayer::Max: uni_vpmaxsd(dst, dst, src); break;
+            case EltwiseLayer::Min:
+                if (isa == cpu_isa_t::sse42)
+                    pminsd(dst, src);
+                else
+                    vpminsd(dst, dst, src);
+                break;
+            case EltwiseLayer::Sub:
+            case EltwiseLayer::Squared_diff:
+                if (isa == cpu_isa_t::sse42)
+                    psubd(dst, src);
+                else
+                    vpsubd(dst, dst, src);
+                if (jep_.op == EltwiseLayer::Squared_diff)
+                    uni_vpmulld(dst, dst, dst);
+                break;
+            default: assert(!"unsupported operation");
+        }
+    }
+};
+
+static bool isJitSupported(EltwiseLayer::eOperation op, Precision prc, const std::vector<float> &scales) {
+    if (prc == Precision::FP32)
+        return op != EltwiseLayer::Pow && op != EltwiseLayer::Floor_mod;
+    // integer lanes are never scaled by the kernel, so Sum with coefficients goes to the reference code
+    if (prc == Precision::I32)
+        return (op == EltwiseLayer::Sum || op == EltwiseLayer::Sub || op == EltwiseLayer::Prod ||
+                op == EltwiseLayer::Max || op == EltwiseLayer::Min || op == EltwiseLayer::Squared_diff) &&
+               std::all_of(scales.begin(), scales.end(), [](float scale) { return scale == 1.0f; });
+    return false;
+}
+
 
 MKLDNNEltwiseNode::MKLDNNEltwiseNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, int socket) :
         MKLDNNNode(layer, eng, socket) {
@@ -118,20 +452,59 @@ void MKLDNNEltwiseNode::getSupportedDescriptors() {
         sum_scales.push_back(with_coeffs ? eltwiseLayer->coeff[i] : 1.0f);
 }
 
+bool MKLDNNEltwiseNode::canUseJit() const {
+    return mayiuse(cpu_isa_t::sse42) && getParentEdges().size() <= MAX_ELTWISE_INPUTS &&
+           isJitSupported(op, getCnnLayer()->precision, sum_scales);
+}
+
+Precision MKLDNNEltwiseNode::getJitInputPrecision(size_t i) const {
+    // Network inputs and constants are read in their own precision, the kernel converts them on load
+    Precision prc = getCnnLayer()->precision;
+    auto parent = getParentEdgeAt(i)->getParent();
+    if (parent->getType() == Input) {
+        Precision inPrc = parent->getCnnLayer()->precision;
+        if (inPrc == Precision::U8 || inPrc == Precision::I8 || (inPrc == Precision::I32 && prc == Precision::FP32))
+            return inPrc;
+    }
+    return prc;
+}
+
 void MKLDNNEltwiseNode::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
-    auto initDesc = [&] (mkldnn::memory::data_type inputDT, mkldnn::memory::data_type outputDT, memory::format format) -> PrimitiveDescInfo {
+    bool useJit = canUseJit();
+    Precision outPrc = getCnnLayer()->precision;
+    std::vector<Precision> inPrcs;
+    for (size_t i = 0; i < getParentEdges().size(); i++)
+        inPrcs.push_back(useJit ? getJitInputPrecision(i) : outPrc);
+
+    // Sum without broadcasting of same precision tensors is done by mkldnn
+    bool mkldnnSum = op == EltwiseLayer::Sum && !broadcast &&
+                     std::all_of(inPrcs.begin(), inPrcs.end(), [&](Precision prc) { return prc == outPrc; });
+    impl_desc_type jit_impl_type = mayiuse(cpu_isa_t::avx512_common) ? impl_desc_type::jit_avx512 :
+                                   mayiuse(cpu_isa_t::avx2) ? impl_desc_type::jit_avx2 : impl_desc_type::jit_sse42;
+
+    // Blocked layouts are fine for the kernel as long as the blocked dimension isn't broadcast
+    bool blockedBroadcast = useJit && !mkldnnSum;
+    auto outDims = getChildEdgeAt(0)->getDims();
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        auto inDims = getParentEdgeAt(i)->getDims();
+        if (inDims.ndims() != outDims.ndims() || (inDims.ndims() > 1 && inDims[1] != outDims[1]))
+            blockedBroadcast = false;
+    }
+
+    auto initDesc = [&] (mkldnn::memory::data_type outputDT, memory::format format) -> PrimitiveDescInfo {
         InferenceEngine::LayerConfig config;
-        impl_desc_type impl_type = impl_desc_type::ref;
+        impl_desc_type impl_type = useJit && !mkldnnSum ? jit_impl_type : impl_desc_type::ref;
         config.dynBatchSupport = true;
         for (size_t i = 0; i < getParentEdges().size(); i++) {
             InferenceEngine::DataConfig dataConfig;
-            dataConfig.inPlace = (!i && canBeInPlace()) ? 0 : -1;
+            dataConfig.inPlace = (!i && canBeInPlace() && inPrcs[i] == outPrc) ? 0 : -1;
             dataConfig.constant = false;
 
-            if (!broadcast) {
+            mkldnn::memory::data_type inputDT = MKLDNNExtensionUtils::IEPrecisionToDataType(inPrcs[i]);
+            if (!broadcast || (blockedBroadcast && !MKLDNNMemory::IsPlainFormat(format))) {
                 dataConfig.desc = MKLDNNMemoryDesc(getParentEdgeAt(i)->getDims(), inputDT, format);
                 config.inConfs.push_back(dataConfig);
             } else {
@@ -157,9 +530,8 @@ void MKLDNNEltwiseNode::initSupportedPrimitiveDescriptors() {
     };
 
     for (const auto& format : getAvailableFormatsForDims(getChildEdgeAt(0)->getDims())) {
-        mkldnn::memory::data_type inputDT = MKLDNNExtensionUtils::IEPrecisionToDataType(getCnnLayer()->precision);
-        mkldnn::memory::data_type outputDT = MKLDNNExtensionUtils::IEPrecisionToDataType(getCnnLayer()->precision);
-        auto impl_desc = initDesc(inputDT, outputDT, format);
+        mkldnn::memory::data_type outputDT = MKLDNNExtensionUtils::IEPrecisionToDataType(outPrc);
+        auto impl_desc = initDesc(outputDT, format);
 
         if (impl_desc.getImplementationType() != impl_desc_type::undef) {
             supportedPrimitiveDescriptors.push_back(impl_desc);
@@ -191,7 +563,12 @@ void MKLDNNEltwiseNode::createPrimitive() {
             srcs_p.emplace_back(srcMemPtr->GetPrimitive());
         }
     }
-    if (op == EltwiseLayer::Sum && !broadcast) {
+    bool samePrecision = true;
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        if (getParentEdgeAt(i)->getDesc().getPrecision() != getChildEdgeAt(0)->getDesc().getPrecision())
+            samePrecision = false;
+    }
+    if (op == EltwiseLayer::Sum && !broadcast && samePrecision) {
         try {
             auto primitive_desc = mkldnn::sum::primitive_desc(dstMemPtr->GetDescriptor(), sum_scales, srcs_pd);
             prim = std::shared_ptr<mkldnn::sum>(new mkldnn::sum(primitive_desc, srcs_p, dstMemPtr->GetPrimitive()));
@@ -200,6 +577,229 @@ void MKLDNNEltwiseNode::createPrimitive() {
             prim = nullptr;
         }
     }
+
+    if (!prim && canUseJit() && prepareJit()) {
+        jit_eltwise_params jep;
+        jep.op = op;
+        jep.inputs_num = getParentEdges().size();
+        for (size_t i = 0; i < jep.inputs_num; i++) {
+            jep.src_prc[i] = getParentEdgeAt(i)->getDesc().getPrecision();
+            jep.src_kind[i] = jit_src_kinds[i];
+            jep.scales[i] = sum_scales[i];
+        }
+        jep.dst_prc = getChildEdgeAt(0)->getDesc().getPrecision();
+
+        if (mayiuse(cpu_isa_t::avx512_common)) {
+            eltwise_kernel.reset(new jit_uni_eltwise_generic<cpu_isa_t::avx512_common>(jep));
+        } else if (mayiuse(cpu_isa_t::avx2)) {
+            eltwise_kernel.reset(new jit_uni_eltwise_generic<cpu_isa_t::avx2>(jep));
+        } else {
+            eltwise_kernel.reset(new jit_uni_eltwise_generic<cpu_isa_t::sse42>(jep));
+        }
+    }
+}
+
+bool MKLDNNEltwiseNode::prepareJit() {
+    const auto outDesc = getChildEdgeAt(0)->getDesc();
+    const auto &outBlk = outDesc.getBlockingDesc();
+    const auto &outOrder = outBlk.getOrder();
+    const auto outDims = outDesc.getDims();
+    const size_t rank = outOrder.size();
+    const size_t inputs = getParentEdges().size();
+
+    if (rank > MAX_ELTWISE_DIMS || !isJitSupported(op, outDesc.getPrecision(), sum_scales))
+        return false;
+
+    // Element strides of the physical dimensions, broadcast ones step by zero
+    size_t dims[MAX_ELTWISE_DIMS];
+    ptrdiff_t dstStrides[MAX_ELTWISE_DIMS];
+    ptrdiff_t srcStrides[MAX_ELTWISE_INPUTS][MAX_ELTWISE_DIMS];
+    for (size_t k = 0; k < rank; k++) {
+        dims[k] = outBlk.getBlockDims()[k];
+        dstStrides[k] = outBlk.getStrides()[k];
+    }
+    for (size_t i = 0; i < inputs; i++) {
+        const auto inDesc = getParentEdgeAt(i)->getDesc();
+        const auto &inBlk = inDesc.getBlockingDesc();
+        const auto &inOrder = inBlk.getOrder();
+        const auto inDims = inDesc.getDims();
+        Precision prc = inDesc.getPrecision();
+        if (prc != Precision::FP32 && prc != Precision::I32 && prc != Precision::I8 && prc != Precision::U8)
+            return false;
+        if (outDesc.getPrecision() == Precision::I32 && prc == Precision::FP32)
+            return false;
+
+        // plain inputs of a lower rank are aligned to the innermost dimensions of the output
+        size_t shift = rank - inOrder.size();
+        if (inOrder.size() > rank || (shift && (inDims.size() != inOrder.size() || outDims.size() != rank)) ||
+                (!shift && inDims.size() != outDims.size()))
+            return false;
+        for (size_t k = 0; k < rank; k++) {
+            if (k < shift) {
+                srcStrides[i][k] = 0;
+                continue;
+            }
+            size_t d = outOrder[k];
+            if (inOrder[k - shift] + shift != d)
+                return false;
+            if (inDims[d - shift] == outDims[d]) {
+                srcStrides[i][k] = inBlk.getStrides()[k - shift];
+            } else if (inDims[d - shift] == 1 && std::count(outOrder.begin(), outOrder.end(), d) == 1) {
+                srcStrides[i][k] = 0;
+            } else {
+                return false;
+            }
+        }
+    }
+
+    // The batch is cut by the dynamic batch, so it is never merged with other dimensions
+    int batchDim = -1;
+    for (size_t k = 0; k < rank; k++) {
+        if (outOrder[k] == 0) {
+            batchDim = static_cast<int>(k);
+            break;
+        }
+    }
+
+    // Unit dimensions don't affect addressing
+    size_t phys[MAX_ELTWISE_DIMS];
+    int nphys = 0;
+    for (size_t k = 0; k < rank; k++) {
+        if (dims[k] != 1)
+            phys[nphys++] = k;
+    }
+
+    for (size_t i = 0; i < inputs; i++)
+        jit_src_kinds[i] = jit_eltwise_src_kind::full;
+
+    // The innermost run is processed by a kernel call, outer dimensions are merged into it
+    // while the output stays dense and every input keeps its access pattern
+    size_t run = 1;
+    int next = nphys - 1;
+    if (nphys > 0) {
+        size_t k = phys[next--];
+        if (dstStrides[k] != 1)
+            return false;
+        for (size_t i = 0; i < inputs; i++) {
+            if (srcStrides[i][k] == 0)
+                jit_src_kinds[i] = jit_eltwise_src_kind::scalar;
+            else if (srcStrides[i][k] != 1)
+                return false;
+        }
+        run = dims[k];
+
+        const size_t simd_w = mayiuse(cpu_isa_t::avx512_common) ? 16 : mayiuse(cpu_isa_t::avx2) ? 8 : 4;
+        while (next >= 0 && static_cast<int>(k) != batchDim && static_cast<int>(phys[next]) != batchDim) {
+            size_t o = phys[next];
+            if (dstStrides[o] != static_cast<ptrdiff_t>(run))
+                break;
+            jit_eltwise_src_kind kinds[MAX_ELTWISE_INPUTS];
+            bool mergeable = true;
+            for (size_t i = 0; i < inputs && mergeable; i++) {
+                kinds[i] = jit_src_kinds[i];
+                if (jit_src_kinds[i] == jit_eltwise_src_kind::full) {
+                    if (srcStrides[i][o] == 0 && run == simd_w)
+                        kinds[i] = jit_eltwise_src_kind::periodic;
+                    else
+                        mergeable = srcStrides[i][o] == static_cast<ptrdiff_t>(run);
+                } else {
+                    mergeable = srcStrides[i][o] == 0;
+                }
+            }
+            if (!mergeable)
+                break;
+            for (size_t i = 0; i < inputs; i++)
+                jit_src_kinds[i] = kinds[i];
+            run *= dims[o];
+            next--;
+        }
+    }
+
+    // Remaining outer dimensions, contiguous neighbours are collapsed
+    size_t outer[MAX_ELTWISE_DIMS];
+    int nouter = 0;
+    for (int n = 0; n <= next; n++) {
+        size_t k = phys[n];
+        bool collapse = nouter > 0 && static_cast<int>(k) != batchDim &&
+                        static_cast<int>(outer[nouter - 1]) != batchDim &&
+                        dstStrides[outer[nouter - 1]] == dstStrides[k] * static_cast<ptrdiff_t>(dims[k]);
+        for (size_t i = 0; i < inputs && collapse; i++)
+            collapse = srcStrides[i][outer[nouter - 1]] == srcStrides[i][k] * static_cast<ptrdiff_t>(dims[k]);
+        if (collapse) {
+            dims[k] *= dims[outer[nouter - 1]];
+            outer[nouter - 1] = k;
+        } else {
+            outer[nouter++] = k;
+        }
+    }
+
+    jit_batch_dim = -1;
+    jit_ndims = nouter + 1;
+    for (int n = 0; n < nouter; n++) {
+        size_t k = outer[n];
+        if (static_cast<int>(k) == batchDim)
+            jit_batch_dim = n;
+        jit_dims[n] = dims[k];
+        jit_dst_strides[n] = dstStrides[k] * outDesc.getPrecision().size();
+        for (size_t i = 0; i < inputs; i++)
+            jit_src_strides[i][n] = srcStrides[i][k] * getParentEdgeAt(i)->getDesc().getPrecision().size();
+    }
+    jit_dims[nouter] = run;
+    if (nphys > 0 && static_cast<int>(phys[nphys - 1]) == batchDim)
+        jit_batch_dim = nouter;
+
+    return true;
+}
+
+void MKLDNNEltwiseNode::jit_eltwise() {
+    const size_t inputs = getParentEdges().size();
+    const uint8_t *src_ptrs[MAX_ELTWISE_INPUTS];
+    size_t src_sizes[MAX_ELTWISE_INPUTS];
+    for (size_t i = 0; i < inputs; i++) {
+        auto &srcMemory = getParentEdgeAt(i)->getMemory();
+        src_sizes[i] = getParentEdgeAt(i)->getDesc().getPrecision().size();
+        src_ptrs[i] = reinterpret_cast<const uint8_t *>(srcMemory.GetData()) +
+                srcMemory.GetDescriptor().data.layout_desc.blocking.offset_padding * src_sizes[i];
+    }
+    auto &dstMemory = getChildEdgeAt(0)->getMemory();
+    const size_t dst_size = getChildEdgeAt(0)->getDesc().getPrecision().size();
+    uint8_t *dst_ptr = reinterpret_cast<uint8_t *>(dstMemory.GetData()) +
+            dstMemory.GetDescriptor().data.layout_desc.blocking.offset_padding * dst_size;
+
+    size_t dims[MAX_ELTWISE_DIMS];
+    std::copy(jit_dims, jit_dims + jit_ndims, dims);
+    if (jit_batch_dim >= 0)
+        dims[jit_batch_dim] = std::min(dims[jit_batch_dim], static_cast<size_t>(batchToProcess()));
+
+    size_t outer = 1;
+    for (int n = 0; n < jit_ndims - 1; n++)
+        outer *= dims[n];
+    const size_t run = dims[jit_ndims - 1];
+    // a multiple of any vector length, so periodic operands are never split
+    const size_t chunk = 4096;
+    const size_t chunks = (run + chunk - 1) / chunk;
+
+    parallel_for2d(outer, chunks, [&](size_t o, size_t c) {
+        ptrdiff_t dst_offset = 0;
+        ptrdiff_t src_offsets[MAX_ELTWISE_INPUTS] = {};
+        for (int n = jit_ndims - 2; n >= 0; n--) {
+            size_t pos = o % dims[n];
+            o /= dims[n];
+            dst_offset += pos * jit_dst_strides[n];
+            for (size_t i = 0; i < inputs; i++)
+                src_offsets[i] += pos * jit_src_strides[i][n];
+        }
+
+        const size_t start = c * chunk;
+        jit_eltwise_call_args args;
+        for (size_t i = 0; i < inputs; i++) {
+            args.src_ptr[i] = src_ptrs[i] + src_offsets[i] +
+                    (jit_src_kinds[i] == jit_eltwise_src_kind::full ? start * src_sizes[i] : 0);
+        }
+        args.dst = dst_ptr + dst_offset + start * dst_size;
+        args.work_amount = std::min(chunk, run - start);
+        (*eltwise_kernel)(&args);
+    });
 }
 
 void MKLDNNEltwiseNode::initOptimalPrimitiveDescriptor() {
@@ -2059,6 +2659,8 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::ref_eltwise(int in0,
 void MKLDNNEltwiseNode::execute(mkldnn::stream strm) {
     if (prim) {
         MKLDNNNode::execute(strm);
+    } else if (eltwise_kernel) {
+        jit_eltwise();
     } else {
         if (op == EltwiseLayer::Floor_mod) {
             for (size_t i = 0; i < getParentEdges().size(); i++)
@@ -8,9 +8,52 @@
 #include <mkldnn_node.h>
 #include <string>
 #include <vector>
+#include <memory>
+#include <cassert>
 
 namespace MKLDNNPlugin {
 
+#define MAX_ELTWISE_INPUTS 7
+#define MAX_ELTWISE_DIMS 8
+
+/**
+ * @brief How the kernel reads an input along the innermost (collapsed) dimension
+ */
+enum class jit_eltwise_src_kind {
+    full,       // one element per output element
+    scalar,     // one element broadcast to the whole run
+    periodic    // one vector register of elements repeated along the run
+};
+
+struct jit_eltwise_params {
+    InferenceEngine::EltwiseLayer::eOperation op;
+    size_t inputs_num;
+    InferenceEngine::Precision src_prc[MAX_ELTWISE_INPUTS];
+    jit_eltwise_src_kind src_kind[MAX_ELTWISE_INPUTS];
+    float scales[MAX_ELTWISE_INPUTS];
+    InferenceEngine::Precision dst_prc;
+};
+
+struct jit_eltwise_call_args {
+    const void *src_ptr[MAX_ELTWISE_INPUTS];
+    void *dst;
+    size_t work_amount;
+};
+
+struct jit_uni_eltwise_kernel {
+    void (*ker_)(const jit_eltwise_call_args *);
+
+    void operator()(const jit_eltwise_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_eltwise_kernel(jit_eltwise_params jep) : ker_(nullptr), jep_(jep) {}
+    virtual ~jit_uni_eltwise_kernel() {}
+
+    jit_eltwise_params jep_;
+};
+
 class MKLDNNEltwiseNode : public MKLDNNNode {
 public:
     MKLDNNEltwiseNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, int socket);
@@ -35,6 +78,20 @@ private:
     bool broadcast = false;
     int batch_dim = 5;
 
+    std::shared_ptr<jit_uni_eltwise_kernel> eltwise_kernel;
+    // broadcasting plan of the kernel: collapsed output dims, the last one is processed by a kernel call
+    int jit_ndims = 0;
+    size_t jit_dims[MAX_ELTWISE_DIMS];
+    ptrdiff_t jit_dst_strides[MAX_ELTWISE_DIMS];
+    ptrdiff_t jit_src_strides[MAX_ELTWISE_INPUTS][MAX_ELTWISE_DIMS];
+    jit_eltwise_src_kind jit_src_kinds[MAX_ELTWISE_INPUTS];
+    int jit_batch_dim = -1;
+
+    bool canUseJit() const;
+    InferenceEngine::Precision getJitInputPrecision(size_t i) const;
+    bool prepareJit();
+    void jit_eltwise();
+
     template <typename T0, typename T1> void ref_eltwise(int in0, int in1);
     void dims_calc(int *dims, const MKLDNNDims &edge_dims);
     void offset_out_calc(int *offset, int *dims);
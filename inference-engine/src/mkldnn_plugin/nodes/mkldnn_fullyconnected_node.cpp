@@ -114,12 +114,24 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
         }
     }
 
-    for (auto format : getAvailableFormatsForDims(getParentEdgeAt(0)->getDims())) {
-        MKLDNNMemoryDesc in_candidate(inDims, inputDataType, format);
-        MKLDNNMemoryDesc out_candidate(getChildEdgeAt(0)->getDims(), outputDataType, memory::any);
+    auto createDescriptors = [&](memory::data_type srcDataType, memory::data_type dstDataType) {
+        for (auto format : getAvailableFormatsForDims(getParentEdgeAt(0)->getDims())) {
+            MKLDNNMemoryDesc in_candidate(inDims, srcDataType, format);
+            MKLDNNMemoryDesc out_candidate(getChildEdgeAt(0)->getDims(), dstDataType, memory::any);
 
-        createDescriptor({in_candidate}, {out_candidate});
+            createDescriptor({in_candidate}, {out_candidate});
+        }
+    };
+
+    if (enforceBF16 && inputDataType == memory::f32 && outputDataType == memory::f32 &&
+            weights->getTensorDesc().getPrecision() == Precision::FP32) {
+        // the bfloat16 gemm reads the activations and the weights in bfloat16 and writes the output in FP32
+        createDescriptors(memory::bf16, memory::f32);
+        if (hasImplementations(*initPrimitiveAttr()))
+            return;
+        descs.clear();
     }
+    createDescriptors(inputDataType, outputDataType);
 }
 
 void MKLDNNFullyConnectedNode::createPrimitive() {
@@ -245,6 +257,9 @@ void MKLDNNFullyConnectedNode::createDescriptor(const std::vector<InferenceEngin
     TensorDesc inDesc = inputDesc[0], outDesc = outputDesc[0];
     mkldnn::memory::data_type wdt = MKLDNNExtensionUtils::IEPrecisionToDataType(inDesc.getPrecision());
     mkldnn::memory::data_type bdt = MKLDNNExtensionUtils::IEPrecisionToDataType(inDesc.getPrecision());
+    // bfloat16 kernels take the biases in FP32
+    if (bdt == memory::bf16)
+        bdt = memory::f32;
 
     Blob::Ptr weights = this->getCnnLayer()->blobs.find("weights")->second;
 
@@ -69,6 +69,8 @@ void MKLDNNGenericNode::initSupportedPrimitiveDescriptors() {
 
 void MKLDNNGenericNode::createPrimitive() {
     if (extFactory) {
+        resetExecBlobs();
+        execBlobs.emplace(getMaxBatch(), createExecBlobs(getMaxBatch()));
         return;
     }
     if (getSelectedPrimitiveDescriptor() == nullptr)
@@ -105,60 +107,90 @@ void MKLDNNGenericNode::cleanup() {
     extFactory.reset();
 }
 
-void MKLDNNGenericNode::execLayer() {
-    bool isDynBatch = dynBatchLim > 0;
-    std::vector<InferenceEngine::Blob::Ptr> inputs;
-    std::vector<InferenceEngine::Blob::CPtr> constInputs;
-    std::vector<InferenceEngine::TensorDesc> inputDescs;
-    std::vector<InferenceEngine::SizeVector> outputShapes;
+bool MKLDNNGenericNode::edgesDataChanged() const {
+    size_t idx = 0;
+    for (size_t i = 0; i < getParentEdges().size(); i++, idx++) {
+        if (idx >= execBlobsData.size() || execBlobsData[idx] != getParentEdgeAt(i)->getMemory().GetData())
+            return true;
+    }
+    for (size_t i = 0; i < outDims.size(); i++, idx++) {
+        if (idx >= execBlobsData.size() || execBlobsData[idx] != getChildEdgesAtPort(i)[0]->getMemory().GetData())
+            return true;
+    }
+    return idx != execBlobsData.size();
+}
+
+void MKLDNNGenericNode::resetExecBlobs() {
+    execBlobs.clear();
+    execBlobsData.clear();
+    for (size_t i = 0; i < getParentEdges().size(); i++)
+        execBlobsData.push_back(getParentEdgeAt(i)->getMemory().GetData());
+    for (size_t i = 0; i < outDims.size(); i++)
+        execBlobsData.push_back(getChildEdgesAtPort(i)[0]->getMemory().GetData());
+}
+
+MKLDNNGenericNode::ExecBlobs MKLDNNGenericNode::createExecBlobs(int batch) {
+    ExecBlobs result;
+    bool isDynBatch = batch < getMaxBatch();
     for (size_t i = 0; i < getParentEdges().size(); i++) {
         auto inputBlob = getParentEdgeAt(i)->getBlob();
-        inputs.push_back(inputBlob);
-        constInputs.push_back(inputBlob);
-        if (isDynBatch && dynBatchLim >= inputs[inputs.size() - 1]->getTensorDesc().getDims()[0]) {
+        if (static_cast<size_t>(batch) >= inputBlob->getTensorDesc().getDims()[0])
             isDynBatch = false;
-        } else {
-            // TODO: Ask the right dims using getShape() from previous node
-            inputDescs.push_back(inputs[inputs.size() - 1]->getTensorDesc());
-            inputDescs[inputDescs.size() - 1].getDims()[0] = static_cast<size_t>(batchToProcess());
-        }
+        result.inputs.push_back(inputBlob);
     }
 
+    std::vector<InferenceEngine::Blob::Ptr> dynInputs;
+    std::vector<InferenceEngine::SizeVector> outputShapes;
     if (isDynBatch) {
-        if (extShapeInference) {
-            auto sts = extShapeInference->inferShapes(constInputs, params, blobs, outputShapes, nullptr);
-            if (sts != InferenceEngine::StatusCode::OK)
-                isDynBatch = false;
-        } else {
-            isDynBatch = false;
+        // TODO: Ask the right dims using getShape() from previous node
+        std::vector<InferenceEngine::Blob::CPtr> constInputs;
+        for (size_t i = 0; i < result.inputs.size(); i++) {
+            auto td = result.inputs[i]->getTensorDesc();
+            auto dims = td.getDims();
+            dims[0] = static_cast<size_t>(batch);
+            td.setDims(dims);
+            dynInputs.push_back(make_blob_with_precision(td, getParentEdgeAt(i)->getMemory().GetData()));
+            constInputs.push_back(dynInputs.back());
         }
+        if (!extShapeInference ||
+            extShapeInference->inferShapes(constInputs, params, blobs, outputShapes, nullptr) != InferenceEngine::OK ||
+            outputShapes.size() < outDims.size())
+            isDynBatch = false;
     }
 
-    if (isDynBatch) {
-        for (size_t i = 0; i < inputs.size(); i++) {
-            auto td = inputs[i]->getTensorDesc();
-            td.setDims(inputDescs[i].getDims());
-            inputs[i] = make_blob_with_precision(td, getParentEdgeAt(i)->getMemory().GetData());
-        }
-    }
-    std::vector<InferenceEngine::Blob::Ptr> outputs;
+    if (isDynBatch)
+        result.inputs = dynInputs;
     for (size_t i = 0; i < outDims.size(); i++) {
+        auto out_edge = getChildEdgesAtPort(i)[0];
+        auto outputBlob = out_edge->getBlob();
         if (isDynBatch) {
-            auto out_edge = getChildEdgesAtPort(i)[0];
-            auto td = out_edge->getBlob()->getTensorDesc();
+            auto td = outputBlob->getTensorDesc();
             td.setDims(outputShapes[i]);
-            outputs.push_back(make_blob_with_precision(td, out_edge->getMemory().GetData()));
-        } else {
-            outputs.push_back(getChildEdgesAtPort(i)[0]->getBlob());
+            outputBlob = make_blob_with_precision(td, out_edge->getMemory().GetData());
         }
+        result.outputs.push_back(outputBlob);
     }
+    return result;
+}
+
+void MKLDNNGenericNode::execLayer() {
     auto * execImpl = dynamic_cast<InferenceEngine::ILayerExecImpl *>(impls[0].get());
-    if (execImpl != nullptr) {
-        InferenceEngine::ResponseDesc resp;
-        InferenceEngine::StatusCode rc = execImpl->execute(inputs, outputs, &resp);
-        if (rc != InferenceEngine::OK) {
-            THROW_IE_EXCEPTION << resp.msg;
-        }
+    if (execImpl == nullptr)
+        return;
+
+    if (edgesDataChanged()) {
+        resetExecBlobs();
+    }
+
+    int batch = batchToProcess();
+    auto it = execBlobs.find(batch);
+    if (it == execBlobs.end())
+        it = execBlobs.emplace(batch, createExecBlobs(batch)).first;
+
+    InferenceEngine::ResponseDesc resp;
+    InferenceEngine::StatusCode rc = execImpl->execute(it->second.inputs, it->second.outputs, &resp);
+    if (rc != InferenceEngine::OK) {
+        THROW_IE_EXCEPTION << resp.msg;
     }
 }
 
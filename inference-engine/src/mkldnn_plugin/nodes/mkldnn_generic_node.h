@@ -43,6 +43,20 @@ protected:
     std::map<std::string, InferenceEngine::Blob::Ptr> blobs;
 
 private:
+    struct ExecBlobs {
+        std::vector<InferenceEngine::Blob::Ptr> inputs;
+        std::vector<InferenceEngine::Blob::Ptr> outputs;
+    };
+
+    bool edgesDataChanged() const;
+    void resetExecBlobs();
+    ExecBlobs createExecBlobs(int batch);
+
+    // Wrappers of the edge memory passed to the extension, built once per batch size.
+    // They are dropped only when the data pointer of any edge is changed.
+    std::map<int, ExecBlobs> execBlobs;
+    std::vector<void *> execBlobsData;
+
     static Register<MKLDNNGenericNode> reg;
 };
 
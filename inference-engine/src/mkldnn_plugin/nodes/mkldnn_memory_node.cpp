@@ -12,15 +12,7 @@ using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 
 MKLDNNMemoryOutputNode::MKLDNNMemoryOutputNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, int socket)
-        : MKLDNNNode(layer, eng, socket) , MKLDNNMemoryNode(layer) {
-    if (created()) {
-        MKLDNNMemoryNodeVirtualEdge::registerOutput(this);
-    }
-}
-
-MKLDNNMemoryOutputNode::~MKLDNNMemoryOutputNode() {
-    MKLDNNMemoryNodeVirtualEdge::remove(this);
-}
+        : MKLDNNNode(layer, eng, socket) , MKLDNNMemoryNode(layer) {}
 
 void MKLDNNMemoryOutputNode::getSupportedDescriptors() {}
 
@@ -53,7 +45,8 @@ void MKLDNNMemoryOutputNode::execute(mkldnn::stream strm)  {
 
     const float *src_ptr = reinterpret_cast<const float*>(srcMemory.GetData()) +
             srcMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
-    float *dst_ptr = reinterpret_cast<float*>(getChildEdgeAt(0)->getMemory().GetData()) +
+    float *dst_ptr = stateBuffer ? reinterpret_cast<float*>(stateBuffer) :
+            reinterpret_cast<float*>(getChildEdgeAt(0)->getMemory().GetData()) +
             getChildEdgeAt(0)->getMemory().GetDescriptor().data.layout_desc.blocking.offset_padding;
 
     // TODO: this can be eliminated by completely removing MKLDNN memory output NODE, to fuse it with output of prev layer
@@ -71,38 +64,4 @@ std::string MKLDNNMemoryInputNode::idFromCombinedName(std::string name) {
 }
 
 MKLDNNMemoryInputNode::MKLDNNMemoryInputNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, int socket)
-        : MKLDNNInputNode(layer, eng, socket), MKLDNNMemoryNode(layer) {
-    if (created()) {
-        MKLDNNMemoryNodeVirtualEdge::registerInput(this);
-    }
-}
-
-MKLDNNMemoryInputNode::~MKLDNNMemoryInputNode() {
-    MKLDNNMemoryNodeVirtualEdge::remove(this);
-}
-
-void MKLDNNMemoryNodeVirtualEdge::registerInput(MKLDNNMemoryInputNode * node) {
-    // in case of output already registered
-    auto sibling = MKLDNNMemoryNodeVirtualEdge::getByName(node->getId());
-    if (sibling != nullptr) {
-        auto outputNode = dynamic_cast<MKLDNNMemoryOutputNode*>(sibling);
-        IE_ASSERT(outputNode != nullptr);
-        outputNode->setInputNode(node);
-    } else {
-        getExisted()[node->getId()] = node;
-    }
-    // std::cout <<"[register] " << node << ", size="<< getExisted().size() <<"\n" << std::flush;
-}
-
-void MKLDNNMemoryNodeVirtualEdge::registerOutput(MKLDNNMemoryOutputNode * node) {
-    // in case of output layer
-    auto sibling = MKLDNNMemoryNodeVirtualEdge::getByName(node->getId());
-    if (sibling != nullptr) {
-        auto inputNode = dynamic_cast<MKLDNNMemoryInputNode*>(sibling);
-        IE_ASSERT(inputNode != nullptr);
-        node->setInputNode(inputNode);
-    } else {
-        getExisted()[node->getId()] = node;
-    }
-    // std::cout <<"[register] " << node << ", size="<< getExisted().size() <<"\n" << std::flush;
-}
+        : MKLDNNInputNode(layer, eng, socket), MKLDNNMemoryNode(layer) {}
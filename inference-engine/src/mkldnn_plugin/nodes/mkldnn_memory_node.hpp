@@ -29,43 +29,15 @@ class MKLDNNMemoryNode {
     }
     virtual void setInputNode(MKLDNNNode *) = 0;
 };
-class MKLDNNMemoryOutputNode;
-class MKLDNNMemoryInputNode;
 
 /**
- * @brief
- * TODO: ATTENTION: this is a temporary solution, this connection should be keep in graph
+ * @brief Writes the new state of the memory layer, the MemoryInput node of the same id reads it by the next inference.
+ * The nodes are paired within the graph, so the graphs of different streams don't share the state.
  */
-class MKLDNNMemoryNodeVirtualEdge {
-    using Holder = std::map<std::string, MKLDNNMemoryNode*>;
-    static Holder & getExisted() {
-        static Holder existed;
-        return existed;
-    }
-
-    static MKLDNNMemoryNode * getByName(std::string name) {
-        auto result = getExisted().find(name);
-        if (result != getExisted().end()) {
-            return result->second;
-        }
-        return nullptr;
-    }
-
- public:
-    static void registerOutput(MKLDNNMemoryOutputNode * node);
-    static void registerInput(MKLDNNMemoryInputNode * node);
-    static void remove(MKLDNNMemoryNode * node) {
-        InferenceEngine::details::erase_if(getExisted(), [&](const Holder::value_type & it){
-            return it.second == node;
-        });
-        // std::cout <<"[remove]   " << node << ", size="<< getExisted().size() <<"\n" << std::flush;
-    }
-};
-
 class MKLDNNMemoryOutputNode : public MKLDNNNode, public MKLDNNMemoryNode {
  public:
     MKLDNNMemoryOutputNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, int socket);
-    ~MKLDNNMemoryOutputNode() override;
+    ~MKLDNNMemoryOutputNode() override = default;
     void getSupportedDescriptors() override;
     void initSupportedPrimitiveDescriptors() override;
     const MKLDNNEdgePtr getChildEdgeAt(size_t idx) const override;
@@ -78,11 +50,20 @@ class MKLDNNMemoryOutputNode : public MKLDNNNode, public MKLDNNMemoryNode {
     void setInputNode(MKLDNNNode* node) override {
         inputNode = node;
     }
+
+    /**
+     * @brief Sets the buffer the state is written to instead of the memory of the input sibling,
+     * it is the spare buffer of the state owned by the running infer request
+     */
+    void setStateBuffer(void *buffer) {
+        stateBuffer = buffer;
+    }
  private:
     /**
      * @brief keeps reference to input sibling node
      */
     MKLDNNNode* inputNode = nullptr;
+    void *stateBuffer = nullptr;
     static Register<MKLDNNMemoryOutputNode> reg;
 };
 
@@ -93,7 +74,7 @@ class MKLDNNMemoryInputNode : public MKLDNNInputNode, public MKLDNNMemoryNode {
     static std::string idFromCombinedName(std::string name);
  public:
     MKLDNNMemoryInputNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, int socket);
-    ~MKLDNNMemoryInputNode() override;
+    ~MKLDNNMemoryInputNode() override = default;
 
     bool created() const override {
         return getType() == MemoryInput;
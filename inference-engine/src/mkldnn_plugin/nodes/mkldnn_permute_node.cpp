@@ -5,13 +5,123 @@
 #include "mkldnn_permute_node.h"
 #include <ie_layers.h>
 #include <string>
+#include <vector>
+#include <algorithm>
+#include <cstring>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
 #include "ie_parallel.hpp"
+#include "jit_generator.hpp"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
+using namespace mkldnn::impl::cpu;
+using namespace Xbyak;
+
+#define GET_OFF(field) offsetof(jit_permute_call_args, field)
+
+/**
+ * @brief Transposes the tile in square blocks of simd_w x simd_w registers: the rows of the source block are
+ * loaded, shuffled in registers and stored as the rows of the destination block
+ */
+template <cpu_isa_t isa>
+struct jit_uni_permute_kernel_f32 : public jit_uni_permute_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_permute_kernel_f32)
+
+    explicit jit_uni_permute_kernel_f32(size_t tile) : jit_uni_permute_kernel(tile), jit_generator() {
+        assert(tile % simd_w == 0);
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_src_stride, ptr[reg_params + GET_OFF(src_stride)]);
+        mov(reg_dst_stride, ptr[reg_params + GET_OFF(dst_stride)]);
+
+        const int blocks = static_cast<int>(tile / simd_w);
+        for (int bl = 0; bl < blocks; bl++) {
+            // the rows of the source block bl are the columns of the destination one
+            mov(reg_dst_blk, reg_dst);
+            for (int bs = 0; bs < blocks; bs++) {
+                mov(reg_aux, reg_src);
+                for (int r = 0; r < simd_w; r++) {
+                    uni_vmovups(Vmm(r), ptr[reg_aux + bs * simd_w * sizeof(float)]);
+                    add(reg_aux, reg_src_stride);
+                }
+
+                transpose();
+
+                for (int r = 0; r < simd_w; r++) {
+                    uni_vmovups(ptr[reg_dst_blk + bl * simd_w * sizeof(float)], get_out_vmm(r));
+                    add(reg_dst_blk, reg_dst_stride);
+                }
+            }
+            for (int r = 0; r < simd_w; r++)
+                add(reg_src, reg_src_stride);
+        }
+
+        this->postamble();
+
+        ker_ = (decltype(ker_))this->getCode();
+    }
+
+private:
+    using Vmm = typename mkldnn::impl::utils::conditional<isa == cpu_isa_t::sse42, Xmm, Ymm>::type;
+    const int simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+
+    Reg64 reg_src = r8;
+    Reg64 reg_dst = r9;
+    Reg64 reg_src_stride = r10;
+    Reg64 reg_dst_stride = r11;
+    Reg64 reg_dst_blk = r12;
+    Reg64 reg_aux = r13;
+    Reg64 reg_params = abi_param1;
+
+    // the rows are loaded into the registers 0 .. simd_w - 1 and the transposed ones are left in
+    // simd_w .. 2 * simd_w - 1 for ymm and in 0 .. simd_w - 1 for xmm
+    Vmm get_out_vmm(int r) {
+        return isa == cpu_isa_t::sse42 ? Vmm(r) : Vmm(simd_w + r);
+    }
+
+    void transpose() {
+        if (isa == cpu_isa_t::sse42) {
+            // 4x4: pairs of the interleaved rows give the halves of the columns
+            movaps(xmm4, xmm0);
+            unpcklps(xmm4, xmm1);
+            movaps(xmm5, xmm0);
+            unpckhps(xmm5, xmm1);
+            movaps(xmm6, xmm2);
+            unpcklps(xmm6, xmm3);
+            movaps(xmm7, xmm2);
+            unpckhps(xmm7, xmm3);
+
+            movaps(xmm0, xmm4);
+            movlhps(xmm0, xmm6);
+            movaps(xmm1, xmm6);
+            movhlps(xmm1, xmm4);
+            movaps(xmm2, xmm5);
+            movlhps(xmm2, xmm7);
+            movaps(xmm3, xmm7);
+            movhlps(xmm3, xmm5);
+        } else {
+            // 8x8: 4x4 transposes in both 128 bit lanes, then the lanes are exchanged
+            for (int i = 0; i < 8; i += 2) {
+                vunpcklps(Ymm(8 + i), Ymm(i), Ymm(i + 1));
+                vunpckhps(Ymm(9 + i), Ymm(i), Ymm(i + 1));
+            }
+            for (int i = 0; i < 8; i += 4) {
+                vshufps(Ymm(i), Ymm(8 + i), Ymm(10 + i), 0x44);
+                vshufps(Ymm(i + 1), Ymm(8 + i), Ymm(10 + i), 0xEE);
+                vshufps(Ymm(i + 2), Ymm(9 + i), Ymm(11 + i), 0x44);
+                vshufps(Ymm(i + 3), Ymm(9 + i), Ymm(11 + i), 0xEE);
+            }
+            for (int i = 0; i < 4; i++) {
+                vperm2f128(Ymm(8 + i), Ymm(i), Ymm(4 + i), 0x20);
+                vperm2f128(Ymm(12 + i), Ymm(i), Ymm(4 + i), 0x31);
+            }
+        }
+    }
+};
 
 MKLDNNPermuteNode::MKLDNNPermuteNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, int socket)
         : MKLDNNNode(layer, eng, socket) {}
@@ -37,14 +147,15 @@ void MKLDNNPermuteNode::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
+    // the data is only moved, so any precision of 1, 2 or 4 bytes is kept to avoid conversions around the node
     InferenceEngine::Precision precision = getCnnLayer()->insData[0].lock()->getPrecision();
-    if (precision != InferenceEngine::Precision::FP32)
+    if (precision != getCnnLayer()->outData[0]->getPrecision() ||
+        (precision != InferenceEngine::Precision::FP32 && precision != InferenceEngine::Precision::I32 &&
+         precision != InferenceEngine::Precision::I16 && precision != InferenceEngine::Precision::BF16 &&
+         precision != InferenceEngine::Precision::I8 && precision != InferenceEngine::Precision::U8))
         precision = InferenceEngine::Precision::FP32;
     auto inputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(precision);
-    precision = getCnnLayer()->outData[0]->getPrecision();
-    if (precision != InferenceEngine::Precision::FP32)
-        precision = InferenceEngine::Precision::FP32;
-    auto outputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(precision);
+    auto outputDataType = inputDataType;
 
     InferenceEngine::LayerConfig config;
     config.dynBatchSupport = true;
@@ -101,6 +212,227 @@ void MKLDNNPermuteNode::createPrimitive() {
         THROW_IE_EXCEPTION << "Input memory didn't allocate.";
     if (getSelectedPrimitiveDescriptor() == nullptr)
         THROW_IE_EXCEPTION << "Preferable primitive descriptor is not set.";
+
+    prepareTransposePlan();
+
+    permute_kernel.reset();
+    if (plan.kind == TransposePlan::tiles && plan.elemSize == sizeof(float)) {
+        if (mayiuse(cpu_isa_t::avx2)) {
+            permute_kernel.reset(new jit_uni_permute_kernel_f32<cpu_isa_t::avx2>(plan.tile));
+        } else if (mayiuse(cpu_isa_t::sse42)) {
+            permute_kernel.reset(new jit_uni_permute_kernel_f32<cpu_isa_t::sse42>(plan.tile));
+        }
+    }
+}
+
+void MKLDNNPermuteNode::prepareTransposePlan() {
+    auto &srcMemPtr = getParentEdgeAt(0)->getMemoryPtr();
+    auto &dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    const auto src = srcMemPtr->GetDescriptor().data;
+    const auto dst = dstMemPtr->GetDescriptor().data;
+    const auto &srcBlk = src.layout_desc.blocking;
+    const auto &dstBlk = dst.layout_desc.blocking;
+    const int ndims = src.ndims;
+    if (ndims != static_cast<int>(order.size()) || dst.ndims != ndims)
+        THROW_IE_EXCEPTION << "Permute layer " << getName() << " has order which doesn't match the input dimensions";
+
+    // destination strides of the source dimensions
+    std::vector<ptrdiff_t> dstStrides(ndims);
+    for (int j = 0; j < ndims; j++) {
+        if (dstBlk.block_dims[j] != 1)
+            THROW_IE_EXCEPTION << "Permute layer " << getName() << " supports only plain output layouts";
+        dstStrides[order[j]] = dstBlk.strides[0][j];
+    }
+
+    // a blocked source dimension is split into the outer and the inner (block) loops
+    typedef TransposePlan::Loop Loop;
+    std::vector<Loop> loops;
+    for (int d = 0; d < ndims; d++) {
+        const ptrdiff_t block = srcBlk.block_dims[d];
+        if (src.dims[d] % block != 0)
+            THROW_IE_EXCEPTION << "Permute layer " << getName() << " doesn't support padded blocked input";
+        loops.push_back({static_cast<size_t>(src.dims[d] / block), srcBlk.strides[0][d], dstStrides[d] * block, d == 0});
+        if (block > 1)
+            loops.push_back({static_cast<size_t>(block), srcBlk.strides[1][d], dstStrides[d], false});
+    }
+
+    loops.erase(std::remove_if(loops.begin(), loops.end(), [](const Loop &loop) {
+        return loop.size == 1 && !loop.batch;
+    }), loops.end());
+    std::stable_sort(loops.begin(), loops.end(), [](const Loop &a, const Loop &b) {
+        return a.dstStride > b.dstStride;
+    });
+
+    plan = TransposePlan();
+    for (auto &loop : loops) {
+        if (!plan.loops.empty()) {
+            auto &outer = plan.loops.back();
+            if (!outer.batch && !loop.batch &&
+                outer.srcStride == loop.srcStride * static_cast<ptrdiff_t>(loop.size) &&
+                outer.dstStride == loop.dstStride * static_cast<ptrdiff_t>(loop.size)) {
+                outer.size *= loop.size;
+                outer.srcStride = loop.srcStride;
+                outer.dstStride = loop.dstStride;
+                continue;
+            }
+        }
+        plan.loops.push_back(loop);
+    }
+
+    plan.elemSize = MKLDNNExtensionUtils::sizeOfDataType(srcMemPtr->GetDataType());
+    plan.srcOffset = srcBlk.offset_padding;
+    plan.dstOffset = dstBlk.offset_padding;
+
+    // the innermost loop writes sequentially, look for the loop which reads sequentially
+    if (!plan.loops.empty() && plan.loops.back().dstStride == 1) {
+        plan.inner = plan.loops.back();
+        plan.loops.pop_back();
+    }
+
+    auto seq = std::find_if(plan.loops.begin(), plan.loops.end(), [](const Loop &loop) { return loop.srcStride == 1; });
+    if (plan.inner.srcStride == 1) {
+        plan.kind = TransposePlan::rows;
+    } else if (seq == plan.loops.end()) {
+        plan.kind = TransposePlan::gather;
+    } else {
+        // tiles of a cache line of the destination wide, the two innermost loops of the work walk over them
+        plan.kind = TransposePlan::tiles;
+        plan.tile = 64 / plan.elemSize;
+        plan.outer = *seq;
+        plan.loops.erase(seq);
+        const auto tile = static_cast<ptrdiff_t>(plan.tile);
+        plan.loops.push_back({(plan.outer.size + plan.tile - 1) / plan.tile, tile, tile * plan.outer.dstStride, false});
+        plan.loops.push_back({(plan.inner.size + plan.tile - 1) / plan.tile, tile * plan.inner.srcStride, tile, false});
+    }
+
+    if (plan.loops.size() > MAX_PERMUTE_LOOPS)
+        THROW_IE_EXCEPTION << "Permute layer " << getName() << " has too many dimensions";
+    for (size_t i = 0; i < plan.loops.size(); i++) {
+        if (plan.loops[i].batch)
+            plan.batchLoop = static_cast<int>(i);
+    }
+}
+
+namespace {
+
+/**
+ * @brief Calls func(srcOffset, dstOffset, indices) for the items [start, end) of the n nested loops
+ * of the given sizes
+ */
+template <typename Loop, typename F>
+void forEachItem(const Loop *loops, const size_t *sizes, size_t n, size_t start, size_t end, const F &func) {
+    size_t idx[MAX_PERMUTE_LOOPS];
+    ptrdiff_t srcOff = 0, dstOff = 0;
+    size_t rem = start;
+    for (size_t i = n; i-- > 0;) {
+        idx[i] = rem % sizes[i];
+        rem /= sizes[i];
+        srcOff += idx[i] * loops[i].srcStride;
+        dstOff += idx[i] * loops[i].dstStride;
+    }
+    for (size_t item = start; item < end; item++) {
+        func(srcOff, dstOff, idx);
+        for (size_t i = n; i-- > 0;) {
+            srcOff += loops[i].srcStride;
+            dstOff += loops[i].dstStride;
+            if (++idx[i] < sizes[i])
+                break;
+            srcOff -= sizes[i] * loops[i].srcStride;
+            dstOff -= sizes[i] * loops[i].dstStride;
+            idx[i] = 0;
+        }
+    }
+}
+
+// the tile is a cache line of the destination wide, the loops of constant size are unrolled and vectorized
+template <typename T, size_t tile>
+void transposeTile(const T *src, T *dst, ptrdiff_t srcStride, ptrdiff_t dstStride) {
+    for (size_t s = 0; s < tile; s++)
+        for (size_t l = 0; l < tile; l++)
+            dst[l + s * dstStride] = src[l * srcStride + s];
+}
+
+template <typename T>
+void transposeTile(const T *src, T *dst, ptrdiff_t srcStride, ptrdiff_t dstStride, size_t ns, size_t nl) {
+    for (size_t s = 0; s < ns; s++)
+        for (size_t l = 0; l < nl; l++)
+            dst[l + s * dstStride] = src[l * srcStride + s];
+}
+
+}  // namespace
+
+template <typename T>
+void MKLDNNPermuteNode::executeTransposePlan(int MB) {
+    typedef TransposePlan::Loop Loop;
+    auto src = reinterpret_cast<const T *>(getParentEdgeAt(0)->getMemoryPtr()->GetData()) + plan.srcOffset;
+    auto dst = reinterpret_cast<T *>(getChildEdgeAt(0)->getMemoryPtr()->GetData()) + plan.dstOffset;
+
+    // only the sizes change with the dynamic batch
+    const size_t n = plan.loops.size();
+    const Loop *loops = plan.loops.data();
+    const size_t innerSize = plan.inner.batch ? std::min<size_t>(plan.inner.size, MB) : plan.inner.size;
+    const size_t outerSize = plan.outer.batch ? std::min<size_t>(plan.outer.size, MB) : plan.outer.size;
+    size_t sizes[MAX_PERMUTE_LOOPS];
+    for (size_t i = 0; i < n; i++)
+        sizes[i] = loops[i].size;
+    if (plan.batchLoop >= 0)
+        sizes[plan.batchLoop] = std::min<size_t>(sizes[plan.batchLoop], MB);
+    const size_t tile = plan.tile;
+    if (plan.kind == TransposePlan::tiles) {
+        sizes[n - 2] = (outerSize + tile - 1) / tile;
+        sizes[n - 1] = (innerSize + tile - 1) / tile;
+    }
+    size_t work = 1;
+    for (size_t i = 0; i < n; i++)
+        work *= sizes[i];
+
+    if (plan.kind == TransposePlan::rows) {
+        // both sides are contiguous: plain copy of the rows
+        const size_t rowSize = innerSize * sizeof(T);
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(work, nthr, ithr, start, end);
+            forEachItem(loops, sizes, n, start, end, [&](ptrdiff_t srcOff, ptrdiff_t dstOff, const size_t *) {
+                std::memcpy(dst + dstOff, src + srcOff, rowSize);
+            });
+        });
+        return;
+    }
+
+    const ptrdiff_t innerStride = plan.inner.srcStride;
+    if (plan.kind == TransposePlan::gather) {
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(work, nthr, ithr, start, end);
+            forEachItem(loops, sizes, n, start, end, [&](ptrdiff_t srcOff, ptrdiff_t dstOff, const size_t *) {
+                for (size_t l = 0; l < innerSize; l++)
+                    dst[dstOff + l] = src[srcOff + l * innerStride];
+            });
+        });
+        return;
+    }
+
+    const ptrdiff_t outerStride = plan.outer.dstStride;
+    auto kernel = permute_kernel.get();
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(work, nthr, ithr, start, end);
+        forEachItem(loops, sizes, n, start, end, [&](ptrdiff_t srcOff, ptrdiff_t dstOff, const size_t *idx) {
+            const size_t ns = std::min(tile, outerSize - idx[n - 2] * tile);
+            const size_t nl = std::min(tile, innerSize - idx[n - 1] * tile);
+            if (ns == tile && nl == tile) {
+                if (kernel) {
+                    jit_permute_call_args args = {src + srcOff, dst + dstOff,
+                                                  innerStride * sizeof(T), outerStride * sizeof(T)};
+                    (*kernel)(&args);
+                } else {
+                    transposeTile<T, 64 / sizeof(T)>(src + srcOff, dst + dstOff, innerStride, outerStride);
+                }
+            } else {
+                transposeTile<T>(src + srcOff, dst + dstOff, innerStride, outerStride, ns, nl);
+            }
+        });
+    });
 }
 
 static void permute_to_0231(int MB, MKLDNNMemoryPtr& srcMemPtr, MKLDNNMemoryPtr& dstMemPtr) {
@@ -555,31 +887,24 @@ std::multimap<InferenceEngine::SizeVector, MKLDNNPermuteNode::PermuteImpl> MKLDN
 void MKLDNNPermuteNode::execute(mkldnn::stream strm) {
     auto &dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
     auto &srcMemPtr = getParentEdgeAt(0)->getMemoryPtr();
-    auto src_data = reinterpret_cast<const float *>(srcMemPtr->GetData());
-    auto dst_data = reinterpret_cast<float *>(dstMemPtr->GetData());
 
+    // the copies of the rows and the tiles of the plan outrun the specialized kernels, they are left
+    // for the permutations where the plan would gather the elements one by one
     for (const auto &impl : OptimizedCases) {
-        if (impl.first == order && impl.second.isValidParams(batchToProcess(), srcMemPtr, dstMemPtr)) {
+        if (plan.kind == TransposePlan::gather && srcMemPtr->GetDataType() == memory::f32 &&
+            impl.first == order && impl.second.isValidParams(batchToProcess(), srcMemPtr, dstMemPtr)) {
             impl.second.execute(batchToProcess(), srcMemPtr, dstMemPtr);
             return;
         }
     }
 
-    auto srcBlob = getParentEdgeAt(0)->getBlob();
-    TensorDesc srcDesc = srcBlob->getTensorDesc();
-
-    SizeVector& dims = srcDesc.getDims();
-    InferenceEngine::SizeVector orderedDims;
-    for (auto ord : order) {
-        orderedDims.push_back(dims[ord]);
+    switch (plan.elemSize) {
+        case 1: executeTransposePlan<uint8_t>(batchToProcess()); break;
+        case 2: executeTransposePlan<uint16_t>(batchToProcess()); break;
+        case 4: executeTransposePlan<uint32_t>(batchToProcess()); break;
+        default: THROW_IE_EXCEPTION << "Permute layer " << getName() << " doesn't support elements of "
+                                    << plan.elemSize << " bytes";
     }
-    TensorDesc dstDesc(InferenceEngine::Precision::FP32, dims, {orderedDims, order});
-
-    int dataSize = srcBlob->size() / srcDesc.getDims()[0] * batchToProcess();
-
-    parallel_for(dataSize, [&](int i) {
-        dst_data[dstDesc.offset(i)] = src_data[srcDesc.offset(i)];
-    });
 }
 
 bool MKLDNNPermuteNode::created() const {
@@ -10,9 +10,39 @@
 #include <vector>
 #include <utility>
 #include <map>
+#include <memory>
+#include <cassert>
 
 namespace MKLDNNPlugin {
 
+// loops of the transpose plan: two per source dimension (outer and block) and two of the tiles
+#define MAX_PERMUTE_LOOPS (2 * TENSOR_MAX_DIMS + 2)
+
+struct jit_permute_call_args {
+    const void *src;
+    void *dst;
+    // in bytes
+    size_t src_stride;
+    size_t dst_stride;
+};
+
+/**
+ * @brief Transposes a full square tile of 4 byte elements: dst[l + s * dst_stride] = src[l * src_stride + s]
+ */
+struct jit_uni_permute_kernel {
+    void (*ker_)(const jit_permute_call_args *);
+
+    void operator()(const jit_permute_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_permute_kernel(size_t tile) : ker_(nullptr), tile_(tile) {}
+    virtual ~jit_uni_permute_kernel() {}
+
+    size_t tile_;
+};
+
 class MKLDNNPermuteNode : public MKLDNNNode {
 public:
     MKLDNNPermuteNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, int socket);
@@ -41,6 +71,51 @@ private:
     };
 
     static std::multimap<InferenceEngine::SizeVector, PermuteImpl> OptimizedCases;
+
+    /**
+     * @brief The permutation as a set of nested loops over the physical layout of the source, built once
+     * in createPrimitive. Loops are sorted by the destination strides so the writes are sequential and
+     * the dimensions which stay adjacent in both tensors are merged.
+     */
+    struct TransposePlan {
+        struct Loop {
+            size_t size;
+            // in elements
+            ptrdiff_t srcStride;
+            ptrdiff_t dstStride;
+            // the size is limited by the dynamic batch
+            bool batch;
+        };
+
+        enum Kind {
+            // the innermost dimension is contiguous on both sides, the rows are copied
+            rows,
+            // 2D transpose of the sequentially read and written dimensions, they are the two innermost loops
+            tiles,
+            // the innermost run is gathered element by element
+            gather
+        };
+
+        Kind kind = rows;
+        // loops of the work split over the threads, the run of the innermost loop is done per item
+        std::vector<Loop> loops;
+        Loop inner = {1, 1, 1, false};
+        // the sequentially read dimension of the tiles
+        Loop outer = {1, 1, 1, false};
+        size_t tile = 0;
+        // the loop of the work limited by the dynamic batch, -1 if there is none or it is the inner or the outer one
+        int batchLoop = -1;
+        size_t elemSize = 0;
+        ptrdiff_t srcOffset = 0;
+        ptrdiff_t dstOffset = 0;
+    };
+
+    void prepareTransposePlan();
+    template <typename T>
+    void executeTransposePlan(int MB);
+
+    TransposePlan plan;
+    std::shared_ptr<jit_uni_permute_kernel> permute_kernel;
 };
 
 }  // namespace MKLDNNPlugin
@@ -9,8 +9,11 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <set>
+#include <algorithm>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include <mkldnn_infer_request.h>
 #include <ie_memcpy.h>
 #include "details/caseless.hpp"
 
@@ -48,10 +51,53 @@ static LayerConfig make_plain_config(const CNNLayerPtr &layer) {
     return config;
 }
 
+static void changeEdgesPtr(const std::vector<MKLDNNEdgePtr> &edges, void *ptr) {
+    for (auto &edge : edges)
+        edge->getMemory().GetPrimitivePtr()->set_data_handle(ptr);
+}
+
+static void *getEdgesPtr(const std::vector<MKLDNNEdgePtr> &edges) {
+    return edges.back()->getMemory().GetPrimitive().get_data_handle();
+}
+
+static bool isPlain(const mkldnn::memory::desc &desc) {
+    const auto &data = desc.data;
+    if (data.format == mkldnn_format_undef || data.format == mkldnn_any ||
+        data.format == mkldnn_wino_fmt || data.format == mkldnn_rnn_packed)
+        return false;
+    for (int i = 0; i < data.ndims; i++) {
+        if (data.layout_desc.blocking.block_dims[i] != 1 || data.layout_desc.blocking.padding_dims[i] != data.dims[i])
+            return false;
+    }
+    return true;
+}
+
+// True if both descriptors address the same elements at the same offsets from the data pointer,
+// strides of the dims of size 1 don't matter
+static bool sameLayout(const mkldnn::memory::desc &lhs, const mkldnn::memory::desc &rhs) {
+    if (!isPlain(lhs) || !isPlain(rhs) || lhs.data.data_type != rhs.data.data_type || lhs.data.ndims != rhs.data.ndims ||
+        lhs.data.layout_desc.blocking.offset_padding != 0 || rhs.data.layout_desc.blocking.offset_padding != 0)
+        return false;
+    for (int i = 0; i < lhs.data.ndims; i++) {
+        if (lhs.data.dims[i] != rhs.data.dims[i])
+            return false;
+        if (lhs.data.dims[i] > 1 &&
+            lhs.data.layout_desc.blocking.strides[0][i] != rhs.data.layout_desc.blocking.strides[0][i])
+            return false;
+    }
+    return true;
+}
+
+/**
+ * Moves a chunk of the full tensor to or from the subgraph port on every iteration. If the port memory is laid out
+ * as the chunk, the subgraph reads or writes the full tensor directly: the port is pointed to the chunk
+ * before the iteration, otherwise the chunk is copied by a reorder.
+ */
 class PortIteratorHelper : public PortMapHelper {
 public:
-    PortIteratorHelper(const MKLDNNMemoryPtr &from, const MKLDNNMemoryPtr &to,
-            bool as_input, const TensorIterator::PortMap &port_map, const mkldnn::engine& eng, int n_iter) : as_input(as_input) {
+    PortIteratorHelper(const MKLDNNMemoryPtr &from, const MKLDNNMemoryPtr &to, bool as_input,
+            const TensorIterator::PortMap &port_map, const mkldnn::engine& eng, int n_iter,
+            const std::vector<MKLDNNEdgePtr> &part_views = {}) : as_input(as_input) {
         const auto &full_blob = as_input ? from : to;
         const auto &part_blob = !as_input ? from : to;
 
@@ -61,7 +107,6 @@ public:
         auto full_dims = full_blob->GetDims();
         auto part_dims = part_blob->GetDims();
 
-        bool simple_copy = port_map.axis == -1;
         if (port_map.axis == -1) {
             // simple copy mode. No iteration through this tensor
             reorders.emplace_back(from->GetPrimitive(), to->GetPrimitive());
@@ -79,8 +124,8 @@ public:
 
             // make chunk view
             auto chunk_desc =  full_blob->GetDescriptor();
-            chunk_desc.data.dims[axis] = 1;
-            chunk_desc.data.layout_desc.blocking.padding_dims[axis] = 1;  // TODO: asamption that plain tensor
+            chunk_desc.data.dims[axis] = abs_stride;
+            chunk_desc.data.layout_desc.blocking.padding_dims[axis] = abs_stride;  // TODO: asamption that plain tensor
 
             mem_holder.push_back(full_blob->GetPrimitive());
             auto full_mem_handler = full_blob->GetPrimitive().get_data_handle();
@@ -89,12 +134,18 @@ public:
 
             auto elem_size = MKLDNNExtensionUtils::sizeOfDataType(mkldnn::memory::data_type(chunk_desc.data.data_type));
 
-            // TODO: only stride 1
-            chunk_stride_in_byte = chunk_desc.data.layout_desc.blocking.strides[0][axis] * elem_size;
+            chunk_stride_in_byte = chunk_desc.data.layout_desc.blocking.strides[0][axis] * abs_stride * elem_size;
             chunk_offset_in_byte = sign_of_stride < 0 ? (iter_count - 1) * chunk_stride_in_byte : 0;
             chunk_stride_in_byte *= sign_of_stride;
 
-            if (as_input) {
+            // the chunk is addressed from the data pointer of the view, so the padding offset moves to the pointer
+            auto view_desc = chunk_desc;
+            view_desc.data.layout_desc.blocking.offset_padding = 0;
+            if (!part_views.empty() && sameLayout(view_desc, part_blob->GetDescriptor())) {
+                views = part_views;
+                own_ptr = getEdgesPtr(views);
+                chunk_offset_in_byte += chunk_desc.data.layout_desc.blocking.offset_padding * elem_size;
+            } else if (as_input) {
                 reorders.emplace_back(chunk_mem_prim, to->GetPrimitive());
             } else {
                 reorders.emplace_back(from->GetPrimitive(), chunk_mem_prim);
@@ -102,16 +153,27 @@ public:
         }
     }
 
+    /**
+     * @brief True if the port is pointed to the chunks, so the helper runs before the iteration for outputs too
+     */
+    bool bound() const {
+        return !views.empty();
+    }
+
     void execute(int n_iter, mkldnn::stream strm) override {
         if (chunk_stride_in_byte != 0) {
             IE_ASSERT(n_iter < iter_count);
 
             auto full_mem = mem_holder[FULL_DATA];
-            auto chunk_mem = mem_holder[CHUNK_DATA];
+            auto chunk_ptr = static_cast<uint8_t *>(full_mem.get_data_handle()) +
+                    chunk_offset_in_byte + chunk_stride_in_byte * n_iter;
 
-            chunk_mem.set_data_handle(static_cast<uint8_t *>(full_mem.get_data_handle()) +
-                    chunk_offset_in_byte + chunk_stride_in_byte * n_iter);
+            if (bound()) {
+                changeEdgesPtr(views, chunk_ptr);
+                return;
+            }
 
+            mem_holder[CHUNK_DATA].set_data_handle(chunk_ptr);
             strm.submit({reorders.begin(), reorders.end()});
         } else {
             if (as_input ? n_iter == 0 : n_iter == (iter_count - 1))
@@ -119,11 +181,19 @@ public:
         }
     };
 
+    void reset() override {
+        if (bound())
+            changeEdgesPtr(views, own_ptr);
+    }
+
 private:
     bool as_input;
     ptrdiff_t chunk_stride_in_byte = 0;
     ptrdiff_t chunk_offset_in_byte = 0;
 
+    std::vector<MKLDNNEdgePtr> views;
+    void *own_ptr = nullptr;
+
     const int FULL_DATA = 0;
     const int CHUNK_DATA = 1;
 };
@@ -131,12 +201,6 @@ private:
 class BackEdgePortHelper : public PortMapHelper {
 public:
     BackEdgePortHelper(const MKLDNNMemoryPtr &from, const MKLDNNMemoryPtr &to, const mkldnn::engine& eng, int n_iter) {
-        auto mem_desc =  from->GetDescriptor();
-
-
-        mem_holder.emplace_back(mkldnn::memory::primitive_desc(mem_desc, eng));
-        auto &temp_mem = mem_holder.back();
-
         reorders.emplace_back(from->GetPrimitive(), to->GetPrimitive());
 
         iter_count = n_iter;
@@ -149,6 +213,36 @@ public:
     };
 };
 
+/**
+ * Passes the value of a back edge by swapping the buffers of the subgraph output and input: the next iteration
+ * reads the buffer just written and writes into the one just read.
+ */
+class BackEdgeSwapHelper : public PortMapHelper {
+public:
+    BackEdgeSwapHelper(const std::vector<MKLDNNEdgePtr> &from_views, const std::vector<MKLDNNEdgePtr> &to_views, int n_iter)
+            : from_views(from_views), to_views(to_views),
+              from_own_ptr(getEdgesPtr(from_views)), to_own_ptr(getEdgesPtr(to_views)) {
+        iter_count = n_iter;
+    }
+
+    void execute(int n_iter, mkldnn::stream strm) override {
+        if (n_iter < iter_count - 1) {
+            void *written = getEdgesPtr(from_views);
+            changeEdgesPtr(from_views, getEdgesPtr(to_views));
+            changeEdgesPtr(to_views, written);
+        }
+    };
+
+    void reset() override {
+        changeEdgesPtr(from_views, from_own_ptr);
+        changeEdgesPtr(to_views, to_own_ptr);
+    }
+
+private:
+    std::vector<MKLDNNEdgePtr> from_views, to_views;
+    void *from_own_ptr, *to_own_ptr;
+};
+
 }  // namespace MKLDNNPlugin
 
 MKLDNNTensorIteratorNode::MKLDNNTensorIteratorNode(InferenceEngine::CNNLayerPtr layer, const mkldnn::engine& eng, int socket) :
@@ -178,12 +272,14 @@ void MKLDNNTensorIteratorNode::getSupportedDescriptors() {
         auto &in_node = in_map[in_data->getName()];
         auto in_mem = in_node->getChildEdgeAt(0)->getMemoryPtr();
         input_mem.push_back(in_mem);
+        input_nodes.push_back(in_node);
     }
 
     for (const auto &out_data : ti->body.outputs) {
         auto &out_node = out_map[out_data->getName()];
         auto out_mem = out_node->getParentEdgeAt(0)->getMemoryPtr();
         output_mem.push_back(out_mem);
+        output_nodes.push_back(out_node);
     }
 }
 
@@ -196,18 +292,51 @@ void MKLDNNTensorIteratorNode::initSupportedPrimitiveDescriptors() {
 }
 
 
+// Edges sharing the memory of a subgraph input or output, empty if some of them can't be switched to another pointer
+static std::vector<MKLDNNEdgePtr> inputViews(const MKLDNNNodePtr &node) {
+    std::vector<MKLDNNEdgePtr> views;
+    for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+        if (!collectInputViews(node->getChildEdgeAt(i), views))
+            return {};
+    }
+    return views;
+}
+
+static std::vector<MKLDNNEdgePtr> outputViews(const MKLDNNNodePtr &node) {
+    std::vector<MKLDNNEdgePtr> views;
+    if (!collectOutputViews(node->getParentEdgeAt(0), views))
+        return {};
+    return views;
+}
+
 void MKLDNNTensorIteratorNode::createPrimitive() {
     auto ti = dynamic_cast<class TensorIterator*>(getCnnLayer().get());
     if (ti == nullptr)
         THROW_IE_EXCEPTION << "Cannot convert to TensorIterator layer.";
 
+    // every edge is switched by one helper only, except an output which is both sliced and sent over a back edge:
+    // the swap leaves it to the slicing which points it to the next chunk anyway
+    std::set<MKLDNNEdgePtr> switched;
+    std::vector<std::set<MKLDNNEdgePtr>> sliced_outputs;
+    auto unswitched = [&](const std::vector<MKLDNNEdgePtr> &views) {
+        for (auto &edge : views) {
+            if (switched.count(edge))
+                return std::vector<MKLDNNEdgePtr>();
+        }
+        return views;
+    };
+
     for (auto map_rule : ti->input_port_map) {
         auto &extr_mem = getParentEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &intr_mem = input_mem[map_rule.to];
 
-        auto mapper = std::shared_ptr<PortMapHelper>(
-                new PortIteratorHelper (extr_mem, intr_mem, true, map_rule, getEngine(), n_iter));
-
+        std::vector<MKLDNNEdgePtr> views;
+        if (map_rule.axis != -1)
+            views = inputViews(input_nodes[map_rule.to]);
+        auto mapper = std::make_shared<PortIteratorHelper>(extr_mem, intr_mem, true, map_rule, getEngine(), n_iter,
+                                                           unswitched(views));
+        if (mapper->bound())
+            switched.insert(views.begin(), views.end());
         in_port_mappers.push_back(mapper);
     }
 
@@ -215,38 +344,86 @@ void MKLDNNTensorIteratorNode::createPrimitive() {
         auto &extr_mem = getChildEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &intr_mem = output_mem[map_rule.to];
 
-        auto mapper = std::shared_ptr<PortMapHelper>(
-                new PortIteratorHelper (intr_mem, extr_mem, false, map_rule, getEngine(), n_iter));
-
-        out_port_mappers.push_back(mapper);
+        std::vector<MKLDNNEdgePtr> views;
+        if (map_rule.axis != -1)
+            views = outputViews(output_nodes[map_rule.to]);
+        auto mapper = std::make_shared<PortIteratorHelper>(intr_mem, extr_mem, false, map_rule, getEngine(), n_iter,
+                                                           unswitched(views));
+        if (mapper->bound()) {
+            switched.insert(views.begin(), views.end());
+            sliced_outputs.emplace_back(views.begin(), views.end());
+            in_port_mappers.push_back(mapper);
+        } else {
+            out_port_mappers.push_back(mapper);
+        }
     }
 
+    // copies of back edges go before the swaps which move the memory they read
+    std::vector<std::shared_ptr<PortMapHelper>> swaps;
     for (auto map_rule : ti->back_edges) {
         auto from_mem = output_mem[map_rule.from];
         auto to_mem = input_mem[map_rule.to];
 
-        auto mapper = std::shared_ptr<PortMapHelper>(
-                new BackEdgePortHelper(from_mem, to_mem, getEngine(), n_iter));
-
-        out_port_mappers.push_back(mapper);
+        auto from_views = outputViews(output_nodes[map_rule.from]);
+        auto to_views = inputViews(input_nodes[map_rule.to]);
+        bool swappable = !from_views.empty() && !to_views.empty() &&
+                sameLayout(from_mem->GetDescriptor(), to_mem->GetDescriptor()) &&
+                getEdgesPtr(from_views) != getEdgesPtr(to_views);
+        auto sliced = std::find(sliced_outputs.begin(), sliced_outputs.end(),
+                                std::set<MKLDNNEdgePtr>(from_views.begin(), from_views.end()));
+        if (sliced == sliced_outputs.end())
+            from_views = unswitched(from_views);
+        to_views = unswitched(to_views);
+
+        if (swappable && !from_views.empty() && !to_views.empty()) {
+            if (sliced != sliced_outputs.end())
+                sliced_outputs.erase(sliced);
+            switched.insert(from_views.begin(), from_views.end());
+            switched.insert(to_views.begin(), to_views.end());
+            swaps.push_back(std::make_shared<BackEdgeSwapHelper>(from_views, to_views, n_iter));
+        } else {
+            out_port_mappers.push_back(std::make_shared<BackEdgePortHelper>(from_mem, to_mem, getEngine(), n_iter));
+        }
     }
+    out_port_mappers.insert(out_port_mappers.end(), swaps.begin(), swaps.end());
 }
 
 void MKLDNNTensorIteratorNode::execute(mkldnn::stream strm) {
     sub_graph.ResetInferCount();
 
-    for (int i = 0; i < n_iter; i++) {
-        // copy data to subgraph iteration
+    // the initial values of the next inference are copied into the subgraph own memory,
+    // so the ports are pointed back to it even if an iteration throws
+    auto resetMappers = [this] {
         for (auto &mapper : in_port_mappers)
-            mapper->execute(i, strm);
+            mapper->reset();
+        for (auto &mapper : out_port_mappers)
+            mapper->reset();
+    };
 
-        sub_graph.Infer();
+    try {
+        for (int i = 0; i < n_iter; i++) {
+            // copy data to subgraph iteration
+            // or point the subgraph ports to the chunks of inputs and outputs
+            for (auto &mapper : in_port_mappers)
+                mapper->execute(i, strm);
 
-        // copy data from subgraph iteration to outputs
-        // or next iteration inputs
-        for (auto &mapper : out_port_mappers)
-            mapper->execute(i, strm);
+            sub_graph.Infer();
+
+            // copy data from subgraph iteration to outputs
+            // or next iteration inputs
+            for (auto &mapper : out_port_mappers)
+                mapper->execute(i, strm);
+        }
+    } catch (...) {
+        resetMappers();
+        throw;
     }
+
+    resetMappers();
+}
+
+size_t MKLDNNTensorIteratorNode::getScratchpadSize() {
+    return sub_graph.GetScratchpadSize();
 }
 
 bool MKLDNNTensorIteratorNode::created() const {
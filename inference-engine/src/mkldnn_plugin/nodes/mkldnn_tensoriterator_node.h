@@ -15,7 +15,12 @@ namespace MKLDNNPlugin {
 
 class PortMapHelper {
 public:
+    virtual ~PortMapHelper() = default;
     virtual void execute(int n_iter, mkldnn::stream strm) = 0;
+    /**
+     * @brief Points the subgraph memory switched during the iterations back to its own buffers
+     */
+    virtual void reset() {}
 protected:
     std::vector<mkldnn::reorder> reorders;
     std::vector<mkldnn::memory> mem_holder;
@@ -32,6 +37,7 @@ public:
     void createPrimitive() override;
     bool created() const override;
     void execute(mkldnn::stream strm) override;
+    size_t getScratchpadSize() override;
 
     void setExtManager(const MKLDNNExtensionManager::Ptr& extMgr) { ext_mng = extMgr; }
 private:
@@ -42,7 +48,9 @@ private:
     MKLDNNExtensionManager::Ptr ext_mng;
     MKLDNNGraph sub_graph;
     std::vector<MKLDNNMemoryPtr> input_mem, output_mem;
+    std::vector<MKLDNNNodePtr> input_nodes, output_nodes;
 
+    // executed before and after every iteration
     std::vector<std::shared_ptr<PortMapHelper>> in_port_mappers, out_port_mappers;
 };
 
@@ -4,10 +4,94 @@
 
 #pragma once
 
+#include <atomic>
 #include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
+/**
+ * @brief A single execution of a node, timestamps are in nanoseconds of the steady clock
+ */
+struct PerfEvent {
+    uint64_t start;
+    uint64_t finish;
+    // stream (graph) which executed the node and a small id of the thread within the process
+    int32_t stream;
+    uint32_t thread;
+};
+
+/**
+ * @brief A fixed-size ring of the latest events, writers never block and overwrite the oldest events.
+ *
+ * Every slot has a sequence number which is odd while the slot is being written, so a reader can take
+ * a consistent snapshot at any time without stopping the inference.
+ */
+class PerfEventsRing {
+public:
+    explicit PerfEventsRing(size_t capacity) : slots(roundUpToPowerOf2(capacity)), mask(slots.size() - 1) {}
+
+    void push(const PerfEvent &event) {
+        const uint64_t idx = head.fetch_add(1, std::memory_order_relaxed);
+        Slot &slot = slots[idx & mask];
+        slot.seq.store(2 * idx + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.start.store(event.start, std::memory_order_relaxed);
+        slot.finish.store(event.finish, std::memory_order_relaxed);
+        slot.stream.store(event.stream, std::memory_order_relaxed);
+        slot.thread.store(event.thread, std::memory_order_relaxed);
+        slot.seq.store(2 * idx + 2, std::memory_order_release);
+    }
+
+    /**
+     * @brief Appends the events still held by the ring, the oldest first
+     */
+    void snapshot(std::vector<PerfEvent> &events) const {
+        const uint64_t end = head.load(std::memory_order_acquire);
+        const uint64_t begin = end > slots.size() ? end - slots.size() : 0;
+        for (uint64_t idx = begin; idx < end; idx++) {
+            const Slot &slot = slots[idx & mask];
+            if (slot.seq.load(std::memory_order_acquire) != 2 * idx + 2)
+                continue;
+            PerfEvent event;
+            event.start = slot.start.load(std::memory_order_relaxed);
+            event.finish = slot.finish.load(std::memory_order_relaxed);
+            event.stream = slot.stream.load(std::memory_order_relaxed);
+            event.thread = slot.thread.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            // skip the slot overwritten while it was copied
+            if (slot.seq.load(std::memory_order_relaxed) == 2 * idx + 2)
+                events.push_back(event);
+        }
+    }
+
+    size_t capacity() const { return slots.size(); }
+
+private:
+    // the fields are atomic as a writer may fill the slot while it's copied, the sequence number tells
+    // whether the copy is consistent
+    struct Slot {
+        std::atomic<uint64_t> seq{0};
+        std::atomic<uint64_t> start{0};
+        std::atomic<uint64_t> finish{0};
+        std::atomic<int32_t> stream{0};
+        std::atomic<uint32_t> thread{0};
+    };
+
+    static size_t roundUpToPowerOf2(size_t value) {
+        size_t result = 1;
+        while (result < value)
+            result <<= 1;
+        return result;
+    }
+
+    std::vector<Slot> slots;
+    const uint64_t mask;
+    std::atomic<uint64_t> head{0};
+};
+
 class PerfCount {
     uint64_t duration;
     uint32_t num;
@@ -15,23 +99,55 @@ class PerfCount {
     std::chrono::high_resolution_clock::time_point __start;
     std::chrono::high_resolution_clock::time_point __finish;
 
+    std::unique_ptr<PerfEventsRing> events;
+    int32_t stream = 0;
+
 public:
     PerfCount(): duration(0), num(0) {}
 
-    uint64_t avg() { return (num == 0) ? 0 : duration / num; }
+    // in microseconds, the sum is kept in nanoseconds so short layers aren't rounded to zero
+    uint64_t avg() { return (num == 0) ? 0 : duration / num / 1000; }
+
+    /**
+     * @brief Starts recording of every execution into a ring of the given size
+     */
+    void enableTrace(int32_t streamId, size_t capacity) {
+        stream = streamId;
+        events.reset(new PerfEventsRing(capacity));
+    }
+
+    const PerfEventsRing *trace() const { return events.get(); }
+
+    static uint64_t nowNs() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    static uint32_t threadId() {
+        static std::atomic<uint32_t> threadsCounter(0);
+        static thread_local uint32_t id = threadsCounter++;
+        return id;
+    }
 
 private:
     void start_itr() {
         __start = std::chrono::high_resolution_clock::now();
+        if (events)
+            traceStart = nowNs();
     }
 
     void finish_itr() {
         __finish = std::chrono::high_resolution_clock::now();
 
-        duration += std::chrono::duration_cast<std::chrono::microseconds>(__finish - __start).count();
+        duration += std::chrono::duration_cast<std::chrono::nanoseconds>(__finish - __start).count();
         num++;
+
+        if (events)
+            events->push({traceStart, nowNs(), stream, threadId()});
     }
 
+    uint64_t traceStart = 0;
+
     friend class PerfHelper;
 };
 
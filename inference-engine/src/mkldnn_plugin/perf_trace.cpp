@@ -0,0 +1,107 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "perf_trace.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <set>
+#include <sstream>
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+std::string escape(const std::string &str) {
+    std::ostringstream out;
+    for (char c : str) {
+        switch (c) {
+            case '"':  out << "\\\""; break;
+            case '\\': out << "\\\\"; break;
+            case '\n': out << "\\n"; break;
+            case '\t': out << "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20)
+                    out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c)
+                        << std::dec << std::setfill(' ');
+                else
+                    out << c;
+        }
+    }
+    return out.str();
+}
+
+// the trace format takes microseconds, the fractional part keeps the nanoseconds
+void writeMicroseconds(std::ostream &out, uint64_t ns) {
+    out << ns / 1000 << "." << std::setw(3) << std::setfill('0') << ns % 1000 << std::setfill(' ');
+}
+
+}  // namespace
+
+std::string PerfTraceToChromeJson(const std::vector<PerfTraceNode> &nodes) {
+    // timestamps are shifted to the first event so the viewers don't lose the precision
+    uint64_t origin = UINT64_MAX;
+    std::set<int32_t> streams;
+    for (auto &node : nodes) {
+        for (auto &event : node.events) {
+            origin = std::min(origin, event.start);
+            streams.insert(event.stream);
+        }
+    }
+
+    std::ostringstream out;
+    out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    bool first = true;
+    for (auto stream : streams) {
+        out << (first ? "" : ",") << "\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << stream
+            << ",\"args\":{\"name\":\"stream " << stream << "\"}}";
+        first = false;
+    }
+    for (auto &node : nodes) {
+        const std::string name = escape(node.name);
+        const std::string type = escape(node.type);
+        const std::string execType = escape(node.execType);
+        for (auto &event : node.events) {
+            out << (first ? "" : ",") << "\n{\"name\":\"" << name << "\",\"cat\":\"" << type
+                << "\",\"ph\":\"X\",\"pid\":" << event.stream << ",\"tid\":" << event.thread << ",\"ts\":";
+            writeMicroseconds(out, event.start - origin);
+            out << ",\"dur\":";
+            writeMicroseconds(out, event.finish - event.start);
+            out << ",\"args\":{\"exec_type\":\"" << execType << "\"}}";
+            first = false;
+        }
+    }
+    out << "\n]}\n";
+    return out.str();
+}
+
+std::map<std::string, std::vector<uint64_t>> PerfTracePercentiles(const std::vector<PerfTraceNode> &nodes,
+                                                                 const std::vector<float> &percentiles) {
+    // the same node of different streams is a single entry
+    std::map<std::string, std::vector<uint64_t>> durations;
+    for (auto &node : nodes) {
+        auto &nodeDurations = durations[node.name];
+        for (auto &event : node.events)
+            nodeDurations.push_back(event.finish - event.start);
+    }
+
+    std::map<std::string, std::vector<uint64_t>> result;
+    for (auto &entry : durations) {
+        auto &values = entry.second;
+        if (values.empty())
+            continue;
+        std::sort(values.begin(), values.end());
+        auto &nodeResult = result[entry.first];
+        for (auto p : percentiles) {
+            // nearest-rank percentile
+            const float rank = std::ceil(std::min(std::max(p, 0.f), 100.f) / 100.f * values.size());
+            const size_t idx = rank < 1.f ? 0 : static_cast<size_t>(rank) - 1;
+            nodeResult.push_back(values[std::min(idx, values.size() - 1)]);
+        }
+    }
+    return result;
+}
+
+}  // namespace MKLDNNPlugin
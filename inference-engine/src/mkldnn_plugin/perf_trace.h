@@ -0,0 +1,37 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+#include "perf_count.h"
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Recorded executions of a node of some stream (see CONFIG_KEY(CPU_PERF_TRACE))
+ */
+struct PerfTraceNode {
+    std::string name;
+    std::string type;
+    std::string execType;
+    std::vector<PerfEvent> events;
+};
+
+/**
+ * @brief Serializes the events in the Chrome trace event format (chrome://tracing, Perfetto UI).
+ * Streams are shown as processes and the threads executed the nodes as their threads.
+ */
+std::string PerfTraceToChromeJson(const std::vector<PerfTraceNode> &nodes);
+
+/**
+ * @brief Computes latency percentiles of every node over the events of all streams
+ * @return node name -> durations in nanoseconds, one per requested percentile
+ */
+std::map<std::string, std::vector<uint64_t>> PerfTracePercentiles(const std::vector<PerfTraceNode> &nodes,
+                                                                 const std::vector<float> &percentiles);
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,237 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+#include <cpu_detector.hpp>
+#include "floatmath.h"
+#include "pwl.h"
+
+#ifdef HAVE_AVX2
+#include "cpu_x86_avx2/floatmath_avx2.hpp"
+#endif
+#ifdef HAVE_AVX512
+#include "cpu_x86_avx512/floatmath_avx512.hpp"
+#endif
+
+// SW_FP32 kernels must be bit-exact with the straightforward loops below, which they were optimized from
+class GNAFloatMathTest : public ::testing::Test {
+protected:
+    std::mt19937 gen{42};
+
+    std::vector<float> random(size_t size) {
+        std::uniform_real_distribution<float> dist(-1.f, 1.f);
+        std::vector<float> data(size);
+        for (auto &value : data)
+            value = dist(gen);
+        return data;
+    }
+
+    static void ref_sgemm(int M, int N, int K, const float *A, int lda, const uint32_t *rows,
+                          const float *B, int ldb, float *C, int ldc) {
+        for (int l = 0; l < M; l++) {
+            int i = rows ? rows[l] : l;
+            for (int j = 0; j < N; j++) {
+                float sum = C[l * ldc + j];
+                for (int k = 0; k < K; k++) {
+                    sum += A[i * lda + k] * B[k * ldb + j];
+                }
+                C[l * ldc + j] = sum;
+            }
+        }
+    }
+
+    static void expect_bit_exact(const std::vector<float> &expected, const std::vector<float> &actual) {
+        ASSERT_EQ(expected.size(), actual.size());
+        ASSERT_EQ(0, std::memcmp(expected.data(), actual.data(), expected.size() * sizeof(float)));
+    }
+
+    void check_sgemm(int M, int N, int K) {
+        auto A = random(M * K), B = random(K * N), C = random(M * N);
+        auto expected = C;
+        ref_sgemm(M, N, K, A.data(), K, nullptr, B.data(), N, expected.data(), N);
+        cblas_sgemm1(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, 1.0, A.data(), K, B.data(), N,
+                     1.0, C.data(), N);
+        expect_bit_exact(expected, C);
+    }
+};
+
+TEST_F(GNAFloatMathTest, sgemmIsBitExactForAnyShape) {
+    for (int M : {1, 7, 8, 17, 64, 301}) {
+        for (int N : {1, 3, 4, 8}) {
+            for (int K : {1, 7, 8, 33, 440}) {
+                SCOPED_TRACE(std::to_string(M) + "x" + std::to_string(N) + "x" + std::to_string(K));
+                check_sgemm(M, N, K);
+            }
+        }
+    }
+}
+
+TEST_F(GNAFloatMathTest, sgemmSubsetIsBitExact) {
+    const int M = 100, N = 2, K = 65;
+    std::vector<uint32_t> rows = {99, 3, 5, 7, 0, 1, 42, 42, 17, 18, 19, 20, 21, 22, 23, 24, 50, 98, 2};
+    const int L = static_cast<int>(rows.size());
+    auto A = random(M * K), B = random(K * N), C = random(L * N);
+    auto expected = C;
+    ref_sgemm(L, N, K, A.data(), K, rows.data(), B.data(), N, expected.data(), N);
+    cblas_sgemm_subset(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, 1.0, A.data(), K, B.data(), N,
+                       1.0, C.data(), N, rows.data(), L);
+    expect_bit_exact(expected, C);
+}
+
+TEST_F(GNAFloatMathTest, diagonalIsBitExact) {
+    const int N = 1027;
+    auto A = random(N), X = random(N), Y = random(N);
+    auto expected = Y;
+    for (int i = 0; i < N; i++)
+        expected[i] += A[i] * X[i];
+    cblas_ssbmv1(CblasRowMajor, CblasLower, N, 0, 1.0, A.data(), 1, X.data(), 1, 1.0, Y.data(), 1);
+    expect_bit_exact(expected, Y);
+}
+
+TEST_F(GNAFloatMathTest, sgemvSplitIsBitExact) {
+    const uint32_t N = 131, K1 = 37, K2 = 29;
+    auto A1 = random(K1), A2 = random(K2), X = random(N * (K1 + K2)), B = random(N);
+    std::vector<float> expected(N), C(N);
+    for (uint32_t i = 0; i < N; i++) {
+        float sum = B[i];
+        for (uint32_t j = 0; j < K1; j++)
+            sum += A1[j] * X[i * (K1 + K2) + j];
+        for (uint32_t j = K1; j < K1 + K2; j++)
+            sum += A2[j - K1] * X[i * (K1 + K2) + j];
+        expected[i] = sum;
+    }
+    sgemv_split(N, K1, K2, A1.data(), A2.data(), X.data(), B.data(), C.data());
+    expect_bit_exact(expected, C);
+}
+
+TEST_F(GNAFloatMathTest, convolutionIsBitExact) {
+    const uint32_t num_filters = 12, num_filter_coefficients = 48, band_stride = 8, num_outputs = 21;
+    const uint32_t num_inputs = (num_outputs - 1) * band_stride + num_filter_coefficients;
+    auto filters = random(num_filters * num_filter_coefficients), biases = random(num_filters);
+    auto inputs = random(num_inputs);
+    std::vector<float> expected(num_outputs * num_filters), outputs(num_outputs * num_filters);
+
+    for (uint32_t j = 0; j < num_outputs; j++) {
+        for (uint32_t i = 0; i < num_filters; i++) {
+            float sum = biases[i];
+            for (uint32_t k = 0; k < num_filter_coefficients; k++)
+                sum += inputs[j * band_stride + k] * filters[i * num_filter_coefficients + k];
+            expected[j * num_filters + i] = sum;
+        }
+    }
+
+    intel_dnn_component_t component = {};
+    component.num_rows_in = 1;
+    component.num_rows_out = 1;
+    component.num_columns_out = num_outputs * num_filters;
+    component.ptr_inputs = inputs.data();
+    component.ptr_outputs = outputs.data();
+    component.op.conv1D.ptr_filters = filters.data();
+    component.op.conv1D.ptr_biases = biases.data();
+    component.op.conv1D.num_filters = num_filters;
+    component.op.conv1D.num_filter_coefficients = num_filter_coefficients;
+    component.op.conv1D.num_filter_rows = num_filter_coefficients / band_stride;
+    component.op.conv1D.num_feature_maps = 1;
+    component.op.conv1D.num_feature_map_columns = band_stride;
+    component.op.conv1D.num_feature_map_rows = num_outputs - 1 + component.op.conv1D.num_filter_rows;
+    CNNFilter32(&component);
+    expect_bit_exact(expected, outputs);
+}
+
+TEST_F(GNAFloatMathTest, activationsAreBitExact) {
+    const uint32_t rows = 3, columns = 3001;
+    auto inputs = random(rows * columns);
+    for (auto &value : inputs)
+        value *= 100.f;
+    inputs[5] = std::numeric_limits<float>::quiet_NaN();
+    inputs[6] = -0.f;
+
+    for (auto type : {kActSigmoid, kActTanh, kActRelu, kActIdentity, kActKaldiLstmClipping}) {
+        SCOPED_TRACE(intel_dnn_activation_name[type]);
+        std::vector<float> expected(rows * columns), outputs(rows * columns);
+        for (size_t i = 0; i < inputs.size(); i++) {
+            float val = inputs[i];
+            switch (type) {
+                case kActSigmoid: expected[i] = 0.5 * (1.0 + tanh(0.5 * val)); break;
+                case kActTanh: expected[i] = tanh(val); break;
+                case kActRelu: expected[i] = (val < 0.0f) ? val * 0.01f : val; break;
+                case kActKaldiLstmClipping:
+                    expected[i] = val > KALDI_LSTM_CLIP_UPPER ? KALDI_LSTM_CLIP_UPPER
+                                                              : (val < KALDI_LSTM_CLIP_LOWER ? KALDI_LSTM_CLIP_LOWER : val);
+                    break;
+                default: expected[i] = val;
+            }
+        }
+
+        intel_dnn_component_t component = {};
+        component.num_rows_in = rows;
+        component.num_columns_in = columns;
+        component.ptr_inputs = inputs.data();
+        component.ptr_outputs = outputs.data();
+        component.op.pwl.func_id.type = type;
+        component.op.pwl.func_id.negative_slope = 0.01f;
+        PwlApply32(&component, 0, rows - 1, 0, columns - 1);
+        expect_bit_exact(expected, outputs);
+    }
+}
+
+#ifdef HAVE_AVX2
+TEST_F(GNAFloatMathTest, avx2RowsKernelIsBitExact) {
+    if (!InferenceEngine::with_cpu_x86_avx2())
+        return;
+    const int rows = GNAPluginNS::avx2::sgemm_rows_block, N = 5, K = 67;
+    auto A = random(rows * K), B = random(K * N), C = random(rows * N);
+    auto expected = C;
+    ref_sgemm(rows, N, K, A.data(), K, nullptr, B.data(), N, expected.data(), N);
+
+    const float *a_rows[rows];
+    float *c_rows[rows];
+    for (int r = 0; r < rows; r++) {
+        a_rows[r] = A.data() + r * K;
+        c_rows[r] = C.data() + r * N;
+    }
+    GNAPluginNS::avx2::sgemm_rows(a_rows, B.data(), N, N, K, c_rows, true);
+    expect_bit_exact(expected, C);
+}
+#endif
+
+#ifdef HAVE_AVX512
+TEST_F(GNAFloatMathTest, avx512RowsKernelIsBitExact) {
+    if (!InferenceEngine::with_cpu_x86_avx512f())
+        return;
+    const int rows = GNAPluginNS::avx512::sgemm_rows_block, N = 5, K = 67;
+    auto A = random(rows * K), B = random(K * N), C = random(rows * N);
+    auto expected = C;
+    ref_sgemm(rows, N, K, A.data(), K, nullptr, B.data(), N, expected.data(), N);
+
+    const float *a_rows[rows];
+    float *c_rows[rows];
+    for (int r = 0; r < rows; r++) {
+        a_rows[r] = A.data() + r * K;
+        c_rows[r] = C.data() + r * N;
+    }
+    GNAPluginNS::avx512::sgemm_rows(a_rows, B.data(), N, N, K, c_rows, true);
+    expect_bit_exact(expected, C);
+}
+#endif
+
+TEST_F(GNAFloatMathTest, DISABLED_PerfAffine) {
+    // speech-like affine layer: 2048 outputs, 2048 inputs, batch of 8 frames
+    const int M = 2048, N = 8, K = 2048, iterations = 20;
+    auto A = random(M * K), B = random(K * N), C = random(M * N);
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        cblas_sgemm1(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, 1.0, A.data(), K, B.data(), N,
+                     1.0, C.data(), N);
+    }
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    std::cout << "[ INFO     ] " << elapsed.count() / iterations << " ms per affine" << std::endl;
+}
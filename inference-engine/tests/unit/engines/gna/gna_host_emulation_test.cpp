@@ -0,0 +1,60 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vector>
+#include <gtest/gtest.h>
+#include <gna/gna_config.hpp>
+#include "gna_matcher.hpp"
+
+using namespace InferenceEngine;
+using namespace GNAPluginNS;
+using namespace GNATestIRs;
+
+// quantized networks propagated by the integer host emulation, strict GNA API mock fails on any library call
+class GNAHostEmulationTest : public GNATest {
+ protected:
+    std::vector<float> input_data = std::vector<float>(20, 1.0f);
+};
+
+TEST_F(GNAHostEmulationTest, SplitFollowedByFCAndEltwiseOnHost) {
+    std::vector<float> expected_result(10, 12.0f);
+    assert_that().onInferModel(FCWithPaddingAfterSplitModel()).withGNAConfig(GNA_CONFIG_KEY(SCALE_FACTOR), 1000.0f)
+        .inNotCompactMode().gna().propagate_forward().onHost().with_tolerance(0.05f)
+        .called_with_input_and_expected_output(input_data, expected_result);
+}
+
+TEST_F(GNAHostEmulationTest, SliceFollowedByFCAndEltwiseOnHost) {
+    std::vector<float> expected_result(8, 14.0f);
+    assert_that().onInferModel(FCWithPaddingAfterSliceModel()).withGNAConfig(GNA_CONFIG_KEY(SCALE_FACTOR), 1000.0f)
+        .inNotCompactMode().gna().propagate_forward().onHost().with_tolerance(0.05f)
+        .called_with_input_and_expected_output(input_data, expected_result);
+}
+
+TEST_F(GNAHostEmulationTest, CropWithoutOffsetOnHost) {
+    std::vector<float> crop_input(10, 1.0f);
+    crop_input.resize(20, 0.0f);
+    std::vector<float> expected_result(10, 11.0f);
+    assert_that().onInferModel(cropWithoutOffsetModel()).withGNAConfig(GNA_CONFIG_KEY(SCALE_FACTOR), 1000.0f)
+        .inNotCompactMode().gna().propagate_forward().onHost().with_tolerance(0.05f)
+        .called_with_input_and_expected_output(crop_input, expected_result);
+}
+
+TEST_F(GNAHostEmulationTest, MultipleInputsOnHost) {
+    std::vector<float> input1_data(10, 1.0f);
+    std::vector<float> input2_data(10, 2.0f);
+    std::vector<float> expected_result(10, 30.0f);
+    assert_that().onInferModel(two_inputs_to_affine())
+        .withGNAConfig(std::string(GNA_CONFIG_KEY(SCALE_FACTOR)) + "_0", 1000.0f)
+        .withGNAConfig(std::string(GNA_CONFIG_KEY(SCALE_FACTOR)) + "_1", 1000.0f)
+        .inNotCompactMode().gna().propagate_forward().onHost().with_tolerance(0.05f)
+        .called_with().input("input_1", input1_data).And().input("input_2", input2_data).result().equal_to(expected_result);
+}
+
+TEST_F(GNAHostEmulationTest, I8WeightsPropagateForwardOnHost) {
+    std::vector<float> expected_result(10, 12.0f);
+    assert_that().onInferModel(FCWithPaddingAfterSplitModel()).withGNAConfig(GNA_CONFIG_KEY(SCALE_FACTOR), 1000.0f)
+        .withGNAConfig(GNA_CONFIG_KEY(PRECISION), "I8")
+        .inNotCompactMode().gna().propagate_forward().onHost().with_tolerance(0.5f)
+        .called_with_input_and_expected_output(input_data, expected_result);
+}
@@ -0,0 +1,389 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+#include <cpu_detector.hpp>
+#include "intmath.h"
+#include "pwl.h"
+
+#ifdef HAVE_AVX2
+#include "cpu_x86_avx2/intmath_avx2.hpp"
+#endif
+
+// quantized kernels must be bit-exact with the straightforward loops below
+class GNAIntMathTest : public ::testing::Test {
+protected:
+    std::mt19937 gen{42};
+
+    template <typename T>
+    std::vector<T> random(size_t size, int64_t low = std::numeric_limits<T>::min(),
+                          int64_t high = std::numeric_limits<T>::max()) {
+        std::uniform_int_distribution<int64_t> dist(low, high);
+        std::vector<T> data(size);
+        for (auto &value : data)
+            value = static_cast<T>(dist(gen));
+        return data;
+    }
+
+    std::vector<intel_compound_bias_t> random_compound_bias(size_t size) {
+        auto biases = random<int32_t>(size);
+        auto multipliers = random<uint8_t>(size);
+        std::vector<intel_compound_bias_t> result(size);
+        for (size_t i = 0; i < size; i++) {
+            result[i].bias = biases[i];
+            result[i].multiplier = multipliers[i];
+        }
+        return result;
+    }
+
+    static int32_t saturate(int64_t value) {
+        return static_cast<int32_t>(std::min<int64_t>(std::max<int64_t>(value, std::numeric_limits<int32_t>::min()),
+                                                      std::numeric_limits<int32_t>::max()));
+    }
+
+    template <typename W>
+    static int64_t ref_dot(const W *a, const int16_t *b, int ldb, int K) {
+        int64_t sum = 0;
+        for (int k = 0; k < K; k++)
+            sum += static_cast<int64_t>(a[k]) * b[k * ldb];
+        return sum;
+    }
+
+    // int32 accumulation of the device, saturated after every pass of its input buffer
+    template <typename W>
+    static int32_t ref_accumulate(int32_t acc, int64_t multiplier, const W *a, const int16_t *b, int ldb, int K,
+                                  int N) {
+        const int pass = static_cast<int>(igemm_pass_size(N));
+        for (int k = 0; k < K; k += pass)
+            acc = saturate(acc + multiplier * ref_dot(a + k, b + k * ldb, ldb, std::min(pass, K - k)));
+        return acc;
+    }
+
+    static uint32_t ref_pwl(std::vector<int32_t> &in, std::vector<int16_t> &out,
+                            const std::vector<intel_pwl_segment_t> &segments) {
+        uint32_t num_saturate = 0;
+        for (size_t j = 0; j < in.size(); j++) {
+            int32_t input = in[j];
+            if (input <= static_cast<int32_t>(segments[0].xBase & XBASEMASK)) {
+                out[j] = segments[0].yBase;
+                continue;
+            }
+            uint32_t k = segments.size() / 2, k_upper = segments.size(), k_lower = 0;
+            while (k_upper > k_lower + 1) {
+                if (static_cast<int32_t>(segments[k].xBase & XBASEMASK) > input) {
+                    k_upper = k;
+                    k = (k + k_lower) / 2;
+                } else {
+                    k_lower = k;
+                    k = (k_upper + k) / 2;
+                }
+            }
+            int64_t diff = static_cast<int64_t>(input) - static_cast<int32_t>(segments[k].xBase & XBASEMASK);
+            int64_t sum = ((diff * segments[k].slope) >> (((segments[k].xBase & ~XBASEMASK) + 1) * 8))
+                          + segments[k].yBase;
+            if (sum > 32767 || sum < -32768)
+                num_saturate++;
+            out[j] = static_cast<int16_t>(std::min<int64_t>(std::max<int64_t>(sum, -32768), 32767));
+        }
+        return num_saturate;
+    }
+
+    std::vector<intel_pwl_segment_t> random_segments(uint32_t num_segments, bool sorted) {
+        auto xbases = random<int32_t>(num_segments);
+        auto ybases = random<int16_t>(num_segments);
+        auto slopes = random<int16_t>(num_segments);
+        auto scales = random<int32_t>(num_segments, 0, 3);
+        if (sorted)
+            std::sort(xbases.begin(), xbases.end());
+        std::vector<intel_pwl_segment_t> segments(num_segments);
+        for (uint32_t i = 0; i < num_segments; i++) {
+            segments[i].xBase = (xbases[i] & XBASEMASK) | scales[i];
+            segments[i].yBase = ybases[i];
+            segments[i].slope = slopes[i];
+        }
+        return segments;
+    }
+
+    void check_pwl(const std::vector<intel_pwl_segment_t> &segments, std::vector<int32_t> inputs) {
+        const uint32_t rows = 2;
+        const uint32_t columns = static_cast<uint32_t>(inputs.size()) / rows;
+        std::vector<int16_t> expected(inputs.size()), outputs(inputs.size());
+        ref_pwl(inputs, expected, segments);
+
+        intel_dnn_component_t component = {};
+        component.num_rows_in = rows;
+        component.num_columns_in = columns;
+        component.ptr_inputs = inputs.data();
+        component.ptr_outputs = outputs.data();
+        component.op.pwl.num_segments = static_cast<uint32_t>(segments.size());
+        component.op.pwl.ptr_segments = const_cast<intel_pwl_segment_t *>(segments.data());
+        PwlApply16(&component, 0, rows - 1, 0, columns - 1);
+        ASSERT_EQ(expected, outputs);
+    }
+};
+
+TEST_F(GNAIntMathTest, igemm16IsBitExactForAnyShape) {
+    for (int M : {1, 5, 16, 37}) {
+        for (int N : {1, 3, 8}) {
+            for (int K : {1, 15, 16, 33, 440, 13000}) {
+                SCOPED_TRACE(std::to_string(M) + "x" + std::to_string(N) + "x" + std::to_string(K));
+                auto A = random<int16_t>(M * K), B = random<int16_t>(K * N);
+                auto C = random<int32_t>(M * N, -(1 << 20), 1 << 20);
+                // pairs of -32768 overflow pmaddwd
+                std::fill(A.begin(), A.begin() + std::min(K, 4), std::numeric_limits<int16_t>::min());
+                for (int k = 0; k < std::min(K, 4); k++)
+                    B[k * N] = std::numeric_limits<int16_t>::min();
+
+                std::vector<int32_t> expected(M * N);
+                for (int i = 0; i < M; i++)
+                    for (int j = 0; j < N; j++)
+                        expected[i * N + j] = ref_accumulate(C[i * N + j], 1, &A[i * K], &B[j], N, K, N);
+
+                cblas_igemm16(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, 1.0, A.data(), K, B.data(), N,
+                              1.0, C.data(), N);
+                ASSERT_EQ(expected, C);
+            }
+        }
+    }
+}
+
+TEST_F(GNAIntMathTest, igemm8IsBitExactForAnyShape) {
+    for (int M : {1, 5, 16, 37}) {
+        for (int N : {1, 3, 8}) {
+            for (int K : {1, 15, 16, 33, 4500}) {
+                SCOPED_TRACE(std::to_string(M) + "x" + std::to_string(N) + "x" + std::to_string(K));
+                auto A = random<int8_t>(M * K);
+                auto B = random<int16_t>(K * N);
+                auto bias = random_compound_bias(M);
+                std::vector<int32_t> expected(M * N), C(M * N);
+                for (int i = 0; i < M; i++)
+                    for (int j = 0; j < N; j++)
+                        expected[i * N + j] = ref_accumulate(bias[i].bias, bias[i].multiplier, &A[i * K], &B[j], N, K, N);
+
+                igemm8_gna(M, N, K, A.data(), K, B.data(), N, bias.data(), C.data(), N);
+                ASSERT_EQ(expected, C);
+            }
+        }
+    }
+}
+
+TEST_F(GNAIntMathTest, igemmSubsetIsBitExact) {
+    const int M = 100, N = 2, K = 65;
+    std::vector<uint32_t> rows = {99, 3, 5, 7, 0, 1, 42, 42, 17, 18, 19, 20, 21, 22, 23, 24, 50, 98, 2};
+    const int L = static_cast<int>(rows.size());
+    auto A8 = random<int8_t>(M * K);
+    auto A16 = random<int16_t>(M * K), B = random<int16_t>(K * N);
+    auto bias = random_compound_bias(M);
+    auto C16 = random<int32_t>(L * N);
+    std::vector<int32_t> expected8(L * N), expected16(L * N), C8(L * N);
+    for (int l = 0; l < L; l++) {
+        for (int j = 0; j < N; j++) {
+            const int i = rows[l];
+            expected8[l * N + j] = ref_accumulate(bias[i].bias, bias[i].multiplier, &A8[i * K], &B[j], N, K, N);
+            expected16[l * N + j] = ref_accumulate(C16[l * N + j], 1, &A16[i * K], &B[j], N, K, N);
+        }
+    }
+
+    igemm8_gna_subset(M, N, K, A8.data(), K, B.data(), N, bias.data(), C8.data(), N, rows.data(), L);
+    cblas_igemm16_subset(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, 1.0, A16.data(), K, B.data(), N,
+                         1.0, C16.data(), N, rows.data(), L);
+    ASSERT_EQ(expected8, C8);
+    ASSERT_EQ(expected16, C16);
+}
+
+TEST_F(GNAIntMathTest, igemmSaturatesBetweenPassesOfInputBuffer) {
+    // the first pass saturates the accumulator, so the second one brings it down from INT32_MAX
+    // instead of cancelling the first one as the exact sum would
+    const int K = 2 * static_cast<int>(igemm_pass_size(1));
+    std::vector<int16_t> A16(K, std::numeric_limits<int16_t>::max()), B(K, std::numeric_limits<int16_t>::max());
+    std::vector<int8_t> A8(K, std::numeric_limits<int8_t>::max());
+    std::fill(B.begin() + K / 2, B.end(), std::numeric_limits<int16_t>::min() + 1);
+    intel_compound_bias_t bias = {};
+    bias.bias = 0;
+    bias.multiplier = 1;
+
+    const int64_t pass_sum16 = int64_t(K / 2) * std::numeric_limits<int16_t>::max() * std::numeric_limits<int16_t>::max();
+    int32_t C16 = 0, C8 = 0;
+    cblas_igemm16(CblasRowMajor, CblasNoTrans, CblasNoTrans, 1, 1, K, 1.0, A16.data(), K, B.data(), 1,
+                  1.0, &C16, 1);
+    igemm8_gna(1, 1, K, A8.data(), K, B.data(), 1, &bias, &C8, 1);
+    ASSERT_EQ(saturate(std::numeric_limits<int32_t>::max() - pass_sum16), C16);
+    ASSERT_EQ(ref_accumulate(0, 1, A8.data(), B.data(), 1, K, 1), C8);
+    ASSERT_NE(saturate(ref_dot(A16.data(), B.data(), 1, K)), C16);
+}
+
+TEST_F(GNAIntMathTest, diagonalIsBitExact) {
+    for (uint32_t N : {1, 3}) {
+        SCOPED_TRACE(N);
+        const uint32_t M = 1027;
+        auto A8 = random<int8_t>(M);
+        auto A16 = random<int16_t>(M), B = random<int16_t>(M * N);
+        auto bias = random_compound_bias(M);
+        auto C16 = random<int32_t>(M * N);
+        std::vector<int32_t> expected8(M * N), expected16(M * N), C8(M * N);
+        for (uint32_t i = 0; i < M; i++) {
+            for (uint32_t j = 0; j < N; j++) {
+                expected8[i * N + j] = saturate(bias[i].bias + int64_t(bias[i].multiplier) * A8[i] * B[i * N + j]);
+                expected16[i * N + j] = saturate(int64_t(C16[i * N + j]) + int64_t(A16[i]) * B[i * N + j]);
+            }
+        }
+
+        isbmm8_gna(M, N, A8.data(), B.data(), N, bias.data(), C8.data(), N);
+        cblas_isbmm16(M, N, A16.data(), B.data(), N, C16.data(), N);
+        ASSERT_EQ(expected8, C8);
+        ASSERT_EQ(expected16, C16);
+    }
+}
+
+TEST_F(GNAIntMathTest, gemvSplitIsBitExact) {
+    const uint32_t N = 131, K1 = 37, K2 = 29;
+    auto A1 = random<int16_t>(K1), A2 = random<int16_t>(K2);
+    auto X8 = random<int8_t>(N * (K1 + K2));
+    auto X16 = random<int16_t>(N * (K1 + K2));
+    auto bias8 = random_compound_bias(N);
+    auto bias16 = random<int32_t>(N);
+    std::vector<int16_t> inputs(A1);
+    inputs.insert(inputs.end(), A2.begin(), A2.end());
+
+    std::vector<int32_t> expected8(N), expected16(N), C8(N), C16(N);
+    for (uint32_t i = 0; i < N; i++) {
+        expected8[i] = ref_accumulate(bias8[i].bias, bias8[i].multiplier, &X8[i * (K1 + K2)], inputs.data(), 1,
+                                      K1 + K2, 1);
+        expected16[i] = ref_accumulate(bias16[i], 1, &X16[i * (K1 + K2)], inputs.data(), 1, K1 + K2, 1);
+    }
+
+    igemv8_gna_split(N, K1, K2, A1.data(), A2.data(), X8.data(), bias8.data(), C8.data());
+    igemv16_split(N, K1, K2, A1.data(), A2.data(), X16.data(), bias16.data(), C16.data());
+    ASSERT_EQ(expected8, C8);
+    ASSERT_EQ(expected16, C16);
+}
+
+TEST_F(GNAIntMathTest, convolutionIsBitExact) {
+    const uint32_t num_filters = 12, num_filter_coefficients = 48, band_stride = 8, num_outputs = 21;
+    const uint32_t num_inputs = (num_outputs - 1) * band_stride + num_filter_coefficients;
+    auto filters = random<int16_t>(num_filters * num_filter_coefficients);
+    auto biases = random<int32_t>(num_filters);
+    auto inputs = random<int16_t>(num_inputs);
+    std::vector<int32_t> expected(num_outputs * num_filters), outputs(num_outputs * num_filters);
+
+    for (uint32_t j = 0; j < num_outputs; j++) {
+        for (uint32_t i = 0; i < num_filters; i++) {
+            expected[j * num_filters + i] = ref_accumulate(biases[i], 1, &filters[i * num_filter_coefficients],
+                                                           &inputs[j * band_stride], 1, num_filter_coefficients, 1);
+        }
+    }
+
+    intel_dnn_component_t component = {};
+    component.num_rows_in = 1;
+    component.num_rows_out = 1;
+    component.num_columns_out = num_outputs * num_filters;
+    component.ptr_inputs = inputs.data();
+    component.ptr_outputs = outputs.data();
+    component.op.conv1D.ptr_filters = filters.data();
+    component.op.conv1D.ptr_biases = biases.data();
+    component.op.conv1D.num_filters = num_filters;
+    component.op.conv1D.num_filter_coefficients = num_filter_coefficients;
+    component.op.conv1D.num_filter_rows = num_filter_coefficients / band_stride;
+    component.op.conv1D.num_feature_maps = 1;
+    component.op.conv1D.num_feature_map_columns = band_stride;
+    component.op.conv1D.num_feature_map_rows = num_outputs - 1 + component.op.conv1D.num_filter_rows;
+    CNNFilter16(&component);
+    ASSERT_EQ(expected, outputs);
+}
+
+TEST_F(GNAIntMathTest, pwlIsBitExact) {
+    for (uint32_t num_segments : {1, 2, 3, 65, 128}) {
+        SCOPED_TRACE(num_segments);
+        auto segments = random_segments(num_segments, true);
+        auto inputs = random<int32_t>(2 * 5003);
+        // values at the segment boundaries and the extremes
+        for (uint32_t i = 0; i < num_segments && 4 * i + 3 < inputs.size(); i++) {
+            const int32_t xbase = static_cast<int32_t>(segments[i].xBase & XBASEMASK);
+            inputs[4 * i] = xbase;
+            inputs[4 * i + 1] = xbase + 1;
+            inputs[4 * i + 2] = xbase - 1;
+        }
+        inputs[inputs.size() - 1] = std::numeric_limits<int32_t>::max();
+        inputs[inputs.size() - 2] = std::numeric_limits<int32_t>::min();
+        check_pwl(segments, inputs);
+    }
+}
+
+TEST_F(GNAIntMathTest, pwlFollowsReferenceSearchForUnsortedSegments) {
+    check_pwl(random_segments(37, false), random<int32_t>(2 * 1000));
+}
+
+TEST_F(GNAIntMathTest, pwlHandlesRepeatedSegmentStarts) {
+    auto segments = random_segments(20, true);
+    for (uint32_t i = 5; i < 12; i++)
+        segments[i].xBase = (segments[4].xBase & XBASEMASK) | (segments[i].xBase & ~XBASEMASK);
+    auto inputs = random<int32_t>(2 * 1000);
+    inputs[0] = static_cast<int32_t>(segments[4].xBase & XBASEMASK);
+    inputs[1] = inputs[0] + 1;
+    check_pwl(segments, inputs);
+}
+
+#ifdef HAVE_AVX2
+TEST_F(GNAIntMathTest, avx2DotProductsAreExact) {
+    if (!InferenceEngine::with_cpu_x86_avx2())
+        return;
+    for (int K : {0, 7, 16, 32, 47, 100000}) {
+        SCOPED_TRACE(K);
+        std::vector<int16_t> a16(K, std::numeric_limits<int16_t>::min()), b(K, std::numeric_limits<int16_t>::min());
+        std::vector<int8_t> a8(K, std::numeric_limits<int8_t>::min());
+        ASSERT_EQ(ref_dot(a16.data(), b.data(), 1, K), GNAPluginNS::avx2::dot16(a16.data(), b.data(), K));
+        ASSERT_EQ(ref_dot(a8.data(), b.data(), 1, K), GNAPluginNS::avx2::dot8(a8.data(), b.data(), K));
+
+        a16 = random<int16_t>(K);
+        a8 = random<int8_t>(K);
+        b = random<int16_t>(K);
+        ASSERT_EQ(ref_dot(a16.data(), b.data(), 1, K), GNAPluginNS::avx2::dot16(a16.data(), b.data(), K));
+        ASSERT_EQ(ref_dot(a8.data(), b.data(), 1, K), GNAPluginNS::avx2::dot8(a8.data(), b.data(), K));
+    }
+}
+#endif
+
+TEST_F(GNAIntMathTest, DISABLED_PerfAffine) {
+    // quantized speech-like affine layer: 2048 outputs, 2048 inputs, batch of 8 frames, 8- and 16-bit weights
+    const int M = 2048, N = 8, K = 2048, iterations = 20;
+    auto A8 = random<int8_t>(M * K);
+    auto A16 = random<int16_t>(M * K), B = random<int16_t>(K * N);
+    auto bias = random_compound_bias(M);
+    std::vector<int32_t> C(M * N);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++)
+        igemm8_gna(M, N, K, A8.data(), K, B.data(), N, bias.data(), C.data(), N);
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    std::cout << "[ INFO     ] " << elapsed.count() / iterations << " ms per int8 affine" << std::endl;
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++)
+        cblas_igemm16(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, 1.0, A16.data(), K, B.data(), N,
+                      1.0, C.data(), N);
+    elapsed = std::chrono::steady_clock::now() - start;
+    std::cout << "[ INFO     ] " << elapsed.count() / iterations << " ms per int16 affine" << std::endl;
+
+    auto segments = random_segments(65, true);
+    std::vector<int32_t> inputs(C);
+    std::vector<int16_t> outputs(M * N);
+    intel_dnn_component_t component = {};
+    component.num_rows_in = M;
+    component.num_columns_in = N;
+    component.ptr_inputs = inputs.data();
+    component.ptr_outputs = outputs.data();
+    component.op.pwl.num_segments = static_cast<uint32_t>(segments.size());
+    component.op.pwl.ptr_segments = segments.data();
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++)
+        PwlApply16(&component, 0, M - 1, 0, N - 1);
+    elapsed = std::chrono::steady_clock::now() - start;
+    std::cout << "[ INFO     ] " << elapsed.count() / iterations << " ms per PWL" << std::endl;
+}
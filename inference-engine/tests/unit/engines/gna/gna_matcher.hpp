@@ -80,6 +80,8 @@ class GnaPluginTestEnvironment {
     std::string importedModelFileName;
     bool is_profiling_enabled = false;
     bool matchOutput = false;
+    bool host_emulation = false;
+    float output_tolerance = 0.0f;
     bool is_setup_of_omp_theads_expected = false;
     std::vector<int16_t> input_processed;
     InferenceEngine::Precision input_precision = InferenceEngine::Precision::FP32;
@@ -392,6 +394,23 @@ class GNAPropagateMatcher : public GNATestConfigurability<GNAPropagateMatcher> {
         _env.target_device = InferenceEngine::TargetDevice::eCPU;
         return *this;
     }
+
+    /**
+     * @brief quantized network is propagated by the plugin's integer emulation, GNA library isn't called
+     */
+    GNAPropagateMatcher & onHost() {
+        _env.config[GNA_CONFIG_KEY(DEVICE_MODE)] = GNA_CONFIG_VALUE(SW_HOST);
+        _env.host_emulation = true;
+        return *this;
+    }
+
+    /**
+     * @brief outputs match expected values up to this absolute error
+     */
+    GNAPropagateMatcher & with_tolerance(float tolerance) {
+        _env.output_tolerance = tolerance;
+        return *this;
+    }
  protected:
     void match();
     intel_nnet_type_t * original_nnet = nullptr;
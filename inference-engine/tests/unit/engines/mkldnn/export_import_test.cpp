@@ -0,0 +1,161 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "tests_common.hpp"
+#include <cpp/ie_cnn_net_reader.h>
+#include <mkldnn_plugin/mkldnn_plugin.h>
+
+using namespace ::testing;
+using namespace InferenceEngine;
+
+class MKLDNNExportImportTests : public TestsCommon {
+protected:
+    const std::string FILE_NAME = "MKLDNNExportImportTests.blob";
+
+    std::string model = R"V0G0N(
+<net name="ConvReLU" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="conv" type="Convolution" precision="FP32" id="1">
+            <convolution_data stride-x="1" stride-y="1" pad-x="1" pad-y="1" kernel-x="3" kernel-y="3" output="4" group="1"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+            <weights offset="0" size="432"/>
+            <biases offset="432" size="16"/>
+        </layer>
+        <layer name="relu" type="ReLU" precision="FP32" id="2">
+            <input>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
+    </edges>
+</net>
+)V0G0N";
+
+    virtual void TearDown() {
+        std::remove(FILE_NAME.c_str());
+    }
+
+    CNNNetwork readNetwork() {
+        CNNNetReader reader;
+        reader.ReadNetwork(model.data(), model.length());
+        TBlob<uint8_t>::Ptr weights = make_shared_blob<uint8_t>({Precision::U8, {448}, C});
+        weights->allocate();
+        fill_data(weights->buffer().as<float*>(), weights->size() / sizeof(float));
+        reader.SetWeights(weights);
+        return reader.getNetwork();
+    }
+
+    static void infer(IExecutableNetwork::Ptr &network, const Blob::Ptr &input, BlobMap &outputs) {
+        IInferRequest::Ptr request;
+        ResponseDesc resp;
+        ASSERT_EQ(OK, network->CreateInferRequest(request, &resp)) << resp.msg;
+        ASSERT_EQ(OK, request->SetBlob("data", input, &resp)) << resp.msg;
+        ASSERT_EQ(OK, request->Infer(&resp)) << resp.msg;
+        for (auto &output : outputs) {
+            ASSERT_EQ(OK, request->GetBlob(output.first.c_str(), output.second, &resp)) << resp.msg;
+        }
+    }
+};
+
+TEST_F(MKLDNNExportImportTests, importedNetworkGivesSameResults) {
+    CNNNetwork network = readNetwork();
+    network.addOutput("conv");
+    network.getInputsInfo().begin()->second->setPrecision(Precision::U8);
+    network.getInputsInfo().begin()->second->setLayout(NHWC);
+
+    std::shared_ptr<MKLDNNPlugin::Engine> engine(new MKLDNNPlugin::Engine());
+    IExecutableNetwork::Ptr loaded;
+    ASSERT_NO_THROW(engine->LoadNetwork(loaded, network, {}));
+
+    ResponseDesc resp;
+    ASSERT_EQ(OK, loaded->Export(FILE_NAME, &resp)) << resp.msg;
+
+    IExecutableNetwork::Ptr imported;
+    ASSERT_NO_THROW(imported = engine->ImportNetwork(FILE_NAME, {}));
+
+    ConstInputsDataMap inputs;
+    ASSERT_EQ(OK, imported->GetInputsInfo(inputs, &resp)) << resp.msg;
+    ASSERT_EQ(1, inputs.size());
+    ASSERT_EQ(Precision::U8, inputs.begin()->second->getPrecision());
+    ASSERT_EQ(NHWC, inputs.begin()->second->getTensorDesc().getLayout());
+
+    ConstOutputsDataMap outputs;
+    ASSERT_EQ(OK, imported->GetOutputsInfo(outputs, &resp)) << resp.msg;
+    ASSERT_EQ(2, outputs.size());
+    ASSERT_NE(outputs.end(), outputs.find("conv"));
+    ASSERT_NE(outputs.end(), outputs.find("relu"));
+
+    Blob::Ptr input = make_shared_blob<uint8_t>({Precision::U8, {1, 3, 8, 8}, NHWC});
+    input->allocate();
+    for (size_t i = 0; i < input->size(); i++)
+        input->buffer().as<uint8_t*>()[i] = static_cast<uint8_t>(i % 255);
+
+    BlobMap ref = {{"conv", nullptr}, {"relu", nullptr}};
+    BlobMap dst = ref;
+    infer(loaded, input, ref);
+    infer(imported, input, dst);
+
+    for (auto &output : ref) {
+        compare(*output.second, *dst[output.first]);
+    }
+}
+
+TEST_F(MKLDNNExportImportTests, importOfCorruptedFileThrows) {
+    std::ofstream(FILE_NAME, std::ios::binary | std::ios::out) << "not a model";
+
+    std::shared_ptr<MKLDNNPlugin::Engine> engine(new MKLDNNPlugin::Engine());
+    ASSERT_THROW(engine->ImportNetwork(FILE_NAME, {}), details::InferenceEngineException);
+}
+
+TEST_F(MKLDNNExportImportTests, importOfMissingFileThrows) {
+    std::shared_ptr<MKLDNNPlugin::Engine> engine(new MKLDNNPlugin::Engine());
+    ASSERT_THROW(engine->ImportNetwork(FILE_NAME + ".missing", {}), details::InferenceEngineException);
+}
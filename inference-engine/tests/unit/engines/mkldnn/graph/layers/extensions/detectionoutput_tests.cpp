@@ -0,0 +1,499 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include <mkldnn_plugin/mkldnn_extension_utils.h>
+#include <extension/ext_list.hpp>
+#include "tests_common.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+using namespace InferenceEngine;
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+
+struct detectionoutput_test_params {
+    size_t num;
+    int num_classes;
+    int num_priors;
+
+    bool share_location;
+    bool variance_encoded_in_target;
+    bool decrease_label_id;
+    int background_label_id;
+    bool center_size;
+
+    int top_k;
+    int keep_top_k;
+    float nms_threshold;
+    float confidence_threshold;
+
+    // number of distinct confidence values, 0 - confidences are all different
+    int conf_levels;
+};
+
+// Straightforward implementation of DetectionOutput for normalized priors: the confidences are transposed
+// to [class, prior], every class is suppressed on its own and keep_top_k sorts all the detections of an image
+void ref_detectionoutput(const float *loc_data, const float *conf_data, const float *prior_data, float *dst_data,
+                         detectionoutput_test_params prm) {
+    const int N = static_cast<int>(prm.num);
+    const int C = prm.num_classes;
+    const int P = prm.num_priors;
+    const int num_loc_classes = prm.share_location ? 1 : C;
+
+    std::vector<float> bboxes(N * num_loc_classes * P * 4);
+    std::vector<float> sizes(N * num_loc_classes * P);
+    std::vector<float> conf(N * C * P);
+    std::vector<int> indices(N * C * P);
+    std::vector<int> buffer(C * P);
+    std::vector<int> detections(N * C, 0);
+
+    for (int n = 0; n < N; n++) {
+        for (int c = 0; c < num_loc_classes; c++) {
+            if (!prm.share_location && c == prm.background_label_id)
+                continue;
+
+            const float *ploc = loc_data + n * 4 * num_loc_classes * P + c * 4;
+            const float *variances = prior_data + P * 4;
+            float *pboxes = &bboxes[(n * num_loc_classes + c) * P * 4];
+            float *psizes = &sizes[(n * num_loc_classes + c) * P];
+            for (int p = 0; p < P; p++) {
+                const float *prior = prior_data + p * 4;
+                const float *l = ploc + 4 * p * num_loc_classes;
+                float v[4] = {1.f, 1.f, 1.f, 1.f};
+                if (!prm.variance_encoded_in_target) {
+                    for (int i = 0; i < 4; i++)
+                        v[i] = variances[p * 4 + i];
+                }
+
+                float box[4];
+                if (!prm.center_size) {
+                    if (prm.variance_encoded_in_target) {
+                        for (int i = 0; i < 4; i++)
+                            box[i] = prior[i] + l[i];
+                    } else {
+                        for (int i = 0; i < 4; i++)
+                            box[i] = prior[i] + v[i] * l[i];
+                    }
+                } else {
+                    float prior_width    =  prior[2] - prior[0];
+                    float prior_height   =  prior[3] - prior[1];
+                    float prior_center_x = (prior[0] + prior[2]) / 2.0f;
+                    float prior_center_y = (prior[1] + prior[3]) / 2.0f;
+
+                    float center_x, center_y, width, height;
+                    if (prm.variance_encoded_in_target) {
+                        center_x = l[0] * prior_width  + prior_center_x;
+                        center_y = l[1] * prior_height + prior_center_y;
+                        width  = std::exp(l[2]) * prior_width;
+                        height = std::exp(l[3]) * prior_height;
+                    } else {
+                        center_x = v[0] * l[0] * prior_width + prior_center_x;
+                        center_y = v[1] * l[1] * prior_height + prior_center_y;
+                        width    = std::exp(v[2] * l[2]) * prior_width;
+                        height   = std::exp(v[3] * l[3]) * prior_height;
+                    }
+
+                    box[0] = center_x - width  / 2.0f;
+                    box[1] = center_y - height / 2.0f;
+                    box[2] = center_x + width  / 2.0f;
+                    box[3] = center_y + height / 2.0f;
+                }
+
+                for (int i = 0; i < 4; i++)
+                    pboxes[p * 4 + i] = box[i];
+                psizes[p] = (box[2] - box[0]) * (box[3] - box[1]);
+            }
+        }
+    }
+
+    for (int n = 0; n < N; n++)
+        for (int c = 0; c < C; c++)
+            for (int p = 0; p < P; p++)
+                conf[(n * C + c) * P + p] = conf_data[(n * P + p) * C + c];
+
+    auto overlap = [](const float *boxes, const float *box_sizes, int idx1, int idx2) {
+        const float *b1 = boxes + idx1 * 4;
+        const float *b2 = boxes + idx2 * 4;
+        if (b2[0] > b1[2] || b2[2] < b1[0] || b2[1] > b1[3] || b2[3] < b1[1])
+            return 0.0f;
+
+        float width  = std::min(b1[2], b2[2]) - std::max(b1[0], b2[0]);
+        float height = std::min(b1[3], b2[3]) - std::max(b1[1], b2[1]);
+        if (width <= 0 || height <= 0)
+            return 0.0f;
+
+        float intersect = width * height;
+        return intersect / (box_sizes[idx1] + box_sizes[idx2] - intersect);
+    };
+
+    for (int n = 0; n < N; n++) {
+        int *pdetections = &detections[n * C];
+
+        if (!prm.decrease_label_id) {
+            for (int c = 0; c < C; c++) {
+                if (c == prm.background_label_id)
+                    continue;
+
+                const float *pconf = &conf[(n * C + c) * P];
+                int *pindices = &indices[(n * C + c) * P];
+                const int loc_class = prm.share_location ? 0 : c;
+                const float *pboxes = &bboxes[(n * num_loc_classes + loc_class) * P * 4];
+                const float *psizes = &sizes[(n * num_loc_classes + loc_class) * P];
+
+                int count = 0;
+                for (int p = 0; p < P; p++) {
+                    if (pconf[p] > prm.confidence_threshold)
+                        pindices[count++] = p;
+                }
+
+                int num_output_scores = (prm.top_k == -1 ? count : std::min(prm.top_k, count));
+                std::partial_sort_copy(pindices, pindices + count, buffer.data(), buffer.data() + num_output_scores,
+                                       [&](int idx1, int idx2) {
+                                           if (pconf[idx1] != pconf[idx2])
+                                               return pconf[idx1] > pconf[idx2];
+                                           return idx1 < idx2;
+                                       });
+
+                for (int i = 0; i < num_output_scores; i++) {
+                    bool keep = true;
+                    for (int k = 0; k < pdetections[c] && keep; k++)
+                        keep = !(overlap(pboxes, psizes, buffer[i], pindices[k]) > prm.nms_threshold);
+                    if (keep)
+                        pindices[pdetections[c]++] = buffer[i];
+                }
+            }
+        } else {
+            const float *pconf = &conf[n * C * P];
+            int *pindices = &indices[n * C * P];
+            const float *pboxes = &bboxes[n * P * 4];
+            const float *psizes = &sizes[n * P];
+
+            // every prior goes to its best class only
+            int count = 0;
+            for (int p = 0; p < P; p++) {
+                float best = -1;
+                int id = 0;
+                for (int c = 1; c < C; c++) {
+                    if (pconf[c * P + p] > best) {
+                        best = pconf[c * P + p];
+                        id = c;
+                    }
+                }
+                if (id > 0 && best >= prm.confidence_threshold)
+                    pindices[count++] = id * P + p;
+            }
+
+            int num_output_scores = (prm.top_k == -1 ? count : std::min(prm.top_k, count));
+            std::partial_sort_copy(pindices, pindices + count, buffer.data(), buffer.data() + num_output_scores,
+                                   [&](int idx1, int idx2) {
+                                       if (pconf[idx1] != pconf[idx2])
+                                           return pconf[idx1] > pconf[idx2];
+                                       return idx1 < idx2;
+                                   });
+
+            for (int i = 0; i < num_output_scores; i++) {
+                const int c = buffer[i] / P;
+                const int p = buffer[i] % P;
+                bool keep = true;
+                for (int k = 0; k < pdetections[c] && keep; k++)
+                    keep = !(overlap(pboxes, psizes, p, pindices[c * P + k]) > prm.nms_threshold);
+                if (keep)
+                    pindices[c * P + pdetections[c]++] = p;
+            }
+        }
+
+        int detections_total = 0;
+        for (int c = 0; c < C; c++)
+            detections_total += pdetections[c];
+
+        if (prm.keep_top_k > -1 && detections_total > prm.keep_top_k) {
+            std::vector<std::pair<float, std::pair<int, int>>> conf_index_class_map;
+            for (int c = 0; c < C; c++) {
+                for (int i = 0; i < pdetections[c]; i++) {
+                    int idx = indices[(n * C + c) * P + i];
+                    conf_index_class_map.push_back(std::make_pair(conf[(n * C + c) * P + idx], std::make_pair(c, idx)));
+                }
+            }
+
+            // equal scores are ordered by class and then by prior
+            std::sort(conf_index_class_map.begin(), conf_index_class_map.end(),
+                      [](const std::pair<float, std::pair<int, int>> &pair1,
+                         const std::pair<float, std::pair<int, int>> &pair2) {
+                          return pair1.first > pair2.first ||
+                                 (pair1.first == pair2.first && pair1.second < pair2.second);
+                      });
+            conf_index_class_map.resize(prm.keep_top_k);
+
+            std::fill(pdetections, pdetections + C, 0);
+            for (auto &item : conf_index_class_map) {
+                int c = item.second.first;
+                indices[(n * C + c) * P + pdetections[c]++] = item.second.second;
+            }
+        }
+    }
+
+    std::fill(dst_data, dst_data + N * prm.keep_top_k * 7, 0.0f);
+
+    int count = 0;
+    for (int n = 0; n < N; n++) {
+        for (int c = 0; c < C; c++) {
+            const int loc_class = prm.share_location ? 0 : c;
+            for (int i = 0; i < detections[n * C + c]; i++) {
+                int idx = indices[(n * C + c) * P + i];
+                const float *box = &bboxes[((n * num_loc_classes + loc_class) * P + idx) * 4];
+
+                float *pdst = dst_data + count * 7;
+                pdst[0] = static_cast<float>(n);
+                pdst[1] = static_cast<float>(prm.decrease_label_id ? c - 1 : c);
+                pdst[2] = conf[(n * C + c) * P + idx];
+                for (int k = 0; k < 4; k++)
+                    pdst[3 + k] = box[k];
+                count++;
+            }
+        }
+    }
+
+    if (count < N * prm.keep_top_k) {
+        // marker at end of boxes list
+        dst_data[count * 7] = -1;
+    }
+}
+
+class MKLDNNCPUExtDetectionOutputTests: public TestsCommon, public WithParamInterface<detectionoutput_test_params> {
+    std::string model_t = R"V0G0N(
+<net Name="DetectionOutput_net" version="2" precision="FP32" batch="_IN_">
+    <layers>
+        <layer name="loc" type="Input" precision="FP32" id="1">
+            <output>
+                <port id="1">
+                    <dim>_IN_</dim>
+                    <dim>_LOC_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="conf" type="Input" precision="FP32" id="2">
+            <output>
+                <port id="2">
+                    <dim>_IN_</dim>
+                    <dim>_CONF_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="priors" type="Input" precision="FP32" id="3">
+            <output>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>_PV_</dim>
+                    <dim>_PRIORS_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="detection_out" type="DetectionOutput" precision="FP32" id="4">
+            <data num_classes="_NC_" share_location="_SL_" background_label_id="_BG_" nms_threshold="_NMS_"
+                  top_k="_TK_" keep_top_k="_KTK_" code_type="_CT_" variance_encoded_in_target="_VET_"
+                  confidence_threshold="_CTH_" decrease_label_id="_DLI_"/>
+            <input>
+                <port id="4">
+                    <dim>_IN_</dim>
+                    <dim>_LOC_</dim>
+                </port>
+                <port id="5">
+                    <dim>_IN_</dim>
+                    <dim>_CONF_</dim>
+                </port>
+                <port id="6">
+                    <dim>1</dim>
+                    <dim>_PV_</dim>
+                    <dim>_PRIORS_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="7">
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>_OUT_</dim>
+                    <dim>7</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="1" from-port="1" to-layer="4" to-port="4"/>
+        <edge from-layer="2" from-port="2" to-layer="4" to-port="5"/>
+        <edge from-layer="3" from-port="3" to-layer="4" to-port="6"/>
+    </edges>
+</net>
+)V0G0N";
+
+    std::string getModel(detectionoutput_test_params p) {
+        std::string model = model_t;
+        int num_loc_classes = p.share_location ? 1 : p.num_classes;
+
+        REPLACE_WITH_NUM(model, "_IN_", p.num);
+        REPLACE_WITH_NUM(model, "_LOC_", p.num_priors * num_loc_classes * 4);
+        REPLACE_WITH_NUM(model, "_CONF_", p.num_priors * p.num_classes);
+        REPLACE_WITH_NUM(model, "_PV_", p.variance_encoded_in_target ? 1 : 2);
+        REPLACE_WITH_NUM(model, "_PRIORS_", p.num_priors * 4);
+        REPLACE_WITH_NUM(model, "_OUT_", p.num * p.keep_top_k);
+
+        REPLACE_WITH_NUM(model, "_NC_", p.num_classes);
+        REPLACE_WITH_NUM(model, "_SL_", p.share_location);
+        REPLACE_WITH_NUM(model, "_BG_", p.background_label_id);
+        REPLACE_WITH_NUM(model, "_NMS_", p.nms_threshold);
+        // the layer takes all the candidates when top_k is not set, the IR does not allow a negative value
+        if (p.top_k == -1)
+            REPLACE_WITH_STR(model, " top_k=\"_TK_\"", "");
+        else
+            REPLACE_WITH_NUM(model, "_TK_", p.top_k);
+        REPLACE_WITH_NUM(model, "_KTK_", p.keep_top_k);
+        REPLACE_WITH_STR(model, "_CT_", p.center_size ? "caffe.PriorBoxParameter.CENTER_SIZE"
+                                                      : "caffe.PriorBoxParameter.CORNER");
+        REPLACE_WITH_NUM(model, "_VET_", p.variance_encoded_in_target);
+        REPLACE_WITH_NUM(model, "_CTH_", p.confidence_threshold);
+        REPLACE_WITH_NUM(model, "_DLI_", p.decrease_label_id);
+
+        return model;
+    }
+
+    // priors on a coarse grid with random jitter so that neighbours overlap, variances of 0.1 and 0.2
+    void fill_priors(float *data, detectionoutput_test_params p) {
+        int grid = static_cast<int>(std::ceil(std::sqrt(static_cast<float>(p.num_priors))));
+        for (int i = 0; i < p.num_priors; i++) {
+            float x = static_cast<float>(i % grid) / grid + (rand() % 100) * 0.0005f;
+            float y = static_cast<float>(i / grid) / grid + (rand() % 100) * 0.0005f;
+            float size = 1.5f / grid + (rand() % 100) * 0.001f;
+            data[i * 4 + 0] = x;
+            data[i * 4 + 1] = y;
+            data[i * 4 + 2] = x + size;
+            data[i * 4 + 3] = y + size;
+        }
+        if (!p.variance_encoded_in_target) {
+            for (int i = 0; i < p.num_priors * 4; i++)
+                data[p.num_priors * 4 + i] = (i % 4) < 2 ? 0.1f : 0.2f;
+        }
+    }
+
+    void fill_confidences(float *data, size_t size, detectionoutput_test_params p) {
+        for (size_t i = 0; i < size; i++) {
+            if (p.conf_levels)
+                data[i] = static_cast<float>(rand() % p.conf_levels + 1) / p.conf_levels;
+            else
+                data[i] = static_cast<float>(rand()) / RAND_MAX;
+        }
+    }
+
+protected:
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            detectionoutput_test_params p = ::testing::WithParamInterface<detectionoutput_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            InferenceEngine::Extension cpuExt(make_so_name("cpu_extension"));
+            MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+            extMgr->AddExtension(InferenceEngine::IExtensionPtr(&cpuExt, [](InferenceEngine::IExtension*){}));
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork(), extMgr);
+
+            srand(42);
+            int num_loc_classes = p.share_location ? 1 : p.num_classes;
+
+            SizeVector loc_dims = {p.num, static_cast<size_t>(p.num_priors * num_loc_classes * 4)};
+            Blob::Ptr loc = make_shared_blob<float>({ Precision::FP32, loc_dims, NC });
+            loc->allocate();
+            float *loc_data = loc->buffer().as<float *>();
+            for (size_t i = 0; i < loc->size(); i++)
+                loc_data[i] = static_cast<float>(rand() % 200 - 100) * 0.002f;
+
+            SizeVector conf_dims = {p.num, static_cast<size_t>(p.num_priors * p.num_classes)};
+            Blob::Ptr conf = make_shared_blob<float>({ Precision::FP32, conf_dims, NC });
+            conf->allocate();
+            fill_confidences(conf->buffer().as<float *>(), conf->size(), p);
+
+            SizeVector priors_dims = {1, static_cast<size_t>(p.variance_encoded_in_target ? 1 : 2),
+                                      static_cast<size_t>(p.num_priors * 4)};
+            Blob::Ptr priors = make_shared_blob<float>({ Precision::FP32, priors_dims, CHW });
+            priors->allocate();
+            fill_priors(priors->buffer().as<float *>(), p);
+
+            BlobMap srcs;
+            srcs.insert(std::pair<std::string, Blob::Ptr>("loc", loc));
+            srcs.insert(std::pair<std::string, Blob::Ptr>("conf", conf));
+            srcs.insert(std::pair<std::string, Blob::Ptr>("priors", priors));
+
+            OutputsDataMap out;
+            out = net_reader.getNetwork().getOutputsInfo();
+            BlobMap outputBlobs;
+
+            std::pair<std::string, DataPtr> item = *out.begin();
+
+            TBlob<float>::Ptr output;
+            output = make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            graph.Infer(srcs, outputBlobs);
+
+            TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+            ref_detectionoutput(loc->buffer().as<const float *>(), conf->buffer().as<const float *>(),
+                                priors->buffer().as<const float *>(), dst_ref.data(), p);
+
+            // the same detections in the same order, equal scores included, the tolerance is for the box decoding only
+            compare(*output, dst_ref, 0.00001f);
+        } catch (const details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNCPUExtDetectionOutputTests, TestsDetectionOutput) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsDetectionOutput, MKLDNNCPUExtDetectionOutputTests,
+        ::testing::Values(
+                // Params: num, num_classes, num_priors, share_location, variance_encoded_in_target, decrease_label_id,
+                //         background_label_id, center_size, top_k, keep_top_k, nms_threshold, confidence_threshold,
+                //         conf_levels
+                // Caffe
+                detectionoutput_test_params{ 1, 21, 100, true, false, false, 0, true, 400, 200, 0.45f, 0.01f, 0 },
+                detectionoutput_test_params{ 1, 21, 100, true, false, false, 0, false, -1, 50, 0.45f, 0.01f, 0 },
+                detectionoutput_test_params{ 1, 7, 64, true, false, false, 6, true, 30, 100, 0.5f, 0.3f, 0 },
+                // batch
+                detectionoutput_test_params{ 4, 21, 150, true, false, false, 0, true, 100, 60, 0.45f, 0.01f, 0 },
+                detectionoutput_test_params{ 3, 9, 81, true, false, false, 0, false, -1, 25, 0.3f, 0.2f, 0 },
+                // share_location=false
+                detectionoutput_test_params{ 1, 5, 60, false, false, false, 0, true, 200, 40, 0.45f, 0.01f, 0 },
+                detectionoutput_test_params{ 2, 6, 49, false, false, false, 2, false, 20, 30, 0.5f, 0.1f, 0 },
+                // variance_encoded_in_target
+                detectionoutput_test_params{ 2, 21, 100, true, true, false, 0, true, 200, 100, 0.45f, 0.01f, 0 },
+                detectionoutput_test_params{ 1, 4, 36, false, true, false, 0, false, -1, 50, 0.45f, 0.01f, 0 },
+                // MXNet
+                detectionoutput_test_params{ 1, 11, 150, true, false, true, 0, true, 400, 100, 0.45f, 0.01f, 0 },
+                detectionoutput_test_params{ 3, 11, 150, true, false, true, 0, true, 50, 20, 0.45f, 0.01f, 0 },
+                detectionoutput_test_params{ 2, 4, 64, true, true, true, 0, false, -1, 30, 0.5f, 0.2f, 0 },
+                // equal scores at the top_k and keep_top_k cut-offs
+                detectionoutput_test_params{ 1, 21, 100, true, false, false, 0, true, 40, 50, 0.45f, 0.01f, 4 },
+                detectionoutput_test_params{ 2, 6, 50, true, false, false, 0, true, 20, 10, 0.45f, 0.01f, 3 },
+                detectionoutput_test_params{ 3, 17, 64, false, false, false, 0, false, 16, 33, 0.6f, 0.1f, 5 },
+                detectionoutput_test_params{ 2, 11, 150, true, false, true, 0, true, 60, 25, 0.45f, 0.01f, 4 },
+                detectionoutput_test_params{ 1, 9, 100, true, true, true, 0, true, -1, 30, 0.45f, 0.01f, 2 }
+        ));
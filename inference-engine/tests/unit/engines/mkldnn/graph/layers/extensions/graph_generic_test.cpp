@@ -15,6 +15,7 @@
 #include "tests_common.hpp"
 
 #include <ext_list.hpp>
+#include <set>
 
 using namespace ::testing;
 using namespace std;
@@ -200,6 +201,42 @@ private:
     InferenceEngine::CNNLayer * cnnLayer;
 };
 
+// Keeps every blob passed to the layer, so each wrapper created by the plugin stays alive and is counted once
+class WrappersCountingPrimitiveImpl : public DoublePrimitiveImpl {
+public:
+    WrappersCountingPrimitiveImpl(const InferenceEngine::CNNLayer *layer) : DoublePrimitiveImpl(layer) {}
+
+    InferenceEngine::StatusCode execute(std::vector<InferenceEngine::Blob::Ptr>& inputs, std::vector<InferenceEngine::Blob::Ptr>& outputs, InferenceEngine::ResponseDesc *resp) noexcept override {
+        seenBlobs.insert(inputs.begin(), inputs.end());
+        seenBlobs.insert(outputs.begin(), outputs.end());
+        return DoublePrimitiveImpl::execute(inputs, outputs, resp);
+    }
+
+    static std::set<InferenceEngine::Blob::Ptr> seenBlobs;
+};
+
+std::set<InferenceEngine::Blob::Ptr> WrappersCountingPrimitiveImpl::seenBlobs;
+
+class WrappersCountingPrimitiveFactory : public InferenceEngine::ILayerImplFactory {
+public:
+    WrappersCountingPrimitiveFactory(const InferenceEngine::CNNLayer *layer) {
+        cnnLayer = const_cast<InferenceEngine::CNNLayer *>(layer);
+    }
+    // set output shapes by input shapes.
+    InferenceEngine::StatusCode getShapes(const std::vector<InferenceEngine::TensorDesc>& inShapes, std::vector<InferenceEngine::TensorDesc>& outShapes, InferenceEngine::ResponseDesc *resp) noexcept override {
+        outShapes.push_back(inShapes[0]);
+        return InferenceEngine::OK;
+    }
+    // First implementation has more priority than next
+    InferenceEngine::StatusCode getImplementations(std::vector<InferenceEngine::ILayerImpl::Ptr>& impls, InferenceEngine::ResponseDesc *resp) noexcept override {
+        impls.push_back(InferenceEngine::ILayerImpl::Ptr(new WrappersCountingPrimitiveImpl(cnnLayer)));
+        return InferenceEngine::OK;
+    }
+
+private:
+    InferenceEngine::CNNLayer * cnnLayer;
+};
+
 class TwoDifferentOutputsImpl : public InferenceEngine::ILayerExecImpl {
 public:
     TwoDifferentOutputsImpl(const InferenceEngine::CNNLayer *layer) {
@@ -444,6 +481,7 @@ public:
     FakeExtensionFabric() {
         factories["CustomNewConvolution"] = [](const InferenceEngine::CNNLayer * cnnLayer) -> InferenceEngine::ILayerImplFactory* { return new FakeGenericPrimitiveFactory(); };
         factories["NewDoubleLayer"] = [](const InferenceEngine::CNNLayer * cnnLayer) -> InferenceEngine::ILayerImplFactory* { return new DoublePrimitiveFactory(cnnLayer); };
+        factories["WrappersCountingDoubleLayer"] = [](const InferenceEngine::CNNLayer * cnnLayer) -> InferenceEngine::ILayerImplFactory* { return new WrappersCountingPrimitiveFactory(cnnLayer); };
         factories["NewTwoDifferentOutputs"] = [](const InferenceEngine::CNNLayer * cnnLayer) -> InferenceEngine::ILayerImplFactory* { return new TwoDifferentOutputsFactory(cnnLayer); };
         factories["ConstPrim"] = [](const InferenceEngine::CNNLayer * cnnLayer) -> InferenceEngine::ILayerImplFactory* { return new ConstPrimitiveFactory(cnnLayer); };
         factories["CustomInPlaceConcat"] = [](const InferenceEngine::CNNLayer * cnnLayer) -> InferenceEngine::ILayerImplFactory* { return new CustomConcatFactory(cnnLayer); };
@@ -1275,6 +1313,112 @@ TEST_F(MKLDNNGraphGenericTests, ExecuteGenericPrimitiveWithDynamicBatch) {
     compare(*output, dst_ref2);
 }
 
+TEST_F(MKLDNNGraphGenericTests, ExecuteGenericPrimitiveDoesNotCreateBlobsPerInfer) {
+    std::string model = R"V0G0N(
+        <Net Name="DoubleLayer_Only" version="2" precision="FP32" batch="2">
+            <layers>
+                <layer name="in1" type="Input" precision="FP32" id="0">
+                    <output>
+                        <port id="0">
+                            <dim>2</dim>
+                            <dim>3</dim>
+                            <dim>5</dim>
+                            <dim>5</dim>
+                        </port>
+                    </output>
+                </layer>
+                <layer name="double_layer" id="1" type="WrappersCountingDoubleLayer" precision="FP32">
+                    <input>
+                        <port id="1">
+                            <dim>2</dim>
+                            <dim>3</dim>
+                            <dim>5</dim>
+                            <dim>5</dim>
+                        </port>
+                    </input>
+                    <output>
+                        <port id="2">
+                            <dim>2</dim>
+                            <dim>3</dim>
+                            <dim>5</dim>
+                            <dim>5</dim>
+                        </port>
+                    </output>
+                </layer>
+            </layers>
+            <edges>
+                <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+            </edges>
+        </Net>
+        )V0G0N";
+    MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+    extMgr->AddExtension(extension);
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    WrappersCountingPrimitiveImpl::seenBlobs.clear();
+
+    MKLDNNGraphTestClass graph;
+    graph.CreateGraph(net_reader.getNetwork(), extMgr);
+
+    InferenceEngine::SizeVector dims_src = {2, 3, 5, 5};
+
+    InferenceEngine::Blob::Ptr src =
+            InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, dims_src, InferenceEngine::NCHW});
+    src->allocate();
+    fill_data(src->buffer(), src->size());
+
+    auto* srcPtr = dynamic_cast<InferenceEngine::TBlob<float>*>(src.get());
+
+    if (srcPtr == nullptr)
+        FAIL() << "Cannot cast blob to TBlob<float>.";
+
+    InferenceEngine::BlobMap srcs;
+    srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("in1", src));
+
+    InferenceEngine::OutputsDataMap out;
+    out = net_reader.getNetwork().getOutputsInfo();
+    InferenceEngine::BlobMap outputBlobs;
+
+    std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+    InferenceEngine::TBlob<float>::Ptr output;
+    output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+    output->allocate();
+    outputBlobs[item.first] = output;
+
+    InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+    dst_ref.allocate();
+    ref_double(*srcPtr, dst_ref);
+
+    // the input and the output wrappers are created once
+    for (int i = 0; i < 3; i++) {
+        graph.Infer(srcs, outputBlobs);
+        compare(*output, dst_ref);
+        ASSERT_EQ(2, WrappersCountingPrimitiveImpl::seenBlobs.size());
+    }
+
+    graph.setProperty({{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "1"}});
+
+    InferenceEngine::TBlob<float> dst_ref2(item.second->getTensorDesc());
+    dst_ref2.allocate();
+    ref_double_batch1(*srcPtr, dst_ref2);
+
+    // the new batch size gets its own wrappers which are reused by the next inferences
+    for (int i = 0; i < 3; i++) {
+        float *dstData = output->data();
+        for (size_t j = 0; j < output->size(); j++) {
+            dstData[j] = 0;
+        }
+        graph.Infer(srcs, outputBlobs);
+        compare(*output, dst_ref2);
+        ASSERT_EQ(4, WrappersCountingPrimitiveImpl::seenBlobs.size());
+    }
+
+    WrappersCountingPrimitiveImpl::seenBlobs.clear();
+}
+
 TEST_F(MKLDNNGraphGenericTests, ExecuteNotInLineGRN) {
     std::string model = R"V0G0N(
 <net name="default" version="2" batch="1">
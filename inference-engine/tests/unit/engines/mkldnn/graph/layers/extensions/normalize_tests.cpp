@@ -0,0 +1,419 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include <mkldnn_plugin/mkldnn_extension_utils.h>
+#include <extension/ext_list.hpp>
+#include "tests_common.hpp"
+#include "ir_gen_helper.hpp"
+
+using namespace InferenceEngine;
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+using namespace single_layer_tests;
+
+
+struct normalize_test_params {
+    // Formats: NCHW
+    vector<size_t> dims;
+
+    int across_spatial;
+    int channel_shared;
+    float eps;
+
+    size_t num_prim_desc;
+    bool isBlockedFormat;
+};
+
+extern InferenceEngine::IExtensionPtr make_FakeExtensions();
+
+void ref_normalize(const TBlob<float> &src, const float *scl, TBlob<float> &dst, normalize_test_params prm) {
+    const float *src_data = src.readOnly();
+    float *dst_data = dst.data();
+
+    size_t N = prm.dims[0];
+    size_t C = prm.dims[1];
+    size_t HW = prm.dims[2] * prm.dims[3];
+
+    for (size_t n = 0; n < N; n++) {
+        const float *psrc = src_data + n * C * HW;
+        float *pdst = dst_data + n * C * HW;
+        if (prm.across_spatial) {
+            double norm = prm.eps;
+            for (size_t i = 0; i < C * HW; i++)
+                norm += psrc[i] * psrc[i];
+            norm = 1.0 / std::sqrt(norm);
+            for (size_t c = 0; c < C; c++) {
+                for (size_t i = 0; i < HW; i++)
+                    pdst[c * HW + i] = psrc[c * HW + i] * norm * (prm.channel_shared ? scl[0] : scl[c]);
+            }
+        } else {
+            for (size_t i = 0; i < HW; i++) {
+                double norm = prm.eps;
+                for (size_t c = 0; c < C; c++)
+                    norm += psrc[c * HW + i] * psrc[c * HW + i];
+                norm = 1.0 / std::sqrt(norm);
+                for (size_t c = 0; c < C; c++)
+                    pdst[c * HW + i] = psrc[c * HW + i] * norm * (prm.channel_shared ? scl[0] : scl[c]);
+            }
+        }
+    }
+}
+
+class MKLDNNCPUExtNormalizeTests: public TestsCommon, public WithParamInterface<normalize_test_params> {
+    std::string layers_t = R"V0G0N(
+        <layer name="fakeLayer" id="1" type="_FL_" precision="FP32">
+            <input>
+                <port id="1">
+                    __SRC_DIMS__
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    __SRC_DIMS__
+                </port>
+            </output>
+        </layer>
+        <layer name="normalize" id="2" type="Normalize" precision="FP32">
+            <data across_spatial="_AS_" channel_shared="_CS_" eps="_EPS_"/>
+            <input>
+                <port id="3">
+                    __SRC_DIMS__
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    __SRC_DIMS__
+                </port>
+            </output>
+            <blobs>
+                <weights offset="0" size="_WS_"/>
+            </blobs>
+        </layer>
+)V0G0N";
+
+    std::string edges_t = R"V0G0N(
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
+)V0G0N";
+
+    std::string getModel(normalize_test_params p) {
+        std::string model = layers_t;
+        if (p.isBlockedFormat)
+            REPLACE_WITH_STR(model, "_FL_", "FakeLayerBLK");
+        else
+            REPLACE_WITH_STR(model, "_FL_", "FakeLayerPLN");
+
+        std::string s_dims;
+        for (auto& dim : p.dims) {
+            s_dims += "\n                    <dim>";
+            s_dims += std::to_string(dim) + "</dim>";
+        }
+        REPLACE_WITH_STR(model, "__SRC_DIMS__", s_dims);
+
+        REPLACE_WITH_NUM(model, "_AS_", p.across_spatial);
+        REPLACE_WITH_NUM(model, "_CS_", p.channel_shared);
+        REPLACE_WITH_NUM(model, "_EPS_", p.eps);
+        REPLACE_WITH_NUM(model, "_WS_", (p.channel_shared ? 1 : p.dims[1]) * sizeof(float));
+
+        model = IRTemplateGenerator::getIRTemplate("Normalize_Only", p.dims, "FP32", model, edges_t);
+
+        return model;
+    }
+
+protected:
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            normalize_test_params p = ::testing::WithParamInterface<normalize_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            size_t scl_size = p.channel_shared ? 1 : p.dims[1];
+            TBlob<uint8_t> *weights = new TBlob<uint8_t>({ Precision::U8, { scl_size * sizeof(float) }, C });
+            weights->allocate();
+            // non zero scales, the shared one is the first
+            float *scl = weights->buffer().as<float *>();
+            for (size_t i = 0; i < scl_size; i++)
+                scl[i] = 0.5f + 0.1f * i;
+            TBlob<uint8_t>::Ptr weights_ptr = TBlob<uint8_t>::Ptr(weights);
+            net_reader.SetWeights(weights_ptr);
+
+            InferenceEngine::Extension cpuExt(make_so_name("cpu_extension"));
+            MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+            extMgr->AddExtension(InferenceEngine::IExtensionPtr(&cpuExt, [](InferenceEngine::IExtension*){}));
+            extMgr->AddExtension(make_FakeExtensions());
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork(), extMgr);
+
+            auto& nodes = graph.getNodes();
+            for (auto &node : nodes) {
+                if (node->getName() == "normalize") {
+                    ASSERT_EQ(p.num_prim_desc, node->getSupportedPrimitiveDescriptors().size());
+                    ASSERT_NE(nullptr, node->getSelectedPrimitiveDescriptor());
+                    // Normalize takes the layout of the previous layer as is. Both layers work in place,
+                    // so the only node allowed between them is a copy that keeps the layout
+                    auto parent = node->getParentEdgeAt(0)->getParent();
+                    if (parent->getType() == MKLDNNPlugin::Reorder)
+                        ASSERT_TRUE(parent->getParentEdgeAt(0)->getDesc() == parent->getChildEdgeAt(0)->getDesc());
+                    else
+                        ASSERT_EQ("fakeLayer", parent->getName());
+                }
+            }
+            if (p.isBlockedFormat) {
+                // the reorders from the input and to the output, and the copy between the in-place layers
+                ASSERT_EQ(7, nodes.size());
+                ASSERT_EQ(3, graph.GetReordersCount());
+            }
+
+            Blob::Ptr src = make_shared_blob<float>({ Precision::FP32, p.dims, NCHW });
+            src->allocate();
+            fill_data(src->buffer(), src->size());
+
+            auto * srcPtr = dynamic_cast<TBlob<float>*>(src.get());
+
+            if (srcPtr == nullptr)
+                FAIL() << "Cannot cast blob to TBlob<float>.";
+
+            BlobMap srcs;
+            srcs.insert(std::pair<std::string, Blob::Ptr>("in1", src));
+
+            OutputsDataMap out;
+            out = net_reader.getNetwork().getOutputsInfo();
+            BlobMap outputBlobs;
+
+            std::pair<std::string, DataPtr> item = *out.begin();
+
+            TBlob<float>::Ptr output;
+            output = make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            graph.Infer(srcs, outputBlobs);
+
+            TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+            ref_normalize(*srcPtr, weights_ptr->buffer().as<const float *>(), dst_ref, p);
+            compare(*output, dst_ref, 0.0001f);
+        } catch (const details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNCPUExtNormalizeTests, TestsNormalize) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsNormalize, MKLDNNCPUExtNormalizeTests,
+        ::testing::Values(
+                normalize_test_params{{2, 64, 15, 15}, 0, 0, 1e-5f, 2, false },
+                normalize_test_params{{2, 64, 15, 15}, 1, 0, 1e-5f, 2, false },
+                normalize_test_params{{2,  3, 33, 65}, 0, 1, 1e-5f, 2, false },
+                normalize_test_params{{2, 64, 15, 15}, 0, 0, 1e-5f, 2, true },
+                normalize_test_params{{2, 64, 15, 15}, 1, 0, 1e-5f, 2, true },
+                normalize_test_params{{2, 64, 15, 15}, 0, 1, 1e-5f, 2, true },
+                normalize_test_params{{1, 19, 38, 38}, 0, 0, 1e-5f, 2, true },
+                normalize_test_params{{2,  3, 33, 65}, 1, 1, 1e-5f, 2, true }
+            ));
+
+struct normalize_int8_test_params {
+    // Formats: NCHW or NC, the network takes 4D data as NHWC
+    vector<size_t> dims;
+    Precision precision;
+
+    int across_spatial;
+    int channel_shared;
+    float eps;
+};
+
+template <typename data_t>
+void ref_normalize_int8(const TBlob<data_t> &src, const float *scl, TBlob<float> &dst, normalize_int8_test_params prm) {
+    const data_t *src_data = src.readOnly();
+    float *dst_data = dst.data();
+
+    size_t N = prm.dims[0];
+    size_t C = prm.dims[1];
+    size_t HW = prm.dims.size() == 4 ? prm.dims[2] * prm.dims[3] : 1;
+
+    for (size_t n = 0; n < N; n++) {
+        const data_t *psrc = src_data + n * C * HW;
+        float *pdst = dst_data + n * C * HW;
+        if (prm.across_spatial) {
+            double norm = prm.eps;
+            for (size_t i = 0; i < C * HW; i++)
+                norm += static_cast<double>(psrc[i]) * psrc[i];
+            norm = 1.0 / std::sqrt(norm);
+            for (size_t c = 0; c < C; c++) {
+                for (size_t i = 0; i < HW; i++)
+                    pdst[c * HW + i] = psrc[c * HW + i] * norm * (prm.channel_shared ? scl[0] : scl[c]);
+            }
+        } else {
+            for (size_t i = 0; i < HW; i++) {
+                double norm = prm.eps;
+                for (size_t c = 0; c < C; c++)
+                    norm += static_cast<double>(psrc[c * HW + i]) * psrc[c * HW + i];
+                norm = 1.0 / std::sqrt(norm);
+                for (size_t c = 0; c < C; c++)
+                    pdst[c * HW + i] = psrc[c * HW + i] * norm * (prm.channel_shared ? scl[0] : scl[c]);
+            }
+        }
+    }
+}
+
+class MKLDNNCPUExtNormalizeInt8Tests: public TestsCommon, public WithParamInterface<normalize_int8_test_params> {
+    std::string layers_t = R"V0G0N(
+        <layer name="normalize" id="1" type="Normalize" precision="FP32">
+            <data across_spatial="_AS_" channel_shared="_CS_" eps="_EPS_"/>
+            <input>
+                <port id="1">
+                    __SRC_DIMS__
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    __SRC_DIMS__
+                </port>
+            </output>
+            <blobs>
+                <weights offset="0" size="_WS_"/>
+            </blobs>
+        </layer>
+)V0G0N";
+
+    std::string edges_t = R"V0G0N(
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+)V0G0N";
+
+    std::string getModel(normalize_int8_test_params p) {
+        std::string model = layers_t;
+
+        std::string s_dims;
+        for (auto& dim : p.dims) {
+            s_dims += "\n                    <dim>";
+            s_dims += std::to_string(dim) + "</dim>";
+        }
+        REPLACE_WITH_STR(model, "__SRC_DIMS__", s_dims);
+
+        REPLACE_WITH_NUM(model, "_AS_", p.across_spatial);
+        REPLACE_WITH_NUM(model, "_CS_", p.channel_shared);
+        REPLACE_WITH_NUM(model, "_EPS_", p.eps);
+        REPLACE_WITH_NUM(model, "_WS_", (p.channel_shared ? 1 : p.dims[1]) * sizeof(float));
+
+        model = IRTemplateGenerator::getIRTemplate("Normalize_Int8", p.dims, "FP32", model, edges_t);
+
+        return model;
+    }
+
+    template <typename data_t>
+    void runTest(const normalize_int8_test_params &p, const TBlob<uint8_t>::Ptr &weights,
+                 MKLDNNGraphTestClass &graph, const DataPtr &output_data) {
+        // the plain data is reordered to the input memory of the graph
+        typename TBlob<data_t>::Ptr src = make_shared_blob<data_t>({ p.precision, p.dims, TensorDesc::getLayoutByDims(p.dims) });
+        src->allocate();
+        data_t *src_data = src->data();
+        for (size_t i = 0; i < src->size(); i++)
+            src_data[i] = static_cast<data_t>(p.precision == Precision::U8 ? (i * 7) % 251 : (i * 7) % 251 - 125);
+
+        BlobMap srcs;
+        srcs.insert(std::pair<std::string, Blob::Ptr>("in1", src));
+
+        TBlob<float>::Ptr output = make_shared_blob<float>(output_data->getTensorDesc());
+        output->allocate();
+        BlobMap outputBlobs;
+        outputBlobs[output_data->getName()] = output;
+
+        graph.Infer(srcs, outputBlobs);
+
+        TBlob<float> dst_ref(output_data->getTensorDesc());
+        dst_ref.allocate();
+        ref_normalize_int8(*src, weights->buffer().as<const float *>(), dst_ref, p);
+        compare(*output, dst_ref, 0.0001f);
+    }
+
+protected:
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            normalize_int8_test_params p = ::testing::WithParamInterface<normalize_int8_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            size_t scl_size = p.channel_shared ? 1 : p.dims[1];
+            TBlob<uint8_t> *weights = new TBlob<uint8_t>({ Precision::U8, { scl_size * sizeof(float) }, C });
+            weights->allocate();
+            // non zero scales, the shared one is the first
+            float *scl = weights->buffer().as<float *>();
+            for (size_t i = 0; i < scl_size; i++)
+                scl[i] = 0.5f + 0.1f * i;
+            TBlob<uint8_t>::Ptr weights_ptr = TBlob<uint8_t>::Ptr(weights);
+            net_reader.SetWeights(weights_ptr);
+
+            CNNNetwork network = net_reader.getNetwork();
+            network.getInputsInfo().begin()->second->setPrecision(p.precision);
+            network.getInputsInfo().begin()->second->setLayout(p.dims.size() == 4 ? NHWC : NC);
+
+            InferenceEngine::Extension cpuExt(make_so_name("cpu_extension"));
+            MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+            extMgr->AddExtension(InferenceEngine::IExtensionPtr(&cpuExt, [](InferenceEngine::IExtension*){}));
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(network, extMgr);
+
+            auto& nodes = graph.getNodes();
+            for (auto &node : nodes) {
+                if (node->getName() == "normalize") {
+                    ASSERT_EQ(1, node->getSupportedPrimitiveDescriptors().size());
+                    ASSERT_NE(nullptr, node->getSelectedPrimitiveDescriptor());
+                    ASSERT_EQ(p.dims.size() == 4 ? NHWC : NC,
+                              node->getSelectedPrimitiveDescriptor()->getConfig().inConfs[0].desc.getLayout());
+                }
+            }
+            // Normalize reads the int8 input as is and writes the plain FP32 output
+            ASSERT_EQ(3, nodes.size());
+            ASSERT_EQ(0, graph.GetReordersCount());
+
+            OutputsDataMap out = network.getOutputsInfo();
+            if (p.precision == Precision::U8)
+                runTest<uint8_t>(p, weights_ptr, graph, out.begin()->second);
+            else
+                runTest<int8_t>(p, weights_ptr, graph, out.begin()->second);
+        } catch (const details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNCPUExtNormalizeInt8Tests, TestsNormalize) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsNormalize, MKLDNNCPUExtNormalizeInt8Tests,
+        ::testing::Values(
+                normalize_int8_test_params{{2, 64, 15, 15}, Precision::U8, 0, 0, 1e-5f },
+                normalize_int8_test_params{{2, 64, 15, 15}, Precision::U8, 1, 0, 1e-5f },
+                normalize_int8_test_params{{1, 19, 38, 38}, Precision::U8, 0, 1, 1e-5f },
+                normalize_int8_test_params{{2, 64, 15, 15}, Precision::I8, 0, 0, 1e-5f },
+                normalize_int8_test_params{{2,  3, 33, 65}, Precision::I8, 1, 1, 1e-5f },
+                normalize_int8_test_params{{4, 100}, Precision::U8, 0, 0, 1e-5f },
+                normalize_int8_test_params{{4, 100}, Precision::U8, 1, 1, 1e-5f },
+                normalize_int8_test_params{{4, 100}, Precision::I8, 0, 0, 1e-5f },
+                normalize_int8_test_params{{3, 37}, Precision::I8, 1, 0, 1e-5f }
+            ));
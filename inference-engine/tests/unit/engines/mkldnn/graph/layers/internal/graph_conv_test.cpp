@@ -521,3 +521,102 @@ INSTANTIATE_TEST_CASE_P(
 #endif
                 conv_test_params{{1, 9, 32, 16},
                                  {2, 4}, {1, 1}, {0, 0}, {0, 0}, 17, 1, "", 5, MKLDNNPlugin::impl_desc_type::ref_any, {MKLDNNPlugin::impl_desc_type::ref_any} }));
+
+class MKLDNNGraphBF16ConvolutionTests: public MKLDNNGraphConvolutionTests {
+protected:
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            Xbyak::util::Cpu cpu;
+            if (!cpu.has(Xbyak::util::Cpu::tAVX512F) || !cpu.has(Xbyak::util::Cpu::tAVX512BW) ||
+                    !cpu.has(Xbyak::util::Cpu::tAVX512VL) || !cpu.has(Xbyak::util::Cpu::tAVX512DQ))
+                GTEST_SKIP();
+
+            conv_test_params p = ::testing::WithParamInterface<conv_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            size_t blob_size = p.out_c * p.dims[1] / p.grp_c;
+            for (auto k : p.kernel) {
+                blob_size *= k;
+            }
+            blob_size = (blob_size + p.out_c) * sizeof(float);
+            TBlob<uint8_t> *weights = new TBlob<uint8_t>({ Precision::U8, {blob_size}, C });
+            weights->allocate();
+            fill_data((float *) weights->buffer(), weights->size() / sizeof(float));
+            TBlob<uint8_t>::Ptr weights_ptr = TBlob<uint8_t>::Ptr(weights);
+
+            net_reader.SetWeights(weights_ptr);
+            CNNNetwork network = net_reader.getNetwork();
+
+            MKLDNNGraphTestClass graph;
+            graph.setProperty({{PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::YES}});
+            graph.CreateGraph(network);
+
+            // the convolution reads bfloat16 and writes FP32, the input is converted by a reorder
+            size_t reorders = 0;
+            for (auto &node : graph.getNodes()) {
+                if (node->getType() == MKLDNNPlugin::Reorder) {
+                    reorders++;
+                } else if (node->getType() == MKLDNNPlugin::Convolution) {
+                    ASSERT_NE(nullptr, node->getSelectedPrimitiveDescriptor());
+                    auto config = node->getSelectedPrimitiveDescriptor()->getConfig();
+                    ASSERT_EQ(Precision::BF16, config.inConfs[0].desc.getPrecision());
+                    ASSERT_EQ(Precision::FP32, config.outConfs[0].desc.getPrecision());
+                    ASSERT_EQ(p.selectedType,
+                              node->getSelectedPrimitiveDescriptor()->getImplementationType() & p.selectedType);
+                }
+            }
+            ASSERT_LE(1, reorders);
+
+            Blob::Ptr src = make_shared_blob<float>({ Precision::FP32, p.dims, NCHW });
+            src->allocate();
+            fill_data(src->buffer(), src->size());
+
+            auto * srcPtr = dynamic_cast<TBlob<float>*>(src.get());
+
+            if (srcPtr == nullptr)
+                FAIL() << "Cannot cast blob to TBlob<float>.";
+
+            BlobMap srcs;
+            srcs.insert(std::pair<std::string, Blob::Ptr>("in1", src));
+
+            OutputsDataMap out;
+            out = network.getOutputsInfo();
+            BlobMap outputBlobs;
+
+            std::pair<std::string, DataPtr> item = *out.begin();
+
+            TBlob<float>::Ptr output;
+            output = make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            graph.Infer(srcs, outputBlobs);
+
+            TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+            ref_conv(*srcPtr, (const float *)weights->buffer(), weights->size() / sizeof(float), dst_ref, p);
+            // bfloat16 keeps 8 bits of mantissa
+            compare_NRMSD(*output, dst_ref, 0.01f);
+        } catch (const details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNGraphBF16ConvolutionTests, TestsBF16Convolution) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestBF16Convolution, MKLDNNGraphBF16ConvolutionTests,
+        ::testing::Values(
+                conv_test_params{{1, 16, 16, 32},
+                                 {1, 1}, {1, 1}, {0, 0}, {0, 0}, 32, 1, "", 1, MKLDNNPlugin::impl_desc_type::jit | MKLDNNPlugin::impl_desc_type::_1x1 },
+                conv_test_params{{1, 32, 20, 20},
+                                 {3, 3}, {1, 1}, {1, 1}, {1, 1}, 48, 1, "", 1, MKLDNNPlugin::impl_desc_type::jit },
+                conv_test_params{{1, 9, 32, 16},
+                                 {2, 4}, {2, 1}, {0, 0}, {0, 0}, 17, 1, "", 1, MKLDNNPlugin::impl_desc_type::jit | MKLDNNPlugin::impl_desc_type::gemm },
+                conv_test_params{{1, 3, 40, 40},
+                                 {3, 3}, {1, 2}, {0, 0}, {0, 0}, 20, 1, "", 1, MKLDNNPlugin::impl_desc_type::jit | MKLDNNPlugin::impl_desc_type::gemm }));
@@ -11,6 +11,7 @@
 #include "single_layer_common.hpp"
 #include <mkldnn_plugin/mkldnn_extension_utils.h>
 #include <inference_engine/cnn_network_impl.hpp>
+#include <cpu_detector.hpp>
 #include "tests_common.hpp"
 
 using namespace ::testing;
@@ -40,6 +41,21 @@ struct eltwise_test_params {
     std::vector<std::function<void(MKLDNNPlugin::PrimitiveDescInfo)>> comp;
 };
 
+// The JIT kernel is generated for the best ISA of the machine, test params use impl_desc_type::jit for it
+MKLDNNPlugin::impl_desc_type eltwise_jit_impl_type() {
+    if (InferenceEngine::with_cpu_x86_avx512f())
+        return MKLDNNPlugin::impl_desc_type::jit_avx512;
+    if (InferenceEngine::with_cpu_x86_avx2())
+        return MKLDNNPlugin::impl_desc_type::jit_avx2;
+    if (InferenceEngine::with_cpu_x86_sse42())
+        return MKLDNNPlugin::impl_desc_type::jit_sse42;
+    return MKLDNNPlugin::impl_desc_type::ref;
+}
+
+MKLDNNPlugin::impl_desc_type eltwise_expected_impl_type(MKLDNNPlugin::impl_desc_type type) {
+    return type == MKLDNNPlugin::impl_desc_type::jit ? eltwise_jit_impl_type() : type;
+}
+
 template<typename data_t>
 void ref_eltwise(const std::vector<InferenceEngine::TBlob<data_t>> &src, InferenceEngine::TBlob<data_t> &dst, eltwise_test_params prm) {
     std::vector<float> scales;
@@ -375,7 +391,7 @@ protected:
                         p.comp.at(j)(nodes[i]->getSupportedPrimitiveDescriptors().at(j));
                     }
                     ASSERT_NE(nullptr, nodes[i]->getSelectedPrimitiveDescriptor());
-                    ASSERT_EQ(p.selectedType, nodes[i]->getSelectedPrimitiveDescriptor()->getImplementationType());
+                    ASSERT_EQ(eltwise_expected_impl_type(p.selectedType), nodes[i]->getSelectedPrimitiveDescriptor()->getImplementationType());
                 }
             }
             InferenceEngine::SizeVector dims_src1 = p.dims1;
@@ -504,9 +520,9 @@ INSTANTIATE_TEST_CASE_P(
                             ASSERT_EQ(InferenceEngine::Layout::NCHW, impl.getConfig().outConfs.at(0).desc.getLayout());
                         }
                 } },
-                eltwise_test_params{{1, 3, 3, 3},{1, 3, 3, 3},{1, 3, 3, 3}, eltwise_test_params::opType::Prod, "", 3, MKLDNNPlugin::impl_desc_type::ref, {
+                eltwise_test_params{{1, 3, 3, 3},{1, 3, 3, 3},{1, 3, 3, 3}, eltwise_test_params::opType::Prod, "", 3, MKLDNNPlugin::impl_desc_type::jit, {
                         [](MKLDNNPlugin::PrimitiveDescInfo impl) {
-                            ASSERT_EQ(MKLDNNPlugin::impl_desc_type::ref, impl.getImplementationType());
+                            ASSERT_EQ(eltwise_jit_impl_type(), impl.getImplementationType());
                             ASSERT_EQ(3, impl.getConfig().inConfs.size());
                             ASSERT_EQ(1, impl.getConfig().outConfs.size());
                             ASSERT_EQ(InferenceEngine::Layout::NCHW, impl.getConfig().inConfs.at(0).desc.getLayout());
@@ -515,9 +531,9 @@ INSTANTIATE_TEST_CASE_P(
                             ASSERT_EQ(InferenceEngine::Layout::NCHW, impl.getConfig().outConfs.at(0).desc.getLayout());
                         }
                 } },
-                eltwise_test_params{{1, 3, 3, 3},{1, 3, 3, 3},{1, 3, 3, 3}, eltwise_test_params::opType::Max, "", 3, MKLDNNPlugin::impl_desc_type::ref, {
+                eltwise_test_params{{1, 3, 3, 3},{1, 3, 3, 3},{1, 3, 3, 3}, eltwise_test_params::opType::Max, "", 3, MKLDNNPlugin::impl_desc_type::jit, {
                         [](MKLDNNPlugin::PrimitiveDescInfo impl) {
-                            ASSERT_EQ(MKLDNNPlugin::impl_desc_type::ref, impl.getImplementationType());
+                            ASSERT_EQ(eltwise_jit_impl_type(), impl.getImplementationType());
                             ASSERT_EQ(3, impl.getConfig().inConfs.size());
                             ASSERT_EQ(1, impl.getConfig().outConfs.size());
                             ASSERT_EQ(InferenceEngine::Layout::NCHW, impl.getConfig().inConfs.at(0).desc.getLayout());
@@ -537,12 +553,12 @@ INSTANTIATE_TEST_CASE_P(
                             ASSERT_EQ(InferenceEngine::Layout::NCDHW, impl.getConfig().outConfs.at(0).desc.getLayout());
                         }
                 } },
-                eltwise_test_params{{1, 3, 3, 3},{1, 3, 3, 3},{1, 3, 3, 3}, eltwise_test_params::opType::Min, "", 3, MKLDNNPlugin::impl_desc_type::ref},
-                eltwise_test_params{{1, 3, 3, 3},{1, 3, 3, 3},{1, 3, 3, 3}, eltwise_test_params::opType::Sub, "", 3, MKLDNNPlugin::impl_desc_type::ref},
-                eltwise_test_params{{1, 3, 3, 3},{1, 3, 3, 3},{1, 3, 3, 3}, eltwise_test_params::opType::Div, "", 3, MKLDNNPlugin::impl_desc_type::ref},
-                eltwise_test_params{{1, 3, 3, 3},{1, 3, 3, 3},{1, 3, 3, 3}, eltwise_test_params::opType::Logical_AND, "", 3, MKLDNNPlugin::impl_desc_type::ref},
-                eltwise_test_params{{1, 3, 3, 3},{1, 3, 3, 3},{1, 3, 3, 3}, eltwise_test_params::opType::Logical_OR, "", 3, MKLDNNPlugin::impl_desc_type::ref},
-                eltwise_test_params{{1, 3, 3, 3},{1, 3, 3, 3},{1, 3, 3, 3}, eltwise_test_params::opType::Logical_XOR, "", 3, MKLDNNPlugin::impl_desc_type::ref}
+                eltwise_test_params{{1, 3, 3, 3},{1, 3, 3, 3},{1, 3, 3, 3}, eltwise_test_params::opType::Min, "", 3, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_test_params{{1, 3, 3, 3},{1, 3, 3, 3},{1, 3, 3, 3}, eltwise_test_params::opType::Sub, "", 3, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_test_params{{1, 3, 3, 3},{1, 3, 3, 3},{1, 3, 3, 3}, eltwise_test_params::opType::Div, "", 3, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_test_params{{1, 3, 3, 3},{1, 3, 3, 3},{1, 3, 3, 3}, eltwise_test_params::opType::Logical_AND, "", 3, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_test_params{{1, 3, 3, 3},{1, 3, 3, 3},{1, 3, 3, 3}, eltwise_test_params::opType::Logical_OR, "", 3, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_test_params{{1, 3, 3, 3},{1, 3, 3, 3},{1, 3, 3, 3}, eltwise_test_params::opType::Logical_XOR, "", 3, MKLDNNPlugin::impl_desc_type::jit}
         ));
         
 class MKLDNNGraphEltwise2InputsTests: public TestsCommon,
@@ -648,7 +664,7 @@ protected:
                         p.comp.at(j)(nodes[i]->getSupportedPrimitiveDescriptors().at(j));
                     }
                     ASSERT_NE(nullptr, nodes[i]->getSelectedPrimitiveDescriptor());
-                    ASSERT_EQ(p.selectedType, nodes[i]->getSelectedPrimitiveDescriptor()->getImplementationType());
+                    ASSERT_EQ(eltwise_expected_impl_type(p.selectedType), nodes[i]->getSelectedPrimitiveDescriptor()->getImplementationType());
                 }
             }
             InferenceEngine::SizeVector dims_src1 = p.dims1;
@@ -729,61 +745,61 @@ INSTANTIATE_TEST_CASE_P(
         TestsEltwise, MKLDNNGraphEltwise2InputsTests,
         ::testing::Values(
                 eltwise_test_params{{1, 3, 3, 3},{1, 3, 3, 3},{}, eltwise_test_params::opType::Sum, "", 3, MKLDNNPlugin::impl_desc_type::ref},
-                eltwise_test_params{{1, 3, 3, 3},{1, 3, 3, 3},{}, eltwise_test_params::opType::Prod, "", 3, MKLDNNPlugin::impl_desc_type::ref},
-                eltwise_test_params{{1, 3, 3, 3},{1, 3, 3, 3},{}, eltwise_test_params::opType::Max, "", 3, MKLDNNPlugin::impl_desc_type::ref},
-                eltwise_test_params{{1, 3, 3, 3},{1, 3, 3, 3},{}, eltwise_test_params::opType::Min, "", 3, MKLDNNPlugin::impl_desc_type::ref},
-                eltwise_test_params{{1, 3, 3, 3},{1, 3, 3, 3},{}, eltwise_test_params::opType::Sub, "", 3, MKLDNNPlugin::impl_desc_type::ref},
-                eltwise_test_params{{1, 3, 3, 3},{1, 3, 3, 3},{}, eltwise_test_params::opType::Div, "", 3, MKLDNNPlugin::impl_desc_type::ref},
-                eltwise_test_params{{1, 3, 3, 3},{1, 3, 3, 3},{}, eltwise_test_params::opType::Squared_diff, "", 3, MKLDNNPlugin::impl_desc_type::ref},
-                eltwise_test_params{{1, 3, 3, 3},{1, 3, 3, 3},{}, eltwise_test_params::opType::Logical_AND, "", 3, MKLDNNPlugin::impl_desc_type::ref},
-                eltwise_test_params{{1, 3, 3, 3},{1, 3, 3, 3},{}, eltwise_test_params::opType::Logical_OR, "", 3, MKLDNNPlugin::impl_desc_type::ref},
-                eltwise_test_params{{1, 3, 3, 3},{1, 3, 3, 3},{}, eltwise_test_params::opType::Logical_XOR, "", 3, MKLDNNPlugin::impl_desc_type::ref}
+                eltwise_test_params{{1, 3, 3, 3},{1, 3, 3, 3},{}, eltwise_test_params::opType::Prod, "", 3, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_test_params{{1, 3, 3, 3},{1, 3, 3, 3},{}, eltwise_test_params::opType::Max, "", 3, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_test_params{{1, 3, 3, 3},{1, 3, 3, 3},{}, eltwise_test_params::opType::Min, "", 3, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_test_params{{1, 3, 3, 3},{1, 3, 3, 3},{}, eltwise_test_params::opType::Sub, "", 3, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_test_params{{1, 3, 3, 3},{1, 3, 3, 3},{}, eltwise_test_params::opType::Div, "", 3, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_test_params{{1, 3, 3, 3},{1, 3, 3, 3},{}, eltwise_test_params::opType::Squared_diff, "", 3, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_test_params{{1, 3, 3, 3},{1, 3, 3, 3},{}, eltwise_test_params::opType::Logical_AND, "", 3, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_test_params{{1, 3, 3, 3},{1, 3, 3, 3},{}, eltwise_test_params::opType::Logical_OR, "", 3, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_test_params{{1, 3, 3, 3},{1, 3, 3, 3},{}, eltwise_test_params::opType::Logical_XOR, "", 3, MKLDNNPlugin::impl_desc_type::jit}
         ));
 
 INSTANTIATE_TEST_CASE_P(
         TestsBroadcasting, MKLDNNGraphEltwise2InputsTests,
         ::testing::Values(
-                eltwise_test_params{{1, 3, 1, 3},{1, 1, 3, 3},{}, eltwise_test_params::opType::Sum, "", 1, MKLDNNPlugin::impl_desc_type::ref},
-                eltwise_test_params{{1, 3, 1, 3},{1, 1, 3, 3},{}, eltwise_test_params::opType::Prod, "", 1, MKLDNNPlugin::impl_desc_type::ref},
-                eltwise_test_params{{1, 3, 1, 3},{1, 1, 3, 3},{}, eltwise_test_params::opType::Max, "", 1, MKLDNNPlugin::impl_desc_type::ref},
-                eltwise_test_params{{1, 3, 1, 3},{1, 1, 3, 3},{}, eltwise_test_params::opType::Min, "", 1, MKLDNNPlugin::impl_desc_type::ref},
-                eltwise_test_params{{1, 3, 1, 3},{1, 1, 3, 3},{}, eltwise_test_params::opType::Sub, "", 1, MKLDNNPlugin::impl_desc_type::ref},
-                eltwise_test_params{{1, 3, 1, 3},{1, 1, 3, 3},{}, eltwise_test_params::opType::Div, "", 1, MKLDNNPlugin::impl_desc_type::ref},
-                eltwise_test_params{{1, 3, 1, 3},{1, 1, 3, 3},{}, eltwise_test_params::opType::Squared_diff, "", 1, MKLDNNPlugin::impl_desc_type::ref},
-                eltwise_test_params{{1, 3, 1, 3},{1, 1, 3, 3},{}, eltwise_test_params::opType::Logical_AND, "", 1, MKLDNNPlugin::impl_desc_type::ref},
-                eltwise_test_params{{1, 3, 1, 3},{1, 1, 3, 3},{}, eltwise_test_params::opType::Logical_OR, "", 1, MKLDNNPlugin::impl_desc_type::ref},
-                eltwise_test_params{{1, 3, 1, 3},{1, 1, 3, 3},{}, eltwise_test_params::opType::Logical_XOR, "", 1, MKLDNNPlugin::impl_desc_type::ref},
+                eltwise_test_params{{1, 3, 1, 3},{1, 1, 3, 3},{}, eltwise_test_params::opType::Sum, "", 1, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_test_params{{1, 3, 1, 3},{1, 1, 3, 3},{}, eltwise_test_params::opType::Prod, "", 1, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_test_params{{1, 3, 1, 3},{1, 1, 3, 3},{}, eltwise_test_params::opType::Max, "", 1, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_test_params{{1, 3, 1, 3},{1, 1, 3, 3},{}, eltwise_test_params::opType::Min, "", 1, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_test_params{{1, 3, 1, 3},{1, 1, 3, 3},{}, eltwise_test_params::opType::Sub, "", 1, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_test_params{{1, 3, 1, 3},{1, 1, 3, 3},{}, eltwise_test_params::opType::Div, "", 1, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_test_params{{1, 3, 1, 3},{1, 1, 3, 3},{}, eltwise_test_params::opType::Squared_diff, "", 1, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_test_params{{1, 3, 1, 3},{1, 1, 3, 3},{}, eltwise_test_params::opType::Logical_AND, "", 1, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_test_params{{1, 3, 1, 3},{1, 1, 3, 3},{}, eltwise_test_params::opType::Logical_OR, "", 1, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_test_params{{1, 3, 1, 3},{1, 1, 3, 3},{}, eltwise_test_params::opType::Logical_XOR, "", 1, MKLDNNPlugin::impl_desc_type::jit},
                 //  batch broadcasting
-                eltwise_test_params{{1, 3, 224},{224, 3, 1},{}, eltwise_test_params::opType::Sum, "", 2, MKLDNNPlugin::impl_desc_type::ref},
-                eltwise_test_params{{2, 3, 1, 2},{1, 3, 2, 1},{}, eltwise_test_params::opType::Sub, "", 1, MKLDNNPlugin::impl_desc_type::ref}
+                eltwise_test_params{{1, 3, 224},{224, 3, 1},{}, eltwise_test_params::opType::Sum, "", 2, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_test_params{{2, 3, 1, 2},{1, 3, 2, 1},{}, eltwise_test_params::opType::Sub, "", 3, MKLDNNPlugin::impl_desc_type::jit}
 
         ));
 
 INSTANTIATE_TEST_CASE_P(
         TestsDiffDims, MKLDNNGraphEltwise2InputsTests,
         ::testing::Values(
-                eltwise_test_params{{1},{1, 3},{}, eltwise_test_params::opType::Sum, "", 1, MKLDNNPlugin::impl_desc_type::ref},
-                eltwise_test_params{{1, 3},{1},{}, eltwise_test_params::opType::Sum, "", 1, MKLDNNPlugin::impl_desc_type::ref},
-                eltwise_test_params{{1, 3},{3},{}, eltwise_test_params::opType::Sum, "", 1, MKLDNNPlugin::impl_desc_type::ref},
-                eltwise_test_params{{1},{1, 3, 3},{}, eltwise_test_params::opType::Sum, "", 2, MKLDNNPlugin::impl_desc_type::ref},
-                eltwise_test_params{{1, 3, 3},{1},{}, eltwise_test_params::opType::Sum, "", 2, MKLDNNPlugin::impl_desc_type::ref},
-                eltwise_test_params{{1, 3, 3},{3},{}, eltwise_test_params::opType::Sum, "", 2, MKLDNNPlugin::impl_desc_type::ref},
-                eltwise_test_params{{1, 3},{1, 3, 3},{}, eltwise_test_params::opType::Sum, "", 2, MKLDNNPlugin::impl_desc_type::ref},
-                eltwise_test_params{{1, 3, 3},{1, 3},{}, eltwise_test_params::opType::Sum, "", 2, MKLDNNPlugin::impl_desc_type::ref},
-                eltwise_test_params{{1},{1, 3, 3, 3},{}, eltwise_test_params::opType::Sum, "", 1, MKLDNNPlugin::impl_desc_type::ref},
-                eltwise_test_params{{1, 3, 3, 3},{1},{}, eltwise_test_params::opType::Sum, "", 1, MKLDNNPlugin::impl_desc_type::ref},
-                eltwise_test_params{{1, 3},{1, 3, 3, 3},{}, eltwise_test_params::opType::Sum, "", 1, MKLDNNPlugin::impl_desc_type::ref},
-                eltwise_test_params{{1, 3, 3, 3},{1, 3},{}, eltwise_test_params::opType::Sum, "", 1, MKLDNNPlugin::impl_desc_type::ref},
-                eltwise_test_params{{1, 3, 3},{1, 3, 3, 3},{}, eltwise_test_params::opType::Sum, "", 1, MKLDNNPlugin::impl_desc_type::ref},
-                eltwise_test_params{{1, 3, 3, 3},{1, 3, 3},{}, eltwise_test_params::opType::Sum, "", 1, MKLDNNPlugin::impl_desc_type::ref},
-                eltwise_test_params{{1},{1, 3, 3, 3, 3},{}, eltwise_test_params::opType::Sum, "", 1, MKLDNNPlugin::impl_desc_type::ref},
-                eltwise_test_params{{1, 3, 3, 3, 3},{1},{}, eltwise_test_params::opType::Sum, "", 1, MKLDNNPlugin::impl_desc_type::ref},
-                eltwise_test_params{{1, 3},{1, 3, 3, 3, 3},{}, eltwise_test_params::opType::Sum, "", 1, MKLDNNPlugin::impl_desc_type::ref},
-                eltwise_test_params{{1, 3, 3, 3, 3},{1, 3},{}, eltwise_test_params::opType::Sum, "", 1, MKLDNNPlugin::impl_desc_type::ref},
-                eltwise_test_params{{1, 3, 3},{1, 3, 3, 3, 3},{}, eltwise_test_params::opType::Sum, "", 1, MKLDNNPlugin::impl_desc_type::ref},
-                eltwise_test_params{{1, 3, 3, 3, 3},{1, 3, 3},{}, eltwise_test_params::opType::Sum, "", 1, MKLDNNPlugin::impl_desc_type::ref},
-                eltwise_test_params{{1, 3, 3, 3},{1, 3, 3, 3, 3},{}, eltwise_test_params::opType::Sum, "", 1, MKLDNNPlugin::impl_desc_type::ref},
-                eltwise_test_params{{1, 3, 3, 3, 3},{1, 3, 3, 3},{}, eltwise_test_params::opType::Sum, "", 1, MKLDNNPlugin::impl_desc_type::ref}
+                eltwise_test_params{{1},{1, 3},{}, eltwise_test_params::opType::Sum, "", 1, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_test_params{{1, 3},{1},{}, eltwise_test_params::opType::Sum, "", 1, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_test_params{{1, 3},{3},{}, eltwise_test_params::opType::Sum, "", 1, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_test_params{{1},{1, 3, 3},{}, eltwise_test_params::opType::Sum, "", 2, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_test_params{{1, 3, 3},{1},{}, eltwise_test_params::opType::Sum, "", 2, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_test_params{{1, 3, 3},{3},{}, eltwise_test_params::opType::Sum, "", 2, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_test_params{{1, 3},{1, 3, 3},{}, eltwise_test_params::opType::Sum, "", 2, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_test_params{{1, 3, 3},{1, 3},{}, eltwise_test_params::opType::Sum, "", 2, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_test_params{{1},{1, 3, 3, 3},{}, eltwise_test_params::opType::Sum, "", 1, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_test_params{{1, 3, 3, 3},{1},{}, eltwise_test_params::opType::Sum, "", 1, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_test_params{{1, 3},{1, 3, 3, 3},{}, eltwise_test_params::opType::Sum, "", 1, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_test_params{{1, 3, 3, 3},{1, 3},{}, eltwise_test_params::opType::Sum, "", 1, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_test_params{{1, 3, 3},{1, 3, 3, 3},{}, eltwise_test_params::opType::Sum, "", 1, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_test_params{{1, 3, 3, 3},{1, 3, 3},{}, eltwise_test_params::opType::Sum, "", 1, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_test_params{{1},{1, 3, 3, 3, 3},{}, eltwise_test_params::opType::Sum, "", 1, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_test_params{{1, 3, 3, 3, 3},{1},{}, eltwise_test_params::opType::Sum, "", 1, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_test_params{{1, 3},{1, 3, 3, 3, 3},{}, eltwise_test_params::opType::Sum, "", 1, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_test_params{{1, 3, 3, 3, 3},{1, 3},{}, eltwise_test_params::opType::Sum, "", 1, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_test_params{{1, 3, 3},{1, 3, 3, 3, 3},{}, eltwise_test_params::opType::Sum, "", 1, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_test_params{{1, 3, 3, 3, 3},{1, 3, 3},{}, eltwise_test_params::opType::Sum, "", 1, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_test_params{{1, 3, 3, 3},{1, 3, 3, 3, 3},{}, eltwise_test_params::opType::Sum, "", 1, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_test_params{{1, 3, 3, 3, 3},{1, 3, 3, 3},{}, eltwise_test_params::opType::Sum, "", 1, MKLDNNPlugin::impl_desc_type::jit}
         ));
 
 class MKLDNNGraphEltwiseDynBatchTests: public MKLDNNGraphEltwise3InputsTests {
@@ -1002,17 +1018,31 @@ protected:
             MKLDNNGraphTestClass graph;
             ASSERT_NO_THROW(graph.CreateGraph(net_reader.getNetwork()));
 
+            // the JIT kernel reads U8 inputs as is, so no U8->FP32 reorders are inserted for it
+            size_t num_nodes = p.num_nodes;
+            size_t num_reorder_nodes = p.num_reorder_nodes;
+            bool jit = eltwise_jit_impl_type() != MKLDNNPlugin::impl_desc_type::ref;
+            if (jit) {
+                num_nodes -= p.num_reorder_nodes;
+                num_reorder_nodes = 0;
+            }
+
             auto& nodes = graph.getNodes();
             nodes = graph.getNodes();
-            ASSERT_EQ(nodes.size(), p.num_nodes);
+            ASSERT_EQ(nodes.size(), num_nodes);
 
             size_t actual_reorder_nodes = 0;
             for (size_t i = 0; i < nodes.size(); i++) {
                 if(nodes[i].get()->getType() == MKLDNNPlugin::Type::Reorder &&
                     FIND_STR(nodes[i].get()->getName(), "_U8_FP32_"))
                     actual_reorder_nodes ++;
+                if (jit && nodes[i].get()->getType() == MKLDNNPlugin::Type::Eltwise) {
+                    auto config = nodes[i].get()->getSelectedPrimitiveDescriptor()->getConfig();
+                    ASSERT_EQ(p.in.precision0, config.inConfs.at(0).desc.getPrecision().name());
+                    ASSERT_EQ(p.in.precision1, config.inConfs.at(1).desc.getPrecision().name());
+                }
             }
-            ASSERT_EQ(actual_reorder_nodes, p.num_reorder_nodes);
+            ASSERT_EQ(actual_reorder_nodes, num_reorder_nodes);
         } catch (const InferenceEngine::details::InferenceEngineException &e) {
             FAIL() << e.what();
         }
@@ -1029,3 +1059,343 @@ INSTANTIATE_TEST_CASE_P(
             precisions_test_2params{ {"FP32",   "U8"}, 5, 1 },
             precisions_test_2params{ {  "U8",   "U8"}, 6, 2 }
         ));
+
+struct eltwise_jit_test_params {
+    std::vector<std::vector<size_t>> dims;
+    std::vector<std::string> precisions;
+    std::string out_precision;
+
+    eltwise_test_params::opType op;
+
+    std::string scales;
+
+    // inputs come to the Eltwise through a layer with blocked output
+    bool blocked;
+
+    // unknown means the layer is rejected on graph creation
+    MKLDNNPlugin::impl_desc_type selectedType;
+};
+
+extern InferenceEngine::IExtensionPtr make_FakeExtensions();
+
+class MKLDNNGraphEltwiseJitTests: public TestsCommon,
+                                  public WithParamInterface<eltwise_jit_test_params> {
+protected:
+    static std::string dimsToStr(const std::vector<size_t> &dims) {
+        std::string str;
+        for (auto &dim : dims) {
+            str += "\n                    <dim>";
+            str += std::to_string(dim) + "</dim>";
+        }
+        return str;
+    }
+
+    static std::vector<size_t> outDims(const eltwise_jit_test_params &p) {
+        size_t rank = 0;
+        for (auto &dims : p.dims)
+            rank = std::max(rank, dims.size());
+        std::vector<size_t> out(rank, 1);
+        for (auto &dims : p.dims) {
+            for (size_t i = 0; i < dims.size(); i++) {
+                size_t &dim = out[rank - dims.size() + i];
+                dim = std::max(dim, dims[i]);
+            }
+        }
+        return out;
+    }
+
+    static InferenceEngine::Layout layoutFor(const std::vector<size_t> &dims) {
+        switch (dims.size()) {
+            case 4: return InferenceEngine::NCHW;
+            case 5: return InferenceEngine::NCDHW;
+            default: return InferenceEngine::ANY;
+        }
+    }
+
+    std::string getModel(const eltwise_jit_test_params &p) {
+        const size_t inputs = p.dims.size();
+        std::string layers;
+        std::string edges;
+        std::string eltwise_ports;
+        for (size_t i = 0; i < inputs; i++) {
+            std::string dims = dimsToStr(p.dims[i]);
+            std::string name = "in" + std::to_string(i + 1);
+            layers += "        <layer name=\"" + name + "\" type=\"Input\" precision=\"" + p.precisions[i] +
+                      "\" id=\"" + std::to_string(i) + "\">\n"
+                      "            <output>\n                <port id=\"0\">" + dims + "\n                </port>\n"
+                      "            </output>\n        </layer>\n";
+            if (p.blocked) {
+                layers += "        <layer name=\"blk" + std::to_string(i + 1) + "\" type=\"FakeLayerBLK\" precision=\"FP32\" id=\"" +
+                          std::to_string(inputs + i) + "\">\n"
+                          "            <input>\n                <port id=\"0\">" + dims + "\n                </port>\n            </input>\n"
+                          "            <output>\n                <port id=\"1\">" + dims + "\n                </port>\n            </output>\n"
+                          "        </layer>\n";
+                edges += "        <edge from-layer=\"" + std::to_string(i) + "\" from-port=\"0\" to-layer=\"" +
+                         std::to_string(inputs + i) + "\" to-port=\"0\"/>\n";
+                edges += "        <edge from-layer=\"" + std::to_string(inputs + i) + "\" from-port=\"1\" to-layer=\"" +
+                         std::to_string(2 * inputs) + "\" to-port=\"" + std::to_string(i) + "\"/>\n";
+            } else {
+                edges += "        <edge from-layer=\"" + std::to_string(i) + "\" from-port=\"0\" to-layer=\"" +
+                         std::to_string(2 * inputs) + "\" to-port=\"" + std::to_string(i) + "\"/>\n";
+            }
+            eltwise_ports += "\n                <port id=\"" + std::to_string(i) + "\">" + dims + "\n                </port>";
+        }
+
+        std::string coeff;
+        if (!p.scales.empty())
+            coeff = "coeff=\"" + p.scales + "\"";
+        layers += "        <layer name=\"eltwise\" type=\"Eltwise\" precision=\"" + p.out_precision +
+                  "\" id=\"" + std::to_string(2 * inputs) + "\">\n"
+                  "            <data operation=\"" + select_op(p.op) + "\" " + coeff + "/>\n"
+                  "            <input>" + eltwise_ports + "\n            </input>\n"
+                  "            <output>\n                <port id=\"" + std::to_string(inputs) + "\">" +
+                  dimsToStr(outDims(p)) + "\n                </port>\n            </output>\n"
+                  "        </layer>\n";
+
+        return "<net name=\"EltwiseJit\" version=\"2\" precision=\"FP32\">\n    <layers>\n" + layers +
+               "    </layers>\n    <edges>\n" + edges + "    </edges>\n</net>\n";
+    }
+
+    // small integers keep the reference computed in floats exact
+    template <typename data_t>
+    static void fill_int_data(data_t *data, size_t size, int low, int high, size_t seed) {
+        for (size_t i = 0; i < size; i++)
+            data[i] = static_cast<data_t>(low + static_cast<int>((i * 7 + seed * 13) % (high - low + 1)));
+    }
+
+    template <typename data_t>
+    static InferenceEngine::TBlob<data_t> convertBlob(const InferenceEngine::Blob::Ptr &blob) {
+        InferenceEngine::Precision prc = std::is_same<data_t, float>::value ? InferenceEngine::Precision::FP32
+                                                                            : InferenceEngine::Precision::I32;
+        auto &desc = blob->getTensorDesc();
+        InferenceEngine::TBlob<data_t> converted({prc, desc.getDims(), desc.getLayout()});
+        converted.allocate();
+        data_t *dst = converted.data();
+        for (size_t i = 0; i < blob->size(); i++) {
+            switch (desc.getPrecision()) {
+                case InferenceEngine::Precision::FP32: dst[i] = static_cast<data_t>(blob->cbuffer().as<const float *>()[i]); break;
+                case InferenceEngine::Precision::I32: dst[i] = static_cast<data_t>(blob->cbuffer().as<const int32_t *>()[i]); break;
+                case InferenceEngine::Precision::I8: dst[i] = static_cast<data_t>(blob->cbuffer().as<const int8_t *>()[i]); break;
+                case InferenceEngine::Precision::U8: dst[i] = static_cast<data_t>(blob->cbuffer().as<const uint8_t *>()[i]); break;
+                default: THROW_IE_EXCEPTION << "Unsupported precision " << desc.getPrecision();
+            }
+        }
+        return converted;
+    }
+
+    template <typename data_t>
+    void checkOutput(const InferenceEngine::Blob::Ptr &output, const std::vector<InferenceEngine::Blob::Ptr> &srcs,
+                     const eltwise_jit_test_params &p) {
+        std::vector<InferenceEngine::TBlob<data_t>> src_vec;
+        for (auto &src : srcs)
+            src_vec.push_back(convertBlob<data_t>(src));
+
+        InferenceEngine::TBlob<data_t> dst_ref(output->getTensorDesc());
+        dst_ref.allocate();
+
+        eltwise_test_params prm;
+        prm.op = p.op;
+        prm.scales = p.scales;
+        ref_eltwise(src_vec, dst_ref, prm);
+
+        if (std::is_same<data_t, float>::value) {
+            compare(*output, dst_ref, 0.0005f);
+        } else {
+            const data_t *res = output->cbuffer().as<const data_t *>();
+            const data_t *ref = dst_ref.readOnly();
+            for (size_t i = 0; i < dst_ref.size(); i++)
+                ASSERT_EQ(ref[i], res[i]) << "at " << i;
+        }
+    }
+
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            eltwise_jit_test_params p = ::testing::WithParamInterface<eltwise_jit_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+            extMgr->AddExtension(make_FakeExtensions());
+
+            MKLDNNGraphTestClass graph;
+            if (p.selectedType == MKLDNNPlugin::impl_desc_type::unknown) {
+                ASSERT_THROW(graph.CreateGraph(net_reader.getNetwork(), extMgr),
+                             InferenceEngine::details::InferenceEngineException);
+                return;
+            }
+            graph.CreateGraph(net_reader.getNetwork(), extMgr);
+
+            auto& nodes = graph.getNodes();
+            for (int i = 0; i < nodes.size(); i++) {
+                if (nodes[i]->getType() == MKLDNNPlugin::Eltwise) {
+                    ASSERT_NE(nullptr, nodes[i]->getSelectedPrimitiveDescriptor());
+                    ASSERT_EQ(eltwise_expected_impl_type(p.selectedType),
+                              nodes[i]->getSelectedPrimitiveDescriptor()->getImplementationType());
+                    if (p.blocked) {
+                        auto &config = nodes[i]->getSelectedPrimitiveDescriptor()->getConfig();
+                        for (auto &inConf : config.inConfs)
+                            ASSERT_EQ(InferenceEngine::Layout::BLOCKED, inConf.desc.getLayout());
+                        ASSERT_EQ(InferenceEngine::Layout::BLOCKED, config.outConfs.at(0).desc.getLayout());
+                    }
+                }
+            }
+
+            InferenceEngine::BlobMap srcs;
+            std::vector<InferenceEngine::Blob::Ptr> src_vec;
+            for (size_t i = 0; i < p.dims.size(); i++) {
+                InferenceEngine::TensorDesc desc(InferenceEngine::Precision::FromStr(p.precisions[i]), p.dims[i], layoutFor(p.dims[i]));
+                InferenceEngine::Blob::Ptr src;
+                switch (desc.getPrecision()) {
+                    case InferenceEngine::Precision::FP32:
+                        src = InferenceEngine::make_shared_blob<float>(desc);
+                        src->allocate();
+                        fill_data_sine(src->buffer(), src->size(), 0.1, 0.9, i + 1);
+                        break;
+                    case InferenceEngine::Precision::I32:
+                        src = InferenceEngine::make_shared_blob<int32_t>(desc);
+                        src->allocate();
+                        fill_int_data(src->buffer().as<int32_t *>(), src->size(), -20, 20, i);
+                        break;
+                    case InferenceEngine::Precision::I8:
+                        src = InferenceEngine::make_shared_blob<int8_t>(desc);
+                        src->allocate();
+                        fill_int_data(src->buffer().as<int8_t *>(), src->size(), -8, 7, i);
+                        break;
+                    case InferenceEngine::Precision::U8:
+                        src = InferenceEngine::make_shared_blob<uint8_t>(desc);
+                        src->allocate();
+                        fill_int_data(src->buffer().as<uint8_t *>(), src->size(), 0, 15, i);
+                        break;
+                    default:
+                        FAIL() << "Unsupported input precision " << p.precisions[i];
+                }
+                srcs["in" + std::to_string(i + 1)] = src;
+                src_vec.push_back(src);
+            }
+
+            InferenceEngine::OutputsDataMap out;
+            out = net_reader.getNetwork().getOutputsInfo();
+            InferenceEngine::BlobMap outputBlobs;
+
+            std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+            InferenceEngine::Blob::Ptr output;
+            if (p.out_precision == "I32")
+                output = InferenceEngine::make_shared_blob<int32_t>(item.second->getTensorDesc());
+            else
+                output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            graph.Infer(srcs, outputBlobs);
+
+            if (p.out_precision == "I32")
+                checkOutput<int32_t>(output, src_vec, p);
+            else
+                checkOutput<float>(output, src_vec, p);
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNGraphEltwiseJitTests, TestsEltwiseJit) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsBlockedBroadcast, MKLDNNGraphEltwiseJitTests,
+        ::testing::Values(
+                // per channel operands are periodic in the blocked layout
+                eltwise_jit_test_params{{{2, 16, 5, 7}, {1, 16, 1, 1}}, {"FP32", "FP32"}, "FP32",
+                                        eltwise_test_params::opType::Prod, "", true, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_jit_test_params{{{1, 32, 4, 4}, {1, 32, 1, 1}, {1, 32, 4, 4}}, {"FP32", "FP32", "FP32"}, "FP32",
+                                        eltwise_test_params::opType::Sum, "0.5,-1.5,2.0", true, MKLDNNPlugin::impl_desc_type::jit},
+                // padded channels block
+                eltwise_jit_test_params{{{1, 20, 3, 5}, {1, 20, 1, 1}}, {"FP32", "FP32"}, "FP32",
+                                        eltwise_test_params::opType::Sub, "", true, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_jit_test_params{{{2, 16, 3, 3}, {2, 16, 1, 3}}, {"FP32", "FP32"}, "FP32",
+                                        eltwise_test_params::opType::Greater, "", true, MKLDNNPlugin::impl_desc_type::jit}
+        ));
+
+INSTANTIATE_TEST_CASE_P(
+        TestsPeriodic, MKLDNNGraphEltwiseJitTests,
+        ::testing::Values(
+                // the operand is periodic when its row is as long as a vector register: 16, 8 and 4 floats
+                eltwise_jit_test_params{{{2, 3, 5, 16}, {1, 1, 1, 16}}, {"FP32", "FP32"}, "FP32",
+                                        eltwise_test_params::opType::Max, "", false, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_jit_test_params{{{2, 3, 5, 8}, {1, 1, 1, 8}}, {"FP32", "FP32"}, "FP32",
+                                        eltwise_test_params::opType::Min, "", false, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_jit_test_params{{{2, 3, 5, 4}, {1, 1, 1, 4}}, {"FP32", "FP32"}, "FP32",
+                                        eltwise_test_params::opType::Squared_diff, "", false, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_jit_test_params{{{2, 3, 5, 8}, {1, 1, 1, 8}}, {"I32", "I32"}, "I32",
+                                        eltwise_test_params::opType::Sub, "", false, MKLDNNPlugin::impl_desc_type::jit}
+        ));
+
+INSTANTIATE_TEST_CASE_P(
+        TestsNary, MKLDNNGraphEltwiseJitTests,
+        ::testing::Values(
+                eltwise_jit_test_params{{{2, 3, 4, 5}, {1, 3, 1, 5}, {2, 1, 4, 1}, {1}, {2, 3, 4, 5}},
+                                        {"FP32", "FP32", "FP32", "FP32", "FP32"}, "FP32",
+                                        eltwise_test_params::opType::Max, "", false, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_jit_test_params{{{2, 3, 4, 5}, {3, 4, 5}, {5}, {2, 3, 1, 1}},
+                                        {"FP32", "FP32", "FP32", "FP32"}, "FP32",
+                                        eltwise_test_params::opType::Sum, "1.0,2.0,-0.5,0.25", false, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_jit_test_params{{{1, 3, 4, 4}, {1, 3, 4, 4}, {1, 3, 4, 4}, {1, 3, 4, 4}, {1, 3, 4, 4}, {1, 3, 4, 4}, {1, 3, 4, 4}},
+                                        {"FP32", "FP32", "FP32", "FP32", "FP32", "FP32", "FP32"}, "FP32",
+                                        eltwise_test_params::opType::Sub, "", false, MKLDNNPlugin::impl_desc_type::jit},
+                // more inputs than the kernel takes
+                eltwise_jit_test_params{{{1, 3, 4, 4}, {1, 3, 4, 4}, {1, 3, 4, 4}, {1, 3, 4, 4},
+                                         {1, 3, 4, 4}, {1, 3, 4, 4}, {1, 3, 4, 4}, {1, 3, 4, 4}},
+                                        {"FP32", "FP32", "FP32", "FP32", "FP32", "FP32", "FP32", "FP32"}, "FP32",
+                                        eltwise_test_params::opType::Sub, "", false, MKLDNNPlugin::impl_desc_type::ref}
+        ));
+
+INSTANTIATE_TEST_CASE_P(
+        TestsMixedPrecisions, MKLDNNGraphEltwiseJitTests,
+        ::testing::Values(
+                eltwise_jit_test_params{{{1, 3, 4, 5}, {1, 3, 4, 5}}, {"U8", "FP32"}, "FP32",
+                                        eltwise_test_params::opType::Sum, "", false, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_jit_test_params{{{1, 3, 4, 5}, {1, 3, 4, 5}}, {"FP32", "I8"}, "FP32",
+                                        eltwise_test_params::opType::Sub, "", false, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_jit_test_params{{{1, 3, 4, 5}, {1, 3, 1, 1}, {1, 1, 4, 5}}, {"I8", "I32", "U8"}, "FP32",
+                                        eltwise_test_params::opType::Prod, "", false, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_jit_test_params{{{2, 3, 4, 5}, {1, 3, 4, 5}}, {"U8", "I8"}, "FP32",
+                                        eltwise_test_params::opType::Less_equal, "", false, MKLDNNPlugin::impl_desc_type::jit}
+        ));
+
+INSTANTIATE_TEST_CASE_P(
+        TestsI32Output, MKLDNNGraphEltwiseJitTests,
+        ::testing::Values(
+                eltwise_jit_test_params{{{1, 3, 4, 5}, {1, 3, 1, 1}}, {"I32", "I32"}, "I32",
+                                        eltwise_test_params::opType::Sum, "", false, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_jit_test_params{{{1, 3, 4, 5}, {1, 3, 4, 5}}, {"I32", "I8"}, "I32",
+                                        eltwise_test_params::opType::Sum, "", false, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_jit_test_params{{{1, 3, 4, 5}, {1, 3, 4, 5}, {1, 1, 4, 5}}, {"I32", "U8", "I8"}, "I32",
+                                        eltwise_test_params::opType::Max, "", false, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_jit_test_params{{{2, 3, 4, 5}, {3, 1, 5}}, {"I32", "I32"}, "I32",
+                                        eltwise_test_params::opType::Min, "", false, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_jit_test_params{{{1, 3, 4, 5}, {1, 3, 4, 5}}, {"U8", "I32"}, "I32",
+                                        eltwise_test_params::opType::Squared_diff, "", false, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_jit_test_params{{{1, 3, 4, 5}, {1, 3, 4, 5}}, {"I32", "I32"}, "I32",
+                                        eltwise_test_params::opType::Prod, "", false, MKLDNNPlugin::impl_desc_type::jit}
+        ));
+
+INSTANTIATE_TEST_CASE_P(
+        TestsSumCoefficients, MKLDNNGraphEltwiseJitTests,
+        ::testing::Values(
+                eltwise_jit_test_params{{{1, 3, 4, 5}, {1, 3, 1, 5}}, {"FP32", "FP32"}, "FP32",
+                                        eltwise_test_params::opType::Sum, "-1.0,3.5", false, MKLDNNPlugin::impl_desc_type::jit},
+                eltwise_jit_test_params{{{1, 3, 4, 5}, {1}, {1, 3, 4, 5}}, {"FP32", "FP32", "FP32"}, "FP32",
+                                        eltwise_test_params::opType::Sum, "0.5,2.0,-0.25", false, MKLDNNPlugin::impl_desc_type::jit},
+                // integer inputs are converted to floats before scaling
+                eltwise_jit_test_params{{{1, 3, 4, 5}, {1, 3, 4, 5}, {1, 3, 1, 1}}, {"U8", "I8", "I32"}, "FP32",
+                                        eltwise_test_params::opType::Sum, "0.5,1.5,-1.0", false, MKLDNNPlugin::impl_desc_type::jit},
+                // integer Sum can't be scaled
+                eltwise_jit_test_params{{{1, 3, 4, 5}, {1, 3, 1, 1}}, {"I32", "I32"}, "I32",
+                                        eltwise_test_params::opType::Sum, "2.0,-1.0", false, MKLDNNPlugin::impl_desc_type::unknown}
+        ));
@@ -13,6 +13,7 @@
 #include <inference_engine/cnn_network_impl.hpp>
 #include "tests_common.hpp"
 
+#include <chrono>
 
 using namespace ::testing;
 using namespace std;
@@ -45,8 +46,7 @@ void ref_permute(const InferenceEngine::TBlob<data_t> &src, InferenceEngine::TBl
     }
 }
 
-class MKLDNNGraphPermuteTests: public TestsCommon,
-                               public WithParamInterface<permute_test_params> {
+class MKLDNNGraphPermuteTestsBase: public TestsCommon {
     std::string model_t = R"V0G0N(
 <Net Name="Power_Only" version="2" precision="FP32" batch="1">
     <layers>
@@ -102,7 +102,11 @@ protected:
 
         return model;
     }
+};
 
+class MKLDNNGraphPermuteTests: public MKLDNNGraphPermuteTestsBase,
+                               public WithParamInterface<permute_test_params> {
+protected:
     virtual void TearDown() {
     }
 
@@ -202,9 +206,171 @@ INSTANTIATE_TEST_CASE_P(
                 permute_test_params{{2, 3, 4, 5, 7}, {0, 2, 4, 3, 1}, 1, MKLDNNPlugin::impl_desc_type::unknown},
                 permute_test_params{{2, 3, 4, 5, 7}, {0, 4, 2, 3, 1}, 1, MKLDNNPlugin::impl_desc_type::unknown},
                 permute_test_params{{2, 3, 4, 5}, {0, 3, 1, 2}, 1, MKLDNNPlugin::impl_desc_type::unknown},
-                permute_test_params{{3, 4, 7}, {1, 0, 2}, 1, MKLDNNPlugin::impl_desc_type::unknown}
+                permute_test_params{{3, 4, 7}, {1, 0, 2}, 1, MKLDNNPlugin::impl_desc_type::unknown},
+                permute_test_params{{2, 70, 33, 18}, {0, 3, 2, 1}, 1, MKLDNNPlugin::impl_desc_type::unknown},
+                permute_test_params{{2, 32, 5, 48}, {0, 3, 2, 1}, 3, MKLDNNPlugin::impl_desc_type::unknown},
+                permute_test_params{{1, 16, 19, 21}, {0, 3, 2, 1}, 3, MKLDNNPlugin::impl_desc_type::unknown},
+                permute_test_params{{2, 8, 3, 4}, {2, 3, 1, 0}, 2, MKLDNNPlugin::impl_desc_type::unknown},
+                permute_test_params{{2, 16, 3, 4, 5}, {0, 4, 1, 3, 2}, 3, MKLDNNPlugin::impl_desc_type::unknown},
+                permute_test_params{{2, 3, 2, 4, 3, 2, 5}, {0, 6, 2, 4, 1, 5, 3}, 1, MKLDNNPlugin::impl_desc_type::unknown},
+                permute_test_params{{3, 2, 2, 3, 2, 2, 3, 2}, {7, 6, 5, 4, 3, 2, 1, 0}, 1, MKLDNNPlugin::impl_desc_type::unknown}
+        ));
+
+struct permute_precision_test_params {
+    InferenceEngine::SizeVector dims;
+    InferenceEngine::SizeVector order;
+    InferenceEngine::Precision precision;
+};
+
+class MKLDNNGraphPermutePrecisionTests: public MKLDNNGraphPermuteTestsBase,
+                                        public WithParamInterface<permute_precision_test_params> {
+protected:
+    template <typename data_t>
+    void test(const permute_precision_test_params &p) {
+        std::string model = getModel({p.dims, p.order, 1, MKLDNNPlugin::impl_desc_type::unknown});
+        REPLACE_WITH_STR(model, "FP32", p.precision.name());
+
+        InferenceEngine::CNNNetReader net_reader;
+        ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+        // the reader makes the outputs FP32, so the permute would be followed by a conversion
+        net_reader.getNetwork().getOutputsInfo().begin()->second->setPrecision(p.precision);
+
+        MKLDNNGraphTestClass graph;
+        graph.CreateGraph(net_reader.getNetwork());
+        auto& nodes = graph.getNodes();
+        for (int i = 0; i < nodes.size(); i++) {
+            if (nodes[i]->getType() == MKLDNNPlugin::Permute) {
+                ASSERT_NE(nullptr, nodes[i]->getSelectedPrimitiveDescriptor());
+                ASSERT_EQ(p.precision, nodes[i]->getSelectedPrimitiveDescriptor()->getConfig().inConfs[0].desc.getPrecision());
+            }
+        }
+
+        InferenceEngine::TBlob<data_t> src({p.precision, p.dims, InferenceEngine::TensorDesc::getLayoutByDims(p.dims)});
+        src.allocate();
+        data_t *src_data = src.data();
+        for (size_t i = 0; i < src.size(); i++)
+            src_data[i] = static_cast<data_t>(i % 251);
+
+        InferenceEngine::BlobMap srcs;
+        srcs["in1"] = std::make_shared<InferenceEngine::TBlob<data_t>>(src);
+
+        InferenceEngine::OutputsDataMap out = net_reader.getNetwork().getOutputsInfo();
+        std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+        auto output = std::make_shared<InferenceEngine::TBlob<data_t>>(item.second->getTensorDesc());
+        output->allocate();
+        InferenceEngine::BlobMap outputBlobs;
+        outputBlobs[item.first] = output;
+
+        graph.Infer(srcs, outputBlobs);
+
+        InferenceEngine::TBlob<data_t> dst_ref(item.second->getTensorDesc());
+        dst_ref.allocate();
+        ref_permute(src, dst_ref, {p.dims, p.order, 1, MKLDNNPlugin::impl_desc_type::unknown});
+
+        const data_t *res = output->readOnly();
+        const data_t *ref = dst_ref.readOnly();
+        for (size_t i = 0; i < dst_ref.size(); i++)
+            ASSERT_EQ(ref[i], res[i]) << "at index " << i;
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            permute_precision_test_params p = ::testing::WithParamInterface<permute_precision_test_params>::GetParam();
+            switch (p.precision) {
+                case InferenceEngine::Precision::U8: test<uint8_t>(p); break;
+                case InferenceEngine::Precision::I8: test<int8_t>(p); break;
+                case InferenceEngine::Precision::I16: test<int16_t>(p); break;
+                case InferenceEngine::Precision::I32: test<int32_t>(p); break;
+                default: FAIL() << "Unsupported precision " << p.precision.name();
+            }
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNGraphPermutePrecisionTests, TestsPermutePrecision) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsPermutePrecision, MKLDNNGraphPermutePrecisionTests,
+        ::testing::Values(
+                permute_precision_test_params{{2, 3, 4, 5}, {0, 2, 3, 1}, InferenceEngine::Precision::U8},
+                permute_precision_test_params{{2, 70, 33, 18}, {0, 3, 2, 1}, InferenceEngine::Precision::U8},
+                permute_precision_test_params{{2, 3, 4, 5, 6}, {0, 4, 2, 1, 3}, InferenceEngine::Precision::I8},
+                permute_precision_test_params{{2, 40, 70}, {0, 2, 1}, InferenceEngine::Precision::I16},
+                permute_precision_test_params{{2, 3, 4, 5}, {3, 2, 1, 0}, InferenceEngine::Precision::I16},
+                permute_precision_test_params{{2, 8, 3, 3, 4, 5}, {0, 1, 4, 2, 5, 3}, InferenceEngine::Precision::I32},
+                permute_precision_test_params{{2, 48, 3, 35}, {0, 3, 2, 1}, InferenceEngine::Precision::I32},
+                permute_precision_test_params{{2, 40, 70}, {0, 2, 1}, InferenceEngine::Precision::I32}
         ));
 
+class MKLDNNGraphPermutePerfTests: public MKLDNNGraphPermuteTestsBase {
+protected:
+    template <typename data_t>
+    double measure(const permute_precision_test_params &p, int iterations) {
+        std::string model = getModel({p.dims, p.order, 1, MKLDNNPlugin::impl_desc_type::unknown});
+        REPLACE_WITH_STR(model, "FP32", p.precision.name());
+
+        InferenceEngine::CNNNetReader net_reader;
+        net_reader.ReadNetwork(model.data(), model.length());
+        InferenceEngine::OutputsDataMap outputs = net_reader.getNetwork().getOutputsInfo();
+        auto output = outputs.begin();
+        output->second->setPrecision(p.precision);
+
+        MKLDNNGraphTestClass graph;
+        graph.CreateGraph(net_reader.getNetwork());
+
+        auto src = std::make_shared<InferenceEngine::TBlob<data_t>>(
+                InferenceEngine::TensorDesc(p.precision, p.dims, InferenceEngine::TensorDesc::getLayoutByDims(p.dims)));
+        src->allocate();
+        auto dst = std::make_shared<InferenceEngine::TBlob<data_t>>(output->second->getTensorDesc());
+        dst->allocate();
+        InferenceEngine::BlobMap srcs = {{"in1", src}};
+        InferenceEngine::BlobMap dsts = {{output->first, dst}};
+        graph.Infer(srcs, dsts);
+
+        // only the node is timed, the copies of the graph inputs and outputs would hide the difference
+        MKLDNNPlugin::MKLDNNNodePtr permute;
+        for (auto &node : graph.getNodes()) {
+            if (node->getType() == MKLDNNPlugin::Permute)
+                permute = node;
+        }
+        mkldnn::stream strm(mkldnn::stream::kind::eager);
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; i++)
+            permute->execute(strm);
+        std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count() / iterations;
+    }
+};
+
+// Common layout changes of the detection and the transformer networks, FP32 ones without a specialized kernel
+// and all of the I32 ones go through the transpose plan
+TEST_F(MKLDNNGraphPermutePerfTests, DISABLED_PerfCommonOrders) {
+    const int iterations = 200;
+    const std::vector<std::pair<InferenceEngine::SizeVector, InferenceEngine::SizeVector>> cases = {
+        {{1, 64, 80, 80}, {0, 2, 3, 1}},
+        {{1, 80, 80, 64}, {0, 3, 1, 2}},
+        {{1, 64, 80, 80}, {0, 3, 2, 1}},
+        {{8, 128, 12, 64}, {0, 2, 1, 3}},
+        {{8, 12, 128, 64}, {0, 1, 3, 2}},
+        {{1, 512, 1024}, {0, 2, 1}},
+        {{1, 4, 8, 2, 40, 40}, {0, 1, 4, 2, 5, 3}}
+    };
+    for (auto &c : cases) {
+        std::string name;
+        for (auto d : c.second)
+            name += std::to_string(d);
+        std::cout << "[ PERF     ] " << name << ": "
+                  << measure<float>({c.first, c.second, InferenceEngine::Precision::FP32}, iterations) << " us FP32, "
+                  << measure<int32_t>({c.first, c.second, InferenceEngine::Precision::I32}, iterations) << " us I32, "
+                  << measure<uint8_t>({c.first, c.second, InferenceEngine::Precision::U8}, iterations) << " us U8"
+                  << std::endl;
+    }
+}
+
 class MKLDNNGraphDynBatchPermuteTests: public MKLDNNGraphPermuteTests {
 protected:
     virtual void SetUp() {
@@ -288,5 +454,6 @@ INSTANTIATE_TEST_CASE_P(
                 permute_test_params{{2, 3, 4, 5, 7}, {0, 2, 1, 3, 4}, 1, MKLDNNPlugin::impl_desc_type::unknown},
                 permute_test_params{{2, 3, 4, 5, 7}, {0, 2, 4, 3, 1}, 1, MKLDNNPlugin::impl_desc_type::unknown},
                 permute_test_params{{2, 3, 4, 5, 7}, {0, 4, 2, 3, 1}, 1, MKLDNNPlugin::impl_desc_type::unknown},
-                permute_test_params{{2, 3, 4, 5}, {0, 3, 1, 2}, 1, MKLDNNPlugin::impl_desc_type::unknown}
+                permute_test_params{{2, 3, 4, 5}, {0, 3, 1, 2}, 1, MKLDNNPlugin::impl_desc_type::unknown},
+                permute_test_params{{2, 70, 33, 18}, {0, 3, 2, 1}, 1, MKLDNNPlugin::impl_desc_type::unknown}
         ));
@@ -0,0 +1,303 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include <mkldnn_plugin/mkldnn_extension_utils.h>
+#include "tests_common.hpp"
+
+#include <chrono>
+
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+
+
+struct ti_test_params {
+    size_t seq;
+    size_t channels;
+    int stride;
+
+    // the sum in the body works in place over the chunk of the sequence, so the ports can't point right into
+    // the full tensors and the chunks and the back edge are copied
+    bool inplace_body;
+};
+
+// h[t] = k * x[t] + h[t - 1], k is 1 for the body working in place and 2 otherwise
+void ref_ti(const float *x, const float *init, float *seq, float *last, ti_test_params prm) {
+    const float k = prm.inplace_body ? 1.f : 2.f;
+    std::vector<float> h(init, init + prm.channels);
+    for (size_t i = 0; i < prm.seq; i++) {
+        size_t t = prm.stride > 0 ? i : prm.seq - 1 - i;
+        for (size_t c = 0; c < prm.channels; c++) {
+            h[c] += k * x[t * prm.channels + c];
+            seq[t * prm.channels + c] = h[c];
+        }
+    }
+    std::copy(h.begin(), h.end(), last);
+}
+
+class MKLDNNGraphTensorIteratorTests: public TestsCommon,
+                                      public WithParamInterface<ti_test_params> {
+    std::string model_t = R"V0G0N(
+<net batch="1" name="TI_Sum" version="4">
+    <layers>
+        <layer id="0" name="in1" precision="FP32" type="Input">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>_T_</dim>
+                    <dim>_C_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="1" name="in2" precision="FP32" type="Input">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>_C_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="2" name="ti" precision="FP32" type="TensorIterator">
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>_T_</dim>
+                    <dim>_C_</dim>
+                </port>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>_C_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>_T_</dim>
+                    <dim>_C_</dim>
+                </port>
+                <port id="4">
+                    <dim>1</dim>
+                    <dim>_C_</dim>
+                </port>
+            </output>
+            <port_map>
+                <input  external_port_id="0" internal_layer_id="0" internal_port_id="0" axis="1" stride="_S_"/>
+                <input  external_port_id="1" internal_layer_id="1" internal_port_id="2"/>
+                <output external_port_id="3" internal_layer_id="2" internal_port_id="1" axis="1" stride="_S_"/>
+                <output external_port_id="4" internal_layer_id="1" internal_port_id="3"/>
+            </port_map>
+            <back_edges>
+                <edge from-layer="1" from-port="3" to-layer="1" to-port="2"/>
+            </back_edges>
+            <body>
+                <layers>
+                    <layer id="0" name="reshape_in" precision="FP32" type="Reshape">
+                        <data dim="1,_C_"/>
+                        <input>
+                            <port id="0">
+                                <dim>1</dim>
+                                <dim>1</dim>
+                                <dim>_C_</dim>
+                            </port>
+                        </input>
+                        <output>
+                            <port id="1">
+                                <dim>1</dim>
+                                <dim>_C_</dim>
+                            </port>
+                        </output>
+                    </layer>
+                    <layer id="1" name="sum" precision="FP32" type="Eltwise">
+                        <data operation="sum"/>
+                        <input>
+                            <port id="0">
+                                <dim>1</dim>
+                                <dim>_C_</dim>
+                            </port>_X2_PORT_
+                            <port id="2">
+                                <dim>1</dim>
+                                <dim>_C_</dim>
+                            </port>
+                        </input>
+                        <output>
+                            <port id="3">
+                                <dim>1</dim>
+                                <dim>_C_</dim>
+                            </port>
+                        </output>
+                    </layer>
+                    <layer id="2" name="reshape_out" precision="FP32" type="Reshape">
+                        <data dim="1,1,_C_"/>
+                        <input>
+                            <port id="0">
+                                <dim>1</dim>
+                                <dim>_C_</dim>
+                            </port>
+                        </input>
+                        <output>
+                            <port id="1">
+                                <dim>1</dim>
+                                <dim>1</dim>
+                                <dim>_C_</dim>
+                            </port>
+                        </output>
+                    </layer>
+                </layers>
+                <edges>
+                    <edge from-layer="0" from-port="1" to-layer="1" to-port="0"/>_X2_EDGE_
+                    <edge from-layer="1" from-port="3" to-layer="2" to-port="0"/>
+                </edges>
+            </body>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="2" to-port="1"/>
+    </edges>
+</net>
+)V0G0N";
+
+    // the chunk goes to the sum twice, so the sum has no input to work in place over
+    std::string x2_port_t = R"V0G0N(
+                            <port id="1">
+                                <dim>1</dim>
+                                <dim>_C_</dim>
+                            </port>)V0G0N";
+    std::string x2_edge_t = R"V0G0N(
+                    <edge from-layer="0" from-port="1" to-layer="1" to-port="1"/>)V0G0N";
+
+protected:
+    std::string getModel(ti_test_params p) {
+        std::string model = model_t;
+        REPLACE_WITH_STR(model, "_X2_PORT_", p.inplace_body ? "" : x2_port_t);
+        REPLACE_WITH_STR(model, "_X2_EDGE_", p.inplace_body ? "" : x2_edge_t);
+        REPLACE_WITH_NUM(model, "_T_", p.seq);
+        REPLACE_WITH_NUM(model, "_C_", p.channels);
+        REPLACE_WITH_NUM(model, "_S_", p.stride);
+
+        return model;
+    }
+
+    struct Blobs {
+        InferenceEngine::BlobMap inputs, outputs;
+        InferenceEngine::Blob::Ptr seq, last;
+    };
+
+    Blobs makeBlobs(InferenceEngine::CNNNetwork network, ti_test_params p) {
+        Blobs blobs;
+        InferenceEngine::Blob::Ptr x = InferenceEngine::make_shared_blob<float>(
+                {InferenceEngine::Precision::FP32, {1, p.seq, p.channels}, InferenceEngine::CHW});
+        x->allocate();
+        fill_data(x->buffer(), x->size());
+        InferenceEngine::Blob::Ptr init = InferenceEngine::make_shared_blob<float>(
+                {InferenceEngine::Precision::FP32, {1, p.channels}, InferenceEngine::NC});
+        init->allocate();
+        fill_data(init->buffer(), init->size());
+        blobs.inputs["in1"] = x;
+        blobs.inputs["in2"] = init;
+
+        for (auto &item : network.getOutputsInfo()) {
+            InferenceEngine::Blob::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            blobs.outputs[item.first] = output;
+            if (item.second->getTensorDesc().getDims().size() == 3)
+                blobs.seq = output;
+            else
+                blobs.last = output;
+        }
+        return blobs;
+    }
+
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            ti_test_params p = ::testing::WithParamInterface<ti_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork());
+
+            Blobs blobs = makeBlobs(net_reader.getNetwork(), p);
+            ASSERT_NE(nullptr, blobs.seq);
+            ASSERT_NE(nullptr, blobs.last);
+
+            InferenceEngine::TBlob<float> seq_ref(blobs.seq->getTensorDesc());
+            seq_ref.allocate();
+            InferenceEngine::TBlob<float> last_ref(blobs.last->getTensorDesc());
+            last_ref.allocate();
+            ref_ti(blobs.inputs["in1"]->buffer(), blobs.inputs["in2"]->buffer(), seq_ref.data(), last_ref.data(), p);
+
+            // the second inference starts from the initial state again
+            for (int n = 0; n < 2; n++) {
+                graph.Infer(blobs.inputs, blobs.outputs);
+
+                compare(*blobs.seq, seq_ref);
+                compare(*blobs.last, last_ref);
+            }
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNGraphTensorIteratorTests, TestsTensorIterator) {}
+
+
+INSTANTIATE_TEST_CASE_P(
+        TestsTensorIterator, MKLDNNGraphTensorIteratorTests,
+        ::testing::Values(
+                ti_test_params{5, 16, 1, false},
+                ti_test_params{5, 16, -1, false},
+                ti_test_params{5, 16, 1, true},
+                ti_test_params{5, 16, -1, true},
+                ti_test_params{1, 7, 1, false},
+                ti_test_params{64, 33, 1, false},
+                ti_test_params{64, 33, -1, true}));
+
+class MKLDNNGraphTensorIteratorPerfTests: public MKLDNNGraphTensorIteratorTests {
+protected:
+    virtual void SetUp() {
+        TestsCommon::SetUp();
+    }
+};
+
+// Long sequences where the copies of the chunks and of the back edge took as much time as the cell itself
+TEST_F(MKLDNNGraphTensorIteratorPerfTests, DISABLED_PerfLongSequence) {
+    const int iterations = 20;
+    for (size_t channels : {256, 1024}) {
+        for (bool inplace_body : {false, true}) {
+            ti_test_params p = {500, channels, 1, inplace_body};
+            std::string model = getModel(p);
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork());
+            Blobs blobs = makeBlobs(net_reader.getNetwork(), p);
+            graph.Infer(blobs.inputs, blobs.outputs);
+
+            auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < iterations; i++)
+                graph.Infer(blobs.inputs, blobs.outputs);
+            std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+            std::cout << "[ PERF     ] " << p.seq << " steps of " << channels << " channels, "
+                      << (inplace_body ? "copied" : "bound") << " ports: "
+                      << elapsed.count() / iterations / p.seq << " us per step" << std::endl;
+        }
+    }
+}
@@ -5,9 +5,11 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock-spec-builders.h>
 #include "mkldnn_plugin/mkldnn_graph.h"
+#include "mkldnn_plugin/mkldnn_infer_request.h"
 
 #include "single_layer_common.hpp"
 #include <mkldnn_plugin/mkldnn_extension_utils.h>
+#include <mkldnn_plugin/mkldnn/omp_manager.h>
 #include "tests_common.hpp"
 #include "../test_graph.hpp"
 #include <ext_list.hpp>
@@ -15,6 +17,10 @@
 #include <ie_ir_reader.hpp>
 #include <ngraph/frontend/onnx_import/onnx.hpp>
 
+#include <chrono>
+#include <numeric>
+#include <thread>
+
 using namespace ::testing;
 using namespace std;
 using namespace mkldnn;
@@ -1239,218 +1245,1092 @@ TEST_F(MKLDNNGraphStructureTests, TestOutputAfterInplacePlusConcat) {
     compare(*output, *src);
 }
 
-TEST_F(MKLDNNGraphStructureTests, TestResnetPart) {
-    std::string modelB = R"V0G0N(
-<net name="ResNet-152" version="2" batch="1">
+TEST_F(MKLDNNGraphStructureTests, TestZeroCopyBindingThroughSplit) {
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
     <layers>
-        <layer name="input" type="Input" precision="FP32" id="0">
+        <layer name="data" type="Input" precision="FP32" id="0">
             <output>
                 <port id="0">
                     <dim>1</dim>
-                    <dim>3</dim>
-                    <dim>224</dim>
-                    <dim>224</dim>
+                    <dim>2</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
                 </port>
             </output>
         </layer>
-        <layer name="conv1" type="Convolution" precision="FP32" id="1">
-            <convolution_data stride-x="2" stride-y="2" pad-x="3" pad-y="3" kernel-x="7" kernel-y="7" output="64" group="1"/>
+        <layer name="split" type="Split" precision="FP32" id="1">
+            <data axis="1"/>
             <input>
-                <port id="1">
+                <port id="0">
                     <dim>1</dim>
-                    <dim>3</dim>
-                    <dim>224</dim>
-                    <dim>224</dim>
+                    <dim>2</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
                 </port>
             </input>
             <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
                 <port id="2">
                     <dim>1</dim>
-                    <dim>64</dim>
-                    <dim>112</dim>
-                    <dim>112</dim>
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
                 </port>
             </output>
-            <weights offset="0" size="37632"/>
-            <biases offset="37632" size="256"/>
         </layer>
-        <layer name="conv1_relu" type="ReLU" precision="FP32" id="4">
+        <layer name="relu1" type="ReLU" precision="FP32" id="2">
             <input>
-                <port id="7">
+                <port id="0">
                     <dim>1</dim>
-                    <dim>64</dim>
-                    <dim>112</dim>
-                    <dim>112</dim>
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
                 </port>
             </input>
             <output>
-                <port id="8">
+                <port id="1">
                     <dim>1</dim>
-                    <dim>64</dim>
-                    <dim>112</dim>
-                    <dim>112</dim>
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
                 </port>
             </output>
         </layer>
-        <layer name="pool1" type="Pooling" precision="FP32" id="5">
-            <pooling_data kernel-x="3" kernel-y="3" pad-x="0" pad-y="0" stride-x="2" stride-y="2" rounding-type="ceil" pool-method="max"/>
+        <layer name="relu2" type="ReLU" precision="FP32" id="3">
             <input>
-                <port id="9">
+                <port id="0">
                     <dim>1</dim>
-                    <dim>64</dim>
-                    <dim>112</dim>
-                    <dim>112</dim>
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
                 </port>
             </input>
             <output>
-                <port id="10">
+                <port id="1">
                     <dim>1</dim>
-                    <dim>64</dim>
-                    <dim>56</dim>
-                    <dim>56</dim>
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
                 </port>
             </output>
         </layer>
-        <layer name="res2a_branch2a" type="Convolution" precision="FP32" id="9">
-            <convolution_data stride-x="1" stride-y="1" pad-x="0" pad-y="0" kernel-x="1" kernel-y="1" output="64" group="1"/>
-            <input>
-                <port id="17">
-                    <dim>1</dim>
-                    <dim>64</dim>
-                    <dim>56</dim>
-                    <dim>56</dim>
-                </port>
-            </input>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+        <edge from-layer="1" from-port="1" to-layer="2" to-port="0"/>
+        <edge from-layer="1" from-port="2" to-layer="3" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    auto graph = std::make_shared<MKLDNNGraphTestClass>();
+    graph->CreateGraph(net_reader.getNetwork());
+
+    MKLDNNPlugin::MKLDNNInferRequest request(net_reader.getNetwork().getInputsInfo(),
+                                             net_reader.getNetwork().getOutputsInfo());
+    request.SetGraph(graph);
+
+    std::vector<InferenceEngine::Blob::Ptr> inputs;
+    for (float sign : {1.f, -1.f}) {
+        InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(
+                {InferenceEngine::Precision::FP32, {1, 2, 8, 8}, InferenceEngine::NCHW});
+        src->allocate();
+        float *data = src->buffer().as<float *>();
+        for (size_t i = 0; i < src->size(); i++)
+            data[i] = sign * (i < 64 ? 1.f : 2.f);
+        inputs.push_back(src);
+    }
+
+    std::map<std::string, InferenceEngine::Blob::Ptr> outputs;
+    for (auto &item : net_reader.getNetwork().getOutputsInfo()) {
+        outputs[item.first] = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+        outputs[item.first]->allocate();
+        request.SetBlob(item.first.c_str(), outputs[item.first]);
+    }
+
+    // inputs of the optimized split and outputs of relu are bound, so nothing is copied.
+    // the second input is bound in place of the first one
+    for (size_t n = 0; n < inputs.size(); n++) {
+        request.SetBlob("data", inputs[n]);
+        ASSERT_NO_THROW(request.Infer());
+        ASSERT_EQ(0, request.GetCopiedBytes());
+
+        float expected1 = n == 0 ? 1.f : 0.f;
+        float expected2 = n == 0 ? 2.f : 0.f;
+        for (size_t i = 0; i < 64; i++) {
+            ASSERT_EQ(expected1, outputs["relu1"]->buffer().as<float *>()[i]);
+            ASSERT_EQ(expected2, outputs["relu2"]->buffer().as<float *>()[i]);
+        }
+    }
+
+    // blob of another layout can't be bound and is copied
+    InferenceEngine::Blob::Ptr nhwc = InferenceEngine::make_shared_blob<float>(
+            {InferenceEngine::Precision::FP32, {1, 2, 8, 8}, InferenceEngine::NHWC});
+    nhwc->allocate();
+    fill_data(nhwc->buffer(), nhwc->size());
+    request.SetBlob("data", nhwc);
+    ASSERT_NO_THROW(request.Infer());
+    ASSERT_EQ(nhwc->byteSize(), request.GetCopiedBytes());
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestZeroCopyBindingThroughInPlaceReshape) {
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
             <output>
-                <port id="18">
+                <port id="0">
                     <dim>1</dim>
-                    <dim>64</dim>
-                    <dim>56</dim>
-                    <dim>56</dim>
+                    <dim>2</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
                 </port>
             </output>
-            <weights offset="37888" size="16384"/>
-            <biases offset="54272" size="256"/>
         </layer>
-        <layer name="res2a_branch2a_relu" type="ReLU" precision="FP32" id="12">
+        <layer name="flatten" type="Reshape" precision="FP32" id="1">
+            <data axis="0" dim="1,128" num_axes="-1"/>
             <input>
-                <port id="23">
+                <port id="0">
                     <dim>1</dim>
-                    <dim>64</dim>
-                    <dim>56</dim>
-                    <dim>56</dim>
+                    <dim>2</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
                 </port>
             </input>
             <output>
-                <port id="24">
+                <port id="1">
                     <dim>1</dim>
-                    <dim>64</dim>
-                    <dim>56</dim>
-                    <dim>56</dim>
+                    <dim>128</dim>
                 </port>
             </output>
         </layer>
-        <layer name="res2a_branch2b" type="Convolution" precision="FP32" id="13">
-            <convolution_data stride-x="1" stride-y="1" pad-x="1" pad-y="1" kernel-x="3" kernel-y="3" output="64" group="1"/>
+        <layer name="scale" type="Power" precision="FP32" id="2">
+            <data power="1" scale="2" shift="0"/>
             <input>
-                <port id="25">
+                <port id="0">
                     <dim>1</dim>
-                    <dim>64</dim>
-                    <dim>56</dim>
-                    <dim>56</dim>
+                    <dim>128</dim>
                 </port>
             </input>
             <output>
-                <port id="26">
+                <port id="1">
                     <dim>1</dim>
-                    <dim>64</dim>
-                    <dim>56</dim>
-                    <dim>56</dim>
+                    <dim>128</dim>
                 </port>
             </output>
-            <weights offset="54528" size="147456"/>
-            <biases offset="201984" size="256"/>
         </layer>
-        <layer name="res2a_branch2b_relu" type="ReLU" precision="FP32" id="16">
+        <layer name="unflatten" type="Reshape" precision="FP32" id="3">
+            <data axis="0" dim="1,2,64" num_axes="-1"/>
             <input>
-                <port id="31">
+                <port id="0">
                     <dim>1</dim>
-                    <dim>64</dim>
-                    <dim>56</dim>
-                    <dim>56</dim>
+                    <dim>128</dim>
                 </port>
             </input>
             <output>
-                <port id="32">
+                <port id="1">
                     <dim>1</dim>
+                    <dim>2</dim>
                     <dim>64</dim>
-                    <dim>56</dim>
-                    <dim>56</dim>
                 </port>
             </output>
         </layer>
-        <layer name="res2a_branch2c" type="Convolution" precision="FP32" id="17">
-            <convolution_data stride-x="1" stride-y="1" pad-x="0" pad-y="0" kernel-x="1" kernel-y="1" output="256" group="1"/>
-            <input>
-                <port id="33">
-                    <dim>1</dim>
-                    <dim>64</dim>
-                    <dim>56</dim>
-                    <dim>56</dim>
-                </port>
-            </input>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+        <edge from-layer="1" from-port="1" to-layer="2" to-port="0"/>
+        <edge from-layer="2" from-port="1" to-layer="3" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    auto graph = std::make_shared<MKLDNNGraphTestClass>();
+    graph->CreateGraph(net_reader.getNetwork());
+    // the reshapes only reinterpret the dims of the memory next to the input and the output
+    size_t reshapes = 0;
+    for (auto &node : graph->getNodes()) {
+        if (node->getType() == MKLDNNPlugin::Reshape) {
+            ASSERT_TRUE(node->isInplace()) << node->getName();
+            reshapes++;
+        }
+    }
+    ASSERT_EQ(2, reshapes);
+
+    MKLDNNPlugin::MKLDNNInferRequest request(net_reader.getNetwork().getInputsInfo(),
+                                             net_reader.getNetwork().getOutputsInfo());
+    request.SetGraph(graph);
+
+    InferenceEngine::Blob::Ptr out = InferenceEngine::make_shared_blob<float>(
+            {InferenceEngine::Precision::FP32, {1, 2, 64}, InferenceEngine::CHW});
+    out->allocate();
+    request.SetBlob("unflatten", out);
+
+    // the input is bound through the reshape before the scale and the output through the reshape after it,
+    // the second input is bound in place of the first one
+    for (float sign : {1.f, -1.f}) {
+        InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(
+                {InferenceEngine::Precision::FP32, {1, 2, 8, 8}, InferenceEngine::NCHW});
+        src->allocate();
+        float *data = src->buffer().as<float *>();
+        for (size_t i = 0; i < src->size(); i++)
+            data[i] = sign * i;
+
+        request.SetBlob("data", src);
+        ASSERT_NO_THROW(request.Infer());
+        ASSERT_EQ(0, request.GetCopiedBytes());
+        for (size_t i = 0; i < out->size(); i++)
+            ASSERT_EQ(2.f * sign * i, out->buffer().as<float *>()[i]);
+    }
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestU16InputsOfAnyRankAreConvertedToFP32) {
+    std::string model_t = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
             <output>
-                <port id="34">
-                    <dim>1</dim>
-                    <dim>256</dim>
-                    <dim>56</dim>
-                    <dim>56</dim>
+                <port id="0">_DIMS_
                 </port>
             </output>
-            <weights offset="202240" size="65536"/>
-            <biases offset="267776" size="1024"/>
         </layer>
-        <layer name="res2a_branch1" type="Convolution" precision="FP32" id="6">
-            <convolution_data stride-x="1" stride-y="1" pad-x="0" pad-y="0" kernel-x="1" kernel-y="1" output="256" group="1"/>
+        <layer name="power" type="Power" precision="FP32" id="1">
+            <data power="1" scale="2" shift="1"/>
             <input>
-                <port id="11">
-                    <dim>1</dim>
-                    <dim>64</dim>
-                    <dim>56</dim>
-                    <dim>56</dim>
+                <port id="0">_DIMS_
                 </port>
             </input>
             <output>
-                <port id="12">
-                    <dim>1</dim>
-                    <dim>256</dim>
-                    <dim>56</dim>
-                    <dim>56</dim>
+                <port id="1">_DIMS_
                 </port>
             </output>
-            <weights offset="268800" size="65536"/>
-            <biases offset="334336" size="1024"/>
         </layer>
-        <layer name="res2a" type="Eltwise" precision="FP32" id="20">
-            <elementwise_data operation="sum"/>
-            <input>
-                <port id="39">
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    // the mean is never subtracted from such inputs, so they are converted element-wise whatever the layout is
+    const std::vector<InferenceEngine::SizeVector> shapes = {{2, 16}, {3, 4, 5}, {1, 2, 3, 4, 5}};
+    for (auto &dims : shapes) {
+        std::string model = model_t;
+        std::string s_dims;
+        for (auto dim : dims)
+            s_dims += "\n                    <dim>" + std::to_string(dim) + "</dim>";
+        REPLACE_WITH_STR(model, "_DIMS_", s_dims);
+
+        InferenceEngine::CNNNetReader net_reader;
+        ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+        InferenceEngine::CNNNetwork network = net_reader.getNetwork();
+        network.getInputsInfo().begin()->second->setPrecision(InferenceEngine::Precision::U16);
+
+        MKLDNNPlugin::MKLDNNExecNetwork::Ptr execNetwork(
+                new MKLDNNPlugin::MKLDNNExecNetwork(network, MKLDNNPlugin::Config(), {}));
+        execNetwork->setNetworkInputs(network.getInputsInfo());
+        execNetwork->setNetworkOutputs(network.getOutputsInfo());
+
+        InferenceEngine::IInferRequest::Ptr request;
+        execNetwork->CreateInferRequest(request);
+
+        InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<uint16_t>(
+                {InferenceEngine::Precision::U16, dims, InferenceEngine::TensorDesc::getLayoutByDims(dims)});
+        src->allocate();
+        uint16_t *src_data = src->buffer().as<uint16_t *>();
+        for (size_t i = 0; i < src->size(); i++)
+            src_data[i] = static_cast<uint16_t>(60000 + i);
+
+        InferenceEngine::ResponseDesc resp;
+        ASSERT_EQ(InferenceEngine::OK, request->SetBlob("data", src, &resp)) << resp.msg;
+        ASSERT_EQ(InferenceEngine::OK, request->Infer(&resp)) << resp.msg;
+
+        InferenceEngine::Blob::Ptr dst;
+        ASSERT_EQ(InferenceEngine::OK, request->GetBlob("power", dst, &resp)) << resp.msg;
+        ASSERT_EQ(src->size(), dst->size());
+        const float *dst_data = dst->buffer().as<const float *>();
+        for (size_t i = 0; i < dst->size(); i++)
+            ASSERT_EQ(2.f * src_data[i] + 1.f, dst_data[i]) << "at index " << i << " of input of rank " << dims.size();
+    }
+}
+
+class MKLDNNGraphBatchingTests: public TestsCommon {
+protected:
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
                     <dim>1</dim>
-                    <dim>256</dim>
-                    <dim>56</dim>
-                    <dim>56</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
                 </port>
-                <port id="40">
+            </output>
+        </layer>
+        <layer name="power" type="Power" precision="FP32" id="1">
+            <data power="1" scale="2" shift="1"/>
+            <input>
+                <port id="0">
                     <dim>1</dim>
-                    <dim>256</dim>
-                    <dim>56</dim>
-                    <dim>56</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
                 </port>
             </input>
             <output>
-                <port id="41">
+                <port id="1">
                     <dim>1</dim>
-                    <dim>256</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    const size_t maxBatch = 4;
+
+    MKLDNNPlugin::MKLDNNExecNetwork::Ptr loadNetwork(std::map<std::string, std::string> config) {
+        InferenceEngine::CNNNetReader net_reader;
+        net_reader.ReadNetwork(model.data(), model.length());
+
+        config[InferenceEngine::PluginConfigParams::KEY_CPU_BATCHING_MAX_BATCH] = std::to_string(maxBatch);
+        MKLDNNPlugin::Config cfg;
+        cfg.readProperties(config);
+        MKLDNNPlugin::MKLDNNExecNetwork::Ptr execNetwork(new MKLDNNPlugin::MKLDNNExecNetwork(net_reader.getNetwork(), cfg, {}));
+        execNetwork->setNetworkInputs(net_reader.getNetwork().getInputsInfo());
+        execNetwork->setNetworkOutputs(net_reader.getNetwork().getOutputsInfo());
+        return execNetwork;
+    }
+
+    // the request gets its own blobs from the plugin, so they are of a single sample
+    static void setInput(const InferenceEngine::IInferRequest::Ptr &request, float base) {
+        InferenceEngine::Blob::Ptr src;
+        InferenceEngine::ResponseDesc resp;
+        ASSERT_EQ(InferenceEngine::OK, request->GetBlob("data", src, &resp)) << resp.msg;
+        ASSERT_EQ(3 * 4 * 4, src->size());
+        float *data = src->buffer().as<float *>();
+        for (size_t i = 0; i < src->size(); i++)
+            data[i] = base + i;
+    }
+
+    static void checkOutput(const InferenceEngine::IInferRequest::Ptr &request, float base) {
+        InferenceEngine::Blob::Ptr dst;
+        InferenceEngine::ResponseDesc resp;
+        ASSERT_EQ(InferenceEngine::OK, request->GetBlob("power", dst, &resp)) << resp.msg;
+        ASSERT_EQ(3 * 4 * 4, dst->size());
+        const float *data = dst->buffer().as<float *>();
+        for (size_t i = 0; i < dst->size(); i++)
+            ASSERT_EQ(2.f * (base + i) + 1.f, data[i]);
+    }
+
+    static std::vector<uint64_t> getHistogram(const MKLDNNPlugin::MKLDNNExecNetwork::Ptr &execNetwork,
+                                              const std::string &name) {
+        InferenceEngine::Parameter histogram;
+        execNetwork->GetMetric(name, histogram, nullptr);
+        return histogram.as<std::vector<uint64_t>>();
+    }
+};
+
+TEST_F(MKLDNNGraphBatchingTests, TestBatchingOfConcurrentRequests) {
+    // the long timeout makes sure all requests get into the same batch
+    auto execNetwork = loadNetwork({{InferenceEngine::PluginConfigParams::KEY_CPU_BATCHING_TIMEOUT, "10000000"}});
+
+    std::vector<InferenceEngine::IInferRequest::Ptr> requests(maxBatch);
+    InferenceEngine::ResponseDesc resp;
+    for (size_t r = 0; r < maxBatch; r++) {
+        execNetwork->CreateInferRequest(requests[r]);
+        setInput(requests[r], r * 100.f);
+    }
+
+    for (auto &request : requests)
+        ASSERT_EQ(InferenceEngine::OK, request->StartAsync(&resp)) << resp.msg;
+    for (auto &request : requests)
+        ASSERT_EQ(InferenceEngine::OK, request->Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY, &resp)) << resp.msg;
+
+    for (size_t r = 0; r < maxBatch; r++)
+        checkOutput(requests[r], r * 100.f);
+
+    std::vector<uint64_t> expected(maxBatch + 1, 0);
+    expected[maxBatch] = 1;
+    ASSERT_EQ(expected, getHistogram(execNetwork, METRIC_KEY(CPU_BATCHING_BATCH_HISTOGRAM)));
+    auto waits = getHistogram(execNetwork, METRIC_KEY(CPU_BATCHING_WAIT_HISTOGRAM));
+    ASSERT_EQ(maxBatch, std::accumulate(waits.begin(), waits.end(), uint64_t(0)));
+
+    // the batch of a request is defined by the batcher only
+    ASSERT_NE(InferenceEngine::OK, requests[0]->SetBatch(2, &resp));
+}
+
+TEST_F(MKLDNNGraphBatchingTests, TestBatchingRunsPartialBatchOnTimeout) {
+    const int timeoutUs = 50000;
+    auto execNetwork = loadNetwork({{InferenceEngine::PluginConfigParams::KEY_CPU_BATCHING_TIMEOUT,
+                                     std::to_string(timeoutUs)}});
+
+    const size_t requestsNum = 2;
+    std::vector<InferenceEngine::IInferRequest::Ptr> requests(requestsNum);
+    InferenceEngine::ResponseDesc resp;
+    for (size_t r = 0; r < requestsNum; r++) {
+        execNetwork->CreateInferRequest(requests[r]);
+        setInput(requests[r], r * 100.f);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (auto &request : requests)
+        ASSERT_EQ(InferenceEngine::OK, request->StartAsync(&resp)) << resp.msg;
+    for (auto &request : requests)
+        ASSERT_EQ(InferenceEngine::OK, request->Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY, &resp)) << resp.msg;
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+    // the batch is not full, so it starts when the timeout of the first request expires
+    ASSERT_LE(timeoutUs, elapsed.count());
+    for (size_t r = 0; r < requestsNum; r++)
+        checkOutput(requests[r], r * 100.f);
+
+    std::vector<uint64_t> expected(maxBatch + 1, 0);
+    expected[requestsNum] = 1;
+    ASSERT_EQ(expected, getHistogram(execNetwork, METRIC_KEY(CPU_BATCHING_BATCH_HISTOGRAM)));
+
+    // a single request waits for the timeout and runs alone
+    ASSERT_EQ(InferenceEngine::OK, requests[0]->Infer(&resp)) << resp.msg;
+    checkOutput(requests[0], 0.f);
+    expected[1] = 1;
+    ASSERT_EQ(expected, getHistogram(execNetwork, METRIC_KEY(CPU_BATCHING_BATCH_HISTOGRAM)));
+}
+
+TEST_F(MKLDNNGraphBatchingTests, TestBatchingOfConcurrentSyncRequests) {
+    auto execNetwork = loadNetwork({{InferenceEngine::PluginConfigParams::KEY_CPU_BATCHING_TIMEOUT, "500"}});
+
+    // more submitters than the max batch, so that batches are formed while others are executed
+    const int threadsNum = 8;
+    const int iterations = 20;
+    std::vector<InferenceEngine::IInferRequest::Ptr> requests(threadsNum);
+    for (auto &request : requests)
+        execNetwork->CreateInferRequest(request);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadsNum; t++) {
+        threads.emplace_back([&, t] {
+            for (int i = 0; i < iterations; i++) {
+                const float base = t * 1000.f + i;
+                setInput(requests[t], base);
+                InferenceEngine::ResponseDesc resp;
+                ASSERT_EQ(InferenceEngine::OK, requests[t]->Infer(&resp)) << resp.msg;
+                checkOutput(requests[t], base);
+            }
+        });
+    }
+    for (auto &thread : threads)
+        thread.join();
+
+    auto batches = getHistogram(execNetwork, METRIC_KEY(CPU_BATCHING_BATCH_HISTOGRAM));
+    ASSERT_EQ(maxBatch + 1, batches.size());
+    uint64_t executed = 0;
+    for (size_t n = 0; n < batches.size(); n++)
+        executed += n * batches[n];
+    ASSERT_EQ(static_cast<uint64_t>(threadsNum * iterations), executed);
+}
+
+TEST_F(MKLDNNGraphBatchingTests, TestBatchingIsDisabledWithoutSingleStream) {
+    const std::vector<std::map<std::string, std::string>> configs = {
+        {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "2"}},
+        {{InferenceEngine::PluginConfigParams::KEY_EXCLUSIVE_ASYNC_REQUESTS, InferenceEngine::PluginConfigParams::YES}}
+    };
+    for (auto &config : configs) {
+        auto execNetwork = loadNetwork(config);
+
+        InferenceEngine::Parameter metrics;
+        execNetwork->GetMetric(METRIC_KEY(SUPPORTED_METRICS), metrics, nullptr);
+        auto names = metrics.as<std::vector<std::string>>();
+        ASSERT_EQ(names.end(), std::find(names.begin(), names.end(), METRIC_KEY(CPU_BATCHING_BATCH_HISTOGRAM)));
+        ASSERT_THROW(getHistogram(execNetwork, METRIC_KEY(CPU_BATCHING_BATCH_HISTOGRAM)),
+                     InferenceEngine::details::InferenceEngineException);
+
+        // the requests are executed one by one as usual
+        std::vector<InferenceEngine::IInferRequest::Ptr> requests(maxBatch);
+        InferenceEngine::ResponseDesc resp;
+        for (size_t r = 0; r < maxBatch; r++) {
+            execNetwork->CreateInferRequest(requests[r]);
+            setInput(requests[r], r * 100.f);
+        }
+        for (auto &request : requests)
+            ASSERT_EQ(InferenceEngine::OK, request->StartAsync(&resp)) << resp.msg;
+        for (auto &request : requests)
+            ASSERT_EQ(InferenceEngine::OK, request->Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY, &resp)) << resp.msg;
+        for (size_t r = 0; r < maxBatch; r++)
+            checkOutput(requests[r], r * 100.f);
+    }
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestMemoryStatesOfInterleavedRequests) {
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>10</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="mem_in" type="Memory" precision="FP32" id="1">
+            <data id="r" index="1" size="2"/>
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>10</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="sum" type="Eltwise" precision="FP32" id="2">
+            <data operation="sum"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>10</dim>
+                </port>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>10</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>10</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="mem_out" type="Memory" precision="FP32" id="3">
+            <data id="r" index="0" size="2"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>10</dim>
+                </port>
+            </input>
+        </layer>
+        <layer name="out" type="Power" precision="FP32" id="4">
+            <data power="1" scale="1" shift="0"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>10</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>10</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="prev" type="Power" precision="FP32" id="5">
+            <data power="1" scale="1" shift="0"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>10</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>10</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="1" from-port="0" to-layer="2" to-port="0"/>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="1"/>
+        <edge from-layer="2" from-port="2" to-layer="3" to-port="0"/>
+        <edge from-layer="2" from-port="2" to-layer="4" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="5" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    MKLDNNPlugin::MKLDNNExecNetwork::Ptr execNetwork(new MKLDNNPlugin::MKLDNNExecNetwork(net_reader.getNetwork(), {}, {}));
+    execNetwork->setNetworkInputs(net_reader.getNetwork().getInputsInfo());
+    execNetwork->setNetworkOutputs(net_reader.getNetwork().getOutputsInfo());
+
+    // every request keeps its own session: "out" accumulates the inputs of the request, "prev" is the previous sum
+    const size_t numRequests = 64;
+    std::vector<InferenceEngine::InferRequest> requests;
+    std::vector<InferenceEngine::Blob::Ptr> inputs(numRequests), outs(numRequests), prevs(numRequests);
+    std::vector<std::vector<float>> sums(numRequests, std::vector<float>(10, 0.f));
+    for (size_t r = 0; r < numRequests; r++) {
+        InferenceEngine::IInferRequest::Ptr request;
+        execNetwork->CreateInferRequest(request);
+        requests.emplace_back(request);
+        inputs[r] = requests[r].GetBlob("data");
+        outs[r] = requests[r].GetBlob("out");
+        prevs[r] = requests[r].GetBlob("prev");
+        ASSERT_EQ(1, requests[r].QueryState().size());
+    }
+
+    auto infer = [&](size_t r, size_t step) {
+        float *data = inputs[r]->buffer().as<float *>();
+        for (size_t i = 0; i < 10; i++)
+            data[i] = static_cast<float>(r + 1) + 0.5f * i + step;
+        requests[r].Infer();
+        for (size_t i = 0; i < 10; i++) {
+            ASSERT_EQ(sums[r][i], prevs[r]->buffer().as<float *>()[i]);
+            sums[r][i] += data[i];
+            ASSERT_EQ(sums[r][i], outs[r]->buffer().as<float *>()[i]);
+        }
+    };
+
+    // the order of the requests changes from step to step
+    for (size_t step = 0; step < 4; step++) {
+        for (size_t n = 0; n < numRequests; n++)
+            ASSERT_NO_FATAL_FAILURE(infer((n * 7 + step * 13) % numRequests, step));
+    }
+
+    for (size_t r = 0; r < numRequests; r++) {
+        auto state = requests[r].QueryState()[0].GetLastState();
+        ASSERT_EQ(10, state->size());
+        for (size_t i = 0; i < 10; i++)
+            ASSERT_EQ(sums[r][i], state->cbuffer().as<const float *>()[i]);
+    }
+
+    // reset of a request doesn't touch the sessions of other requests
+    requests[5].QueryState()[0].Reset();
+    std::fill(sums[5].begin(), sums[5].end(), 0.f);
+    ASSERT_NO_FATAL_FAILURE(infer(5, 0));
+    ASSERT_NO_FATAL_FAILURE(infer(6, 0));
+
+    // the state of the network resets all requests
+    auto networkStates = execNetwork->QueryState();
+    ASSERT_EQ(1, networkStates.size());
+    networkStates[0]->Reset();
+    for (size_t r = 0; r < numRequests; r++) {
+        std::fill(sums[r].begin(), sums[r].end(), 0.f);
+        ASSERT_NO_FATAL_FAILURE(infer(r, 0));
+    }
+
+    // the state is bound to the graph memory, so an inference copies nothing in and out of it,
+    // only the "prev" output reads the state buffer itself and is copied out of it
+    auto graph = std::make_shared<MKLDNNGraphTestClass>();
+    graph->CreateGraph(net_reader.getNetwork());
+
+    MKLDNNPlugin::MKLDNNInferRequest request(net_reader.getNetwork().getInputsInfo(),
+                                             net_reader.getNetwork().getOutputsInfo());
+    request.SetGraph(graph);
+    request.SetMemoryStates(graph->CreateMemoryStates());
+    InferenceEngine::Blob::Ptr out;
+    request.GetBlob("out", out);
+    for (size_t n = 1; n <= 3; n++) {
+        InferenceEngine::Blob::Ptr src;
+        request.GetBlob("data", src);
+        float *data = src->buffer().as<float *>();
+        for (size_t i = 0; i < 10; i++)
+            data[i] = 1.f;
+        ASSERT_NO_THROW(request.Infer());
+        ASSERT_EQ(10 * sizeof(float), request.GetCopiedBytes());
+        for (size_t i = 0; i < 10; i++)
+            ASSERT_EQ(static_cast<float>(n), out->buffer().as<float *>()[i]);
+    }
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestParallelExecutionOfBranches) {
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="left1" type="Power" precision="FP32" id="1">
+            <data power="1" scale="2" shift="0"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="left2" type="Power" precision="FP32" id="2">
+            <data power="1" scale="1" shift="1"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="right1" type="Power" precision="FP32" id="3">
+            <data power="1" scale="3" shift="0"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="right2" type="Power" precision="FP32" id="4">
+            <data power="1" scale="1" shift="-1"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="sum" type="Eltwise" precision="FP32" id="5">
+            <data operation="sum"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+        <edge from-layer="1" from-port="1" to-layer="2" to-port="0"/>
+        <edge from-layer="0" from-port="0" to-layer="3" to-port="0"/>
+        <edge from-layer="3" from-port="1" to-layer="4" to-port="0"/>
+        <edge from-layer="2" from-port="1" to-layer="5" to-port="0"/>
+        <edge from-layer="4" from-port="1" to-layer="5" to-port="1"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    MKLDNNGraphTestClass graph;
+    graph.setProperty({{InferenceEngine::PluginConfigParams::KEY_CPU_PARALLEL_BRANCHES,
+                        InferenceEngine::PluginConfigParams::YES}});
+    graph.CreateGraph(net_reader.getNetwork());
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    ASSERT_NE(0, graph.getParallelLevelsCount());
+#endif
+
+    InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(
+            {InferenceEngine::Precision::FP32, {1, 3, 4, 4}, InferenceEngine::NCHW});
+    src->allocate();
+    float *data = src->buffer().as<float *>();
+    for (size_t i = 0; i < src->size(); i++)
+        data[i] = static_cast<float>(i);
+
+    InferenceEngine::BlobMap srcs;
+    srcs["data"] = src;
+
+    InferenceEngine::OutputsDataMap out = net_reader.getNetwork().getOutputsInfo();
+    InferenceEngine::BlobMap outputBlobs;
+    InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(
+            out.begin()->second->getTensorDesc());
+    output->allocate();
+    outputBlobs[out.begin()->first] = output;
+
+    // the branches must not overwrite memory of each other on repeated executions
+    for (int iter = 0; iter < 10; iter++) {
+        graph.Infer(srcs, outputBlobs);
+        const float *dst = output->buffer().as<float *>();
+        for (size_t i = 0; i < output->size(); i++)
+            ASSERT_EQ(5.f * i, dst[i]);
+    }
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestResnetPart) {
+    std::string modelB = R"V0G0N(
+<net name="ResNet-152" version="2" batch="1">
+    <layers>
+        <layer name="input" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>224</dim>
+                    <dim>224</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="conv1" type="Convolution" precision="FP32" id="1">
+            <convolution_data stride-x="2" stride-y="2" pad-x="3" pad-y="3" kernel-x="7" kernel-y="7" output="64" group="1"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>224</dim>
+                    <dim>224</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>64</dim>
+                    <dim>112</dim>
+                    <dim>112</dim>
+                </port>
+            </output>
+            <weights offset="0" size="37632"/>
+            <biases offset="37632" size="256"/>
+        </layer>
+        <layer name="conv1_relu" type="ReLU" precision="FP32" id="4">
+            <input>
+                <port id="7">
+                    <dim>1</dim>
+                    <dim>64</dim>
+                    <dim>112</dim>
+                    <dim>112</dim>
+                </port>
+            </input>
+            <output>
+                <port id="8">
+                    <dim>1</dim>
+                    <dim>64</dim>
+                    <dim>112</dim>
+                    <dim>112</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="pool1" type="Pooling" precision="FP32" id="5">
+            <pooling_data kernel-x="3" kernel-y="3" pad-x="0" pad-y="0" stride-x="2" stride-y="2" rounding-type="ceil" pool-method="max"/>
+            <input>
+                <port id="9">
+                    <dim>1</dim>
+                    <dim>64</dim>
+                    <dim>112</dim>
+                    <dim>112</dim>
+                </port>
+            </input>
+            <output>
+                <port id="10">
+                    <dim>1</dim>
+                    <dim>64</dim>
+                    <dim>56</dim>
+                    <dim>56</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="res2a_branch2a" type="Convolution" precision="FP32" id="9">
+            <convolution_data stride-x="1" stride-y="1" pad-x="0" pad-y="0" kernel-x="1" kernel-y="1" output="64" group="1"/>
+            <input>
+                <port id="17">
+                    <dim>1</dim>
+                    <dim>64</dim>
+                    <dim>56</dim>
+                    <dim>56</dim>
+                </port>
+            </input>
+            <output>
+                <port id="18">
+                    <dim>1</dim>
+                    <dim>64</dim>
+                    <dim>56</dim>
+                    <dim>56</dim>
+                </port>
+            </output>
+            <weights offset="37888" size="16384"/>
+            <biases offset="54272" size="256"/>
+        </layer>
+        <layer name="res2a_branch2a_relu" type="ReLU" precision="FP32" id="12">
+            <input>
+                <port id="23">
+                    <dim>1</dim>
+                    <dim>64</dim>
+                    <dim>56</dim>
+                    <dim>56</dim>
+                </port>
+            </input>
+            <output>
+                <port id="24">
+                    <dim>1</dim>
+                    <dim>64</dim>
+                    <dim>56</dim>
+                    <dim>56</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="res2a_branch2b" type="Convolution" precision="FP32" id="13">
+            <convolution_data stride-x="1" stride-y="1" pad-x="1" pad-y="1" kernel-x="3" kernel-y="3" output="64" group="1"/>
+            <input>
+                <port id="25">
+                    <dim>1</dim>
+                    <dim>64</dim>
+                    <dim>56</dim>
+                    <dim>56</dim>
+                </port>
+            </input>
+            <output>
+                <port id="26">
+                    <dim>1</dim>
+                    <dim>64</dim>
+                    <dim>56</dim>
+                    <dim>56</dim>
+                </port>
+            </output>
+            <weights offset="54528" size="147456"/>
+            <biases offset="201984" size="256"/>
+        </layer>
+        <layer name="res2a_branch2b_relu" type="ReLU" precision="FP32" id="16">
+            <input>
+                <port id="31">
+                    <dim>1</dim>
+                    <dim>64</dim>
+                    <dim>56</dim>
+                    <dim>56</dim>
+                </port>
+            </input>
+            <output>
+                <port id="32">
+                    <dim>1</dim>
+                    <dim>64</dim>
+                    <dim>56</dim>
+                    <dim>56</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="res2a_branch2c" type="Convolution" precision="FP32" id="17">
+            <convolution_data stride-x="1" stride-y="1" pad-x="0" pad-y="0" kernel-x="1" kernel-y="1" output="256" group="1"/>
+            <input>
+                <port id="33">
+                    <dim>1</dim>
+                    <dim>64</dim>
+                    <dim>56</dim>
+                    <dim>56</dim>
+                </port>
+            </input>
+            <output>
+                <port id="34">
+                    <dim>1</dim>
+                    <dim>256</dim>
+                    <dim>56</dim>
+                    <dim>56</dim>
+                </port>
+            </output>
+            <weights offset="202240" size="65536"/>
+            <biases offset="267776" size="1024"/>
+        </layer>
+        <layer name="res2a_branch1" type="Convolution" precision="FP32" id="6">
+            <convolution_data stride-x="1" stride-y="1" pad-x="0" pad-y="0" kernel-x="1" kernel-y="1" output="256" group="1"/>
+            <input>
+                <port id="11">
+                    <dim>1</dim>
+                    <dim>64</dim>
+                    <dim>56</dim>
+                    <dim>56</dim>
+                </port>
+            </input>
+            <output>
+                <port id="12">
+                    <dim>1</dim>
+                    <dim>256</dim>
+                    <dim>56</dim>
+                    <dim>56</dim>
+                </port>
+            </output>
+            <weights offset="268800" size="65536"/>
+            <biases offset="334336" size="1024"/>
+        </layer>
+        <layer name="res2a" type="Eltwise" precision="FP32" id="20">
+            <elementwise_data operation="sum"/>
+            <input>
+                <port id="39">
+                    <dim>1</dim>
+                    <dim>256</dim>
+                    <dim>56</dim>
+                    <dim>56</dim>
+                </port>
+                <port id="40">
+                    <dim>1</dim>
+                    <dim>256</dim>
+                    <dim>56</dim>
+                    <dim>56</dim>
+                </port>
+            </input>
+            <output>
+                <port id="41">
+                    <dim>1</dim>
+                    <dim>256</dim>
                     <dim>56</dim>
                     <dim>56</dim>
                 </port>
@@ -2415,6 +3295,126 @@ TEST_F(MKLDNNGraphStructureTests, TestLoadTopologyWithConstLayer) {
     ASSERT_EQ(InferenceEngine::OK, sts) << resp.msg;
 }
 
+TEST_F(MKLDNNGraphStructureTests, TestConstantsAreSharedBetweenStreams) {
+    std::string model = R"V0G0N(
+<net batch="1" name="model" version="2">
+	<layers>
+		<layer id="0" name="data" precision="FP32" type="Input">
+			<output>
+				<port id="0">
+					<dim>1</dim>
+					<dim>3</dim>
+					<dim>20</dim>
+					<dim>20</dim>
+				</port>
+			</output>
+		</layer>
+		<layer id="1" name="data1" precision="FP32" type="Const">
+			<output>
+				<port id="0">
+					<dim>1</dim>
+					<dim>3</dim>
+					<dim>20</dim>
+					<dim>20</dim>
+				</port>
+			</output>
+			<blobs>
+				<custom offset="0" size="4800"/>
+			</blobs>
+		</layer>
+		<layer id="2" name="sum" precision="FP32" type="Eltwise">
+			<elementwise_data operation="sum"/>
+			<input>
+				<port id="0">
+					<dim>1</dim>
+					<dim>3</dim>
+					<dim>20</dim>
+					<dim>20</dim>
+				</port>
+				<port id="1">
+					<dim>1</dim>
+					<dim>3</dim>
+					<dim>20</dim>
+					<dim>20</dim>
+				</port>
+			</input>
+			<output>
+				<port id="2">
+					<dim>1</dim>
+					<dim>3</dim>
+					<dim>20</dim>
+					<dim>20</dim>
+				</port>
+			</output>
+		</layer>
+	</layers>
+	<edges>
+		<edge from-layer="0" from-port="0" to-layer="2" to-port="0"/>
+		<edge from-layer="1" from-port="0" to-layer="2" to-port="1"/>
+	</edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>({ InferenceEngine::Precision::U8, {4800}, InferenceEngine::C });
+    weights->allocate();
+    fill_data((float *) weights->buffer(), weights->size() / sizeof(float));
+    InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
+
+    net_reader.SetWeights(weights_ptr);
+
+    MKLDNNPlugin::Config cfg;
+    cfg.throughputStreams = 2;
+    MKLDNNPlugin::MKLDNNExecNetwork::Ptr execNetwork(new MKLDNNPlugin::MKLDNNExecNetwork(net_reader.getNetwork(), cfg, {}));
+    execNetwork->setNetworkInputs(net_reader.getNetwork().getInputsInfo());
+    execNetwork->setNetworkOutputs(net_reader.getNetwork().getOutputsInfo());
+
+    InferenceEngine::Parameter sharedSize, streamSize;
+    ASSERT_NO_THROW(execNetwork->GetMetric(METRIC_KEY(CPU_SHARED_CONSTANTS_MEMORY_SIZE), sharedSize, nullptr));
+    ASSERT_NO_THROW(execNetwork->GetMetric(METRIC_KEY(CPU_STREAM_MEMORY_SIZE), streamSize, nullptr));
+    // one copy of the constant per socket, not per stream
+    const uint64_t constSize = 4800;
+    const uint64_t maxCopies = std::min(2, MKLDNNPlugin::cpu::getNumberOfCPUSockets());
+    ASSERT_LT(0u, sharedSize.as<uint64_t>());
+    ASSERT_EQ(0u, sharedSize.as<uint64_t>() % constSize);
+    ASSERT_GE(maxCopies * constSize, sharedSize.as<uint64_t>());
+    ASSERT_LT(0u, streamSize.as<uint64_t>());
+
+    InferenceEngine::TensorDesc desc(InferenceEngine::Precision::FP32, {1, 3, 20, 20}, InferenceEngine::NCHW);
+    InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(desc);
+    src->allocate();
+    fill_data(src->buffer(), src->size());
+
+    InferenceEngine::TBlob<float> ref(desc);
+    ref.allocate();
+    for (size_t i = 0; i < ref.size(); i++)
+        ref.data()[i] = src->buffer().as<float *>()[i] + reinterpret_cast<float *>(weights_ptr->buffer().as<uint8_t *>())[i];
+
+    // every stream should see the same constant data
+    std::vector<InferenceEngine::IInferRequest::Ptr> requests(4);
+    std::vector<InferenceEngine::TBlob<float>::Ptr> outputs(requests.size());
+    InferenceEngine::ResponseDesc resp;
+    for (size_t r = 0; r < requests.size(); r++) {
+        execNetwork->CreateInferRequest(requests[r]);
+
+        InferenceEngine::StatusCode sts = requests[r]->SetBlob("data", src, &resp);
+        ASSERT_EQ(InferenceEngine::OK, sts) << resp.msg;
+
+        outputs[r] = InferenceEngine::make_shared_blob<float>(desc);
+        outputs[r]->allocate();
+        sts = requests[r]->SetBlob("sum", outputs[r], &resp);
+        ASSERT_EQ(InferenceEngine::OK, sts) << resp.msg;
+    }
+    for (auto &request : requests)
+        ASSERT_EQ(InferenceEngine::OK, request->StartAsync(&resp)) << resp.msg;
+    for (size_t r = 0; r < requests.size(); r++) {
+        ASSERT_EQ(InferenceEngine::OK, requests[r]->Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY, &resp)) << resp.msg;
+        compare(*outputs[r], ref);
+    }
+}
+
 TEST_F(MKLDNNGraphStructureTests, TestLoadTopologyWithEltwiseBeforeConcat) {
     std::string model = R"V0G0N(
 <net batch="1" name="model" version="2">
@@ -184,6 +184,10 @@ public:
         return graphNodes;
     }
 
+    size_t getParallelLevelsCount() const {
+        return parallelLevels.size();
+    }
+
     void CreateGraph(InferenceEngine::ICNNNetwork &network, const MKLDNNPlugin::MKLDNNExtensionManager::Ptr& extMgr) {
         MKLDNNGraph::CreateGraph(network, extMgr);
     }
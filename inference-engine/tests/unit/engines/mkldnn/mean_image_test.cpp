@@ -0,0 +1,106 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include "mkldnn_plugin/mean_image.h"
+
+#include <random>
+
+using namespace ::testing;
+using namespace InferenceEngine;
+using namespace MKLDNNPlugin;
+
+struct mean_image_test_params {
+    Layout layout;
+    MeanVariant variant;
+};
+
+class MKLDNNMeanImageTests : public TestWithParam<mean_image_test_params> {
+protected:
+    const SizeVector dims = {2, 3, 5, 7};
+
+    MeanImage createMean(MeanVariant variant) {
+        InputInfo::Ptr info = std::make_shared<InputInfo>();
+        info->setInputData(std::make_shared<Data>("in", TensorDesc(Precision::FP32, dims, NCHW)));
+
+        PreProcessInfo &pp = info->getPreProcess();
+        pp.init(dims[1]);
+        for (size_t c = 0; c < dims[1]; c++) {
+            if (variant == MEAN_VALUE) {
+                pp[c]->meanValue = 10.5f * (c + 1);
+            } else {
+                Blob::Ptr meanData = make_shared_blob<float>({Precision::FP32, {dims[2], dims[3]}, HW});
+                meanData->allocate();
+                float *data = meanData->buffer().as<float *>();
+                for (size_t i = 0; i < meanData->size(); i++)
+                    data[i] = static_cast<float>(c * 100 + i) / 4;
+                pp.setMeanImageForChannel(meanData, c);
+            }
+        }
+        pp.setVariant(variant);
+
+        MeanImage mean;
+        mean.Load(MKLDNNDims(dims), info);
+        return mean;
+    }
+
+    template <typename T>
+    void compareWithReference(MeanImage &mean, Layout layout) {
+        std::vector<T> src(2*3*5*7);
+        std::mt19937 rng(42);
+        std::uniform_int_distribution<int> dist(std::numeric_limits<T>::min(), std::numeric_limits<T>::max());
+        for (auto &v : src) v = static_cast<T>(dist(rng));
+
+        // reference is the former three-pass flow: convert, copy, subtract
+        std::vector<float> ref(src.begin(), src.end());
+        mean.Subtract(MKLDNNDims(dims), ref.data(), layout);
+
+        std::vector<float> dst(src.size(), -1.f);
+        mean.ConvertAndSubtract(MKLDNNDims(dims), src.data(), dst.data(), layout);
+
+        ASSERT_EQ(ref, dst);
+    }
+};
+
+TEST_P(MKLDNNMeanImageTests, ConvertAndSubtractMatchesSubtractOnConvertedData) {
+    auto p = GetParam();
+    MeanImage mean = createMean(p.variant);
+
+    compareWithReference<uint8_t>(mean, p.layout);
+    compareWithReference<int16_t>(mean, p.layout);
+    compareWithReference<uint16_t>(mean, p.layout);
+}
+
+TEST_P(MKLDNNMeanImageTests, ConvertAndSubtractConvertsOnlyWithoutMean) {
+    auto p = GetParam();
+    MeanImage noMean;
+
+    compareWithReference<uint8_t>(noMean, p.layout);
+    compareWithReference<uint16_t>(noMean, p.layout);
+}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsMeanImage, MKLDNNMeanImageTests,
+        ::testing::Values(
+                mean_image_test_params{NCHW, MEAN_VALUE},
+                mean_image_test_params{NHWC, MEAN_VALUE},
+                mean_image_test_params{NCHW, MEAN_IMAGE}));
+
+TEST(MKLDNNMeanImageConvertTests, ConvertAndSubtractConvertsInputsOfAnyRankWithoutMean) {
+    MeanImage noMean;
+    const std::vector<std::pair<SizeVector, Layout>> shapes = {
+        {{2, 5}, NC}, {{3, 4, 5}, CHW}, {{1, 2, 3, 4, 5}, NCDHW}, {{2, 3, 5, 7}, BLOCKED}
+    };
+
+    for (auto &shape : shapes) {
+        MKLDNNDims dims(shape.first);
+        std::vector<uint16_t> src(dims.size());
+        for (size_t i = 0; i < src.size(); i++)
+            src[i] = static_cast<uint16_t>(65535 - i * 7);
+
+        std::vector<float> dst(src.size(), -1.f);
+        ASSERT_NO_THROW(noMean.ConvertAndSubtract(dims, src.data(), dst.data(), shape.second));
+        ASSERT_EQ(std::vector<float>(src.begin(), src.end()), dst);
+    }
+}
@@ -0,0 +1,98 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include "mkldnn_plugin/perf_trace.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace ::testing;
+using namespace MKLDNNPlugin;
+
+TEST(MKLDNNPerfTraceTests, RingKeepsLatestEvents) {
+    PerfEventsRing ring(5);
+    ASSERT_EQ(8, ring.capacity());
+
+    for (uint64_t i = 0; i < 20; i++)
+        ring.push({i, i + 1, 0, 0});
+
+    std::vector<PerfEvent> events;
+    ring.snapshot(events);
+    ASSERT_EQ(8, events.size());
+    for (size_t i = 0; i < events.size(); i++)
+        ASSERT_EQ(12 + i, events[i].start);
+}
+
+TEST(MKLDNNPerfTraceTests, SnapshotWhileWritingReturnsConsistentEvents) {
+    PerfEventsRing ring(64);
+    std::atomic<bool> stop(false);
+    std::vector<std::thread> writers;
+    for (int t = 0; t < 2; t++) {
+        writers.emplace_back([&, t] {
+            for (uint64_t i = 0; !stop; i++)
+                ring.push({i, 2 * i + 1, t, static_cast<uint32_t>(t)});
+        });
+    }
+    for (int n = 0; n < 1000; n++) {
+        std::vector<PerfEvent> events;
+        ring.snapshot(events);
+        ASSERT_GE(ring.capacity(), events.size());
+        for (auto &event : events) {
+            ASSERT_EQ(2 * event.start + 1, event.finish);
+            ASSERT_EQ(event.stream, static_cast<int32_t>(event.thread));
+        }
+    }
+    stop = true;
+    for (auto &writer : writers)
+        writer.join();
+}
+
+TEST(MKLDNNPerfTraceTests, CounterRecordsEventsOnlyWhenEnabled) {
+    PerfCount counter;
+    ASSERT_EQ(nullptr, counter.trace());
+    { PerfHelper helper(counter); }
+
+    counter.enableTrace(3, 16);
+    for (int i = 0; i < 4; i++) {
+        PerfHelper helper(counter);
+    }
+
+    std::vector<PerfEvent> events;
+    counter.trace()->snapshot(events);
+    ASSERT_EQ(4, events.size());
+    for (size_t i = 0; i < events.size(); i++) {
+        ASSERT_EQ(3, events[i].stream);
+        ASSERT_LE(events[i].start, events[i].finish);
+        if (i > 0)
+            ASSERT_LE(events[i - 1].finish, events[i].start);
+    }
+}
+
+TEST(MKLDNNPerfTraceTests, PercentilesMergeStreams) {
+    std::vector<PerfTraceNode> nodes(2);
+    nodes[0].name = nodes[1].name = "conv";
+    for (uint64_t i = 1; i <= 100; i++)
+        nodes[i % 2].events.push_back({1000, 1000 + i, static_cast<int32_t>(i % 2), 0});
+
+    auto percentiles = PerfTracePercentiles(nodes, {50.f, 90.f, 99.f, 100.f});
+    ASSERT_EQ(1, percentiles.size());
+    ASSERT_EQ((std::vector<uint64_t>{50, 90, 99, 100}), percentiles["conv"]);
+}
+
+TEST(MKLDNNPerfTraceTests, ChromeJsonHasEventPerExecution) {
+    std::vector<PerfTraceNode> nodes(1);
+    nodes[0].name = "conv\"1\"";
+    nodes[0].type = "Convolution";
+    nodes[0].execType = "jit_avx2_FP32";
+    nodes[0].events.push_back({5000, 6500, 0, 1});
+    nodes[0].events.push_back({7000, 7042, 1, 2});
+
+    std::string json = PerfTraceToChromeJson(nodes);
+    ASSERT_NE(std::string::npos, json.find("\"name\":\"conv\\\"1\\\"\""));
+    ASSERT_NE(std::string::npos, json.find("\"ph\":\"X\",\"pid\":0,\"tid\":1,\"ts\":0.000,\"dur\":1.500"));
+    ASSERT_NE(std::string::npos, json.find("\"ph\":\"X\",\"pid\":1,\"tid\":2,\"ts\":2.000,\"dur\":0.042"));
+    ASSERT_NE(std::string::npos, json.find("\"args\":{\"name\":\"stream 1\"}"));
+}
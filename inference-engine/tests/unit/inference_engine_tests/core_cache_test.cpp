@@ -0,0 +1,370 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+# include <direct.h>
+# define makeDir(path) _mkdir(path)
+# define removeDir(path) _rmdir(path)
+#else
+# include <sys/stat.h>
+# include <unistd.h>
+# define makeDir(path) mkdir(path, 0755)
+# define removeDir(path) rmdir(path)
+#endif
+
+#include "tests_common.hpp"
+#include "details/ie_so_loader.h"
+#include "ie_core.hpp"
+#include "ie_plugin_config.hpp"
+#include "cpp/ie_cnn_net_reader.h"
+#include "mock_inference_engine.hpp"
+#include "mock_iexecutable_network.hpp"
+
+using namespace ::testing;
+using namespace std;
+using namespace InferenceEngine;
+using namespace InferenceEngine::details;
+
+// extension which is identified by its description and layer types only
+class CacheTestExtension : public IExtension {
+public:
+    explicit CacheTestExtension(const char * description) : version({{2, 1}, "test", description}) {}
+
+    void SetLogCallback(IErrorListener &) noexcept override {}
+    void Unload() noexcept override {}
+    void Release() noexcept override {}
+
+    void GetVersion(const Version *& versionInfo) const noexcept override {
+        versionInfo = &version;
+    }
+
+    StatusCode getPrimitiveTypes(char **& types, unsigned int & size, ResponseDesc *) noexcept override {
+        size = 1;
+        types = new char *[size];
+        types[0] = new char[sizeof("CustomLayer")];
+        std::copy_n("CustomLayer", sizeof("CustomLayer"), types[0]);
+        return OK;
+    }
+
+    StatusCode getFactoryFor(ILayerImplFactory *&, const CNNLayer *, ResponseDesc *) noexcept override {
+        return NOT_FOUND;
+    }
+
+private:
+    Version version;
+};
+
+class CoreCacheTests : public TestsCommon {
+protected:
+    std::string _model = R"V0G0N(
+<net name="Power_Only" version="3" precision="FP32" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="power" type="Power" precision="FP32" id="1">
+            <data scale="0.75" shift="0.35" power="0.5"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+    </edges>
+</net>
+)V0G0N";
+
+    const std::string cacheDir = "core_cache_test_dir";
+    const std::string pluginsXml = "core_cache_test_plugins.xml";
+    const std::string compiledContent = "compiled Power_Only network";
+
+    // the mock plugin forwards to this engine, so it must outlive the core
+    MockInferenceEngine engine;
+    Version version = {{2, 1}, "mock", "mock plugin"};
+    unique_ptr<SharedObjectLoader> sharedObjectLoader;
+    unique_ptr<Core> core;
+    CNNNetwork network;
+    std::string lastExportPath;
+
+    void SetUp() override {
+        TestsCommon::SetUp();
+
+        std::ofstream(pluginsXml) << "<ie><plugins></plugins></ie>";
+        makeDir(cacheDir.c_str());
+
+        CNNNetReader reader;
+        ASSERT_NO_THROW(reader.ReadNetwork(_model.data(), _model.length()));
+        network = reader.getNetwork();
+
+        sharedObjectLoader.reset(new SharedObjectLoader(get_mock_engine_name().c_str()));
+        auto injectProxyEngine = reinterpret_cast<void (*)(IInferencePlugin *)>(
+            sharedObjectLoader->get_symbol("InjectProxyEngine"));
+        injectProxyEngine(&engine);
+
+        EXPECT_CALL(engine, GetVersion(_)).WillRepeatedly(SetArgReferee<0>(&version));
+        EXPECT_CALL(engine, Release()).Times(AnyNumber());
+        EXPECT_CALL(engine, AddExtension(_, _)).WillRepeatedly(Return(OK));
+
+        core.reset(new Core(pluginsXml));
+        core->RegisterPlugin(std::string("mock_engine") + IE_BUILD_POSTFIX, "MOCK");
+    }
+
+    void TearDown() override {
+        core.reset();
+        sharedObjectLoader.reset();
+
+        std::remove(entryPath().c_str());
+        for (auto && path : entryPaths) {
+            std::remove(path.c_str());
+        }
+        std::remove(pluginsXml.c_str());
+        removeDir(cacheDir.c_str());
+    }
+
+    // path of the cache entry: the plugin exports into a temporary file which is renamed then
+    std::string entryPath() const {
+        return lastExportPath.substr(0, lastExportPath.find(".tmp"));
+    }
+
+    std::string readEntry() const {
+        std::ifstream entry(entryPath());
+        return std::string(std::istreambuf_iterator<char>(entry), std::istreambuf_iterator<char>());
+    }
+
+    IExecutableNetwork::Ptr makeExecutableNetwork(StatusCode exportStatus) {
+        auto exeNetwork = std::make_shared<NiceMock<MockIExecutableNetwork>>();
+        ON_CALL(*exeNetwork, Export(_, _)).WillByDefault(
+            Invoke([this, exportStatus](const std::string & path, ResponseDesc *) {
+                lastExportPath = path;
+                if (exportStatus == OK) {
+                    std::ofstream(path) << compiledContent;
+                }
+                return exportStatus;
+            }));
+        return exeNetwork;
+    }
+
+    void expectLoadNetwork(int times, StatusCode exportStatus = OK) {
+        EXPECT_CALL(engine, LoadNetwork(_, _, _, _)).Times(times).WillRepeatedly(
+            Invoke([this, exportStatus](IExecutableNetwork::Ptr & ret, ICNNNetwork &,
+                                        const std::map<std::string, std::string> &, ResponseDesc *) {
+                ret = makeExecutableNetwork(exportStatus);
+                return OK;
+            }));
+    }
+
+    // the plugin accepts only entries it has exported itself
+    void expectImportNetwork(int times) {
+        EXPECT_CALL(engine, ImportNetwork(_, _, _, _)).Times(times).WillRepeatedly(
+            Invoke([this](IExecutableNetwork::Ptr & ret, const std::string & path,
+                          const std::map<std::string, std::string> &, ResponseDesc *) {
+                std::ifstream entry(path);
+                std::string content((std::istreambuf_iterator<char>(entry)), std::istreambuf_iterator<char>());
+                if (content != compiledContent) {
+                    return NETWORK_NOT_READ;
+                }
+                ret = makeExecutableNetwork(OK);
+                return OK;
+            }));
+    }
+
+    void loadNetwork() {
+        loadNetwork(network);
+    }
+
+    void loadNetwork(CNNNetwork & net) {
+        ASSERT_NO_THROW(core->LoadNetwork(net, "MOCK", {{ CONFIG_KEY(CACHE_DIR), cacheDir }}));
+    }
+
+    // every entry is removed in the end, the tests below may create several of them
+    std::vector<std::string> entryPaths;
+
+    void rememberEntry() {
+        entryPaths.push_back(entryPath());
+    }
+
+    uint64_t cacheHits() {
+        return core->GetMetric("MOCK", METRIC_KEY(CACHE_HITS)).as<uint64_t>();
+    }
+
+    uint64_t cacheMisses() {
+        return core->GetMetric("MOCK", METRIC_KEY(CACHE_MISSES)).as<uint64_t>();
+    }
+};
+
+TEST_F(CoreCacheTests, cacheMissCompilesAndExportsNetwork) {
+    expectLoadNetwork(1);
+    expectImportNetwork(0);
+
+    loadNetwork();
+
+    ASSERT_EQ(0u, cacheHits());
+    ASSERT_EQ(1u, cacheMisses());
+    ASSERT_FALSE(lastExportPath.empty());
+    ASSERT_EQ(compiledContent, readEntry());
+}
+
+TEST_F(CoreCacheTests, cacheHitImportsNetwork) {
+    expectLoadNetwork(1);
+    expectImportNetwork(2);
+
+    loadNetwork();
+    loadNetwork();
+    loadNetwork();
+
+    ASSERT_EQ(2u, cacheHits());
+    ASSERT_EQ(1u, cacheMisses());
+}
+
+TEST_F(CoreCacheTests, corruptedEntryIsRecompiled) {
+    expectLoadNetwork(2);
+    expectImportNetwork(1);
+
+    loadNetwork();
+    std::ofstream(entryPath()) << "not a compiled network";
+    loadNetwork();
+
+    ASSERT_EQ(0u, cacheHits());
+    ASSERT_EQ(2u, cacheMisses());
+    ASSERT_EQ(compiledContent, readEntry());
+}
+
+TEST_F(CoreCacheTests, truncatedEntryIsRecompiled) {
+    expectLoadNetwork(2);
+    expectImportNetwork(2);
+
+    loadNetwork();
+    std::ofstream(entryPath()) << compiledContent.substr(0, compiledContent.size() / 2);
+    loadNetwork();
+    loadNetwork();
+
+    ASSERT_EQ(1u, cacheHits());
+    ASSERT_EQ(2u, cacheMisses());
+    ASSERT_EQ(compiledContent, readEntry());
+}
+
+TEST_F(CoreCacheTests, pluginWithoutExportIsNotCached) {
+    expectLoadNetwork(3, NOT_IMPLEMENTED);
+    expectImportNetwork(0);
+
+    loadNetwork();
+    loadNetwork();
+    loadNetwork();
+
+    // only the first load goes through the cache, then the device is known to be not exportable
+    ASSERT_EQ(0u, cacheHits());
+    ASSERT_EQ(1u, cacheMisses());
+    ASSERT_FALSE(lastExportPath.empty());
+    std::ifstream entry(entryPath());
+    ASSERT_FALSE(entry.good());
+}
+
+TEST_F(CoreCacheTests, concurrentLoadsCountEveryRequest) {
+    const int threadsNum = 4;
+    const int loadsPerThread = 8;
+
+    expectLoadNetwork(1);
+    expectImportNetwork(threadsNum * loadsPerThread);
+
+    loadNetwork();
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadsNum; t++) {
+        threads.emplace_back([&] {
+            for (int i = 0; i < loadsPerThread; i++) {
+                loadNetwork();
+            }
+        });
+    }
+    for (auto & thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_EQ(static_cast<uint64_t>(threadsNum * loadsPerThread), cacheHits());
+    ASSERT_EQ(1u, cacheMisses());
+}
+
+TEST_F(CoreCacheTests, sameModelReadAgainHitsCache) {
+    expectLoadNetwork(1);
+    expectImportNetwork(1);
+
+    loadNetwork();
+
+    CNNNetReader reader;
+    ASSERT_NO_THROW(reader.ReadNetwork(_model.data(), _model.length()));
+    CNNNetwork otherNetwork = reader.getNetwork();
+    loadNetwork(otherNetwork);
+
+    ASSERT_EQ(1u, cacheHits());
+    ASSERT_EQ(1u, cacheMisses());
+}
+
+TEST_F(CoreCacheTests, reshapedNetworkIsRecompiled) {
+    expectLoadNetwork(2);
+    expectImportNetwork(1);
+
+    loadNetwork();
+    rememberEntry();
+    network.setBatchSize(2);
+    loadNetwork();
+    ASSERT_NE(entryPaths.back(), entryPath());
+    rememberEntry();
+    loadNetwork();
+
+    ASSERT_EQ(1u, cacheHits());
+    ASSERT_EQ(2u, cacheMisses());
+}
+
+TEST_F(CoreCacheTests, addedExtensionChangesEntry) {
+    expectLoadNetwork(3);
+    expectImportNetwork(1);
+
+    loadNetwork();
+    rememberEntry();
+    core->AddExtension(std::make_shared<CacheTestExtension>("first"), "MOCK");
+    loadNetwork();
+    rememberEntry();
+    loadNetwork();
+    core->AddExtension(std::make_shared<CacheTestExtension>("second"), "MOCK");
+    loadNetwork();
+    rememberEntry();
+
+    ASSERT_EQ(1u, cacheHits());
+    ASSERT_EQ(3u, cacheMisses());
+    ASSERT_EQ(3u, std::set<std::string>(entryPaths.begin(), entryPaths.end()).size());
+}
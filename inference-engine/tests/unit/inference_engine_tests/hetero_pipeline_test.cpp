@@ -0,0 +1,284 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <inference_engine.hpp>
+#include <cpp_interfaces/base/ie_executable_network_base.hpp>
+#include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
+#include <hetero/hetero_pipeline.hpp>
+#include <hetero/hetero_infer_request.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <string>
+#include <algorithm>
+
+using namespace ::testing;
+using namespace std;
+using namespace InferenceEngine;
+using namespace HeteroPlugin;
+
+namespace {
+
+const SizeVector blobDims = {1, 4};
+
+TensorDesc blobDesc() {
+    return TensorDesc(Precision::FP32, blobDims, Layout::NC);
+}
+
+Blob::Ptr makeBlob(float value) {
+    auto blob = make_shared_blob<float>(blobDesc());
+    blob->allocate();
+    std::fill_n(blob->buffer().as<float *>(), blob->size(), value);
+    return blob;
+}
+
+float valueOf(const Blob::Ptr &blob) {
+    return blob->cbuffer().as<const float *>()[0];
+}
+
+// tracks how many requests of a stage and of all stages run at the same time
+struct Concurrency {
+    std::atomic<int> running{0};
+    std::atomic<int> maxRunning{0};
+
+    void enter() {
+        int now = ++running;
+        int prev = maxRunning.load();
+        while (prev < now && !maxRunning.compare_exchange_weak(prev, now)) {}
+    }
+
+    void leave() {
+        --running;
+    }
+};
+
+/**
+ * @brief A subgraph computing out = in * scale + shift for every output, it fails for input 13
+ */
+class StageNetwork : public ExecutableNetworkThreadSafeDefault {
+public:
+    StageNetwork(const vector<string> &inputs, const vector<string> &outputs, float scale, float shift,
+                 Concurrency &total) : _scale(scale), _shift(shift), _total(total) {
+        for (auto &&name : inputs) {
+            InputInfo::Ptr info(new InputInfo());
+            info->setInputData(std::make_shared<Data>(name, blobDesc()));
+            _networkInputs[name] = info;
+        }
+        for (auto &&name : outputs) {
+            _networkOutputs[name] = std::make_shared<Data>(name, blobDesc());
+        }
+    }
+
+    class Request : public InferRequestInternal {
+    public:
+        Request(const InputsDataMap &inputs, const OutputsDataMap &outputs, StageNetwork &network)
+                : InferRequestInternal(inputs, outputs), _network(network) {
+            for (auto &&input : _networkInputs) {
+                _inputs[input.first] = makeBlob(0.f);
+            }
+            for (auto &&output : _networkOutputs) {
+                _outputs[output.first] = makeBlob(0.f);
+            }
+        }
+
+        void InferImpl() override {
+            _network._self.enter();
+            _network._total.enter();
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            float in = 0.f;
+            for (auto &&input : _inputs) {
+                in += valueOf(input.second);
+            }
+            _network._self.leave();
+            _network._total.leave();
+            if (in == 13.f) {
+                THROW_IE_EXCEPTION << "unlucky input";
+            }
+            for (auto &&output : _outputs) {
+                std::fill_n(output.second->buffer().as<float *>(), output.second->size(),
+                            in * _network._scale + _network._shift);
+            }
+        }
+
+        void GetPerformanceCounts(std::map<std::string, InferenceEngineProfileInfo> &perfMap) const override {
+            perfMap["layer"] = InferenceEngineProfileInfo();
+        }
+
+    private:
+        StageNetwork &_network;
+    };
+
+    InferRequestInternal::Ptr CreateInferRequestImpl(InputsDataMap networkInputs,
+                                                     OutputsDataMap networkOutputs) override {
+        _requestsCreated++;
+        return std::make_shared<Request>(networkInputs, networkOutputs, *this);
+    }
+
+    int _requestsCreated = 0;
+    Concurrency _self;
+
+private:
+    float _scale;
+    float _shift;
+    Concurrency &_total;
+};
+
+}  // namespace
+
+class HeteroPipelineTests : public ::testing::Test {
+protected:
+    Concurrency total;
+    vector<shared_ptr<StageNetwork>> stageNetworks;
+    vector<HeteroPipeline::StageDesc> stages;
+
+    void addStage(const vector<string> &inputs, const vector<string> &outputs, float scale, float shift) {
+        auto impl = std::make_shared<StageNetwork>(inputs, outputs, scale, shift, total);
+        stageNetworks.push_back(impl);
+        HeteroPipeline::StageDesc desc;
+        desc._network = std::make_shared<ExecutableNetwork>(make_executable_network(impl));
+        desc._iNames.insert(inputs.begin(), inputs.end());
+        desc._oNames.insert(outputs.begin(), outputs.end());
+        stages.push_back(desc);
+    }
+
+    // in -> (x + 1) -> mid -> (x * 2) -> out
+    HeteroPipeline::Ptr makeChain(bool perfCounts = false) {
+        addStage({"in"}, {"mid"}, 1.f, 1.f);
+        addStage({"mid"}, {"out"}, 2.f, 0.f);
+        return std::make_shared<HeteroPipeline>(stages, std::unordered_set<std::string>{"out"}, perfCounts);
+    }
+
+    HeteroPipeline::Job::Ptr makeJob(float input) {
+        auto job = std::make_shared<HeteroPipeline::Job>();
+        job->_blobs["in"] = makeBlob(input);
+        job->_blobs["out"] = makeBlob(-1.f);
+        return job;
+    }
+};
+
+TEST_F(HeteroPipelineTests, chainIsDoubleBuffered) {
+    auto pipeline = makeChain();
+    ASSERT_EQ(2, pipeline->slotsCount());
+    ASSERT_EQ(2, pipeline->stagesCount());
+    for (auto &&network : stageNetworks) {
+        ASSERT_EQ(2, network->_requestsCreated);
+    }
+}
+
+TEST_F(HeteroPipelineTests, slotsCoverDistanceBetweenProducerAndConsumer) {
+    addStage({"in"}, {"a", "b"}, 1.f, 0.f);
+    addStage({"a"}, {"c"}, 1.f, 0.f);
+    addStage({"b", "c"}, {"out"}, 1.f, 0.f);
+    auto pipeline = std::make_shared<HeteroPipeline>(stages, std::unordered_set<std::string>{"out"}, false);
+    ASSERT_EQ(3, pipeline->slotsCount());
+
+    auto job = makeJob(2.f);
+    pipeline->run(job);
+    ASSERT_FLOAT_EQ(4.f, valueOf(job->_blobs["out"]));
+}
+
+TEST_F(HeteroPipelineTests, computesAllQueuedJobs) {
+    auto pipeline = makeChain();
+    vector<HeteroPipeline::Job::Ptr> jobs;
+    for (int i = 0; i < 16; i++) {
+        jobs.push_back(makeJob(static_cast<float>(i % 8)));
+        pipeline->start(jobs.back());
+    }
+    for (int i = 0; i < 16; i++) {
+        ASSERT_EQ(StatusCode::OK, pipeline->wait(jobs[i], IInferRequest::WaitMode::RESULT_READY));
+        ASSERT_FLOAT_EQ((i % 8 + 1.f) * 2.f, valueOf(jobs[i]->_blobs["out"]));
+    }
+}
+
+TEST_F(HeteroPipelineTests, overlapsStagesOfConsecutiveJobs) {
+    auto pipeline = makeChain();
+    vector<HeteroPipeline::Job::Ptr> jobs;
+    for (int i = 0; i < 8; i++) {
+        jobs.push_back(makeJob(1.f));
+        pipeline->start(jobs.back());
+    }
+    for (auto &&job : jobs) {
+        ASSERT_EQ(StatusCode::OK, pipeline->wait(job, IInferRequest::WaitMode::RESULT_READY));
+    }
+    ASSERT_EQ(2, total.maxRunning);
+    for (auto &&network : stageNetworks) {
+        ASSERT_EQ(1, network->_self.maxRunning);
+    }
+}
+
+TEST_F(HeteroPipelineTests, callsOnDoneBeforeJobIsReported) {
+    auto pipeline = makeChain();
+    std::atomic<int> calls{0};
+    auto job = makeJob(3.f);
+    job->_onDone = [&](StatusCode sts) {
+        EXPECT_EQ(StatusCode::OK, sts);
+        calls++;
+    };
+    pipeline->start(job);
+    ASSERT_EQ(StatusCode::OK, pipeline->wait(job, IInferRequest::WaitMode::RESULT_READY));
+    ASSERT_EQ(1, calls);
+    ASSERT_FLOAT_EQ(8.f, valueOf(job->_blobs["out"]));
+}
+
+TEST_F(HeteroPipelineTests, failedStageDoesNotBlockNextJobs) {
+    auto pipeline = makeChain();
+    auto bad = makeJob(13.f);
+    auto good = makeJob(2.f);
+    pipeline->start(bad);
+    pipeline->start(good);
+    ASSERT_NE(StatusCode::OK, pipeline->wait(bad, IInferRequest::WaitMode::RESULT_READY));
+    ASSERT_EQ(StatusCode::OK, pipeline->wait(good, IInferRequest::WaitMode::RESULT_READY));
+    ASSERT_FLOAT_EQ(6.f, valueOf(good->_blobs["out"]));
+    ASSERT_FLOAT_EQ(-1.f, valueOf(bad->_blobs["out"]));
+
+    ASSERT_THROW(pipeline->run(makeJob(13.f)), details::InferenceEngineException);
+}
+
+TEST_F(HeteroPipelineTests, collectsPerformanceCountersOfAllStages) {
+    auto pipeline = makeChain(true);
+    auto job = makeJob(1.f);
+    pipeline->run(job);
+    ASSERT_EQ(2, job->_perfCounts.size());
+    ASSERT_EQ(1, job->_perfCounts.count("subgraph0: layer"));
+    ASSERT_EQ(1, job->_perfCounts.count("subgraph1: layer"));
+}
+
+TEST_F(HeteroPipelineTests, inferRequestsShareSubRequests) {
+    auto pipeline = makeChain();
+
+    InputsDataMap inputs;
+    InputInfo::Ptr info(new InputInfo());
+    info->setInputData(std::make_shared<Data>("in", blobDesc()));
+    inputs["in"] = info;
+    OutputsDataMap outputs;
+    outputs["out"] = std::make_shared<Data>("out", blobDesc());
+
+    vector<std::thread> threads;
+    std::atomic<int> failures{0};
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([&, t] {
+            HeteroInferRequest request(inputs, outputs, pipeline);
+            Blob::Ptr in, out;
+            request.GetBlob("in", in);
+            request.GetBlob("out", out);
+            for (int i = 0; i < 5; i++) {
+                std::fill_n(in->buffer().as<float *>(), in->size(), static_cast<float>(t + i));
+                request.Infer();
+                if (valueOf(out) != (t + i + 1.f) * 2.f) {
+                    failures++;
+                }
+            }
+        });
+    }
+    for (auto &&thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQ(0, failures);
+    for (auto &&network : stageNetworks) {
+        ASSERT_EQ(2, network->_requestsCreated);
+    }
+}
@@ -0,0 +1,94 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <ie_blob.h>
+#include <ie_blob_proxy.hpp>
+#include <mmap_allocator.hpp>
+
+using namespace ::testing;
+using namespace std;
+using namespace InferenceEngine;
+using namespace InferenceEngine::details;
+
+class MmapAllocatorTests: public ::testing::Test {
+protected:
+    const std::string FILE_NAME = "MmapAllocatorTests.bin";
+    std::vector<float> data;
+
+    virtual void TearDown() {
+        std::remove(FILE_NAME.c_str());
+    }
+
+    virtual void SetUp() {
+        for (size_t i = 0; i < 1024; i++)
+            data.push_back(static_cast<float>(i) * 0.5f);
+        std::ofstream ofs(FILE_NAME, std::ios::binary | std::ios::out);
+        ofs.write(reinterpret_cast<const char*>(data.data()), data.size() * sizeof(float));
+    }
+};
+
+TEST_F(MmapAllocatorTests, canMapWholeFile) {
+    IAllocator* allocator = new MmapAllocator(FILE_NAME);
+    const size_t size = data.size() * sizeof(float);
+    void* handle = allocator->alloc(size);
+    ASSERT_NE(nullptr, handle);
+    auto ptr = reinterpret_cast<float*>(allocator->lock(handle, LOCK_FOR_READ));
+    for (size_t i = 0; i < data.size(); i++)
+        ASSERT_EQ(data[i], ptr[i]);
+    allocator->unlock(handle);
+    ASSERT_TRUE(allocator->free(handle));
+    allocator->Release();
+}
+
+TEST_F(MmapAllocatorTests, cannotMapMoreThanFileSize) {
+    IAllocator* allocator = new MmapAllocator(FILE_NAME);
+    ASSERT_EQ(nullptr, allocator->alloc(data.size() * sizeof(float) + 1));
+    allocator->Release();
+}
+
+TEST_F(MmapAllocatorTests, cannotMapMissingFile) {
+    IAllocator* allocator = new MmapAllocator(FILE_NAME + ".missing");
+    ASSERT_EQ(nullptr, allocator->alloc(16));
+    allocator->Release();
+}
+
+TEST_F(MmapAllocatorTests, writesToMappedBlobDoNotReachFile) {
+    auto blob = readFileToBlob(FILE_NAME);
+    ASSERT_EQ(data.size() * sizeof(float), blob->size());
+    blob->buffer().as<float*>()[0] = -1.f;
+    ASSERT_EQ(-1.f, blob->buffer().as<float*>()[0]);
+
+    auto reread = readFileToBlob(FILE_NAME);
+    ASSERT_EQ(data[0], reread->cbuffer().as<const float*>()[0]);
+}
+
+TEST_F(MmapAllocatorTests, proxyOutlivesMappedBlob) {
+    const size_t offset = 16;
+    const size_t count = 8;
+    TBlob<float>::Ptr proxy;
+    {
+        auto blob = readFileToBlob(FILE_NAME);
+        proxy = make_shared<TBlobProxy<float>>(Precision::FP32, C, blob, offset * sizeof(float), SizeVector{count});
+    }
+    auto ptr = proxy->cbuffer().as<const float*>();
+    for (size_t i = 0; i < count; i++)
+        ASSERT_EQ(data[offset + i], ptr[i]);
+}
+
+TEST_F(MmapAllocatorTests, emptyFileGivesEmptyBlob) {
+    std::ofstream(FILE_NAME, std::ios::binary | std::ios::out | std::ios::trunc).close();
+    auto blob = readFileToBlob(FILE_NAME);
+    ASSERT_EQ(0, blob->size());
+}
+
+TEST_F(MmapAllocatorTests, throwsOnMissingFile) {
+    ASSERT_THROW(readFileToBlob(FILE_NAME + ".missing"), InferenceEngineException);
+}
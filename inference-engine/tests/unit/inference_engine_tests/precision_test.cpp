@@ -12,6 +12,7 @@ class PrecisionTests : public ::testing::Test {};
 
 TEST_F(PrecisionTests, ShowsCorrectPrecisionNames) {
     ASSERT_STREQ(Precision(Precision::FP16).name(),  "FP16" );
+    ASSERT_STREQ(Precision(Precision::BF16).name(),  "BF16" );
     ASSERT_STREQ(Precision(Precision::FP32).name(),  "FP32" );
     ASSERT_STREQ(Precision(Precision::I16).name() ,  "I16"  );
     ASSERT_STREQ(Precision(Precision::I32).name() ,  "I32"  );
@@ -27,6 +28,7 @@ TEST_F(PrecisionTests, ShowsCorrectPrecisionNames) {
 
 TEST_F(PrecisionTests, sizeIsCorrect) {
     ASSERT_EQ(Precision(Precision::FP16).size(), 2);
+    ASSERT_EQ(Precision(Precision::BF16).size(), 2);
     ASSERT_EQ(Precision(Precision::FP32).size(), 4);
     ASSERT_EQ(Precision(Precision::I32).size(), 4);
     ASSERT_EQ(Precision(Precision::I16).size(), 2);
@@ -41,6 +43,7 @@ TEST_F(PrecisionTests, sizeIsCorrect) {
 
 TEST_F(PrecisionTests, is_float) {
     ASSERT_TRUE(Precision(Precision::FP16).is_float());
+    ASSERT_TRUE(Precision(Precision::BF16).is_float());
     ASSERT_TRUE(Precision(Precision::FP32).is_float());
     ASSERT_FALSE(Precision(Precision::I32).is_float());
     ASSERT_FALSE(Precision(Precision::I16).is_float());
@@ -56,6 +59,7 @@ TEST_F(PrecisionTests, is_float) {
 
 TEST_F(PrecisionTests, constructFromSTR) {
     ASSERT_EQ(Precision(Precision::FP16), Precision::FromStr("FP16"));
+    ASSERT_EQ(Precision(Precision::BF16), Precision::FromStr("BF16"));
     ASSERT_EQ(Precision(Precision::FP32),  Precision::FromStr("FP32" ));
     ASSERT_EQ(Precision(Precision::I32),  Precision::FromStr("I32" ));
     ASSERT_EQ(Precision(Precision::I16),  Precision::FromStr("I16"  ));
@@ -0,0 +1,400 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifdef HAVE_SSE
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "cpu_detector.hpp"
+#include "ie_preprocess_gapi_kernels_sse42.hpp"
+#include "blob_transform_sse42.hpp"
+#ifdef HAVE_AVX2
+#include "ie_preprocess_gapi_kernels_avx2.hpp"
+#include "blob_transform_avx2.hpp"
+#endif
+#ifdef HAVE_AVX512
+#include "ie_preprocess_gapi_kernels_avx512.hpp"
+#include "blob_transform_avx512.hpp"
+#endif
+
+using namespace InferenceEngine;
+using namespace InferenceEngine::gapi;
+using namespace InferenceEngine::gapi::kernels;
+
+// AVX2 and AVX-512 kernels must give exactly the same results as the
+// SSE 4.2 ones they are dispatched instead of, so all checks below are
+// bit-exact comparisons against the SSE 4.2 tier.
+
+namespace {
+
+std::mt19937 rng(42);
+
+template<typename V>
+void fillRandom(V& v, int lo, int hi) {
+    std::uniform_int_distribution<int> d(lo, hi);
+    for (auto& e : v) e = static_cast<typename V::value_type>(d(rng));
+}
+
+void fillRandom(std::vector<float>& v, float lo, float hi) {
+    std::uniform_real_distribution<float> d(lo, hi);
+    for (auto& e : v) e = d(rng);
+}
+
+struct LinearU8Data {
+    int inW, outW;
+    std::vector<uint8_t> src0, src1, tmp;
+    std::vector<short> alpha, clone, mapsx, beta;
+
+    LinearU8Data(int inW_, int outW_, int chanNum) : inW(inW_), outW(outW_),
+            src0(4*chanNum*inW), src1(4*chanNum*inW), tmp(4*chanNum*inW + 64),
+            alpha(outW), clone(4*outW), mapsx(outW), beta(4) {
+        fillRandom(src0, 0, 255);
+        fillRandom(src1, 0, 255);
+        fillRandom(alpha, 0, SHRT_MAX);
+        fillRandom(beta, 0, SHRT_MAX);
+        for (int x = 0; x < outW; x++) {
+            mapsx[x] = static_cast<short>(std::min(inW - 2, static_cast<int>(static_cast<int64_t>(x) * inW / outW)));
+            for (int l = 0; l < 4; l++) {
+                clone[4*x + l] = alpha[x];
+            }
+        }
+    }
+};
+
+struct LinearF32Data {
+    int inW, outW;
+    std::vector<float> src0, src1, alpha, beta;
+    std::vector<int> mapsx;
+
+    LinearF32Data(int inW_, int outW_) : inW(inW_), outW(outW_),
+            src0(4*inW), src1(4*inW), alpha(outW), beta(4), mapsx(outW) {
+        fillRandom(src0, 0.f, 255.f);
+        fillRandom(src1, 0.f, 255.f);
+        fillRandom(alpha, 0.f, 1.f);
+        fillRandom(beta, 0.f, 1.f);
+        for (int x = 0; x < outW; x++) {
+            mapsx[x] = std::min(inW - 2, static_cast<int>(static_cast<int64_t>(x) * inW / outW));
+        }
+    }
+};
+
+using LinearU8Fn = decltype(&calcRowLinear_8U);
+using LinearU8C3Fn = decltype(&calcRowLinear_8UC3);
+using LinearF32Fn = decltype(&calcRowLinear_32F);
+using Merge32FC3Fn = decltype(&mergeRow_32FC3);
+using Split32FC3Fn = decltype(&splitRow_32FC3);
+using BlobSplitF32Fn = decltype(&blob_copy_4d_split_f32c3);
+
+std::vector<uint8_t> runLinearU8(LinearU8Fn fn, LinearU8Data& d, int lpi) {
+    std::vector<uint8_t> out(4*d.outW);
+    const uint8_t *src0[4], *src1[4];
+    uint8_t *dst[4];
+    for (int l = 0; l < 4; l++) {
+        src0[l] = &d.src0[l*d.inW];
+        src1[l] = &d.src1[l*d.inW];
+        dst[l]  = &out[l*d.outW];
+    }
+    fn(dst, src0, src1, d.alpha.data(), d.clone.data(), d.mapsx.data(), d.beta.data(), d.tmp.data(),
+       Size(d.inW, 100), Size(d.outW, 50), lpi);
+    out.resize(lpi*d.outW);
+    return out;
+}
+
+std::vector<uint8_t> runLinearU8C3(LinearU8C3Fn fn, LinearU8Data& d, int lpi) {
+    std::vector<uint8_t> out(3*4*d.outW);
+    const uint8_t *src0[4], *src1[4];
+    std::array<std::array<uint8_t*, 4>, 3> dst;
+    for (int l = 0; l < 4; l++) {
+        src0[l] = &d.src0[3*l*d.inW];
+        src1[l] = &d.src1[3*l*d.inW];
+        for (int c = 0; c < 3; c++) {
+            dst[c][l] = &out[(c*4 + l)*d.outW];
+        }
+    }
+    fn(dst, src0, src1, d.alpha.data(), d.clone.data(), d.mapsx.data(), d.beta.data(), d.tmp.data(),
+       Size(d.inW, 100), Size(d.outW, 50), lpi);
+    return out;
+}
+
+std::vector<float> runLinearF32(LinearF32Fn fn, LinearF32Data& d, int lpi) {
+    std::vector<float> out(4*d.outW);
+    const float *src0[4], *src1[4];
+    float *dst[4];
+    for (int l = 0; l < 4; l++) {
+        src0[l] = &d.src0[l*d.inW];
+        src1[l] = &d.src1[l*d.inW];
+        dst[l]  = &out[l*d.outW];
+    }
+    fn(dst, src0, src1, d.alpha.data(), d.mapsx.data(), d.beta.data(),
+       Size(d.inW, 100), Size(d.outW, 50), lpi);
+    out.resize(lpi*d.outW);
+    return out;
+}
+
+std::vector<uint8_t> runNV12(decltype(&calculate_nv12_to_rgb) fn, const std::vector<uint8_t>& y,
+                             const std::vector<uint8_t>& uv, int width) {
+    std::vector<uint8_t> out(2*3*width);
+    const uchar* srcY[2] = {&y[0], &y[width]};
+    uchar* dst[2] = {&out[0], &out[3*width]};
+    fn(srcY, uv.data(), dst, width);
+    return out;
+}
+
+std::vector<float> runBlobSplitF32(BlobSplitF32Fn fn, const std::vector<float>& src, int H, int W) {
+    std::vector<float> dst(3*H*W);
+    fn(src.data(), dst.data(), 3*H*W, 3*W, 3*H*W, W, H*W, 1, H, W);
+    return dst;
+}
+
+const int widths[] = {32, 33, 99, 300, 416, 1000, 1920};
+
+}  // namespace
+
+#ifdef HAVE_AVX2
+TEST(PreprocSIMDKernelsTests, avx2LinearU8IsBitExactWithSSE42) {
+    if (!with_cpu_x86_avx2()) GTEST_SKIP();
+    for (int inW : widths) for (int outW : widths) for (int lpi = 1; lpi <= 4; lpi++) {
+        LinearU8Data d(inW, outW, 1);
+        ASSERT_EQ(runLinearU8(calcRowLinear_8U, d, lpi), runLinearU8(kernels::avx::calcRowLinear_8U, d, lpi))
+            << inW << " -> " << outW << ", lpi=" << lpi;
+    }
+}
+
+TEST(PreprocSIMDKernelsTests, avx2LinearU8C3IsBitExactWithSSE42) {
+    if (!with_cpu_x86_avx2()) GTEST_SKIP();
+    for (int inW : widths) for (int outW : widths) for (int lpi = 1; lpi <= 4; lpi++) {
+        LinearU8Data d(inW, outW, 3);
+        ASSERT_EQ(runLinearU8C3(calcRowLinear_8UC3, d, lpi), runLinearU8C3(kernels::avx::calcRowLinear_8UC3, d, lpi))
+            << inW << " -> " << outW << ", lpi=" << lpi;
+    }
+}
+
+TEST(PreprocSIMDKernelsTests, avx2LinearF32IsBitExactWithSSE42) {
+    if (!with_cpu_x86_avx2()) GTEST_SKIP();
+    for (int inW : widths) for (int outW : widths) for (int lpi = 1; lpi <= 4; lpi++) {
+        LinearF32Data d(inW, outW);
+        ASSERT_EQ(runLinearF32(calcRowLinear_32F, d, lpi), runLinearF32(kernels::avx::calcRowLinear_32F, d, lpi))
+            << inW << " -> " << outW << ", lpi=" << lpi;
+    }
+}
+
+TEST(PreprocSIMDKernelsTests, avx2NV12toRGBIsBitExactWithSSE42) {
+    if (!with_cpu_x86_avx2()) GTEST_SKIP();
+    for (int width : {2, 30, 64, 66, 130, 1920}) {
+        std::vector<uint8_t> y(2*width), uv(width);
+        fillRandom(y, 0, 255);
+        fillRandom(uv, 0, 255);
+        ASSERT_EQ(runNV12(calculate_nv12_to_rgb, y, uv, width), runNV12(kernels::avx::calculate_nv12_to_rgb, y, uv, width))
+            << "width=" << width;
+    }
+}
+
+TEST(PreprocSIMDKernelsTests, avx2SplitMergeIsBitExactWithSSE42) {
+    if (!with_cpu_x86_avx2()) GTEST_SKIP();
+    for (int length : {1, 7, 31, 32, 33, 100, 1000}) {
+        std::vector<uint8_t> in0(length), in1(length), in2(length);
+        fillRandom(in0, 0, 255);
+        fillRandom(in1, 0, 255);
+        fillRandom(in2, 0, 255);
+        std::vector<uint8_t> ref(3*length), out(3*length);
+        mergeRow_8UC3(in0.data(), in1.data(), in2.data(), ref.data(), length);
+        kernels::avx::mergeRow_8UC3(in0.data(), in1.data(), in2.data(), out.data(), length);
+        ASSERT_EQ(ref, out) << "length=" << length;
+
+        std::vector<uint8_t> o0(length), o1(length), o2(length);
+        kernels::avx::splitRow_8UC3(ref.data(), o0.data(), o1.data(), o2.data(), length);
+        ASSERT_EQ(in0, o0);
+        ASSERT_EQ(in1, o1);
+        ASSERT_EQ(in2, o2);
+    }
+}
+
+TEST(PreprocSIMDKernelsTests, avx2BlobCopyIsBitExactWithSSE42) {
+    if (!with_cpu_x86_avx2()) GTEST_SKIP();
+    for (int W : {7, 32, 33, 300}) {
+        const int H = 5;
+        std::vector<float> src(3*H*W);
+        fillRandom(src, -1.f, 1.f);
+        ASSERT_EQ(runBlobSplitF32(blob_copy_4d_split_f32c3, src, H, W),
+                  runBlobSplitF32(InferenceEngine::avx::blob_copy_4d_split_f32c3, src, H, W)) << "W=" << W;
+    }
+}
+#endif  // HAVE_AVX2
+
+#ifdef HAVE_AVX512
+TEST(PreprocSIMDKernelsTests, avx512LinearU8IsBitExactWithSSE42) {
+    if (!with_cpu_x86_avx512f()) GTEST_SKIP();
+    for (int inW : widths) for (int outW : widths) for (int lpi = 1; lpi <= 4; lpi++) {
+        LinearU8Data d(inW, outW, 1);
+        ASSERT_EQ(runLinearU8(calcRowLinear_8U, d, lpi), runLinearU8(kernels::avx512::calcRowLinear_8U, d, lpi))
+            << inW << " -> " << outW << ", lpi=" << lpi;
+    }
+}
+
+TEST(PreprocSIMDKernelsTests, avx512LinearU8C3IsBitExactWithSSE42) {
+    if (!with_cpu_x86_avx512f()) GTEST_SKIP();
+    for (int inW : widths) for (int outW : widths) for (int lpi = 1; lpi <= 4; lpi++) {
+        LinearU8Data d(inW, outW, 3);
+        ASSERT_EQ(runLinearU8C3(calcRowLinear_8UC3, d, lpi), runLinearU8C3(kernels::avx512::calcRowLinear_8UC3, d, lpi))
+            << inW << " -> " << outW << ", lpi=" << lpi;
+    }
+}
+
+TEST(PreprocSIMDKernelsTests, avx512LinearF32IsBitExactWithSSE42) {
+    if (!with_cpu_x86_avx512f()) GTEST_SKIP();
+    for (int inW : widths) for (int outW : widths) for (int lpi = 1; lpi <= 4; lpi++) {
+        LinearF32Data d(inW, outW);
+        ASSERT_EQ(runLinearF32(calcRowLinear_32F, d, lpi), runLinearF32(kernels::avx512::calcRowLinear_32F, d, lpi))
+            << inW << " -> " << outW << ", lpi=" << lpi;
+    }
+}
+
+TEST(PreprocSIMDKernelsTests, avx512SplitMergeIsBitExactWithSSE42) {
+    if (!with_cpu_x86_avx512f()) GTEST_SKIP();
+    for (int length : {1, 7, 15, 16, 17, 100, 1000}) {
+        std::vector<float> in0(length), in1(length), in2(length);
+        fillRandom(in0, -1.f, 1.f);
+        fillRandom(in1, -1.f, 1.f);
+        fillRandom(in2, -1.f, 1.f);
+        std::vector<float> ref(3*length), out(3*length);
+        mergeRow_32FC3(in0.data(), in1.data(), in2.data(), ref.data(), length);
+        kernels::avx512::mergeRow_32FC3(in0.data(), in1.data(), in2.data(), out.data(), length);
+        ASSERT_EQ(ref, out) << "length=" << length;
+
+        std::vector<float> o0(length), o1(length), o2(length);
+        kernels::avx512::splitRow_32FC3(ref.data(), o0.data(), o1.data(), o2.data(), length);
+        ASSERT_EQ(in0, o0);
+        ASSERT_EQ(in1, o1);
+        ASSERT_EQ(in2, o2);
+    }
+}
+
+TEST(PreprocSIMDKernelsTests, avx512BlobCopyIsBitExactWithSSE42) {
+    if (!with_cpu_x86_avx512f()) GTEST_SKIP();
+    for (int W : {7, 16, 17, 300}) {
+        const int H = 5;
+        std::vector<float> src(3*H*W);
+        fillRandom(src, -1.f, 1.f);
+        ASSERT_EQ(runBlobSplitF32(blob_copy_4d_split_f32c3, src, H, W),
+                  runBlobSplitF32(InferenceEngine::avx512::blob_copy_4d_split_f32c3, src, H, W)) << "W=" << W;
+    }
+}
+#endif  // HAVE_AVX512
+
+//----------------------------------------------------------------------
+//
+// Microbenchmark: per-row kernels for a 1080p frame downscaled to 300x300
+// and 416x416, run on every ISA tier available on this machine.
+// Run with --gtest_also_run_disabled_tests --gtest_filter=*Perf*
+//
+//----------------------------------------------------------------------
+
+namespace {
+
+double measureMs(const std::function<void()>& body, int iterations = 200) {
+    body();  // warm-up
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        body();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count() / iterations;
+}
+
+struct Tier {
+    const char* name;
+    bool enabled;
+    LinearU8C3Fn linearU8C3;
+    LinearF32Fn linearF32;
+    decltype(&calculate_nv12_to_rgb) nv12;
+    Split32FC3Fn split32FC3;
+    Merge32FC3Fn merge32FC3;
+    BlobSplitF32Fn blobSplitF32;
+};
+
+std::vector<Tier> availableTiers() {
+    std::vector<Tier> tiers = {
+        {"SSE4.2", with_cpu_x86_sse42(), calcRowLinear_8UC3, calcRowLinear_32F, calculate_nv12_to_rgb,
+         splitRow_32FC3, mergeRow_32FC3, blob_copy_4d_split_f32c3},
+    };
+#ifdef HAVE_AVX2
+    tiers.push_back({"AVX2", with_cpu_x86_avx2(), kernels::avx::calcRowLinear_8UC3, kernels::avx::calcRowLinear_32F,
+                     kernels::avx::calculate_nv12_to_rgb, kernels::avx::splitRow_32FC3, kernels::avx::mergeRow_32FC3,
+                     InferenceEngine::avx::blob_copy_4d_split_f32c3});
+#endif
+#ifdef HAVE_AVX512
+    // NB: NV12 has no AVX-512 variant and is dispatched to AVX2 there
+    tiers.push_back({"AVX-512", with_cpu_x86_avx512f(), kernels::avx512::calcRowLinear_8UC3, kernels::avx512::calcRowLinear_32F,
+                     kernels::avx::calculate_nv12_to_rgb, kernels::avx512::splitRow_32FC3, kernels::avx512::mergeRow_32FC3,
+                     InferenceEngine::avx512::blob_copy_4d_split_f32c3});
+#endif
+    return tiers;
+}
+
+}  // namespace
+
+TEST(PreprocSIMDKernelsTests, DISABLED_Perf1080p) {
+    const int inW = 1920, inH = 1080;
+
+    for (const auto& tier : availableTiers()) {
+        if (!tier.enabled) continue;
+
+        for (int outW : {300, 416}) {
+            const int outH = outW;
+
+            // a full frame takes outH/4 calls of 4 rows each
+            LinearU8Data u8(inW, outW, 3);
+            double linearU8C3 = measureMs([&]() {
+                for (int y = 0; y < outH; y += 4) runLinearU8C3(tier.linearU8C3, u8, 4);
+            }, 20);
+
+            LinearF32Data f32(inW, outW);
+            double linearF32 = measureMs([&]() {
+                for (int y = 0; y < outH; y += 4) runLinearF32(tier.linearF32, f32, 4);
+            }, 20);
+
+            std::cout << "[ PERF     ] " << tier.name << " resize " << inW << "x" << inH << " -> "
+                      << outW << "x" << outH << ": U8C3 " << linearU8C3 << " ms, F32 "
+                      << linearF32 << " ms" << std::endl;
+        }
+
+        std::vector<uint8_t> y(2*inW), uv(inW);
+        fillRandom(y, 0, 255);
+        fillRandom(uv, 0, 255);
+        double nv12 = measureMs([&]() {
+            for (int r = 0; r < inH; r += 2) runNV12(tier.nv12, y, uv, inW);
+        }, 20);
+
+        std::vector<float> planes(3*inW), packed(3*inW);
+        fillRandom(packed, 0.f, 255.f);
+        double split = measureMs([&]() {
+            for (int r = 0; r < inH; r++) {
+                tier.split32FC3(packed.data(), &planes[0], &planes[inW], &planes[2*inW], inW);
+            }
+        }, 20);
+        double merge = measureMs([&]() {
+            for (int r = 0; r < inH; r++) {
+                tier.merge32FC3(&planes[0], &planes[inW], &planes[2*inW], packed.data(), inW);
+            }
+        }, 20);
+
+        std::vector<float> frame(3*inW*inH);
+        fillRandom(frame, 0.f, 255.f);
+        double blobCopy = measureMs([&]() { runBlobSplitF32(tier.blobSplitF32, frame, inH, inW); }, 10);
+
+        std::cout << "[ PERF     ] " << tier.name << " 1080p: NV12toRGB " << nv12 << " ms, split F32C3 "
+                  << split << " ms, merge F32C3 " << merge << " ms, NHWC->NCHW F32 " << blobCopy
+                  << " ms" << std::endl;
+    }
+}
+
+#endif  // HAVE_SSE
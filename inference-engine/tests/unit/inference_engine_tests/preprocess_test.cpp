@@ -4,6 +4,11 @@
 
 #include <gtest/gtest.h>
 #include <ie_preprocess.hpp>
+#include "ie_preprocess_data.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
 
 using namespace std;
 
@@ -57,3 +62,78 @@ TEST_F(PreProcessTests, noThrowWithCorrectSizeMeanImage) {
     IE_SUPPRESS_DEPRECATED_END
     ASSERT_NO_THROW(info.setMeanImage(blob));
 }
+
+namespace {
+
+InferenceEngine::Blob::Ptr makeImage(size_t height, size_t width) {
+    auto image = InferenceEngine::make_shared_blob<uint8_t>({ InferenceEngine::Precision::U8,
+        { 1, 3, height, width }, InferenceEngine::Layout::NHWC });
+    image->allocate();
+    auto data = image->buffer().as<uint8_t*>();
+    for (size_t i = 0; i < image->size(); i++) {
+        data[i] = static_cast<uint8_t>((i * 7) ^ (i >> 5));
+    }
+    return image;
+}
+
+InferenceEngine::Blob::Ptr resize(InferenceEngine::PreProcessData &preprocess,
+                                  const InferenceEngine::Blob::Ptr &image) {
+    InferenceEngine::Blob::Ptr output = InferenceEngine::make_shared_blob<uint8_t>({
+        InferenceEngine::Precision::U8, { 1, 3, 224, 224 }, InferenceEngine::Layout::NCHW });
+    output->allocate();
+    InferenceEngine::PreProcessInfo info;
+    info.setResizeAlgorithm(InferenceEngine::RESIZE_BILINEAR);
+    preprocess.setRoiBlob(image);
+    preprocess.execute(output, info, false);
+    return output;
+}
+
+// frames of several cameras and crops of them, more than the engine keeps compiled
+std::vector<InferenceEngine::Blob::Ptr> makeFrames() {
+    auto hd = makeImage(720, 1280);
+    return { hd, makeImage(480, 640), makeImage(1080, 1920),
+             InferenceEngine::make_shared_blob(hd, { 0, 100, 50, 300, 200 }),
+             InferenceEngine::make_shared_blob(hd, { 0, 640, 360, 400, 300 }) };
+}
+
+}  // namespace
+
+TEST_F(PreProcessTests, resizesAlternatingResolutionsAsSeparateCalls) {
+    auto frames = makeFrames();
+
+    InferenceEngine::PreProcessData preprocess;
+    for (int round = 0; round < 3; round++) {
+        for (size_t i = 0; i < frames.size(); i++) {
+            auto output = resize(preprocess, frames[i]);
+
+            InferenceEngine::PreProcessData separate;
+            auto expected = resize(separate, frames[i]);
+
+            ASSERT_EQ(0, std::memcmp(expected->cbuffer().as<const uint8_t*>(), output->cbuffer().as<const uint8_t*>(),
+                                     output->byteSize())) << "round " << round << ", frame " << i;
+        }
+    }
+}
+
+// The resolutions alternating within the number of compiled calls kept by the engine used to recompile
+// the graph on every call
+TEST_F(PreProcessTests, DISABLED_PerfAlternatingResolutions) {
+    auto frames = makeFrames();
+    frames.pop_back();
+
+    for (bool alternate : { false, true }) {
+        InferenceEngine::PreProcessData preprocess;
+        for (auto &frame : frames) {
+            resize(preprocess, frame);
+        }
+
+        const int iterations = 200;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; i++) {
+            resize(preprocess, frames[alternate ? i % frames.size() : 0]);
+        }
+        std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+        std::cout << "[ PERF     ] " << (alternate ? "alternating resolutions" : "same resolution") << ": "
+                  << elapsed.count() / iterations << " us per frame" << std::endl;
+    }
+}
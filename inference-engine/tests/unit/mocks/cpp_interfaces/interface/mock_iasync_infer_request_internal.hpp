@@ -22,4 +22,5 @@ public:
     MOCK_METHOD2(GetBlob, void(const char *name, InferenceEngine::Blob::Ptr &));
     MOCK_METHOD1(SetCompletionCallback, void(InferenceEngine::IInferRequest::CompletionCallback));
 	MOCK_METHOD1(SetBatch, void(int));
+    MOCK_METHOD0(QueryState, std::vector<InferenceEngine::IMemoryStateInternal::Ptr>());
 };
@@ -0,0 +1,114 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifdef ENABLE_MKL_DNN
+
+#include <gtest/gtest.h>
+#include <mkldnn_plugin/mkldnn_streams.h>
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <set>
+#include <functional>
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+using namespace InferenceEngine;
+using namespace MKLDNNPlugin;
+
+class MultiWorkerExecutorStressTests : public ::testing::Test {
+protected:
+    static MultiWorkerTaskExecutor::Ptr createExecutor(size_t streams) {
+        std::vector<Task::Ptr> initTasks;
+        for (size_t i = 0; i < streams; i++)
+            initTasks.push_back(std::make_shared<Task>([] {}));
+        return std::make_shared<MultiWorkerTaskExecutor>(initTasks);
+    }
+
+    // submits tasksPerThread tasks from every submitting thread and waits until all of them are executed
+    static void submit(const MultiWorkerTaskExecutor::Ptr &executor, size_t submitters, size_t tasksPerThread,
+                       const std::function<void(size_t, size_t)> &body) {
+        std::atomic<size_t> executed(0);
+        std::vector<std::thread> threads;
+        for (size_t s = 0; s < submitters; s++) {
+            threads.emplace_back([&, s] {
+                for (size_t i = 0; i < tasksPerThread; i++) {
+                    auto task = std::make_shared<Task>([&, s, i] {
+                        body(s, i);
+                        executed++;
+                    });
+                    ASSERT_TRUE(executor->startTask(task));
+                }
+            });
+        }
+        for (auto &thread : threads)
+            thread.join();
+
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(60);
+        while (executed != submitters * tasksPerThread && std::chrono::steady_clock::now() < deadline)
+            std::this_thread::yield();
+        ASSERT_EQ(submitters * tasksPerThread, executed);
+    }
+};
+
+TEST_F(MultiWorkerExecutorStressTests, allTasksAreExecutedOnce) {
+    auto executor = createExecutor(4);
+    const size_t submitters = 8, tasksPerThread = 5000;
+
+    std::vector<std::atomic<int>> counters(submitters * tasksPerThread);
+    for (auto &counter : counters) counter = 0;
+    submit(executor, submitters, tasksPerThread, [&](size_t s, size_t i) {
+        counters[s * tasksPerThread + i]++;
+    });
+
+    for (auto &counter : counters)
+        ASSERT_EQ(1, counter);
+}
+
+TEST_F(MultiWorkerExecutorStressTests, tasksOfSubmittingThreadStartInFifoOrder) {
+    // with a single worker any reordering would be visible
+    auto executor = createExecutor(1);
+    const size_t submitters = 4, tasksPerThread = 5000;
+
+    std::vector<size_t> last(submitters, 0);
+    bool inOrder = true;
+    submit(executor, submitters, tasksPerThread, [&](size_t s, size_t i) {
+        if (i != 0 && last[s] != i - 1)
+            inOrder = false;
+        last[s] = i;
+    });
+    ASSERT_TRUE(inOrder);
+}
+
+TEST_F(MultiWorkerExecutorStressTests, tasksAreStolenFromBusyStream) {
+    auto executor = createExecutor(4);
+
+    // all tasks come from one thread, so they land in one queue and the rest of streams have to steal them
+    std::mutex mutex;
+    std::set<std::thread::id> workers;
+    submit(executor, 1, 200, [&](size_t, size_t) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        std::lock_guard<std::mutex> lock(mutex);
+        workers.insert(std::this_thread::get_id());
+    });
+    ASSERT_LT(1, workers.size());
+}
+
+TEST_F(MultiWorkerExecutorStressTests, throughputOfSmallTasks) {
+    const size_t streams = std::max(2u, std::thread::hardware_concurrency() / 2);
+    auto executor = createExecutor(streams);
+    const size_t submitters = 4, tasksPerThread = 50000;
+
+    auto start = std::chrono::steady_clock::now();
+    submit(executor, submitters, tasksPerThread, [](size_t, size_t) {});
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::cout << "[ INFO     ] " << streams << " streams, " << submitters << " submitting threads: "
+              << static_cast<size_t>(submitters * tasksPerThread / elapsed.count()) << " tasks/s" << std::endl;
+}
+
+#endif  // ENABLE_MKL_DNN